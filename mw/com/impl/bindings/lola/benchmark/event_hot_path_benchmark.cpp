@@ -0,0 +1,366 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+/// \file
+/// \brief Measures the latencies of the lock-free slot algorithms of EventDataControl on the LoLa event hot path.
+///
+/// \details One producer thread allocates slots and marks them as ready, while consumer threads read them either via
+/// ReferenceNextEvent() or via a SlotCollector (as a ProxyEvent does) and dereference them again. The EventDataControl
+/// is placed in a real shared memory object. Each case runs for a fixed number of producer iterations, which can be
+/// given as first command line argument. The latencies include the overhead of reading the steady clock twice.
+///
+/// A second sweep puts one producer against eight consumer threads on the same slots and compares the SlotStatusLayouts
+/// kPacked and kCacheLineAligned, i.e. the effect of false sharing between neighbouring slot states.
+
+#include "platform/aas/mw/com/impl/bindings/lola/benchmark/latency_histogram.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_data_control.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "platform/aas/mw/com/impl/bindings/lola/slot_collector.h"
+#include "platform/aas/mw/com/impl/bindings/lola/transaction_log_id.h"
+#include "platform/aas/mw/com/impl/bindings/lola/transaction_log_set.h"
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
+
+#include "platform/aas/lib/memory/shared/managed_memory_resource.h"
+#include "platform/aas/lib/memory/shared/shared_memory_factory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr auto kShmPath{"/lola_event_hot_path_benchmark"};
+constexpr std::size_t kShmSize{16U * 1024U * 1024U};
+constexpr std::uint64_t kDefaultProducerIterations{100000U};
+const TransactionLogId kBenchmarkTransactionLogId{0U};
+/// \brief Number of consumer threads (each with its own subscriber) of the contention sweep.
+constexpr std::size_t kContentionConsumerThreads{8U};
+
+enum class ConsumerMode : std::uint8_t
+{
+    kReferenceNextEvent,
+    kSlotCollector,
+};
+
+struct BenchmarkCase
+{
+    std::size_t number_of_slots;
+    std::size_t number_of_subscribers;
+    std::size_t number_of_consumer_threads;
+    ConsumerMode consumer_mode;
+    SlotStatusLayout slot_status_layout;
+};
+
+struct ProducerLatencies
+{
+    LatencyHistogram allocate_next_slot{};
+    LatencyHistogram event_ready{};
+    std::uint64_t allocation_failures{0U};
+};
+
+struct ConsumerLatencies
+{
+    LatencyHistogram reference_next_event{};
+    LatencyHistogram get_new_samples_slot_indices{};
+    LatencyHistogram dereference_event{};
+};
+
+/// \brief Measures the duration of the given call.
+template <typename Callable>
+auto Measure(LatencyHistogram& histogram, Callable&& callable) noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto result = callable();
+    histogram.Record(std::chrono::steady_clock::now() - start);
+    return result;
+}
+
+void RunProducer(EventDataControl& event_data_control,
+                 const std::uint64_t iterations,
+                 ProducerLatencies& latencies) noexcept
+{
+    EventSlotStatus::EventTimeStamp time_stamp{1U};
+    for (std::uint64_t iteration{0U}; iteration < iterations; ++iteration)
+    {
+        const auto slot = Measure(latencies.allocate_next_slot, [&event_data_control]() noexcept {
+            return event_data_control.AllocateNextSlot();
+        });
+        if (!slot.has_value())
+        {
+            ++latencies.allocation_failures;
+            std::this_thread::yield();
+            continue;
+        }
+        ++time_stamp;
+        static_cast<void>(Measure(latencies.event_ready, [&event_data_control, &slot, time_stamp]() noexcept {
+            event_data_control.EventReady(slot.value(), time_stamp);
+            return true;
+        }));
+    }
+}
+
+/// \brief State of one subscriber, which is served by a consumer thread.
+struct Subscriber
+{
+    TransactionLogSet::TransactionLogIndex transaction_log_index;
+    EventSlotStatus::EventTimeStamp last_time_stamp;
+    std::unique_ptr<SlotCollector> slot_collector;
+};
+
+void ConsumeViaReferenceNextEvent(EventDataControl& event_data_control,
+                                  Subscriber& subscriber,
+                                  ConsumerLatencies& latencies) noexcept
+{
+    const auto slot = Measure(latencies.reference_next_event, [&event_data_control, &subscriber]() noexcept {
+        return event_data_control.ReferenceNextEvent(subscriber.last_time_stamp, subscriber.transaction_log_index);
+    });
+    if (!slot.has_value())
+    {
+        return;
+    }
+    subscriber.last_time_stamp = event_data_control[slot.value()].GetTimeStamp();
+    static_cast<void>(Measure(latencies.dereference_event, [&event_data_control, &subscriber, &slot]() noexcept {
+        event_data_control.DereferenceEvent(slot.value(), subscriber.transaction_log_index);
+        return true;
+    }));
+}
+
+void ConsumeViaSlotCollector(EventDataControl& event_data_control,
+                             Subscriber& subscriber,
+                             const std::size_t max_samples,
+                             ConsumerLatencies& latencies) noexcept
+{
+    const auto slot_indices = Measure(latencies.get_new_samples_slot_indices, [&subscriber, max_samples]() noexcept {
+        return subscriber.slot_collector->GetNewSamplesSlotIndices(max_samples);
+    });
+    for (auto slot_index = slot_indices.begin; slot_index != slot_indices.end; ++slot_index)
+    {
+        const auto slot = *slot_index;
+        static_cast<void>(Measure(latencies.dereference_event, [&event_data_control, &subscriber, slot]() noexcept {
+            event_data_control.DereferenceEvent(slot, subscriber.transaction_log_index);
+            return true;
+        }));
+    }
+}
+
+void RunConsumer(EventDataControl& event_data_control,
+                 std::vector<Subscriber>& subscribers,
+                 const BenchmarkCase& benchmark_case,
+                 const std::size_t max_samples_per_subscriber,
+                 const std::atomic<bool>& producer_done,
+                 ConsumerLatencies& latencies) noexcept
+{
+    while (!producer_done.load(std::memory_order_relaxed))
+    {
+        for (auto& subscriber : subscribers)
+        {
+            if (benchmark_case.consumer_mode == ConsumerMode::kReferenceNextEvent)
+            {
+                ConsumeViaReferenceNextEvent(event_data_control, subscriber, latencies);
+            }
+            else
+            {
+                ConsumeViaSlotCollector(event_data_control, subscriber, max_samples_per_subscriber, latencies);
+            }
+        }
+    }
+}
+
+void PrintLatencies(const std::string& operation, const LatencyHistogram& histogram) noexcept
+{
+    if (histogram.GetCount() == 0U)
+    {
+        return;
+    }
+    std::cout << "  " << std::left << std::setw(30) << operation << std::right << std::setw(10) << histogram.GetCount()
+              << std::setw(10) << histogram.GetPercentile(50.0).count() << std::setw(10)
+              << histogram.GetPercentile(99.0).count() << std::setw(10) << histogram.GetPercentile(99.9).count()
+              << std::setw(12) << histogram.GetMax().count() << '\n';
+}
+
+bool RunBenchmarkCase(const BenchmarkCase& benchmark_case, const std::uint64_t producer_iterations) noexcept
+{
+    memory::shared::SharedMemoryFactory::Remove(kShmPath);
+    EventDataControl* event_data_control{nullptr};
+    const auto memory_resource = memory::shared::SharedMemoryFactory::Create(
+        kShmPath,
+        [&event_data_control, &benchmark_case](std::shared_ptr<memory::shared::ManagedMemoryResource> memory) {
+            event_data_control =
+                memory->construct<EventDataControl>(benchmark_case.number_of_slots,
+                                                    memory->getMemoryResourceProxy(),
+                                                    benchmark_case.number_of_subscribers,
+                                                    benchmark_case.slot_status_layout);
+        },
+        kShmSize);
+    if ((memory_resource == nullptr) || (event_data_control == nullptr))
+    {
+        std::cerr << "Could not create shared memory object " << kShmPath << '\n';
+        return false;
+    }
+
+    // Like in LoLa, the slots are sized, so that each subscriber can hold its maximum number of samples and the
+    // producer still finds a free slot.
+    const auto max_samples_per_subscriber =
+        std::max(std::size_t{1U}, (benchmark_case.number_of_slots - 1U) / benchmark_case.number_of_subscribers);
+
+    std::vector<std::vector<Subscriber>> subscribers_per_thread(benchmark_case.number_of_consumer_threads);
+    for (std::size_t subscriber_index{0U}; subscriber_index < benchmark_case.number_of_subscribers; ++subscriber_index)
+    {
+        const auto transaction_log_index =
+            event_data_control->GetTransactionLogSet().RegisterProxyElement(kBenchmarkTransactionLogId);
+        if (!transaction_log_index.has_value())
+        {
+            std::cerr << "Could not register subscriber " << subscriber_index << '\n';
+            memory::shared::SharedMemoryFactory::Remove(kShmPath);
+            return false;
+        }
+        subscribers_per_thread[subscriber_index % benchmark_case.number_of_consumer_threads].push_back(
+            Subscriber{transaction_log_index.value(),
+                       EventSlotStatus::EventTimeStamp{0U},
+                       std::make_unique<SlotCollector>(
+                           *event_data_control, max_samples_per_subscriber, transaction_log_index.value())});
+    }
+
+    event_data_control->GetPerformanceCounters().Reset();
+    ProducerLatencies producer_latencies{};
+    std::vector<ConsumerLatencies> consumer_latencies(benchmark_case.number_of_consumer_threads);
+    std::atomic<bool> producer_done{false};
+    std::vector<std::thread> consumer_threads{};
+    for (std::size_t thread_index{0U}; thread_index < benchmark_case.number_of_consumer_threads; ++thread_index)
+    {
+        consumer_threads.emplace_back([&, thread_index]() noexcept {
+            RunConsumer(*event_data_control,
+                        subscribers_per_thread[thread_index],
+                        benchmark_case,
+                        max_samples_per_subscriber,
+                        producer_done,
+                        consumer_latencies[thread_index]);
+        });
+    }
+    RunProducer(*event_data_control, producer_iterations, producer_latencies);
+    producer_done = true;
+    for (auto& consumer_thread : consumer_threads)
+    {
+        consumer_thread.join();
+    }
+
+    ConsumerLatencies merged_consumer_latencies{};
+    for (const auto& latencies : consumer_latencies)
+    {
+        merged_consumer_latencies.reference_next_event.Merge(latencies.reference_next_event);
+        merged_consumer_latencies.get_new_samples_slot_indices.Merge(latencies.get_new_samples_slot_indices);
+        merged_consumer_latencies.dereference_event.Merge(latencies.dereference_event);
+    }
+
+    std::cout << "slots: " << benchmark_case.number_of_slots
+              << ", subscribers: " << benchmark_case.number_of_subscribers
+              << ", consumer threads: " << benchmark_case.number_of_consumer_threads << ", consumer: "
+              << ((benchmark_case.consumer_mode == ConsumerMode::kReferenceNextEvent) ? "ReferenceNextEvent"
+                                                                                      : "SlotCollector")
+              << ", layout: " << benchmark_case.slot_status_layout
+              << ", allocation failures: " << producer_latencies.allocation_failures << '\n';
+    std::cout << "  " << std::left << std::setw(30) << "operation [ns]" << std::right << std::setw(10) << "count"
+              << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(12)
+              << "max" << '\n';
+    PrintLatencies("AllocateNextSlot", producer_latencies.allocate_next_slot);
+    PrintLatencies("EventReady", producer_latencies.event_ready);
+    PrintLatencies("ReferenceNextEvent", merged_consumer_latencies.reference_next_event);
+    PrintLatencies("GetNewSamplesSlotIndices", merged_consumer_latencies.get_new_samples_slot_indices);
+    PrintLatencies("DereferenceEvent", merged_consumer_latencies.dereference_event);
+    event_data_control->DumpPerformanceCounters();
+    std::cout << std::endl;
+
+    memory::shared::SharedMemoryFactory::Remove(kShmPath);
+    return true;
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
+
+int main(int argc, const char** argv)
+{
+    using bmw::mw::com::impl::lola::BenchmarkCase;
+    using bmw::mw::com::impl::SlotStatusLayout;
+    using bmw::mw::com::impl::lola::ConsumerMode;
+    using bmw::mw::com::impl::lola::kContentionConsumerThreads;
+
+    std::uint64_t producer_iterations{bmw::mw::com::impl::lola::kDefaultProducerIterations};
+    if (argc > 1)
+    {
+        producer_iterations = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    bool success{true};
+    for (const std::size_t number_of_slots : {8U, 64U, 256U})
+    {
+        for (const std::size_t number_of_subscribers : {1U, 4U, 16U})
+        {
+            if (number_of_subscribers >= number_of_slots)
+            {
+                continue;
+            }
+            for (const std::size_t number_of_consumer_threads : {1U, 4U})
+            {
+                if (number_of_consumer_threads > number_of_subscribers)
+                {
+                    continue;
+                }
+                for (const auto consumer_mode : {ConsumerMode::kReferenceNextEvent, ConsumerMode::kSlotCollector})
+                {
+                    success = bmw::mw::com::impl::lola::RunBenchmarkCase(
+                                  BenchmarkCase{number_of_slots,
+                                                number_of_subscribers,
+                                                number_of_consumer_threads,
+                                                consumer_mode,
+                                                SlotStatusLayout::kPacked},
+                                  producer_iterations) &&
+                              success;
+                }
+            }
+        }
+    }
+
+    // contention sweep: 1 producer and 8 consumer threads, each with its own subscriber, work on few slots, so that
+    // neighbouring slot states are accessed concurrently.
+    for (const std::size_t number_of_slots : {16U, 64U})
+    {
+        for (const auto consumer_mode : {ConsumerMode::kReferenceNextEvent, ConsumerMode::kSlotCollector})
+        {
+            for (const auto slot_status_layout : {SlotStatusLayout::kPacked, SlotStatusLayout::kCacheLineAligned})
+            {
+                success = bmw::mw::com::impl::lola::RunBenchmarkCase(BenchmarkCase{number_of_slots,
+                                                                                   kContentionConsumerThreads,
+                                                                                   kContentionConsumerThreads,
+                                                                                   consumer_mode,
+                                                                                   slot_status_layout},
+                                                                     producer_iterations) &&
+                          success;
+            }
+        }
+    }
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/benchmark/latency_histogram.h"
+
+#include <amp_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+std::size_t GetMostSignificantBit(std::uint64_t value) noexcept
+{
+    std::size_t most_significant_bit{0U};
+    while (value > 1U)
+    {
+        value >>= 1U;
+        ++most_significant_bit;
+    }
+    return most_significant_bit;
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : buckets_{}, count_{0U}, min_ns_{std::numeric_limits<std::uint64_t>::max()}, max_ns_{0U}
+{
+}
+
+void LatencyHistogram::Record(const std::chrono::nanoseconds latency) noexcept
+{
+    const auto latency_ns =
+        static_cast<std::uint64_t>(std::clamp(latency, std::chrono::nanoseconds::zero(), kMaxLatency).count());
+    ++buckets_[GetBucketIndex(latency_ns)];
+    ++count_;
+    min_ns_ = std::min(min_ns_, latency_ns);
+    max_ns_ = std::max(max_ns_, latency_ns);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) noexcept
+{
+    for (std::size_t bucket_index{0U}; bucket_index < kBucketCount; ++bucket_index)
+    {
+        buckets_[bucket_index] += other.buckets_[bucket_index];
+    }
+    count_ += other.count_;
+    min_ns_ = std::min(min_ns_, other.min_ns_);
+    max_ns_ = std::max(max_ns_, other.max_ns_);
+}
+
+std::uint64_t LatencyHistogram::GetCount() const noexcept
+{
+    return count_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMin() const noexcept
+{
+    return std::chrono::nanoseconds{(count_ == 0U) ? 0U : min_ns_};
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMax() const noexcept
+{
+    return std::chrono::nanoseconds{max_ns_};
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetPercentile(const double percentile) const noexcept
+{
+    AMP_PRECONDITION_PRD_MESSAGE((percentile > 0.0) && (percentile <= 100.0),
+                                 "LatencyHistogram: percentile has to be in range (0, 100]");
+    if (count_ == 0U)
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    const auto rank = std::max(
+        std::uint64_t{1U},
+        static_cast<std::uint64_t>(std::ceil((percentile / 100.0) * static_cast<double>(count_))));
+    std::uint64_t cumulative_count{0U};
+    for (std::size_t bucket_index{0U}; bucket_index < kBucketCount; ++bucket_index)
+    {
+        cumulative_count += buckets_[bucket_index];
+        if (cumulative_count >= rank)
+        {
+            return std::chrono::nanoseconds{std::min(GetBucketUpperBound(bucket_index), max_ns_)};
+        }
+    }
+    return GetMax();
+}
+
+std::size_t LatencyHistogram::GetBucketIndex(const std::uint64_t latency_ns) noexcept
+{
+    if (latency_ns < kLinearBucketCount)
+    {
+        return static_cast<std::size_t>(latency_ns);
+    }
+    const auto most_significant_bit = GetMostSignificantBit(latency_ns);
+    const auto shift = most_significant_bit - kSubBucketBits;
+    const auto sub_bucket = static_cast<std::size_t>(latency_ns >> shift) - kSubBucketCount;
+    return kLinearBucketCount + ((most_significant_bit - (kSubBucketBits + 1U)) * kSubBucketCount) + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::GetBucketUpperBound(const std::size_t bucket_index) noexcept
+{
+    if (bucket_index < kLinearBucketCount)
+    {
+        return bucket_index;
+    }
+    const auto logarithmic_index = bucket_index - kLinearBucketCount;
+    const auto most_significant_bit = (logarithmic_index / kSubBucketCount) + kSubBucketBits + 1U;
+    const auto sub_bucket = (logarithmic_index % kSubBucketCount) + kSubBucketCount;
+    const auto shift = most_significant_bit - kSubBucketBits;
+    return ((std::uint64_t{sub_bucket} + 1U) << shift) - 1U;
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,72 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_BENCHMARK_LATENCY_HISTOGRAM_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_BENCHMARK_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Histogram of latencies with a bounded relative error, which can be recorded without allocating memory.
+///
+/// \details Latencies below 64ns are counted exactly. Above, each power of two is split into 32 buckets, so that the
+/// relative error of a reported percentile is below 1/32. Latencies above kMaxLatency are counted in the last bucket.
+/// Recording is not thread-safe: Each thread shall record into its own histogram. The histograms can be merged
+/// afterwards.
+class LatencyHistogram final
+{
+  public:
+    static constexpr std::chrono::nanoseconds kMaxLatency{(std::uint64_t{1U} << 40U) - 1U};
+
+    LatencyHistogram() noexcept;
+
+    void Record(const std::chrono::nanoseconds latency) noexcept;
+
+    /// \brief Adds all latencies recorded by other to this histogram.
+    void Merge(const LatencyHistogram& other) noexcept;
+
+    std::uint64_t GetCount() const noexcept;
+    std::chrono::nanoseconds GetMin() const noexcept;
+    std::chrono::nanoseconds GetMax() const noexcept;
+
+    /// \brief Returns the latency, which is not exceeded by the given percentage of the recorded latencies.
+    /// \param percentile percentage in the range (0, 100].
+    /// \return the upper bound of the bucket containing the percentile, but never more than GetMax(). 0, if no latency
+    ///         has been recorded.
+    std::chrono::nanoseconds GetPercentile(const double percentile) const noexcept;
+
+  private:
+    static constexpr std::size_t kSubBucketBits{5U};
+    static constexpr std::size_t kSubBucketCount{std::size_t{1U} << kSubBucketBits};
+    static constexpr std::size_t kLinearBucketCount{2U * kSubBucketCount};
+    static constexpr std::size_t kBucketCount{kLinearBucketCount + ((40U - (kSubBucketBits + 1U)) * kSubBucketCount)};
+
+    static std::size_t GetBucketIndex(const std::uint64_t latency_ns) noexcept;
+    static std::uint64_t GetBucketUpperBound(const std::size_t bucket_index) noexcept;
+
+    std::array<std::uint64_t, kBucketCount> buckets_;
+    std::uint64_t count_;
+    std::uint64_t min_ns_;
+    std::uint64_t max_ns_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_BENCHMARK_LATENCY_HISTOGRAM_H
@@ -0,0 +1,116 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/benchmark/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using std::chrono::nanoseconds;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero)
+{
+    // Given a histogram without recorded latencies
+    const LatencyHistogram unit{};
+
+    // Then all statistics are zero
+    EXPECT_EQ(unit.GetCount(), 0U);
+    EXPECT_EQ(unit.GetMin(), nanoseconds{0});
+    EXPECT_EQ(unit.GetMax(), nanoseconds{0});
+    EXPECT_EQ(unit.GetPercentile(50.0), nanoseconds{0});
+}
+
+TEST(LatencyHistogramTest, SmallLatenciesAreReportedExactly)
+{
+    // Given a histogram with the latencies 1ns to 50ns
+    LatencyHistogram unit{};
+    for (std::int64_t latency{1}; latency <= 50; ++latency)
+    {
+        unit.Record(nanoseconds{latency});
+    }
+
+    // Then the percentiles are exact
+    EXPECT_EQ(unit.GetCount(), 50U);
+    EXPECT_EQ(unit.GetMin(), nanoseconds{1});
+    EXPECT_EQ(unit.GetMax(), nanoseconds{50});
+    EXPECT_EQ(unit.GetPercentile(50.0), nanoseconds{25});
+    EXPECT_EQ(unit.GetPercentile(100.0), nanoseconds{50});
+}
+
+TEST(LatencyHistogramTest, PercentilesOfBigLatenciesHaveBoundedRelativeError)
+{
+    // Given a histogram with the latencies 1us to 100us
+    LatencyHistogram unit{};
+    for (std::int64_t latency{1}; latency <= 100; ++latency)
+    {
+        unit.Record(nanoseconds{latency * 1000});
+    }
+
+    // When reading the percentiles
+    const auto p50 = unit.GetPercentile(50.0).count();
+    const auto p99 = unit.GetPercentile(99.0).count();
+
+    // Then they are not below the exact value and at most 1/32 above it
+    EXPECT_GE(p50, 50000);
+    EXPECT_LE(p50, 50000 + (50000 / 32));
+    EXPECT_GE(p99, 99000);
+    EXPECT_LE(p99, 99000 + (99000 / 32));
+    // And the biggest percentile is the maximum
+    EXPECT_EQ(unit.GetPercentile(100.0), nanoseconds{100000});
+}
+
+TEST(LatencyHistogramTest, MergeAddsAllRecordedLatencies)
+{
+    // Given two histograms with different latencies
+    LatencyHistogram unit{};
+    unit.Record(nanoseconds{10});
+    LatencyHistogram other{};
+    other.Record(nanoseconds{5});
+    other.Record(nanoseconds{20});
+
+    // When merging the second one into the first one
+    unit.Merge(other);
+
+    // Then the first one contains all latencies
+    EXPECT_EQ(unit.GetCount(), 3U);
+    EXPECT_EQ(unit.GetMin(), nanoseconds{5});
+    EXPECT_EQ(unit.GetMax(), nanoseconds{20});
+    EXPECT_EQ(unit.GetPercentile(50.0), nanoseconds{10});
+}
+
+TEST(LatencyHistogramTest, LatenciesOutOfRangeAreClamped)
+{
+    // Given a histogram
+    LatencyHistogram unit{};
+
+    // When recording a negative and a too big latency
+    unit.Record(nanoseconds{-1});
+    unit.Record(LatencyHistogram::kMaxLatency + nanoseconds{1});
+
+    // Then they are clamped to the supported range
+    EXPECT_EQ(unit.GetMin(), nanoseconds{0});
+    EXPECT_EQ(unit.GetMax(), LatencyHistogram::kMaxLatency);
+    EXPECT_EQ(unit.GetPercentile(100.0), LatencyHistogram::kMaxLatency);
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
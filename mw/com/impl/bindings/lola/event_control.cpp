@@ -28,8 +28,9 @@ namespace lola
 EventControl::EventControl(const SlotIndexType number_of_slots,
                            const SubscriberCountType max_subscribers,
                            const bool enforce_max_samples,
-                           const bmw::memory::shared::MemoryResourceProxy* const proxy) noexcept
-    : data_control{number_of_slots, proxy, max_subscribers},
+                           const bmw::memory::shared::MemoryResourceProxy* const proxy,
+                           const SlotStatusLayout slot_status_layout) noexcept
+    : data_control{number_of_slots, proxy, max_subscribers, slot_status_layout},
       subscription_control{number_of_slots, max_subscribers, enforce_max_samples}
 {
 }
@@ -37,7 +37,8 @@ class EventControl
     EventControl(const SlotIndexType number_of_slots,
                  const SubscriberCountType max_subscribers,
                  const bool enforce_max_samples,
-                 const bmw::memory::shared::MemoryResourceProxy* const proxy) noexcept;
+                 const bmw::memory::shared::MemoryResourceProxy* const proxy,
+                 const SlotStatusLayout slot_status_layout = SlotStatusLayout::kPacked) noexcept;
     EventDataControl data_control;
     EventSubscriptionControl subscription_control;
 };
@@ -0,0 +1,120 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_control_slots.h"
+
+namespace bmw::mw::com::impl::lola
+{
+
+namespace
+{
+
+static_assert((EventControlSlots::kCacheLineSize % sizeof(EventControlSlots::value_type)) == 0U,
+              "A cache line has to be able to hold a whole number of slot states");
+
+std::size_t GetNumberOfElements(const std::size_t number_of_slots, const std::size_t stride) noexcept
+{
+    // Additional (stride - 1) elements allow to move the first slot to a cache line boundary.
+    return (number_of_slots * stride) + (stride - 1U);
+}
+
+}  // namespace
+
+EventControlSlots::EventControlSlots(const SlotIndexType number_of_slots,
+                                     const SlotStatusLayout layout,
+                                     const memory::shared::MemoryResourceProxy* const proxy) noexcept
+    : storage_{GetNumberOfElements(number_of_slots, GetStride(layout)), proxy},
+      number_of_slots_{number_of_slots},
+      stride_{GetStride(layout)},
+      first_slot_offset_{0U},
+      layout_{layout}
+{
+    if ((stride_ > 1U) && (storage_.size() > 0U))
+    {
+        // The address is only used to calculate the alignment, it is never converted back to a pointer.
+        const auto address = reinterpret_cast<std::uintptr_t>(&storage_[0U]);
+        const auto misalignment = address % kCacheLineSize;
+        if (misalignment != 0U)
+        {
+            first_slot_offset_ = (kCacheLineSize - misalignment) / sizeof(value_type);
+        }
+    }
+}
+
+std::size_t EventControlSlots::GetRequiredStorageSize(const std::size_t number_of_slots,
+                                                      const SlotStatusLayout layout) noexcept
+{
+    return GetNumberOfElements(number_of_slots, GetStride(layout)) * sizeof(value_type);
+}
+
+auto EventControlSlots::operator[](const std::size_t slot_index) noexcept -> value_type&
+{
+    return storage_[first_slot_offset_ + (slot_index * stride_)];
+}
+
+auto EventControlSlots::operator[](const std::size_t slot_index) const noexcept -> const value_type&
+{
+    return storage_[first_slot_offset_ + (slot_index * stride_)];
+}
+
+std::size_t EventControlSlots::size() const noexcept
+{
+    return number_of_slots_;
+}
+
+auto EventControlSlots::begin() noexcept -> iterator
+{
+    return iterator{GetFirstSlot(), stride_};
+}
+
+auto EventControlSlots::end() noexcept -> iterator
+{
+    return iterator{GetFirstSlot() + (number_of_slots_ * stride_), stride_};
+}
+
+auto EventControlSlots::begin() const noexcept -> const_iterator
+{
+    return const_iterator{GetFirstSlot(), stride_};
+}
+
+auto EventControlSlots::end() const noexcept -> const_iterator
+{
+    return const_iterator{GetFirstSlot() + (number_of_slots_ * stride_), stride_};
+}
+
+SlotStatusLayout EventControlSlots::GetLayout() const noexcept
+{
+    return layout_;
+}
+
+auto EventControlSlots::GetFirstSlot() noexcept -> value_type*
+{
+    return (number_of_slots_ == 0U) ? nullptr : &storage_[first_slot_offset_];
+}
+
+auto EventControlSlots::GetFirstSlot() const noexcept -> const value_type*
+{
+    return (number_of_slots_ == 0U) ? nullptr : &storage_[first_slot_offset_];
+}
+
+std::size_t EventControlSlots::GetStride(const SlotStatusLayout layout) noexcept
+{
+    if (layout == SlotStatusLayout::kCacheLineAligned)
+    {
+        return kCacheLineSize / sizeof(value_type);
+    }
+    return 1U;
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,116 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_CONTROL_SLOTS_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_CONTROL_SLOTS_H
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
+
+#include "platform/aas/lib/containers/dynamic_array.h"
+#include "platform/aas/lib/memory/shared/memory_resource_proxy.h"
+#include "platform/aas/lib/memory/shared/polymorphic_offset_ptr_allocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Array of the EventSlotStatus atomics of one event, which is stored in shared memory.
+///
+/// \details Depending on the configured SlotStatusLayout, the slot states are either placed back to back (kPacked) or
+/// each one in its own cache line (kCacheLineAligned). In the latter case, the underlying storage is over-allocated, so
+/// that the first slot state can be placed at a cache line boundary. Since shared memory is always mapped page-aligned,
+/// the offset of this boundary within the storage is the same in every process.
+class EventControlSlots final
+{
+  public:
+    using value_type = std::atomic<EventSlotStatus::value_type>;
+    using SlotIndexType = std::uint16_t;
+
+    /// \brief Assumed size of a cache line on our target platforms.
+    static constexpr std::size_t kCacheLineSize{64U};
+
+    /// \brief Forward iterator over the slot states, which skips the padding between them.
+    template <typename ValueType>
+    class SlotIterator final
+    {
+      public:
+        SlotIterator(ValueType* const slot, const std::size_t stride) noexcept : slot_{slot}, stride_{stride} {}
+
+        ValueType& operator*() const noexcept { return *slot_; }
+
+        SlotIterator& operator++() noexcept
+        {
+            slot_ += stride_;
+            return *this;
+        }
+
+        bool operator==(const SlotIterator& other) const noexcept { return slot_ == other.slot_; }
+        bool operator!=(const SlotIterator& other) const noexcept { return slot_ != other.slot_; }
+
+      private:
+        ValueType* slot_;
+        std::size_t stride_;
+    };
+
+    using iterator = SlotIterator<value_type>;
+    using const_iterator = SlotIterator<const value_type>;
+
+    EventControlSlots(const SlotIndexType number_of_slots,
+                      const SlotStatusLayout layout,
+                      const memory::shared::MemoryResourceProxy* const proxy) noexcept;
+    ~EventControlSlots() noexcept = default;
+
+    EventControlSlots(const EventControlSlots&) = delete;
+    EventControlSlots& operator=(const EventControlSlots&) = delete;
+    EventControlSlots(EventControlSlots&&) noexcept = delete;
+    EventControlSlots& operator=(EventControlSlots&& other) noexcept = delete;
+
+    /// \brief Returns the number of bytes, which will be allocated from the memory resource for the given slots.
+    static std::size_t GetRequiredStorageSize(const std::size_t number_of_slots, const SlotStatusLayout layout) noexcept;
+
+    /// \brief Directly access the slot state for one specific slot (no bound check performed!)
+    value_type& operator[](const std::size_t slot_index) noexcept;
+    const value_type& operator[](const std::size_t slot_index) const noexcept;
+
+    /// \brief Returns the number of slots (not the number of allocated elements).
+    std::size_t size() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    SlotStatusLayout GetLayout() const noexcept;
+
+  private:
+    using Storage = bmw::containers::DynamicArray<value_type, memory::shared::PolymorphicOffsetPtrAllocator<value_type>>;
+
+    static std::size_t GetStride(const SlotStatusLayout layout) noexcept;
+    value_type* GetFirstSlot() noexcept;
+    const value_type* GetFirstSlot() const noexcept;
+
+    Storage storage_;
+    std::size_t number_of_slots_;
+    std::size_t stride_;
+    std::size_t first_slot_offset_;
+    SlotStatusLayout layout_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_CONTROL_SLOTS_H
@@ -0,0 +1,116 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_control_slots.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr EventControlSlots::SlotIndexType kNumberOfSlots{5U};
+
+std::uintptr_t GetAddress(const EventControlSlots::value_type& slot)
+{
+    return reinterpret_cast<std::uintptr_t>(&slot);
+}
+
+class EventControlSlotsFixture : public ::testing::Test
+{
+  protected:
+    FakeMemoryResource memory_{};
+};
+
+TEST_F(EventControlSlotsFixture, PackedSlotStatesArePlacedBackToBack)
+{
+    // Given slot states with a packed layout
+    EventControlSlots unit{kNumberOfSlots, SlotStatusLayout::kPacked, memory_.getMemoryResourceProxy()};
+
+    // Then the number of slots is the configured one
+    EXPECT_EQ(unit.size(), kNumberOfSlots);
+
+    // and every slot state directly follows the previous one
+    for (std::size_t slot_index = 1U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(GetAddress(unit[slot_index]) - GetAddress(unit[slot_index - 1U]),
+                  sizeof(EventControlSlots::value_type));
+    }
+}
+
+TEST_F(EventControlSlotsFixture, CacheLineAlignedSlotStatesAreEachPlacedInOwnCacheLine)
+{
+    // Given slot states with a cache line aligned layout
+    EventControlSlots unit{kNumberOfSlots, SlotStatusLayout::kCacheLineAligned, memory_.getMemoryResourceProxy()};
+
+    // Then the number of slots is the configured one
+    EXPECT_EQ(unit.size(), kNumberOfSlots);
+
+    // and every slot state starts at a cache line boundary
+    for (std::size_t slot_index = 0U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(GetAddress(unit[slot_index]) % EventControlSlots::kCacheLineSize, 0U);
+    }
+
+    // and consecutive slot states are exactly one cache line apart
+    for (std::size_t slot_index = 1U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(GetAddress(unit[slot_index]) - GetAddress(unit[slot_index - 1U]), EventControlSlots::kCacheLineSize);
+    }
+}
+
+TEST_F(EventControlSlotsFixture, IteratingVisitsEverySlotStateOnce)
+{
+    for (const auto layout : {SlotStatusLayout::kPacked, SlotStatusLayout::kCacheLineAligned})
+    {
+        // Given slot states with the respective layout, where each slot state holds its index
+        EventControlSlots unit{kNumberOfSlots, layout, memory_.getMemoryResourceProxy()};
+        for (std::size_t slot_index = 0U; slot_index < unit.size(); ++slot_index)
+        {
+            unit[slot_index].store(static_cast<EventSlotStatus::value_type>(slot_index));
+        }
+
+        // When iterating over all slot states
+        std::size_t visited_slots{0U};
+        for (const auto& slot : unit)
+        {
+            // Then the slot states are visited in index order
+            EXPECT_EQ(slot.load(), static_cast<EventSlotStatus::value_type>(visited_slots));
+            ++visited_slots;
+        }
+
+        // and every slot state is visited
+        EXPECT_EQ(visited_slots, kNumberOfSlots);
+    }
+}
+
+TEST(EventControlSlotsTest, RequiredStorageSizeContainsPaddingForCacheLineAlignedLayout)
+{
+    // Expect that the packed layout only needs the slot states themselves
+    EXPECT_EQ(EventControlSlots::GetRequiredStorageSize(kNumberOfSlots, SlotStatusLayout::kPacked),
+              kNumberOfSlots * sizeof(EventControlSlots::value_type));
+
+    // and that the cache line aligned layout needs one cache line per slot and the space to align the first slot
+    EXPECT_EQ(EventControlSlots::GetRequiredStorageSize(kNumberOfSlots, SlotStatusLayout::kCacheLineAligned),
+              (kNumberOfSlots * EventControlSlots::kCacheLineSize) + EventControlSlots::kCacheLineSize -
+                  sizeof(EventControlSlots::value_type));
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
@@ -14,6 +14,7 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/event_data_control.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace bmw
@@ -41,8 +42,13 @@ template <template <class> class AtomicIndirectorType>
 EventDataControlImpl<AtomicIndirectorType>::EventDataControlImpl(
     const SlotIndexType max_slots,
     const bmw::memory::shared::MemoryResourceProxy* const proxy,
-    const LolaEventInstanceDeployment::SubscriberCountType max_number_combined_subscribers) noexcept
-    : state_slots_{max_slots, proxy}, transaction_log_set_{max_number_combined_subscribers, max_slots, proxy}
+    const LolaEventInstanceDeployment::SubscriberCountType max_number_combined_subscribers,
+    const SlotStatusLayout slot_status_layout) noexcept
+    : state_slots_{max_slots, slot_status_layout, proxy},
+      allocation_order_{max_slots, proxy},
+      transaction_log_set_{max_number_combined_subscribers, max_slots, proxy},
+      update_notifier_{},
+      performance_counters_{}
 {
 }
 
@@ -61,41 +67,180 @@ auto EventDataControlImpl<AtomicIndirectorType>::AllocateNextSlot() noexcept ->
             continue;
         }
 
-        EventSlotStatus status{state_slots_[selected_index.value()].load(std::memory_order_acquire)};
-
-        // we need to check that this is still the same, since it is possible that is has change after we found it
-        // earlier
-        if ((status.GetReferenceCount() != static_cast<EventSlotStatus::SubscriberCount>(0)) || status.IsInWriting())
+        if (TryAcquireSlotForWriting(selected_index.value()))
         {
-            continue;
+            break;
         }
+    }
+
+    if (retry_counter >= MAX_ALLOCATE_RETRIES)
+    {
+        performance_counters_.RecordAllocationFailure(retry_counter);
+        // If this happens, it shows that we have a wrong configuration in the system, see doc-string
+        return {};
+    }
+
+    performance_counters_.RecordAllocation(retry_counter);
+    return selected_index;
+}
 
-        EventSlotStatus status_new{};  // This will set the refcount to 0 by default
-        status_new.MarkInWriting();
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::AllocateNextSlots(const amp::span<SlotIndexType> slot_indices) noexcept
+    -> std::size_t
+{
+    const auto number_of_requested_slots = static_cast<std::size_t>(slot_indices.size());
+    std::size_t number_of_acquired_slots{0U};
+
+    if (allocation_order_.TryLock())
+    {
+        if (allocation_order_.IsStale())
+        {
+            RebuildAllocationOrder();
+        }
+        // Acquiring a slot doesn't change the allocation order, so the walk can simply continue behind it.
+        for (auto slot_index = allocation_order_.GetOldest(); slot_index != EventSlotAllocationOrder::kNoSlot;
+             slot_index = allocation_order_.GetNewer(slot_index))
+        {
+            if (number_of_acquired_slots == number_of_requested_slots)
+            {
+                break;
+            }
+            const EventSlotStatus status{state_slots_[slot_index].load(std::memory_order_acquire)};
+            if ((status.IsUsed() == false) && TryAcquireSlotForWriting(slot_index))
+            {
+                performance_counters_.RecordAllocation(0U);
+                slot_indices[number_of_acquired_slots] = slot_index;
+                ++number_of_acquired_slots;
+            }
+        }
+        allocation_order_.Unlock();
+    }
 
-        auto status_value_type{static_cast<EventSlotStatus::value_type&>(status)};
-        auto status_new_value_type{static_cast<EventSlotStatus::value_type&>(status_new)};
-        if (state_slots_[selected_index.value()].compare_exchange_weak(
-                status_value_type, status_new_value_type, std::memory_order_acq_rel))
+    for (; number_of_acquired_slots < number_of_requested_slots; ++number_of_acquired_slots)
+    {
+        const auto slot_index = AllocateNextSlot();
+        if (!slot_index.has_value())
         {
             break;
         }
+        slot_indices[number_of_acquired_slots] = slot_index.value();
     }
+    return number_of_acquired_slots;
+}
 
-    num_alloc_retries.fetch_add(retry_counter);
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::TryAcquireSlotForWriting(const SlotIndexType slot_index) noexcept
+    -> bool
+{
+    EventSlotStatus status{state_slots_[slot_index].load(std::memory_order_acquire)};
 
-    if (retry_counter >= MAX_ALLOCATE_RETRIES)
+    // we need to check that this is still the same, since it is possible that is has change after we found it
+    // earlier
+    if ((status.GetReferenceCount() != static_cast<EventSlotStatus::SubscriberCount>(0)) || status.IsInWriting())
     {
-        ++num_alloc_misses;
-        // If this happens, it shows that we have a wrong configuration in the system, see doc-string
-        return {};
+        return false;
     }
 
-    return selected_index;
+    EventSlotStatus status_new{};  // This will set the refcount to 0 by default
+    status_new.MarkInWriting();
+
+    auto status_value_type{static_cast<EventSlotStatus::value_type&>(status)};
+    auto status_new_value_type{static_cast<EventSlotStatus::value_type&>(status_new)};
+    if (state_slots_[slot_index].compare_exchange_weak(
+            status_value_type, status_new_value_type, std::memory_order_acq_rel))
+    {
+        // Readers, which copy the slot data without referencing it (see FindNewestEvent()), rely on the
+        // in-writing mark being visible before any write to the slot data.
+        std::atomic_thread_fence(std::memory_order_release);
+        return true;
+    }
+    return false;
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::FindOldestUnusedSlot() noexcept -> amp::optional<SlotIndexType>
+{
+    if (allocation_order_.TryLock())
+    {
+        if (allocation_order_.IsStale())
+        {
+            RebuildAllocationOrder();
+        }
+        const auto selected_index = FindOldestUnusedSlotInAllocationOrder();
+        allocation_order_.Unlock();
+        return selected_index;
+    }
+
+    // another thread currently accesses the allocation order, we don't wait for it.
+    return FindOldestUnusedSlotByScan();
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::FindOldestUnusedSlotInAllocationOrder() const noexcept
+    -> amp::optional<SlotIndexType>
+{
+    // Invalid slots are always at the front of the allocation order and the remaining slots are ordered by their
+    // time stamp. So the first slot, which is not used, is the same one FindOldestUnusedSlotByScan() would select.
+    for (auto slot_index = allocation_order_.GetOldest(); slot_index != EventSlotAllocationOrder::kNoSlot;
+         slot_index = allocation_order_.GetNewer(slot_index))
+    {
+        const EventSlotStatus status{state_slots_[slot_index].load(std::memory_order_acquire)};
+        if (status.IsUsed() == false)
+        {
+            return slot_index;
+        }
+    }
+    return {};
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::UpdateAllocationOrder(
+    const SlotIndexType slot_index,
+    const EventSlotStatus::EventTimeStamp time_stamp) noexcept -> void
+{
+    if (allocation_order_.TryLock())
+    {
+        allocation_order_.Update(slot_index, time_stamp);
+        allocation_order_.Unlock();
+    }
+    else
+    {
+        // we don't wait for the other thread, but let the next thread, which acquires the lock, rebuild the order.
+        allocation_order_.MarkStale();
+    }
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::RebuildAllocationOrder() noexcept -> void
+{
+    allocation_order_.Clear();
+
+    SlotIndexType slot_index{0U};
+    for (const auto& slot : state_slots_)
+    {
+        const EventSlotStatus status{slot.load(std::memory_order_acquire)};
+        // Slots currently in writing keep their previous time stamp. They will be re-ordered on EventReady()/Discard().
+        EventSlotStatus::EventTimeStamp time_stamp{allocation_order_.GetTimeStamp(slot_index)};
+        if (status.IsInvalid())
+        {
+            time_stamp = 0U;
+        }
+        else if (status.IsInWriting() == false)
+        {
+            time_stamp = status.GetTimeStamp();
+        }
+        else
+        {
+            ; /* In writing, keep previous time stamp. */
+        }
+        allocation_order_.Update(slot_index, time_stamp);
+        ++slot_index;
+    }
 }
 
 template <template <class> class AtomicIndirectorType>
-auto EventDataControlImpl<AtomicIndirectorType>::FindOldestUnusedSlot() const noexcept -> amp::optional<SlotIndexType>
+auto EventDataControlImpl<AtomicIndirectorType>::FindOldestUnusedSlotByScan() const noexcept
+    -> amp::optional<SlotIndexType>
 {
     EventSlotStatus::EventTimeStamp oldest_time_stamp{EventSlotStatus::TIMESTAMP_MAX};
     auto current_index{0};
@@ -136,6 +281,7 @@ auto EventDataControlImpl<AtomicIndirectorType>::EventReady(const SlotIndexType
     const EventSlotStatus initial{time_stamp, 0};
     state_slots_[slot_index].store(static_cast<EventSlotStatus::value_type>(
         initial));  // no race-condition can happen, since sender is only in one thread
+    UpdateAllocationOrder(slot_index, time_stamp);
 }
 
 template <template <class> class AtomicIndirectorType>
@@ -146,6 +292,7 @@ auto EventDataControlImpl<AtomicIndirectorType>::Discard(const SlotIndexType slo
     {
         slot.MarkInvalid();
         state_slots_[slot_index].store(static_cast<EventSlotStatus::value_type>(slot), std::memory_order_release);
+        UpdateAllocationOrder(slot_index, 0U);
     }
 }
 
@@ -179,6 +326,7 @@ auto EventDataControlImpl<AtomicIndirectorType>::ReferenceSpecificEvent(
                 state_slots_[slot_index], slot_current_status_value, slot_new_status_value, std::memory_order_acq_rel))
         {
             transaction_log.ReferenceTransactionCommit(slot_index);
+            transaction_log.GetPerformanceCounters().RecordReference(counter);
             return true;
         }
         transaction_log.ReferenceTransactionAbort(slot_index);
@@ -231,6 +379,11 @@ auto EventDataControlImpl<AtomicIndirectorType>::ReferenceNextEvent(
 
         EventSlotStatus::value_type status_new_val{candidate_slot_status};
         ++status_new_val;
+        if (EventSlotStatus{status_new_val}.GetReferenceCount() == 0)
+        {
+            // ref-counter overflow
+            return {};
+        }
 
         auto candidate_slot_status_value_type{static_cast<EventSlotStatus::value_type&>(candidate_slot_status)};
 
@@ -247,19 +400,142 @@ auto EventDataControlImpl<AtomicIndirectorType>::ReferenceNextEvent(
         transaction_log.ReferenceTransactionAbort(possible_index_value);
     }
 
-    num_ref_retries += counter;
-
     if (counter < MAX_REFERENCE_RETRIES)
     {
+        transaction_log.GetPerformanceCounters().RecordReference(counter);
         return possible_index;
     }
 
-    ++num_ref_misses;
+    transaction_log.GetPerformanceCounters().RecordReferenceFailure(counter);
 
     // if this happens it means we have a wrong configuration in the system, see doc-string
     return {};
 }
 
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::ReferenceNextEvents(
+    const EventSlotStatus::EventTimeStamp last_search_time,
+    const TransactionLogSet::TransactionLogIndex transaction_log_index,
+    const amp::span<SlotIndexType> slot_indices,
+    const amp::span<EventSlotStatus::EventTimeStamp> time_stamps) noexcept -> std::size_t
+{
+    const auto max_count = static_cast<std::size_t>(std::min(slot_indices.size(), time_stamps.size()));
+    if (max_count == 0U)
+    {
+        return 0U;
+    }
+
+    // Single pass over all slots: keep the max_count newest candidates sorted by descending timestamp. The candidate
+    // buffers are local to the caller, so shifting them is cheap compared to touching the shared slot array again.
+    std::size_t num_candidates{0U};
+    SlotIndexType current_index{0U};
+    for (const auto& slot : state_slots_)
+    {
+        const EventSlotStatus slot_status{slot.load(std::memory_order_relaxed)};
+        if (slot_status.IsTimeStampBetween(last_search_time, EventSlotStatus::TIMESTAMP_MAX))
+        {
+            const auto time_stamp = slot_status.GetTimeStamp();
+            if ((num_candidates < max_count) || (time_stamp > time_stamps[num_candidates - 1U]))
+            {
+                // if the buffer is full, the oldest candidate (last position) is dropped
+                auto position = std::min(num_candidates, max_count - 1U);
+                if (num_candidates < max_count)
+                {
+                    ++num_candidates;
+                }
+                while ((position > 0U) && (time_stamps[position - 1U] < time_stamp))
+                {
+                    time_stamps[position] = time_stamps[position - 1U];
+                    slot_indices[position] = slot_indices[position - 1U];
+                    --position;
+                }
+                time_stamps[position] = time_stamp;
+                slot_indices[position] = current_index;
+            }
+        }
+        ++current_index;
+    }
+
+    auto& transaction_log = transaction_log_set_.GetTransactionLog(transaction_log_index);
+
+    std::size_t num_referenced{0U};
+    for (; num_referenced < num_candidates; ++num_referenced)
+    {
+        if (!ReferenceCandidateEvent(slot_indices[num_referenced], time_stamps[num_referenced], transaction_log))
+        {
+            break;
+        }
+    }
+
+    // A candidate has been overwritten since the scan (or we ran out of retries). Fall back to the single slot search
+    // for the remaining samples, which are all older than the last one we successfully referenced.
+    if (num_referenced < num_candidates)
+    {
+        EventSlotStatus::EventTimeStamp upper_limit{
+            (num_referenced == 0U) ? EventSlotStatus::TIMESTAMP_MAX : time_stamps[num_referenced - 1U]};
+        for (; num_referenced < max_count; ++num_referenced)
+        {
+            const auto slot_index = ReferenceNextEvent(last_search_time, transaction_log_index, upper_limit);
+            if (!slot_index.has_value())
+            {
+                break;
+            }
+            upper_limit = operator[](slot_index.value()).GetTimeStamp();
+            slot_indices[num_referenced] = slot_index.value();
+            time_stamps[num_referenced] = upper_limit;
+        }
+    }
+
+    return num_referenced;
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::ReferenceCandidateEvent(
+    const SlotIndexType slot_index,
+    const EventSlotStatus::EventTimeStamp expected_time_stamp,
+    TransactionLog& transaction_log) noexcept -> bool
+{
+    auto& slot_value = state_slots_[slot_index];
+
+    // We only retry, if other consumers changed the refcount of the slot concurrently. Since timestamps are unique,
+    // a changed timestamp means that the slot does not contain the candidate sample anymore.
+    auto counter = 0U;
+    for (; counter < MAX_REFERENCE_RETRIES; counter++)
+    {
+        const EventSlotStatus slot_status{slot_value.load(std::memory_order_relaxed)};
+        if (slot_status.IsInWriting() || slot_status.IsInvalid() ||
+            (slot_status.GetTimeStamp() != expected_time_stamp))
+        {
+            break;
+        }
+
+        auto slot_status_value{static_cast<EventSlotStatus::value_type>(slot_status)};
+        const EventSlotStatus::value_type slot_new_status_value{slot_status_value + 1U};
+        const EventSlotStatus slot_new_status{slot_new_status_value};
+        if (slot_new_status.GetReferenceCount() == 0)
+        {
+            // ref-counter overflow
+            break;
+        }
+
+        transaction_log.ReferenceTransactionBegin(slot_index);
+        if (AtomicIndirectorType<EventSlotStatus::value_type>::compare_exchange_weak(
+                slot_value, slot_status_value, slot_new_status_value, std::memory_order_acq_rel))
+        {
+            transaction_log.ReferenceTransactionCommit(slot_index);
+            transaction_log.GetPerformanceCounters().RecordReference(counter);
+            return true;
+        }
+        transaction_log.ReferenceTransactionAbort(slot_index);
+    }
+
+    if (counter == MAX_REFERENCE_RETRIES)
+    {
+        transaction_log.GetPerformanceCounters().RecordReferenceFailure(counter);
+    }
+    return false;
+}
+
 template <template <class> class AtomicIndirectorType>
 std::size_t EventDataControlImpl<AtomicIndirectorType>::GetNumNewEvents(
     const EventSlotStatus::EventTimeStamp reference_time) const noexcept
@@ -277,6 +553,38 @@ std::size_t EventDataControlImpl<AtomicIndirectorType>::GetNumNewEvents(
     return result;
 }
 
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::FindNewestEvent() const noexcept
+    -> amp::optional<std::pair<SlotIndexType, EventSlotStatus::EventTimeStamp>>
+{
+    amp::optional<std::pair<SlotIndexType, EventSlotStatus::EventTimeStamp>> newest_event{};
+    EventSlotStatus::EventTimeStamp newest_time_stamp{0U};
+    SlotIndexType slot_index{0U};
+    for (const auto& slot : state_slots_)
+    {
+        const EventSlotStatus slot_status{slot.load(std::memory_order_acquire)};
+        if (slot_status.IsTimeStampBetween(newest_time_stamp, EventSlotStatus::TIMESTAMP_MAX))
+        {
+            newest_time_stamp = slot_status.GetTimeStamp();
+            newest_event = std::make_pair(slot_index, newest_time_stamp);
+        }
+        ++slot_index;
+    }
+    return newest_event;
+}
+
+template <template <class> class AtomicIndirectorType>
+bool EventDataControlImpl<AtomicIndirectorType>::IsEventUnchanged(
+    const SlotIndexType slot_index,
+    const EventSlotStatus::EventTimeStamp time_stamp) const noexcept
+{
+    // Orders the preceding (non-atomic) reads of the slot data before the re-check of the slot state. Slots in writing
+    // and invalid slots have a time stamp of 0, so they never match a valid time stamp.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const EventSlotStatus slot_status{state_slots_[slot_index].load(std::memory_order_relaxed)};
+    return (slot_status.GetTimeStamp() == time_stamp) && (slot_status.IsInWriting() == false);
+}
+
 template <template <class> class AtomicIndirectorType>
 auto EventDataControlImpl<AtomicIndirectorType>::DereferenceEvent(
     const SlotIndexType event_slot_index,
@@ -325,25 +633,123 @@ auto EventDataControlImpl<AtomicIndirectorType>::RemoveAllocationsForWriting() n
             }
         }
     }
+
+    // The previous skeleton might have died while it accessed the allocation order. Since it is dead, we can safely
+    // release its lock and let the next allocation rebuild the order.
+    allocation_order_.Unlock();
+    allocation_order_.MarkStale();
 }
 
 template <template <class> class AtomicIndirectorType>
-auto EventDataControlImpl<AtomicIndirectorType>::DumpPerformanceCounters() -> void
+auto EventDataControlImpl<AtomicIndirectorType>::GetSlotHolderDiagnostics() const noexcept
+    -> std::vector<SlotHolderDiagnostics>
 {
-    std::cout << "EventDataControlImpl performance breakdown\n"
-              << "======================================\n"
-              << "\nnum_alloc_misses:  " << num_alloc_misses << "\nnum_ref_misses     " << num_ref_misses
-              << "\nnum_alloc_retries: " << num_alloc_retries << "\nnum_ref_retries:   " << num_ref_retries
-              << std::endl;
+    std::vector<SlotHolderDiagnostics> slots{};
+    slots.reserve(state_slots_.size());
+    EventSlotStatus::EventTimeStamp newest_time_stamp{0U};
+    SlotIndexType slot_index{0U};
+    for (const auto& slot : state_slots_)
+    {
+        const EventSlotStatus slot_status{slot.load(std::memory_order_acquire)};
+        // A slot in writing is owned by the producer and can't be referenced by consumers.
+        const bool is_readable{(!slot_status.IsInvalid()) && (!slot_status.IsInWriting())};
+        const auto time_stamp = is_readable ? slot_status.GetTimeStamp() : EventSlotStatus::EventTimeStamp{0U};
+        const auto reference_count =
+            is_readable ? slot_status.GetReferenceCount() : EventSlotStatus::SubscriberCount{0U};
+        newest_time_stamp = std::max(newest_time_stamp, time_stamp);
+        slots.push_back(SlotHolderDiagnostics{slot_index, time_stamp, 0U, reference_count, false, {}});
+        ++slot_index;
+    }
+
+    // The TransactionLogSet mutex keeps the TransactionLogs from being (un)registered during the walk.
+    transaction_log_set_.VisitActiveProxyTransactionLogs(
+        [&slots](const TransactionLogSet::TransactionLogNode& transaction_log_node) noexcept {
+            const auto transaction_log_id = transaction_log_node.GetTransactionLogId();
+            const auto& transaction_log = transaction_log_node.GetTransactionLog();
+            for (auto& slot : slots)
+            {
+                if (!transaction_log.IsSlotReferenced(slot.slot_index))
+                {
+                    continue;
+                }
+                // Several proxy event instances of one application share the same TransactionLogId.
+                const auto holder = std::find_if(
+                    slot.holders.begin(), slot.holders.end(), [transaction_log_id](const SlotHolder& existing_holder) {
+                        return existing_holder.transaction_log_id == transaction_log_id;
+                    });
+                if (holder != slot.holders.end())
+                {
+                    ++(holder->number_of_references);
+                }
+                else
+                {
+                    slot.holders.push_back(SlotHolder{transaction_log_id, amp::nullopt, 1U});
+                }
+            }
+        });
+
+    const auto& skeleton_tracing_transaction_log_node = transaction_log_set_.GetSkeletonTracingTransactionLog();
+    if (skeleton_tracing_transaction_log_node.IsActive())
+    {
+        for (auto& slot : slots)
+        {
+            slot.referenced_by_skeleton_tracing =
+                skeleton_tracing_transaction_log_node.GetTransactionLog().IsSlotReferenced(slot.slot_index);
+        }
+    }
+
+    const auto unreferenced_slots = std::remove_if(slots.begin(), slots.end(), [](const SlotHolderDiagnostics& slot) {
+        return (slot.reference_count == 0U) && slot.holders.empty() && (!slot.referenced_by_skeleton_tracing);
+    });
+    slots.erase(unreferenced_slots, slots.end());
+    for (auto& slot : slots)
+    {
+        slot.held_publish_cycles = (newest_time_stamp > slot.time_stamp) ? (newest_time_stamp - slot.time_stamp) : 0U;
+    }
+    return slots;
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlImpl<AtomicIndirectorType>::GetPerformanceCountersSnapshot() const noexcept
+    -> EventPerformanceCounters::Snapshot
+{
+    EventPerformanceCounters::Snapshot snapshot{};
+    performance_counters_.AddTo(snapshot);
+
+    // The counters of inactive TransactionLogs are added as well, since they still hold the counts of consumers, which
+    // have unsubscribed in the meantime.
+    for (const auto& transaction_log_node : transaction_log_set_.GetProxyTransactionLogs())
+    {
+        transaction_log_node.GetTransactionLog().GetPerformanceCounters().AddTo(snapshot);
+    }
+    transaction_log_set_.GetSkeletonTracingTransactionLog().GetTransactionLog().GetPerformanceCounters().AddTo(
+        snapshot);
+
+    for (const auto& slot : state_slots_)
+    {
+        const EventSlotStatus slot_status{slot.load(std::memory_order_relaxed)};
+        if ((!slot_status.IsInvalid()) && (!slot_status.IsInWriting()))
+        {
+            snapshot.outstanding_references += slot_status.GetReferenceCount();
+        }
+    }
+    return snapshot;
 }
 
 template <template <class> class AtomicIndirectorType>
-auto EventDataControlImpl<AtomicIndirectorType>::ResetPerformanceCounters() -> void
+auto EventDataControlImpl<AtomicIndirectorType>::DumpPerformanceCounters() const -> void
 {
-    num_alloc_misses.store(0U);
-    num_ref_misses.store(0U);
-    num_alloc_retries.store(0U);
-    num_ref_retries.store(0U);
+    const auto counters = GetPerformanceCountersSnapshot();
+    std::cout << "EventDataControlImpl performance breakdown\n"
+              << "======================================\n"
+              << "\nallocations:                " << counters.allocations
+              << "\nallocation_failures:        " << counters.allocation_failures
+              << "\nallocation_retries:         " << counters.allocation_retries
+              << "\nreferences:                 " << counters.references
+              << "\nreference_failures:         " << counters.reference_failures
+              << "\nreference_retries:          " << counters.reference_retries
+              << "\noutstanding_references:     " << counters.outstanding_references
+              << "\nnotifications:              " << counters.notifications << std::endl;
 }
 
 template class EventDataControlImpl<memory::shared::AtomicIndirectorReal>;
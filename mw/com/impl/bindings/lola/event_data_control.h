@@ -15,7 +15,12 @@
 #ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_DATA_CONTROL_H
 #define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_DATA_CONTROL_H
 
+#include "platform/aas/mw/com/impl/bindings/lola/event_control_slots.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_performance_counters.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_allocation_order.h"
 #include "platform/aas/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_notifier.h"
+#include "platform/aas/mw/com/impl/bindings/lola/slot_holder_diagnostics.h"
 
 #include "platform/aas/mw/com/impl/bindings/lola/transaction_log_id.h"
 #include "platform/aas/mw/com/impl/bindings/lola/transaction_log_set.h"
@@ -28,10 +33,13 @@
 #include "platform/aas/lib/containers/dynamic_array.h"
 
 #include <amp_optional.hpp>
+#include <amp_span.hpp>
 
 #include <atomic>
 #include <cstdint>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace bmw
 {
@@ -73,9 +81,7 @@ class EventDataControlImpl final
   public:
     /// \brief Represents the type for the index to access the underlying slots
     using SlotIndexType = std::uint16_t;
-    using EventControlSlots = bmw::containers::DynamicArray<
-        std::atomic<EventSlotStatus::value_type>,
-        memory::shared::PolymorphicOffsetPtrAllocator<std::atomic<EventSlotStatus::value_type>>>;
+    using EventControlSlots = lola::EventControlSlots;
 
     /// \brief Will construct EventDataControlImpl and dynamically allocate memory on provided resource on
     /// construction
@@ -83,10 +89,12 @@ class EventDataControlImpl final
     /// \param proxy The memory resource proxy where the memory shall be allocated (e.g. Shared Memory)
     /// \param max_number_combined_subscribers The max number of subscribers which can subscribe to the SkeletonEvent
     ///        owning this EventDataControl at any one time.
+    /// \param slot_status_layout The layout of the slot states in memory
     EventDataControlImpl(
         const SlotIndexType max_slots,
         const bmw::memory::shared::MemoryResourceProxy* const proxy,
-        const LolaEventInstanceDeployment::SubscriberCountType max_number_combined_subscribers) noexcept;
+        const LolaEventInstanceDeployment::SubscriberCountType max_number_combined_subscribers,
+        const SlotStatusLayout slot_status_layout = SlotStatusLayout::kPacked) noexcept;
     ~EventDataControlImpl() noexcept = default;
 
     EventDataControlImpl(const EventDataControlImpl&) = delete;
@@ -96,7 +104,10 @@ class EventDataControlImpl final
 
     /// \brief Checks for the oldest unused slot and acquires for writing (thread-safe, wait-free)
     ///
-    /// \details This method will perform retries (bounded) on data-races. In order to ensure that _always_
+    /// \details The oldest unused slot is looked up via the EventSlotAllocationOrder, which makes the lookup O(1) in
+    /// the common case. Only if the order is currently accessed by another thread, the slot array is scanned.
+    ///
+    /// This method will perform retries (bounded) on data-races. In order to ensure that _always_
     /// a slot is found, it needs to be ensured that:
     /// * enough slots are allocated (sum of all possible max allocations by consumer + 1)
     /// * enough retries are performed (currently max number of parallel actions is restricted to 50 (number of
@@ -106,6 +117,17 @@ class EventDataControlImpl final
     /// \post EventReady() is invoked to withdraw write-ownership
     amp::optional<SlotIndexType> AllocateNextSlot() noexcept;
 
+    /// \brief Acquires the oldest unused slots for writing (thread-safe, wait-free)
+    ///
+    /// \details All slots are acquired within one walk over the EventSlotAllocationOrder. Slots, which can't be
+    /// acquired that way (e.g. since the order is currently accessed by another thread), are acquired via
+    /// AllocateNextSlot().
+    ///
+    /// \param slot_indices receives the indices of the acquired slots. Its size is the number of requested slots.
+    /// \return number of acquired slots, which are stored at the front of slot_indices
+    /// \post EventReady() is invoked for each acquired slot to withdraw write-ownership
+    std::size_t AllocateNextSlots(const amp::span<SlotIndexType> slot_indices) noexcept;
+
     /// \brief Indicates that a slot is ready for reading - writing has finished. (thread-safe, wait-free)
     /// \pre AllocateNextSlot() was invoked to obtain write-ownership
     void EventReady(const SlotIndexType slot_index, const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
@@ -134,18 +156,58 @@ class EventDataControlImpl final
     /// \details This method will perform retries (bounded) on data-races. I.e. if a viable slot failed to be marked
     /// for reading because of a data race, retries are made.
     ///
-    /// \return Will return the index of an event, if one exists > last_search_time, empty otherwise
+    /// \return Will return the index of an event, if one exists > last_search_time, empty otherwise or if the reference
+    ///         count of the newest event would overflow
     /// \post DereferenceEvent() is invoked to withdraw read-ownership
     amp::optional<SlotIndexType> ReferenceNextEvent(
         const EventSlotStatus::EventTimeStamp last_search_time,
         const TransactionLogSet::TransactionLogIndex transaction_log_index,
         const EventSlotStatus::EventTimeStamp upper_limit = EventSlotStatus::TIMESTAMP_MAX) noexcept;
 
+    /// \brief Will search for the max_count newest slots after last_search_time and mark them for reading
+    /// \param last_search_time The time stamp the last time a search for an event was performed
+    /// \param slot_indices Output buffer for the indices of the referenced slots. Its size restricts the number of
+    ///        slots which will be referenced.
+    /// \param time_stamps Output buffer for the time stamps of the referenced slots. Must have the same size as
+    ///        slot_indices.
+    ///
+    /// \details In contrast to calling ReferenceNextEvent() repeatedly, the slot array is only traversed once to
+    /// select the candidates, which are then referenced one by one. Each reference is recorded in the TransactionLog
+    /// exactly like in ReferenceNextEvent(). If a candidate is overwritten by the producer between selection and
+    /// referencing, the remaining slots are collected via ReferenceNextEvent(), so that the result is identical to the
+    /// one of the repeated single calls. Like there, a slot is not referenced, if its reference count would overflow.
+    ///
+    /// \return Number of referenced slots. The first n entries of slot_indices/time_stamps are filled, ordered from
+    ///         the newest to the oldest event.
+    /// \post DereferenceEvent() is invoked for each referenced slot to withdraw read-ownership
+    std::size_t ReferenceNextEvents(const EventSlotStatus::EventTimeStamp last_search_time,
+                                    const TransactionLogSet::TransactionLogIndex transaction_log_index,
+                                    const amp::span<SlotIndexType> slot_indices,
+                                    const amp::span<EventSlotStatus::EventTimeStamp> time_stamps) noexcept;
+
     /// \brief Returns number/count of events within event slots, which are newer than the given timestamp.
     /// \param reference_time given reference timestamp.
     /// \return number/count of available events, which are newer than the given reference_time.
     std::size_t GetNumNewEvents(const EventSlotStatus::EventTimeStamp reference_time) const noexcept;
 
+    /// \brief Searches for the slot containing the newest event without marking it for reading (thread-safe,
+    ///        wait-free)
+    ///
+    /// \details In contrast to ReferenceNextEvent(), the slot states are only loaded, so no shared cache line is
+    /// written and no TransactionLog is involved. Since the slot is not referenced, the producer may overwrite it at
+    /// any time. A caller therefore has to copy the slot data and validate the copy afterwards via IsEventUnchanged()
+    /// (seqlock-style read).
+    ///
+    /// \return Index and time stamp of the slot containing the newest event, empty if there is no event
+    amp::optional<std::pair<SlotIndexType, EventSlotStatus::EventTimeStamp>> FindNewestEvent() const noexcept;
+
+    /// \brief Checks whether the given slot still contains the event with the given time stamp (thread-safe,
+    ///        wait-free)
+    /// \pre FindNewestEvent() returned slot_index and time_stamp and the slot data has been copied.
+    /// \return true if the copied slot data is consistent, false if it may have been torn by the producer
+    bool IsEventUnchanged(const SlotIndexType slot_index,
+                          const EventSlotStatus::EventTimeStamp time_stamp) const noexcept;
+
     /// \brief Indicates that a consumer is finished reading (thread-safe, wait-free)
     /// \pre ReferenceNextEvent() was invoked to obtain read-ownership
     ///
@@ -170,26 +232,64 @@ class EventDataControlImpl final
 
     TransactionLogSet& GetTransactionLogSet() noexcept { return transaction_log_set_; }
 
+    /// \brief Wake-up counter, which is signalled by the producer for every sent sample. Consumers in
+    ///        EventNotificationMode::kSharedMemory wait on it instead of waiting for notification messages.
+    EventUpdateNotifier& GetUpdateNotifier() noexcept { return update_notifier_; }
+
+    /// \brief Reports, which consumers reference the slots of this event (thread-safe, blocking (takes the
+    ///        TransactionLogSet mutex))
+    ///
+    /// \details Walks over all active TransactionLogs and reports each slot, which is referenced, together with the
+    /// TransactionLogIds holding it and the number of samples published since. The TransactionLogSet mutex is held
+    /// while walking the TransactionLogs, so Subscribe() / Unsubscribe() of consumers wait for it. The slot states and
+    /// references are only read while producer and consumers go on, so the result is only a best-effort snapshot.
+    /// The pids of the holders are not filled in, as the uid-pid mapping is not part of the EventDataControl. Intended
+    /// for diagnostics, e.g. after an allocation failed, since it allocates memory for the result.
+    ///
+    /// \return diagnostics of all referenced slots, ordered by slot index
+    std::vector<SlotHolderDiagnostics> GetSlotHolderDiagnostics() const noexcept;
+
+    /// \brief Producer side performance counters of this event, which are updated by the allocations and notifications.
+    EventPerformanceCounters& GetPerformanceCounters() noexcept { return performance_counters_; }
+    const EventPerformanceCounters& GetPerformanceCounters() const noexcept { return performance_counters_; }
+
+    /// \brief Returns the performance counters of this event (thread-safe, wait-free)
+    ///
+    /// \details Adds up the producer side counters and the consumer side counters of all TransactionLogs. The number of
+    /// outstanding references is taken from the reference counts of the slots. No lock is taken: all values are only
+    /// read while producer and consumers go on, so the snapshot isn't necessarily consistent across counters.
+    EventPerformanceCounters::Snapshot GetPerformanceCountersSnapshot() const noexcept;
+
     // helper for performance indication (no production usage)
-    static void DumpPerformanceCounters();
-    static void ResetPerformanceCounters();
+    void DumpPerformanceCounters() const;
 
   private:
-    amp::optional<SlotIndexType> FindOldestUnusedSlot() const noexcept;
+    bool TryAcquireSlotForWriting(const SlotIndexType slot_index) noexcept;
+    amp::optional<SlotIndexType> FindOldestUnusedSlot() noexcept;
+    amp::optional<SlotIndexType> FindOldestUnusedSlotInAllocationOrder() const noexcept;
+    amp::optional<SlotIndexType> FindOldestUnusedSlotByScan() const noexcept;
+    void UpdateAllocationOrder(const SlotIndexType slot_index,
+                               const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
+    void RebuildAllocationOrder() noexcept;
+
+    bool ReferenceCandidateEvent(const SlotIndexType slot_index,
+                                 const EventSlotStatus::EventTimeStamp expected_time_stamp,
+                                 TransactionLog& transaction_log) noexcept;
 
     // Shared Memory ready :)!
     // we don't implement a smarter structure and just iterate through it, because we believe that by
     // cache optimization this is way faster then e.g. a tree, since a tree also needs to be
-    // implement wait-free.
+    // implement wait-free. Depending on the configured SlotStatusLayout, each slot state has its own cache line.
     EventControlSlots state_slots_;
 
+    // Producer side hint to find the oldest unused slot without iterating over all state_slots_.
+    EventSlotAllocationOrder allocation_order_;
+
     TransactionLogSet transaction_log_set_;
 
-    // helper variables to calculated performance indicators
-    static inline std::atomic_uint_fast64_t num_alloc_misses{0U};
-    static inline std::atomic_uint_fast64_t num_ref_misses{0U};
-    static inline std::atomic_uint_fast64_t num_alloc_retries{0U};
-    static inline std::atomic_uint_fast64_t num_ref_retries{0U};
+    EventUpdateNotifier update_notifier_;
+
+    EventPerformanceCounters performance_counters_;
 
     template <template <typename> class T>
     friend class detail_event_data_control_composite::EventDataControlCompositeImpl;
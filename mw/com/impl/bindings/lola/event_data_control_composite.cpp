@@ -111,6 +111,8 @@ auto EventDataControlCompositeImpl<AtomicIndirectorType>::TryLockSlot(
         return false;
     }
 
+    // See EventDataControlImpl::AllocateNextSlot(): the in-writing mark has to be visible before the slot data changes.
+    std::atomic_thread_fence(std::memory_order_release);
     return true;
 }
 
@@ -128,11 +130,15 @@ auto EventDataControlCompositeImpl<AtomicIndirectorType>::AllocateNextMultiSlot(
             const EventSlotStatus::EventTimeStamp time_stamp{std::get<1>(possible_slot_value)};
             if (TryLockSlot(slot_index, time_stamp))
             {
+                asil_qm_control_->performance_counters_.RecordAllocation(counter);
+                asil_b_control_->performance_counters_.RecordAllocation(counter);
                 return slot_index;
             }
         }
     }
 
+    asil_qm_control_->performance_counters_.RecordAllocationFailure(MAX_MULTI_ALLOCATE_COUNT);
+    asil_b_control_->performance_counters_.RecordAllocationFailure(MAX_MULTI_ALLOCATE_COUNT);
     return amp::nullopt;
 }
 
@@ -166,6 +172,52 @@ auto EventDataControlCompositeImpl<AtomicIndirectorType>::AllocateNextSlot() noe
     }
 }
 
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlCompositeImpl<AtomicIndirectorType>::AllocateNextSlots(
+    const amp::span<EventDataControl::SlotIndexType> slot_indices) noexcept -> std::pair<std::size_t, bool>
+{
+    if (asil_b_control_ == nullptr)
+    {
+        return {asil_qm_control_->AllocateNextSlots(slot_indices), false};
+    }
+
+    std::size_t number_of_acquired_slots{0U};
+    // Slots, which are shared with QM consumers, have to be acquired in both control parts one by one.
+    while ((!ignore_qm_control_) && (number_of_acquired_slots < static_cast<std::size_t>(slot_indices.size())))
+    {
+        const auto slot = AllocateNextSlot();
+        if (!slot.first.has_value())
+        {
+            return {number_of_acquired_slots, ignore_qm_control_};
+        }
+        slot_indices[number_of_acquired_slots] = slot.first.value();
+        ++number_of_acquired_slots;
+    }
+
+    // The QM control part is ignored (possibly only since the last AllocateNextSlot() call), so the remaining slots
+    // are acquired solely within the ASIL-B control part.
+    const amp::span<EventDataControl::SlotIndexType> remaining_slot_indices{
+        slot_indices.data() + number_of_acquired_slots,
+        static_cast<std::size_t>(slot_indices.size()) - number_of_acquired_slots};
+    number_of_acquired_slots += asil_b_control_->AllocateNextSlots(remaining_slot_indices);
+    return {number_of_acquired_slots, ignore_qm_control_};
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventDataControlCompositeImpl<AtomicIndirectorType>::TryAllocateNextSlot() noexcept
+    -> amp::optional<EventDataControl::SlotIndexType>
+{
+    if (asil_b_control_ == nullptr)
+    {
+        return asil_qm_control_->AllocateNextSlot();
+    }
+    if (ignore_qm_control_)
+    {
+        return asil_b_control_->AllocateNextSlot();
+    }
+    return AllocateNextMultiSlot();
+}
+
 template <template <class> class AtomicIndirectorType>
 auto EventDataControlCompositeImpl<AtomicIndirectorType>::EventReady(
     const EventDataControl::SlotIndexType slot,
@@ -21,7 +21,9 @@
 #include "platform/aas/lib/memory/shared/atomic_indirector.h"
 
 #include <amp_optional.hpp>
+#include <amp_span.hpp>
 
+#include <cstddef>
 #include <tuple>
 #include <utility>
 
@@ -70,6 +72,29 @@ class EventDataControlCompositeImpl
     /// \post EventReady() is invoked to withdraw write-ownership
     std::pair<amp::optional<EventDataControl::SlotIndexType>, bool> AllocateNextSlot() noexcept;
 
+    /// \brief Acquires the oldest unused slots for writing (thread-safe, wait-free)
+    ///
+    /// \details Same as calling AllocateNextSlot() for each requested slot, but the slots are acquired within one walk
+    /// over the slots, as long as the QM control part is ignored or doesn't exist.
+    ///
+    /// \param slot_indices receives the indices of the acquired slots. Its size is the number of requested slots.
+    /// \return a pair, where 1st element contains the number of acquired slots, which are stored at the front of
+    ///         slot_indices, and 2nd element contains a flag, whether consumers with lesser ASIL (QM) are ignored due
+    ///         to misbehavior.
+    /// \post EventReady() is invoked for each acquired slot to withdraw write-ownership
+    std::pair<std::size_t, bool> AllocateNextSlots(
+        const amp::span<EventDataControl::SlotIndexType> slot_indices) noexcept;
+
+    /// \brief Acquires the oldest unused slot for writing like AllocateNextSlot(), but a failure doesn't disconnect
+    ///        the QM consumers (thread-safe, wait-free)
+    ///
+    /// \details Used to acquire slots in addition to the ones the producer already holds. A failure then doesn't imply
+    /// that the QM consumers exceed their max samples.
+    ///
+    /// \return the reserved slot for writing if found, empty otherwise.
+    /// \post EventReady() or Discard() is invoked to withdraw write-ownership
+    amp::optional<EventDataControl::SlotIndexType> TryAllocateNextSlot() noexcept;
+
     /// \brief Indicates that a slot is ready for reading - writing has finished. (thread-safe, wait-free)
     /// \pre AllocateNextSlot() was invoked to obtain write-ownership
     void EventReady(const EventDataControl::SlotIndexType slot,
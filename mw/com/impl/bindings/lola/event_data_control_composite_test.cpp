@@ -383,6 +383,36 @@ TEST_F(EventDataControlCompositeFixture, ReturnsNoSlotIfAllused)
     EXPECT_FALSE(allocation.first.has_value());
 }
 
+TEST_F(EventDataControlCompositeFixture, TryAllocateNextSlotDoesNotDisconnectQmIfAllSlotsAreUsed)
+{
+    // Given an EventDataControlComposite with all slots used
+    AllocateAllSlots();
+
+    // When trying to allocate one additional slot
+    const auto allocation = unit_.TryAllocateNextSlot();
+
+    // Then no slot is found
+    EXPECT_FALSE(allocation.has_value());
+
+    // and the QM control part is still used
+    EXPECT_FALSE(unit_.IsQmControlDisconnected());
+}
+
+TEST_F(EventDataControlCompositeFixture, TryAllocateNextSlotSkipsEventIfUsedInQmList)
+{
+    // Given an EventDataControlComposite with all slots written at one time, and only one unused
+    AllocateAllSlots();
+    unit_.EventReady(2, 1);
+    unit_.EventReady(4, 2);
+    amp::ignore = qm_.ReferenceNextEvent(0, transaction_log_index_qm_);  // slot 4 is used in QM list
+
+    // When trying to allocate one additional slot
+    const auto allocation = unit_.TryAllocateNextSlot();
+
+    // Then the slot is allocated, which was only unused
+    EXPECT_EQ(allocation.value(), 2);
+}
+
 TEST_F(EventDataControlCompositeFixture, QmConsumerViolation)
 {
     RecordProperty("Verifies", ", ");
@@ -14,6 +14,7 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/event_data_control.h"
 
+#include "platform/aas/mw/com/impl/bindings/lola/event_data_control_test_resources.h"
 #include "platform/aas/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
 #include "platform/aas/mw/com/impl/instance_specifier.h"
 
@@ -21,6 +22,7 @@
 #include "platform/aas/lib/memory/shared/atomic_mock.h"
 
 #include <gtest/gtest.h>
+#include <array>
 #include <chrono>
 #include <limits>
 #include <mutex>
@@ -188,6 +190,50 @@ TEST_F(EventDataControlFixture, CanAllocateOldestSlotAfterOneSlotReady)
     EXPECT_EQ(slot.value(), 2);
 }
 
+TEST_F(EventDataControlFixture, AllocatesOldestSlotIfTimeStampsAreNotInSlotOrder)
+{
+    // Given an EventDataControl, where the slots have been sent in reverse slot order
+    EventDataControl unit{3, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (auto counter = 0; counter < 3; ++counter)
+    {
+        unit.AllocateNextSlot();
+    }
+    unit.EventReady(2, 1);
+    unit.EventReady(1, 2);
+    unit.EventReady(0, 3);
+
+    // When allocating slots again
+    // Then they are allocated from the oldest (lowest timestamp) to the newest
+    EXPECT_EQ(unit.AllocateNextSlot().value(), 2);
+    EXPECT_EQ(unit.AllocateNextSlot().value(), 1);
+    EXPECT_EQ(unit.AllocateNextSlot().value(), 0);
+}
+
+TEST_F(EventDataControlFixture, AllocatesDiscardedSlotBeforeOlderSlots)
+{
+    // Given an EventDataControl, where all slots have been sent
+    EventDataControl unit{3, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (unsigned int i = 1; i <= 3; i++)
+    {
+        unit.EventReady(unit.AllocateNextSlot().value(), i);
+    }
+
+    // and the oldest slot was allocated again, but discarded
+    const auto discarded_slot = unit.AllocateNextSlot();
+    ASSERT_EQ(discarded_slot.value(), 0);
+    unit.Discard(discarded_slot.value());
+
+    // and a referenced slot
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+    ASSERT_TRUE(unit.ReferenceSpecificEvent(1, transaction_log_index));
+
+    // When allocating the next slots
+    // Then the discarded slot is allocated first, followed by the oldest unused slot
+    EXPECT_EQ(unit.AllocateNextSlot().value(), 0);
+    EXPECT_EQ(unit.AllocateNextSlot().value(), 2);
+    EXPECT_FALSE(unit.AllocateNextSlot().has_value());
+}
+
 TEST_F(EventDataControlFixture, RandomizedSlotAllocation)
 {
     // Given an empty EventDataControl
@@ -376,6 +422,260 @@ TEST_F(EventDataControlFixture, GetNumNewEvents_Many)
     EXPECT_EQ(unit.GetNumNewEvents(6), 0);
 }
 
+TEST_F(EventDataControlFixture, FindNewestEventReturnsNothingIfNoEventIsReady)
+{
+    // Given an EventDataControl with one slot in writing
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    const auto slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+
+    // When searching for the newest event
+    const auto newest_event = unit.FindNewestEvent();
+
+    // Then no event is found
+    EXPECT_FALSE(newest_event.has_value());
+}
+
+TEST_F(EventDataControlFixture, FindNewestEventReturnsNewestReadySlotWithoutReferencingIt)
+{
+    // Given an EventDataControl with three ready slots, which are not ordered by their time stamps
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (const EventSlotStatus::EventTimeStamp time_stamp : {2U, 5U, 3U})
+    {
+        const auto slot = unit.AllocateNextSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.EventReady(*slot, time_stamp);
+    }
+
+    // When searching for the newest event
+    const auto newest_event = unit.FindNewestEvent();
+
+    // Then the slot with the highest time stamp is found
+    ASSERT_TRUE(newest_event.has_value());
+    EXPECT_EQ(newest_event->first, 1U);
+    EXPECT_EQ(newest_event->second, 5U);
+
+    // and the slot is not referenced
+    EXPECT_EQ(unit[newest_event->first].GetReferenceCount(), 0U);
+}
+
+TEST_F(EventDataControlFixture, EventIsChangedAfterSlotGotReallocated)
+{
+    // Given an EventDataControl with one slot, which contains an event with time stamp 1
+    EventDataControl unit{1U, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    auto slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+    unit.EventReady(*slot, 1U);
+    EXPECT_TRUE(unit.IsEventUnchanged(*slot, 1U));
+
+    // When the producer allocates the slot again
+    slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+
+    // Then the event is reported as changed while the slot is in writing
+    EXPECT_FALSE(unit.IsEventUnchanged(*slot, 1U));
+
+    // and also after the new event is ready
+    unit.EventReady(*slot, 2U);
+    EXPECT_FALSE(unit.IsEventUnchanged(*slot, 1U));
+    EXPECT_TRUE(unit.IsEventUnchanged(*slot, 2U));
+}
+
+TEST_F(EventDataControlFixture, ReferenceNextEventsReferencesNewestSlotsInDescendingOrder)
+{
+    // Given an EventDataControl with 6 ready slots
+    EventDataControl unit{6, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (unsigned int i = 1; i <= 6; i++)
+    {
+        auto slot = unit.AllocateNextSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.EventReady(*slot, i);
+    }
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing up to 3 events in one batch
+    std::array<EventDataControl::SlotIndexType, 3U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 3U> time_stamps{};
+    const auto num_referenced = unit.ReferenceNextEvents(0,
+                                                         transaction_log_index,
+                                                         amp::span<EventDataControl::SlotIndexType>{slot_indices},
+                                                         amp::span<EventSlotStatus::EventTimeStamp>{time_stamps});
+
+    // Then the 3 newest events are referenced, ordered from newest to oldest
+    ASSERT_EQ(num_referenced, 3U);
+    EXPECT_EQ(time_stamps[0], 6U);
+    EXPECT_EQ(time_stamps[1], 5U);
+    EXPECT_EQ(time_stamps[2], 4U);
+    for (std::size_t i = 0U; i < num_referenced; ++i)
+    {
+        EXPECT_EQ(unit[slot_indices[i]].GetTimeStamp(), time_stamps[i]);
+        EXPECT_EQ(unit[slot_indices[i]].GetReferenceCount(), 1U);
+    }
+    // and only the 3 older slots can be allocated again
+    EXPECT_TRUE(unit.AllocateNextSlot().has_value());
+    EXPECT_TRUE(unit.AllocateNextSlot().has_value());
+    EXPECT_TRUE(unit.AllocateNextSlot().has_value());
+    EXPECT_FALSE(unit.AllocateNextSlot().has_value());
+}
+
+TEST_F(EventDataControlFixture, ReferenceNextEventsOnlyReferencesEventsNewerThanLastSearchTime)
+{
+    // Given an EventDataControl with 4 ready slots
+    EventDataControl unit{4, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (unsigned int i = 1; i <= 4; i++)
+    {
+        auto slot = unit.AllocateNextSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.EventReady(*slot, i);
+    }
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing up to 4 events newer than timestamp 2
+    std::array<EventDataControl::SlotIndexType, 4U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 4U> time_stamps{};
+    const auto num_referenced = unit.ReferenceNextEvents(2,
+                                                         transaction_log_index,
+                                                         amp::span<EventDataControl::SlotIndexType>{slot_indices},
+                                                         amp::span<EventSlotStatus::EventTimeStamp>{time_stamps});
+
+    // Then only the 2 events with timestamp 4 and 3 are referenced
+    ASSERT_EQ(num_referenced, 2U);
+    EXPECT_EQ(time_stamps[0], 4U);
+    EXPECT_EQ(time_stamps[1], 3U);
+}
+
+TEST_F(EventDataControlFixture, FailingToUpdateSlotValueCausesReferenceNextEventsToReturnZero)
+{
+    using namespace bmw::memory::shared;
+    using ::testing::_;
+    using ::testing::Return;
+
+    AtomicMock<EventSlotStatus::value_type> atomic_mock;
+    AtomicIndirectorMock<EventSlotStatus::value_type>::SetMockObject(&atomic_mock);
+
+    // Given the operation to update the slot value always fails
+    EXPECT_CALL(atomic_mock, compare_exchange_weak(_, _, _)).WillRepeatedly(Return(false));
+
+    // and a EventDataControlUnit with one ready slot
+    detail_event_data_control::EventDataControlImpl<AtomicIndirectorMock> unit_mock{
+        1, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    auto slot = unit_mock.AllocateNextSlot();
+    unit_mock.EventReady(*slot, 1);
+
+    const auto transaction_log_index =
+        unit_mock.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing the next events
+    std::array<EventDataControl::SlotIndexType, 1U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 1U> time_stamps{};
+    const auto num_referenced =
+        unit_mock.ReferenceNextEvents(0,
+                                      transaction_log_index,
+                                      amp::span<EventDataControl::SlotIndexType>{slot_indices},
+                                      amp::span<EventSlotStatus::EventTimeStamp>{time_stamps});
+
+    // No event will be referenced
+    EXPECT_EQ(num_referenced, 0U);
+}
+
+TEST_F(EventDataControlFixture, ReferenceNextEventDoesNotOverflowReferenceCount)
+{
+    constexpr auto kMaxReferenceCount = std::numeric_limits<EventSlotStatus::SubscriberCount>::max();
+
+    // Given an EventDataControl with one ready slot, whose reference count is at its maximum
+    EventDataControl unit{1, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    const auto slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+    unit.EventReady(*slot, 1);
+    EventDataControlAttorney{unit}.SetSlotStatus(*slot, EventSlotStatus{1U, kMaxReferenceCount});
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing the next event
+    const auto referenced_slot = unit.ReferenceNextEvent(0, transaction_log_index);
+
+    // Then no event is referenced
+    EXPECT_FALSE(referenced_slot.has_value());
+    // and the slot status is unchanged
+    EXPECT_EQ(unit[*slot].GetTimeStamp(), 1U);
+    EXPECT_EQ(unit[*slot].GetReferenceCount(), kMaxReferenceCount);
+}
+
+TEST_F(EventDataControlFixture, ReferenceNextEventsDoesNotOverflowReferenceCount)
+{
+    constexpr auto kMaxReferenceCount = std::numeric_limits<EventSlotStatus::SubscriberCount>::max();
+
+    // Given an EventDataControl with 2 ready slots, where the reference count of the newest one is at its maximum
+    EventDataControl unit{2, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    const auto oldest_slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(oldest_slot.has_value());
+    unit.EventReady(*oldest_slot, 1);
+    const auto newest_slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(newest_slot.has_value());
+    unit.EventReady(*newest_slot, 2);
+    EventDataControlAttorney{unit}.SetSlotStatus(*newest_slot, EventSlotStatus{2U, kMaxReferenceCount});
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing up to 2 events in one batch
+    std::array<EventDataControl::SlotIndexType, 2U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 2U> time_stamps{};
+    const auto num_referenced = unit.ReferenceNextEvents(0,
+                                                         transaction_log_index,
+                                                         amp::span<EventDataControl::SlotIndexType>{slot_indices},
+                                                         amp::span<EventSlotStatus::EventTimeStamp>{time_stamps});
+
+    // Then no event is referenced, since the newest one can't be referenced anymore
+    EXPECT_EQ(num_referenced, 0U);
+    // and the status of the newest slot is unchanged
+    EXPECT_EQ(unit[*newest_slot].GetTimeStamp(), 2U);
+    EXPECT_EQ(unit[*newest_slot].GetReferenceCount(), kMaxReferenceCount);
+    EXPECT_EQ(unit[*oldest_slot].GetReferenceCount(), 0U);
+}
+
+TEST_F(EventDataControlFixture, AllocateNextSlotsAllocatesFromOldestToNewestSlot)
+{
+    // Given an EventDataControl, where the slots have been sent in reverse slot order
+    EventDataControl unit{3, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (auto counter = 0; counter < 3; ++counter)
+    {
+        unit.AllocateNextSlot();
+    }
+    unit.EventReady(2, 1);
+    unit.EventReady(1, 2);
+    unit.EventReady(0, 3);
+
+    // When allocating all slots at once
+    std::array<EventDataControl::SlotIndexType, 3U> slot_indices{};
+    const auto number_of_slots = unit.AllocateNextSlots({slot_indices.data(), slot_indices.size()});
+
+    // Then they are allocated from the oldest (lowest timestamp) to the newest
+    ASSERT_EQ(number_of_slots, 3U);
+    EXPECT_EQ(slot_indices[0], 2);
+    EXPECT_EQ(slot_indices[1], 1);
+    EXPECT_EQ(slot_indices[2], 0);
+    for (const auto slot_index : slot_indices)
+    {
+        EXPECT_TRUE(unit[slot_index].IsInWriting());
+    }
+}
+
+TEST_F(EventDataControlFixture, AllocateNextSlotsReturnsNumberOfAvailableSlots)
+{
+    // Given an initialized EventDataControl structure where 3 slots are allocated
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (auto counter = 0; counter < 3; ++counter)
+    {
+        unit.AllocateNextSlot();
+    }
+
+    // When trying to allocate 3 slots at once
+    std::array<EventDataControl::SlotIndexType, 3U> slot_indices{};
+    const auto number_of_slots = unit.AllocateNextSlots({slot_indices.data(), slot_indices.size()});
+
+    // Then only the 2 remaining slots are allocated
+    EXPECT_EQ(number_of_slots, 2U);
+    EXPECT_FALSE(unit.AllocateNextSlot().has_value());
+}
+
 using EventDataControlReferenceSpecificEventFixture = EventDataControlFixture;
 
 TEST_F(EventDataControlReferenceSpecificEventFixture, ReferenceSpecificEvents)
@@ -481,6 +781,159 @@ TEST_F(EventDataControlFixture, AllocatedSlotsCanBeCleanedUp)
     EXPECT_FALSE(unit[second_slot.value()].IsInWriting());
 }
 
+TEST_F(EventDataControlFixture, PerformanceCountersCountAllocationsAndFailures)
+{
+    // Given an EventDataControl with two slots, which are both allocated
+    EventDataControl unit{2U, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    ASSERT_TRUE(unit.AllocateNextSlot().has_value());
+    ASSERT_TRUE(unit.AllocateNextSlot().has_value());
+
+    // When allocating another slot
+    EXPECT_FALSE(unit.AllocateNextSlot().has_value());
+
+    // Then the two allocations and the failed one are counted
+    const auto counters = unit.GetPerformanceCountersSnapshot();
+    EXPECT_EQ(counters.allocations, 2U);
+    EXPECT_EQ(counters.allocation_failures, 1U);
+    EXPECT_GT(counters.allocation_retries, 0U);
+}
+
+TEST_F(EventDataControlFixture, PerformanceCountersCountReferencesAndOutstandingReferences)
+{
+    // Given an EventDataControl with three ready slots
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (const EventSlotStatus::EventTimeStamp time_stamp : {1U, 2U, 3U})
+    {
+        const auto slot = unit.AllocateNextSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.EventReady(*slot, time_stamp);
+    }
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When referencing two events, releasing one of them and referencing the third one
+    const auto first = unit.ReferenceNextEvent(0U, transaction_log_index, 2U);
+    const auto second = unit.ReferenceNextEvent(0U, transaction_log_index, 3U);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    unit.DereferenceEvent(*first, transaction_log_index);
+    const auto third = unit.ReferenceNextEvent(2U, transaction_log_index);
+    ASSERT_TRUE(third.has_value());
+
+    // Then three references are counted, of which two are still held
+    const auto counters = unit.GetPerformanceCountersSnapshot();
+    EXPECT_EQ(counters.references, 3U);
+    EXPECT_EQ(counters.reference_failures, 0U);
+    EXPECT_EQ(counters.outstanding_references, 2U);
+}
+
+TEST_F(EventDataControlFixture, PerformanceCountersSumUpReferencesOfAllTransactionLogs)
+{
+    // Given an EventDataControl with a ready slot and two registered consumers
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    const auto slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+    unit.EventReady(*slot, 1U);
+    const auto first_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+    const auto second_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+
+    // When both consumers reference the slot and the first one releases it and unregisters
+    ASSERT_TRUE(unit.ReferenceNextEvent(0U, first_index).has_value());
+    ASSERT_TRUE(unit.ReferenceNextEvent(0U, second_index).has_value());
+    unit.DereferenceEvent(*slot, first_index);
+    unit.GetTransactionLogSet().Unregister(first_index);
+
+    // Then the references of both consumers are counted, but only the one of the second consumer is outstanding
+    const auto counters = unit.GetPerformanceCountersSnapshot();
+    EXPECT_EQ(counters.references, 2U);
+    EXPECT_EQ(counters.outstanding_references, 1U);
+}
+
+TEST_F(EventDataControlFixture, PerformanceCountersAreKeptPerEventDataControl)
+{
+    // Given two EventDataControls
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    EventDataControl other{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+
+    // When allocating a slot in one of them
+    ASSERT_TRUE(unit.AllocateNextSlot().has_value());
+
+    // Then only its counters are changed
+    EXPECT_EQ(unit.GetPerformanceCountersSnapshot().allocations, 1U);
+    EXPECT_EQ(other.GetPerformanceCountersSnapshot().allocations, 0U);
+}
+
+TEST_F(EventDataControlFixture, SlotHolderDiagnosticsReportTransactionLogIdsHoldingSlots)
+{
+    // Given an EventDataControl with three ready slots
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    for (const EventSlotStatus::EventTimeStamp time_stamp : {1U, 2U, 3U})
+    {
+        const auto slot = unit.AllocateNextSlot();
+        ASSERT_TRUE(slot.has_value());
+        unit.EventReady(*slot, time_stamp);
+    }
+
+    // and two proxy elements of one application and one of another application
+    const TransactionLogId other_transaction_log_id{kDummyTransactionLogId + 1U};
+    const auto first_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+    const auto second_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+    const auto other_index = unit.GetTransactionLogSet().RegisterProxyElement(other_transaction_log_id).value();
+
+    // When the proxy elements of the first application reference the oldest event and the other one the newest event
+    const auto oldest_slot = unit.ReferenceNextEvent(0U, first_index, 2U);
+    ASSERT_TRUE(oldest_slot.has_value());
+    ASSERT_TRUE(unit.ReferenceNextEvent(0U, second_index, 2U).has_value());
+    const auto newest_slot = unit.ReferenceNextEvent(0U, other_index);
+    ASSERT_TRUE(newest_slot.has_value());
+
+    // Then the diagnostics report exactly the two referenced slots
+    const auto slots = unit.GetSlotHolderDiagnostics();
+    ASSERT_EQ(slots.size(), 2U);
+    const auto& oldest = (slots[0].slot_index == *oldest_slot) ? slots[0] : slots[1];
+    const auto& newest = (slots[0].slot_index == *newest_slot) ? slots[0] : slots[1];
+
+    // with the oldest slot being held twice by the first application for two publish cycles
+    EXPECT_EQ(oldest.slot_index, *oldest_slot);
+    EXPECT_EQ(oldest.time_stamp, 1U);
+    EXPECT_EQ(oldest.held_publish_cycles, 2U);
+    EXPECT_EQ(oldest.reference_count, 2U);
+    EXPECT_FALSE(oldest.referenced_by_skeleton_tracing);
+    ASSERT_EQ(oldest.holders.size(), 1U);
+    EXPECT_EQ(oldest.holders[0].transaction_log_id, kDummyTransactionLogId);
+    EXPECT_EQ(oldest.holders[0].number_of_references, 2U);
+    EXPECT_FALSE(oldest.holders[0].pid.has_value());
+
+    // and the newest slot being held once by the other application
+    EXPECT_EQ(newest.slot_index, *newest_slot);
+    EXPECT_EQ(newest.held_publish_cycles, 0U);
+    EXPECT_EQ(newest.reference_count, 1U);
+    ASSERT_EQ(newest.holders.size(), 1U);
+    EXPECT_EQ(newest.holders[0].transaction_log_id, other_transaction_log_id);
+    EXPECT_EQ(newest.holders[0].number_of_references, 1U);
+}
+
+TEST_F(EventDataControlFixture, SlotHolderDiagnosticsReportNoSlotsAfterDereferencing)
+{
+    // Given an EventDataControl with a ready slot, which has been referenced and dereferenced again
+    EventDataControl unit{kMaxSlots, memory_.getMemoryResourceProxy(), kMaxSubscribers};
+    const auto allocated_slot = unit.AllocateNextSlot();
+    ASSERT_TRUE(allocated_slot.has_value());
+    unit.EventReady(*allocated_slot, 1U);
+    const auto transaction_log_index = unit.GetTransactionLogSet().RegisterProxyElement(kDummyTransactionLogId).value();
+    const auto slot = unit.ReferenceNextEvent(0U, transaction_log_index);
+    ASSERT_TRUE(slot.has_value());
+    unit.DereferenceEvent(*slot, transaction_log_index);
+
+    // and a slot, which is currently in writing
+    ASSERT_TRUE(unit.AllocateNextSlot().has_value());
+
+    // When getting the slot holder diagnostics
+    const auto slots = unit.GetSlotHolderDiagnostics();
+
+    // Then no slot is reported
+    EXPECT_TRUE(slots.empty());
+}
+
 struct MultiSenderMultiReceiverParams
 {
     EventDataControl::SlotIndexType num_slots;
@@ -493,8 +946,7 @@ struct MultiSenderMultiReceiverParams
 class MultiSenderMultiReceiverTest : public ::testing::TestWithParam<MultiSenderMultiReceiverParams>
 {
   public:
-    MultiSenderMultiReceiverTest() { EventDataControl::ResetPerformanceCounters(); }
-    ~MultiSenderMultiReceiverTest() override { EventDataControl::DumpPerformanceCounters(); }
+    ~MultiSenderMultiReceiverTest() override { unit_.DumpPerformanceCounters(); }
 
   protected:
     // Protected by lock_
@@ -593,7 +1045,7 @@ TEST_P(MultiSenderMultiReceiverTest, DISABLED_MultiSenderMultiReceiverMaxReceive
             ASSERT_NE(ts, std::numeric_limits<std::uint32_t>::max());
             if (!slot.has_value())
             {
-                EventDataControl::DumpPerformanceCounters();
+                unit_.DumpPerformanceCounters();
                 
                 /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
                 std::terminate();
@@ -152,4 +152,10 @@ void EventDataControlAttorney::PrepareGetNumNewEvents(const std::size_t expected
     }
 }
 
+void EventDataControlAttorney::SetSlotStatus(const EventDataControl::SlotIndexType slot_index,
+                                             const EventSlotStatus slot_status) noexcept
+{
+    event_data_control_.state_slots_[slot_index].store(static_cast<EventSlotStatus::value_type>(slot_status));
+}
+
 }  // namespace bmw::mw::com::impl::lola
@@ -90,6 +90,9 @@ class EventDataControlAttorney
     void PrepareGetNumNewEvents(const std::size_t expected_result,
                                 const EventSlotStatus::EventTimeStamp reference_time) noexcept;
 
+    /// \brief Overwrites the status of the given slot of the underlying EventDataControl
+    void SetSlotStatus(const EventDataControl::SlotIndexType slot_index, const EventSlotStatus slot_status) noexcept;
+
   private:
     EventDataControl& event_data_control_;
 };
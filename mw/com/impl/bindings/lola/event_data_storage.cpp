@@ -13,3 +13,38 @@
 
 
 #include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+
+EventDataSlotLayout EventDataSlotLayout::Create(const std::size_t sample_size,
+                                                const std::size_t sample_alignment,
+                                                const std::size_t min_slot_alignment) noexcept
+{
+    AMP_PRECONDITION_PRD_MESSAGE((min_slot_alignment != 0U) && ((min_slot_alignment & (min_slot_alignment - 1U)) == 0U),
+                                 "Slot alignment has to be a power of two");
+    const std::size_t slot_alignment = (min_slot_alignment > sample_alignment) ? min_slot_alignment : sample_alignment;
+    // Each slot has to start at a multiple of the slot alignment, so the sample size is rounded up to it.
+    const std::size_t slot_stride = ((sample_size + slot_alignment - 1U) / slot_alignment) * slot_alignment;
+    return EventDataSlotLayout{slot_alignment, slot_stride};
+}
+
+std::size_t EventDataSlotLayout::GetRequiredStorageSize(const std::size_t number_of_slots) const noexcept
+{
+    // Additional (slot_alignment - 1) bytes allow to move the first slot to a slot alignment boundary.
+    return (number_of_slots * slot_stride) + (slot_alignment - 1U);
+}
+
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -16,8 +16,14 @@
 #define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_DATA_STORAGE_H
 
 #include "platform/aas/lib/containers/dynamic_array.h"
+#include "platform/aas/lib/memory/shared/memory_resource_proxy.h"
 #include "platform/aas/lib/memory/shared/polymorphic_offset_ptr_allocator.h"
 
+#include <amp_assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <scoped_allocator>
 
 namespace bmw
@@ -31,6 +37,35 @@ namespace impl
 namespace lola
 {
 
+/// \brief Placement of the sample slots of an EventDataStorage.
+///
+/// \details Only depends on size and alignment of the sample type and the configured minimum slot alignment, so that it
+/// can be calculated for shared memory size estimation without knowing the sample type.
+struct EventDataSlotLayout
+{
+    /// \brief Creates the layout for the given sample type properties.
+    /// \param sample_size size of the sample type
+    /// \param sample_alignment alignment of the sample type
+    /// \param min_slot_alignment minimum alignment of each slot, has to be a power of two.
+    static EventDataSlotLayout Create(const std::size_t sample_size,
+                                      const std::size_t sample_alignment,
+                                      const std::size_t min_slot_alignment) noexcept;
+
+    /// \brief Returns the number of bytes, which will be allocated from the memory resource for the given slots.
+    std::size_t GetRequiredStorageSize(const std::size_t number_of_slots) const noexcept;
+
+    /// \brief Alignment of each slot, which is the bigger one of sample type alignment and minimum slot alignment.
+    std::size_t slot_alignment;
+    /// \brief Distance in bytes between the start of two consecutive slots.
+    std::size_t slot_stride;
+};
+
+/// \brief Byte array in the data shared memory, from which the DynamicSamples of an event get their data.
+///
+/// \details Ranges of it are handed out on producer side by a SampleArenaAllocator.
+using EventSampleArena =
+    bmw::containers::DynamicArray<std::uint8_t, memory::shared::PolymorphicOffsetPtrAllocator<std::uint8_t>>;
+
 /// \brief Container for storing the actual data of a LoLa Event
 ///
 /// \details This container will be accessed in parallel by multiple threads. The access must be synchronized via the
@@ -38,9 +73,148 @@ namespace lola
 /// the storage and then mark the slot as ready (similar for a consumer). This enables us cache optimized access of
 /// these data structures. The overall contract will be abstracted for the end-user anyhow, so the separation into two
 /// classes should be no problem.
+///
+/// The slots are placed according to an EventDataSlotLayout. To align the first slot, the underlying byte storage is
+/// over-allocated. Since shared memory is always mapped page-aligned and the slot alignment never exceeds the page
+/// size, the offset of the first slot within the storage is the same in every process.
+template <typename SampleType>
+class EventDataStorage final
+{
+  public:
+    using value_type = SampleType;
+
+    /// \brief Creates the storage and default constructs a sample in each slot.
+    /// \param number_of_slots number of sample slots
+    /// \param proxy memory resource to allocate the storage from
+    /// \param min_slot_alignment minimum alignment of each slot, has to be a power of two. The slots are never aligned
+    ///        less than alignof(SampleType).
+    EventDataStorage(const std::size_t number_of_slots,
+                     const memory::shared::MemoryResourceProxy* const proxy,
+                     const std::size_t min_slot_alignment = alignof(SampleType)) noexcept;
+    ~EventDataStorage() noexcept;
+
+    EventDataStorage(const EventDataStorage&) = delete;
+    EventDataStorage& operator=(const EventDataStorage&) = delete;
+    EventDataStorage(EventDataStorage&&) noexcept = delete;
+    EventDataStorage& operator=(EventDataStorage&& other) noexcept = delete;
+
+    /// \brief Access the sample in the given slot. Terminates, if the slot index is out of bounds.
+    SampleType& at(const std::size_t slot_index) noexcept;
+    const SampleType& at(const std::size_t slot_index) const noexcept;
+
+    /// \brief Returns the address of the first slot or nullptr, if there are no slots.
+    SampleType* data() noexcept;
+    const SampleType* data() const noexcept;
+
+    /// \brief Returns the number of slots.
+    std::size_t size() const noexcept;
+
+    const EventDataSlotLayout& GetSlotLayout() const noexcept;
+
+  private:
+    using Storage =
+        bmw::containers::DynamicArray<std::uint8_t, memory::shared::PolymorphicOffsetPtrAllocator<std::uint8_t>>;
+    using SampleAllocator = std::scoped_allocator_adaptor<memory::shared::PolymorphicOffsetPtrAllocator<SampleType>>;
+
+    SampleType* GetSlot(const std::size_t slot_index) noexcept;
+    const SampleType* GetSlot(const std::size_t slot_index) const noexcept;
+
+    EventDataSlotLayout layout_;
+    Storage storage_;
+    SampleAllocator sample_allocator_;
+    std::size_t number_of_slots_;
+    std::size_t first_slot_offset_;
+};
+
+template <typename SampleType>
+EventDataStorage<SampleType>::EventDataStorage(const std::size_t number_of_slots,
+                                               const memory::shared::MemoryResourceProxy* const proxy,
+                                               const std::size_t min_slot_alignment) noexcept
+    : layout_{EventDataSlotLayout::Create(sizeof(SampleType), alignof(SampleType), min_slot_alignment)},
+      storage_{layout_.GetRequiredStorageSize(number_of_slots), proxy},
+      sample_allocator_{proxy},
+      number_of_slots_{number_of_slots},
+      first_slot_offset_{0U}
+{
+    if (storage_.size() > 0U)
+    {
+        // The address is only used to calculate the alignment, it is never converted back to a pointer.
+        const auto address = reinterpret_cast<std::uintptr_t>(&storage_[0U]);
+        const auto misalignment = address % layout_.slot_alignment;
+        if (misalignment != 0U)
+        {
+            first_slot_offset_ = layout_.slot_alignment - misalignment;
+        }
+    }
+
+    for (std::size_t slot_index{0U}; slot_index < number_of_slots_; ++slot_index)
+    {
+        std::allocator_traits<SampleAllocator>::construct(sample_allocator_, GetSlot(slot_index));
+    }
+}
+
 template <typename SampleType>
-using EventDataStorage = bmw::containers::
-    DynamicArray<SampleType, std::scoped_allocator_adaptor<memory::shared::PolymorphicOffsetPtrAllocator<SampleType>>>;
+EventDataStorage<SampleType>::~EventDataStorage() noexcept
+{
+    for (std::size_t slot_index{0U}; slot_index < number_of_slots_; ++slot_index)
+    {
+        std::allocator_traits<SampleAllocator>::destroy(sample_allocator_, GetSlot(slot_index));
+    }
+}
+
+template <typename SampleType>
+SampleType& EventDataStorage<SampleType>::at(const std::size_t slot_index) noexcept
+{
+    AMP_PRECONDITION_PRD_MESSAGE(slot_index < number_of_slots_, "EventDataStorage: slot index out of bounds");
+    return *GetSlot(slot_index);
+}
+
+template <typename SampleType>
+const SampleType& EventDataStorage<SampleType>::at(const std::size_t slot_index) const noexcept
+{
+    AMP_PRECONDITION_PRD_MESSAGE(slot_index < number_of_slots_, "EventDataStorage: slot index out of bounds");
+    return *GetSlot(slot_index);
+}
+
+template <typename SampleType>
+SampleType* EventDataStorage<SampleType>::data() noexcept
+{
+    return (number_of_slots_ == 0U) ? nullptr : GetSlot(0U);
+}
+
+template <typename SampleType>
+const SampleType* EventDataStorage<SampleType>::data() const noexcept
+{
+    return (number_of_slots_ == 0U) ? nullptr : GetSlot(0U);
+}
+
+template <typename SampleType>
+std::size_t EventDataStorage<SampleType>::size() const noexcept
+{
+    return number_of_slots_;
+}
+
+template <typename SampleType>
+const EventDataSlotLayout& EventDataStorage<SampleType>::GetSlotLayout() const noexcept
+{
+    return layout_;
+}
+
+template <typename SampleType>
+SampleType* EventDataStorage<SampleType>::GetSlot(const std::size_t slot_index) noexcept
+{
+    // A SampleType has been constructed at this address in the constructor.
+    return static_cast<SampleType*>(
+        static_cast<void*>(&storage_[first_slot_offset_ + (slot_index * layout_.slot_stride)]));
+}
+
+template <typename SampleType>
+const SampleType* EventDataStorage<SampleType>::GetSlot(const std::size_t slot_index) const noexcept
+{
+    // A SampleType has been constructed at this address in the constructor.
+    return static_cast<const SampleType*>(
+        static_cast<const void*>(&storage_[first_slot_offset_ + (slot_index * layout_.slot_stride)]));
+}
 
 }  // namespace lola
 }  // namespace impl
@@ -0,0 +1,147 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{5U};
+
+struct SmallSample
+{
+    std::uint8_t value;
+};
+
+std::uintptr_t GetAddress(const SmallSample& sample)
+{
+    return reinterpret_cast<std::uintptr_t>(&sample);
+}
+
+class EventDataStorageFixture : public ::testing::Test
+{
+  protected:
+    FakeMemoryResource memory_{};
+};
+
+TEST(EventDataSlotLayoutTest, SlotsAreAlignedAccordingToSampleTypeByDefault)
+{
+    // When creating the layout of a sample type without minimum slot alignment
+    const auto layout = EventDataSlotLayout::Create(12U, 4U, 1U);
+
+    // Then the slots are aligned like the sample type and placed back to back
+    EXPECT_EQ(layout.slot_alignment, 4U);
+    EXPECT_EQ(layout.slot_stride, 12U);
+}
+
+TEST(EventDataSlotLayoutTest, SampleSizeIsRoundedUpToMinSlotAlignment)
+{
+    // When creating the layout of a sample type with a minimum slot alignment bigger than its alignment
+    const auto layout = EventDataSlotLayout::Create(12U, 4U, 64U);
+
+    // Then each slot takes a multiple of the minimum slot alignment
+    EXPECT_EQ(layout.slot_alignment, 64U);
+    EXPECT_EQ(layout.slot_stride, 64U);
+
+    // and the required storage allows to align the first slot
+    EXPECT_EQ(layout.GetRequiredStorageSize(kNumberOfSlots), (kNumberOfSlots * 64U) + 63U);
+}
+
+TEST(EventDataSlotLayoutTest, SampleAlignmentIsKeptIfBiggerThanMinSlotAlignment)
+{
+    // When creating the layout of a sample type with a minimum slot alignment smaller than its alignment
+    const auto layout = EventDataSlotLayout::Create(32U, 16U, 8U);
+
+    // Then the alignment of the sample type is used
+    EXPECT_EQ(layout.slot_alignment, 16U);
+    EXPECT_EQ(layout.slot_stride, 32U);
+}
+
+TEST(EventDataSlotLayoutDeathTest, MinSlotAlignmentNotBeingAPowerOfTwoTerminates)
+{
+    // When creating a layout with a minimum slot alignment, which is not a power of two
+    // Then the program terminates
+    EXPECT_DEATH(EventDataSlotLayout::Create(12U, 4U, 48U), ".*");
+}
+
+TEST_F(EventDataStorageFixture, SlotsArePlacedBackToBackByDefault)
+{
+    // Given a storage without minimum slot alignment
+    EventDataStorage<SmallSample> unit{kNumberOfSlots, memory_.getMemoryResourceProxy()};
+
+    // Then the number of slots is the configured one
+    EXPECT_EQ(unit.size(), kNumberOfSlots);
+
+    // and every slot directly follows the previous one
+    for (std::size_t slot_index = 1U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(GetAddress(unit.at(slot_index)) - GetAddress(unit.at(slot_index - 1U)), sizeof(SmallSample));
+    }
+}
+
+TEST_F(EventDataStorageFixture, SlotsAreAlignedToMinSlotAlignment)
+{
+    // Given a storage with a minimum slot alignment of a cache line
+    constexpr std::size_t kSlotAlignment{64U};
+    EventDataStorage<SmallSample> unit{kNumberOfSlots, memory_.getMemoryResourceProxy(), kSlotAlignment};
+
+    // Then every slot starts at a cache line boundary
+    for (std::size_t slot_index = 0U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(GetAddress(unit.at(slot_index)) % kSlotAlignment, 0U);
+    }
+
+    // and the first slot is returned as start of the slots
+    EXPECT_EQ(unit.data(), &unit.at(0U));
+    EXPECT_EQ(unit.GetSlotLayout().slot_stride, kSlotAlignment);
+}
+
+TEST_F(EventDataStorageFixture, SamplesInDifferentSlotsAreIndependent)
+{
+    // Given a storage with a minimum slot alignment
+    EventDataStorage<SmallSample> unit{kNumberOfSlots, memory_.getMemoryResourceProxy(), 64U};
+
+    // When writing a different value to each slot
+    for (std::size_t slot_index = 0U; slot_index < unit.size(); ++slot_index)
+    {
+        unit.at(slot_index).value = static_cast<std::uint8_t>(slot_index);
+    }
+
+    // Then each slot keeps its value
+    for (std::size_t slot_index = 0U; slot_index < unit.size(); ++slot_index)
+    {
+        EXPECT_EQ(unit.at(slot_index).value, static_cast<std::uint8_t>(slot_index));
+    }
+}
+
+TEST_F(EventDataStorageFixture, AccessingSlotOutOfBoundsTerminates)
+{
+    // Given a storage
+    EventDataStorage<SmallSample> unit{kNumberOfSlots, memory_.getMemoryResourceProxy()};
+
+    // When accessing a slot beyond the number of slots
+    // Then the program terminates
+    EXPECT_DEATH(unit.at(kNumberOfSlots), ".*");
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
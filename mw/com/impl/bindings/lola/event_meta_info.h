@@ -17,6 +17,9 @@
 
 #include "platform/aas/lib/memory/shared/offset_ptr.h"
 #include "platform/aas/mw/com/impl/bindings/lola/data_type_meta_info.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
+
+#include <cstddef>
 
 namespace bmw::mw::com::impl::lola
 {
@@ -28,12 +31,40 @@ namespace bmw::mw::com::impl::lola
 class EventMetaInfo
 {
   public:
+    /// \brief Meta-info of an event, whose slots are aligned according to its data type and placed back to back.
     EventMetaInfo(const DataTypeMetaInfo data_type_info, const memory::shared::OffsetPtr<void> event_slots_raw_array)
-        : data_type_info_(data_type_info), event_slots_raw_array_(event_slots_raw_array)
+        : EventMetaInfo(data_type_info,
+                        EventDataSlotLayout::Create(data_type_info.size_of_, data_type_info.align_of_, 1U),
+                        event_slots_raw_array)
+    {
+    }
+    EventMetaInfo(const DataTypeMetaInfo data_type_info,
+                  const EventDataSlotLayout slot_layout,
+                  const memory::shared::OffsetPtr<void> event_slots_raw_array)
+        : EventMetaInfo(data_type_info, slot_layout, event_slots_raw_array, nullptr, 0U)
+    {
+    }
+    EventMetaInfo(const DataTypeMetaInfo data_type_info,
+                  const EventDataSlotLayout slot_layout,
+                  const memory::shared::OffsetPtr<void> event_slots_raw_array,
+                  const memory::shared::OffsetPtr<void> sample_arena,
+                  const std::size_t sample_arena_size)
+        : data_type_info_(data_type_info),
+          slot_layout_(slot_layout),
+          event_slots_raw_array_(event_slots_raw_array),
+          sample_arena_(sample_arena),
+          sample_arena_size_(sample_arena_size)
     {
     }
     DataTypeMetaInfo data_type_info_;
+    /// \brief Placement of the slots starting at event_slots_raw_array_. Generic proxies, which don't know the data
+    ///        type, have to use it to find a slot.
+    EventDataSlotLayout slot_layout_;
     memory::shared::OffsetPtr<void> event_slots_raw_array_;
+    /// \brief Start of the sample arena, from which the DynamicSamples of the event get their data. Null, if the event
+    ///        has no sample arena.
+    memory::shared::OffsetPtr<void> sample_arena_;
+    std::size_t sample_arena_size_;
 };
 
 }  // namespace bmw::mw::com::impl::lola
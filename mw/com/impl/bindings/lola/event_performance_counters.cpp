@@ -0,0 +1,125 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_performance_counters.h"
+
+namespace bmw::mw::com::impl::lola
+{
+
+// The counters are shared between processes, which is only possible for lock-free atomics.
+static_assert(std::atomic<EventPerformanceCounters::CounterType>::is_always_lock_free, "Counters must be lock-free");
+
+EventPerformanceCounters::EventPerformanceCounters() noexcept
+    : allocations_{0U}, allocation_failures_{0U}, allocation_retries_{0U}, notifications_{0U}
+{
+}
+
+void EventPerformanceCounters::RecordAllocation(const std::size_t retries) noexcept
+{
+    allocations_.fetch_add(1U, std::memory_order_relaxed);
+    if (retries != 0U)
+    {
+        allocation_retries_.fetch_add(retries, std::memory_order_relaxed);
+    }
+}
+
+void EventPerformanceCounters::RecordAllocationFailure(const std::size_t retries) noexcept
+{
+    allocation_failures_.fetch_add(1U, std::memory_order_relaxed);
+    allocation_retries_.fetch_add(retries, std::memory_order_relaxed);
+}
+
+void EventPerformanceCounters::RecordNotification() noexcept
+{
+    notifications_.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void EventPerformanceCounters::AddTo(Snapshot& snapshot) const noexcept
+{
+    snapshot.allocations += allocations_.load(std::memory_order_relaxed);
+    snapshot.allocation_failures += allocation_failures_.load(std::memory_order_relaxed);
+    snapshot.allocation_retries += allocation_retries_.load(std::memory_order_relaxed);
+    snapshot.notifications += notifications_.load(std::memory_order_relaxed);
+}
+
+void EventPerformanceCounters::Reset() noexcept
+{
+    allocations_.store(0U, std::memory_order_relaxed);
+    allocation_failures_.store(0U, std::memory_order_relaxed);
+    allocation_retries_.store(0U, std::memory_order_relaxed);
+    notifications_.store(0U, std::memory_order_relaxed);
+}
+
+ReferencePerformanceCounters::ReferencePerformanceCounters() noexcept
+    : references_{0U}, reference_failures_{0U}, reference_retries_{0U}
+{
+}
+
+ReferencePerformanceCounters::ReferencePerformanceCounters(const ReferencePerformanceCounters& other) noexcept
+    : references_{other.references_.load(std::memory_order_relaxed)},
+      reference_failures_{other.reference_failures_.load(std::memory_order_relaxed)},
+      reference_retries_{other.reference_retries_.load(std::memory_order_relaxed)}
+{
+}
+
+auto ReferencePerformanceCounters::operator=(const ReferencePerformanceCounters& other) noexcept
+    -> ReferencePerformanceCounters&
+{
+    if (this != &other)
+    {
+        references_.store(other.references_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        reference_failures_.store(other.reference_failures_.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+        reference_retries_.store(other.reference_retries_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+void ReferencePerformanceCounters::RecordReference(const std::size_t retries) noexcept
+{
+    Increment(references_, 1U);
+    if (retries != 0U)
+    {
+        Increment(reference_retries_, retries);
+    }
+}
+
+void ReferencePerformanceCounters::RecordReferenceFailure(const std::size_t retries) noexcept
+{
+    Increment(reference_failures_, 1U);
+    Increment(reference_retries_, retries);
+}
+
+void ReferencePerformanceCounters::AddTo(EventPerformanceCounters::Snapshot& snapshot) const noexcept
+{
+    snapshot.references += references_.load(std::memory_order_relaxed);
+    snapshot.reference_failures += reference_failures_.load(std::memory_order_relaxed);
+    snapshot.reference_retries += reference_retries_.load(std::memory_order_relaxed);
+}
+
+void ReferencePerformanceCounters::Reset() noexcept
+{
+    references_.store(0U, std::memory_order_relaxed);
+    reference_failures_.store(0U, std::memory_order_relaxed);
+    reference_retries_.store(0U, std::memory_order_relaxed);
+}
+
+void ReferencePerformanceCounters::Increment(std::atomic<CounterType>& counter, const std::size_t value) noexcept
+{
+    // There is only a single writer, so no read-modify-write operation is needed.
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,129 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Producer side performance counters of an event/field, which are stored in shared memory next to its
+/// EventDataControl.
+///
+/// \details Since the counters live in the control shared memory of the event, the producer, all consumers and
+/// external tools, which map the control shared memory, see the same values. They are only written by the skeleton and
+/// updated with relaxed atomics. The consumer side counters are kept per consumer in ReferencePerformanceCounters, so
+/// that consumers never write to a cache line shared with other consumers or the producer.
+class EventPerformanceCounters final
+{
+  public:
+    using CounterType = std::uint64_t;
+
+    /// \brief Copy of the counter values of an event/field at one point in time.
+    // NOLINTNEXTLINE(bmw-struct-usage-compliance): Intended struct semantic.
+    struct Snapshot
+    {
+        /// \brief Number of slots successfully allocated for writing.
+        CounterType allocations;
+        /// \brief Number of allocations, which failed because no slot could be acquired.
+        CounterType allocation_failures;
+        /// \brief Number of compare-and-swap retries needed to allocate slots.
+        CounterType allocation_retries;
+        /// \brief Number of slots successfully referenced by consumers.
+        CounterType references;
+        /// \brief Number of reference attempts, which gave up after the maximum number of retries.
+        CounterType reference_failures;
+        /// \brief Number of compare-and-swap retries needed to reference slots.
+        CounterType reference_retries;
+        /// \brief Number of slot references, which are held by all consumers at the time of the snapshot.
+        CounterType outstanding_references;
+        /// \brief Number of update notifications sent by the producer.
+        CounterType notifications;
+    };
+
+    EventPerformanceCounters() noexcept;
+    ~EventPerformanceCounters() noexcept = default;
+
+    EventPerformanceCounters(const EventPerformanceCounters&) = delete;
+    EventPerformanceCounters& operator=(const EventPerformanceCounters&) = delete;
+    EventPerformanceCounters(EventPerformanceCounters&&) noexcept = delete;
+    EventPerformanceCounters& operator=(EventPerformanceCounters&& other) noexcept = delete;
+
+    /// \brief Records a successful slot allocation, which needed the given number of retries.
+    void RecordAllocation(const std::size_t retries) noexcept;
+    /// \brief Records a failed slot allocation after the given number of retries.
+    void RecordAllocationFailure(const std::size_t retries) noexcept;
+    /// \brief Records an update notification.
+    void RecordNotification() noexcept;
+
+    /// \brief Adds the current counter values to snapshot (thread-safe, wait-free).
+    void AddTo(Snapshot& snapshot) const noexcept;
+
+    /// \brief Sets all counters to zero.
+    void Reset() noexcept;
+
+  private:
+    std::atomic<CounterType> allocations_;
+    std::atomic<CounterType> allocation_failures_;
+    std::atomic<CounterType> allocation_retries_;
+    std::atomic<CounterType> notifications_;
+};
+
+/// \brief Consumer side performance counters, which are kept per consumer in its TransactionLog.
+///
+/// \details Like the TransactionLog itself, the counters are only written by the single consumer owning them. So they
+/// are updated by plain relaxed loads and stores without any read-modify-write operation. Readers sum up the counters
+/// of all consumers via AddTo(). The counters of a TransactionLog are kept when it gets reused by another consumer, so
+/// that the sums never decrease.
+class ReferencePerformanceCounters final
+{
+  public:
+    using CounterType = EventPerformanceCounters::CounterType;
+
+    ReferencePerformanceCounters() noexcept;
+    ~ReferencePerformanceCounters() noexcept = default;
+
+    /// \brief Copying is needed, as TransactionLogs are copyable. The copy as a whole isn't atomic.
+    ReferencePerformanceCounters(const ReferencePerformanceCounters& other) noexcept;
+    ReferencePerformanceCounters& operator=(const ReferencePerformanceCounters& other) noexcept;
+    ReferencePerformanceCounters(ReferencePerformanceCounters&&) noexcept = delete;
+    ReferencePerformanceCounters& operator=(ReferencePerformanceCounters&& other) noexcept = delete;
+
+    /// \brief Records a successfully referenced slot, which needed the given number of retries.
+    void RecordReference(const std::size_t retries) noexcept;
+    /// \brief Records a failed reference attempt after the given number of retries.
+    void RecordReferenceFailure(const std::size_t retries) noexcept;
+
+    /// \brief Adds the current counter values to snapshot (thread-safe, wait-free).
+    void AddTo(EventPerformanceCounters::Snapshot& snapshot) const noexcept;
+
+    /// \brief Sets all counters to zero.
+    void Reset() noexcept;
+
+  private:
+    static void Increment(std::atomic<CounterType>& counter, const std::size_t value) noexcept;
+
+    std::atomic<CounterType> references_;
+    std::atomic<CounterType> reference_failures_;
+    std::atomic<CounterType> reference_retries_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
@@ -0,0 +1,159 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_performance_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+TEST(EventPerformanceCountersTest, CountersAreZeroAfterConstruction)
+{
+    // Given newly constructed producer and consumer counters
+    EventPerformanceCounters unit{};
+    ReferencePerformanceCounters reference_counters{};
+
+    // When adding them to a snapshot
+    EventPerformanceCounters::Snapshot snapshot{};
+    unit.AddTo(snapshot);
+    reference_counters.AddTo(snapshot);
+
+    // Then all counters are zero
+    EXPECT_EQ(snapshot.allocations, 0U);
+    EXPECT_EQ(snapshot.allocation_failures, 0U);
+    EXPECT_EQ(snapshot.allocation_retries, 0U);
+    EXPECT_EQ(snapshot.references, 0U);
+    EXPECT_EQ(snapshot.reference_failures, 0U);
+    EXPECT_EQ(snapshot.reference_retries, 0U);
+    EXPECT_EQ(snapshot.outstanding_references, 0U);
+    EXPECT_EQ(snapshot.notifications, 0U);
+}
+
+TEST(EventPerformanceCountersTest, ProducerSideOperationsAreCounted)
+{
+    // Given counters
+    EventPerformanceCounters unit{};
+
+    // When recording two allocations, a failed allocation and a notification
+    unit.RecordAllocation(0U);
+    unit.RecordAllocation(2U);
+    unit.RecordAllocationFailure(5U);
+    unit.RecordNotification();
+
+    // Then they are reflected in the snapshot, including the retries of all allocation attempts
+    EventPerformanceCounters::Snapshot snapshot{};
+    unit.AddTo(snapshot);
+    EXPECT_EQ(snapshot.allocations, 2U);
+    EXPECT_EQ(snapshot.allocation_failures, 1U);
+    EXPECT_EQ(snapshot.allocation_retries, 7U);
+    EXPECT_EQ(snapshot.notifications, 1U);
+}
+
+TEST(EventPerformanceCountersTest, ResetSetsProducerSideCountersToZero)
+{
+    // Given counters with recorded operations
+    EventPerformanceCounters unit{};
+    unit.RecordAllocation(1U);
+    unit.RecordAllocationFailure(1U);
+    unit.RecordNotification();
+
+    // When resetting the counters
+    unit.Reset();
+
+    // Then all counters are zero
+    EventPerformanceCounters::Snapshot snapshot{};
+    unit.AddTo(snapshot);
+    EXPECT_EQ(snapshot.allocations, 0U);
+    EXPECT_EQ(snapshot.allocation_failures, 0U);
+    EXPECT_EQ(snapshot.allocation_retries, 0U);
+    EXPECT_EQ(snapshot.notifications, 0U);
+}
+
+TEST(ReferencePerformanceCountersTest, ConsumerSideOperationsAreCounted)
+{
+    // Given counters
+    ReferencePerformanceCounters unit{};
+
+    // When recording two references and a failed reference
+    unit.RecordReference(1U);
+    unit.RecordReference(0U);
+    unit.RecordReferenceFailure(3U);
+
+    // Then they are reflected in the snapshot, including the retries of all reference attempts
+    EventPerformanceCounters::Snapshot snapshot{};
+    unit.AddTo(snapshot);
+    EXPECT_EQ(snapshot.references, 2U);
+    EXPECT_EQ(snapshot.reference_failures, 1U);
+    EXPECT_EQ(snapshot.reference_retries, 4U);
+}
+
+TEST(ReferencePerformanceCountersTest, CountersOfSeveralConsumersAreSummedUp)
+{
+    // Given the counters of two consumers, which each recorded references
+    ReferencePerformanceCounters first{};
+    ReferencePerformanceCounters second{};
+    first.RecordReference(1U);
+    second.RecordReference(0U);
+    second.RecordReference(2U);
+
+    // When adding both to a snapshot
+    EventPerformanceCounters::Snapshot snapshot{};
+    first.AddTo(snapshot);
+    second.AddTo(snapshot);
+
+    // Then the snapshot contains the sum of both
+    EXPECT_EQ(snapshot.references, 3U);
+    EXPECT_EQ(snapshot.reference_retries, 3U);
+}
+
+TEST(ReferencePerformanceCountersTest, CopyContainsCounterValues)
+{
+    // Given counters with a recorded reference
+    ReferencePerformanceCounters unit{};
+    unit.RecordReference(2U);
+
+    // When copying them
+    const ReferencePerformanceCounters copy{unit};
+
+    // Then the copy contains the same values
+    EventPerformanceCounters::Snapshot snapshot{};
+    copy.AddTo(snapshot);
+    EXPECT_EQ(snapshot.references, 1U);
+    EXPECT_EQ(snapshot.reference_retries, 2U);
+}
+
+TEST(ReferencePerformanceCountersTest, ResetSetsConsumerSideCountersToZero)
+{
+    // Given counters with recorded operations
+    ReferencePerformanceCounters unit{};
+    unit.RecordReference(1U);
+    unit.RecordReferenceFailure(2U);
+
+    // When resetting the counters
+    unit.Reset();
+
+    // Then all counters are zero
+    EventPerformanceCounters::Snapshot snapshot{};
+    unit.AddTo(snapshot);
+    EXPECT_EQ(snapshot.references, 0U);
+    EXPECT_EQ(snapshot.reference_failures, 0U);
+    EXPECT_EQ(snapshot.reference_retries, 0U);
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
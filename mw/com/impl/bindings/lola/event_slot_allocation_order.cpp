@@ -0,0 +1,162 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_allocation_order.h"
+
+namespace bmw::mw::com::impl::lola
+{
+
+EventSlotAllocationOrder::EventSlotAllocationOrder(const SlotIndexType max_slots,
+                                                   const memory::shared::MemoryResourceProxy* const proxy) noexcept
+    : newer_{max_slots, proxy},
+      older_{max_slots, proxy},
+      time_stamps_{max_slots, proxy},
+      oldest_{kNoSlot},
+      newest_{kNoSlot},
+      locked_{false},
+      stale_{false}
+{
+    for (SlotIndexType slot_index = 0U; slot_index < max_slots; ++slot_index)
+    {
+        time_stamps_[slot_index] = 0U;
+        older_[slot_index] = kNoSlot;
+        newer_[slot_index] = kNoSlot;
+        InsertAfter(newest_, slot_index);
+    }
+}
+
+bool EventSlotAllocationOrder::TryLock() noexcept
+{
+    return !locked_.exchange(true, std::memory_order_acquire);
+}
+
+void EventSlotAllocationOrder::Unlock() noexcept
+{
+    locked_.store(false, std::memory_order_release);
+}
+
+bool EventSlotAllocationOrder::IsStale() const noexcept
+{
+    return stale_.load(std::memory_order_acquire);
+}
+
+void EventSlotAllocationOrder::MarkStale() noexcept
+{
+    stale_.store(true, std::memory_order_release);
+}
+
+auto EventSlotAllocationOrder::GetOldest() const noexcept -> SlotIndexType
+{
+    return oldest_;
+}
+
+auto EventSlotAllocationOrder::GetNewer(const SlotIndexType slot_index) const noexcept -> SlotIndexType
+{
+    return newer_[slot_index];
+}
+
+EventSlotStatus::EventTimeStamp EventSlotAllocationOrder::GetTimeStamp(const SlotIndexType slot_index) const noexcept
+{
+    return time_stamps_[slot_index];
+}
+
+void EventSlotAllocationOrder::Update(const SlotIndexType slot_index,
+                                      const EventSlotStatus::EventTimeStamp time_stamp) noexcept
+{
+    if (IsLinked(slot_index))
+    {
+        Unlink(slot_index);
+    }
+    time_stamps_[slot_index] = time_stamp;
+
+    // kNoSlot as predecessor inserts at the front
+    SlotIndexType predecessor{kNoSlot};
+    if (time_stamp != static_cast<EventSlotStatus::EventTimeStamp>(0))
+    {
+        predecessor = newest_;
+        while ((predecessor != kNoSlot) && (time_stamps_[predecessor] > time_stamp))
+        {
+            predecessor = older_[predecessor];
+        }
+    }
+    InsertAfter(predecessor, slot_index);
+}
+
+void EventSlotAllocationOrder::Clear() noexcept
+{
+    // reset the flag first, so that an update, which is skipped while the order is rebuilt, is not lost.
+    stale_.store(false, std::memory_order_release);
+
+    for (SlotIndexType slot_index = 0U; slot_index < static_cast<SlotIndexType>(time_stamps_.size()); ++slot_index)
+    {
+        newer_[slot_index] = kNoSlot;
+        older_[slot_index] = kNoSlot;
+    }
+    oldest_ = kNoSlot;
+    newest_ = kNoSlot;
+}
+
+bool EventSlotAllocationOrder::IsLinked(const SlotIndexType slot_index) const noexcept
+{
+    return (oldest_ == slot_index) || (older_[slot_index] != kNoSlot);
+}
+
+void EventSlotAllocationOrder::Unlink(const SlotIndexType slot_index) noexcept
+{
+    const auto older = older_[slot_index];
+    const auto newer = newer_[slot_index];
+    if (older != kNoSlot)
+    {
+        newer_[older] = newer;
+    }
+    else
+    {
+        oldest_ = newer;
+    }
+    if (newer != kNoSlot)
+    {
+        older_[newer] = older;
+    }
+    else
+    {
+        newest_ = older;
+    }
+    older_[slot_index] = kNoSlot;
+    newer_[slot_index] = kNoSlot;
+}
+
+void EventSlotAllocationOrder::InsertAfter(const SlotIndexType predecessor, const SlotIndexType slot_index) noexcept
+{
+    const auto successor = (predecessor == kNoSlot) ? oldest_ : newer_[predecessor];
+    older_[slot_index] = predecessor;
+    newer_[slot_index] = successor;
+    if (predecessor != kNoSlot)
+    {
+        newer_[predecessor] = slot_index;
+    }
+    else
+    {
+        oldest_ = slot_index;
+    }
+    if (successor != kNoSlot)
+    {
+        older_[successor] = slot_index;
+    }
+    else
+    {
+        newest_ = slot_index;
+    }
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,123 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_SLOT_ALLOCATION_ORDER_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_SLOT_ALLOCATION_ORDER_H
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_status.h"
+
+#include "platform/aas/lib/containers/dynamic_array.h"
+#include "platform/aas/lib/memory/shared/memory_resource_proxy.h"
+#include "platform/aas/lib/memory/shared/polymorphic_offset_ptr_allocator.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Producer side hint, which keeps the slots of an event ordered by the time stamp they have been written with
+///        the last time (oldest first). It is stored in shared memory next to the slot status array of an
+///        EventDataControl.
+///
+/// \details The order is kept as a doubly linked list over the slot indices, so that a slot which has been sent or
+/// discarded can be moved to its new position in O(1) in the common case. The oldest unused slot is then the first
+/// slot in the order, which is not referenced or in writing - in contrast to a full scan of the slot array, which
+/// needs to look at every slot on every allocation.
+///
+/// The order is only accessed from the producer side. Since EventDataControl::AllocateNextSlot() may be called from
+/// multiple threads, every access needs to be guarded via TryLock()/Unlock(). A caller which fails to acquire the lock
+/// never waits, but falls back to the full scan. If an update of the order had to be skipped because of that, the order
+/// is marked as stale and has to be rebuilt by the next caller, which acquires the lock.
+class EventSlotAllocationOrder final
+{
+  public:
+    using SlotIndexType = std::uint16_t;
+
+    /// \brief Sentinel returned by GetOldest()/GetNewer() if there is no (further) slot in the order.
+    static constexpr SlotIndexType kNoSlot{std::numeric_limits<SlotIndexType>::max()};
+
+    /// \brief Number of bytes, which are allocated per slot from the memory resource.
+    static constexpr std::size_t kStorageSizePerSlot{(2U * sizeof(SlotIndexType)) +
+                                                     sizeof(EventSlotStatus::EventTimeStamp)};
+
+    /// \brief Number of containers (newer_, older_ and time_stamps_), which allocate from the memory resource.
+    static constexpr std::size_t kNumberOfContainers{3U};
+
+    /// \brief Creates the order for max_slots slots, which are all treated as never written (i.e. ordered by index).
+    EventSlotAllocationOrder(const SlotIndexType max_slots,
+                             const memory::shared::MemoryResourceProxy* const proxy) noexcept;
+    ~EventSlotAllocationOrder() noexcept = default;
+
+    EventSlotAllocationOrder(const EventSlotAllocationOrder&) = delete;
+    EventSlotAllocationOrder& operator=(const EventSlotAllocationOrder&) = delete;
+    EventSlotAllocationOrder(EventSlotAllocationOrder&&) noexcept = delete;
+    EventSlotAllocationOrder& operator=(EventSlotAllocationOrder&& other) noexcept = delete;
+
+    /// \brief Tries to acquire exclusive access to the order (wait-free).
+    /// \return true if the lock could be acquired, false otherwise.
+    bool TryLock() noexcept;
+    void Unlock() noexcept;
+
+    bool IsStale() const noexcept;
+    void MarkStale() noexcept;
+
+    /// \brief Returns the slot, which has been written the longest time ago.
+    /// \pre Lock acquired.
+    SlotIndexType GetOldest() const noexcept;
+
+    /// \brief Returns the slot, which has been written next after the given one or kNoSlot if there is none.
+    /// \pre Lock acquired.
+    SlotIndexType GetNewer(const SlotIndexType slot_index) const noexcept;
+
+    /// \brief Returns the time stamp, the given slot has been written with the last time (0 if never written).
+    /// \pre Lock acquired.
+    EventSlotStatus::EventTimeStamp GetTimeStamp(const SlotIndexType slot_index) const noexcept;
+
+    /// \brief Moves the given slot to the position, which corresponds to time_stamp.
+    ///
+    /// \details A time stamp of 0 (slot invalid) moves the slot to the front. Otherwise, the new position is searched
+    /// starting from the newest slot, so updating a slot with the newest time stamp (EventReady()) is O(1).
+    /// \pre Lock acquired.
+    void Update(const SlotIndexType slot_index, const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
+
+    /// \brief Removes all slots from the order and resets the stale flag. The last time stamps of the slots are kept.
+    ///        Has to be followed by calls to Update() for every slot.
+    /// \pre Lock acquired.
+    void Clear() noexcept;
+
+  private:
+    using SlotIndices =
+        bmw::containers::DynamicArray<SlotIndexType, memory::shared::PolymorphicOffsetPtrAllocator<SlotIndexType>>;
+    using TimeStamps =
+        bmw::containers::DynamicArray<EventSlotStatus::EventTimeStamp,
+                                      memory::shared::PolymorphicOffsetPtrAllocator<EventSlotStatus::EventTimeStamp>>;
+
+    bool IsLinked(const SlotIndexType slot_index) const noexcept;
+    void Unlink(const SlotIndexType slot_index) noexcept;
+    void InsertAfter(const SlotIndexType predecessor, const SlotIndexType slot_index) noexcept;
+
+    SlotIndices newer_;
+    SlotIndices older_;
+    TimeStamps time_stamps_;
+    SlotIndexType oldest_;
+    SlotIndexType newest_;
+    std::atomic<bool> locked_;
+    std::atomic<bool> stale_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_SLOT_ALLOCATION_ORDER_H
@@ -0,0 +1,132 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_allocation_order.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using SlotIndexType = EventSlotAllocationOrder::SlotIndexType;
+
+class EventSlotAllocationOrderFixture : public ::testing::Test
+{
+  protected:
+    std::vector<SlotIndexType> GetOrder(const EventSlotAllocationOrder& unit) const
+    {
+        std::vector<SlotIndexType> order{};
+        for (auto slot_index = unit.GetOldest(); slot_index != EventSlotAllocationOrder::kNoSlot;
+             slot_index = unit.GetNewer(slot_index))
+        {
+            order.push_back(slot_index);
+        }
+        return order;
+    }
+
+    FakeMemoryResource memory_{};
+};
+
+TEST_F(EventSlotAllocationOrderFixture, NewOrderIsSortedByIndex)
+{
+    // Given a newly constructed order with 4 slots
+    EventSlotAllocationOrder unit{4U, memory_.getMemoryResourceProxy()};
+
+    // Then all slots are ordered by their index
+    EXPECT_EQ(GetOrder(unit), (std::vector<SlotIndexType>{0U, 1U, 2U, 3U}));
+}
+
+TEST_F(EventSlotAllocationOrderFixture, UpdatedSlotWithNewestTimeStampBecomesNewest)
+{
+    // Given an order with 4 slots
+    EventSlotAllocationOrder unit{4U, memory_.getMemoryResourceProxy()};
+
+    // When updating slots with increasing time stamps
+    unit.Update(0U, 1U);
+    unit.Update(1U, 2U);
+    unit.Update(0U, 3U);
+
+    // Then never written slots are the oldest and the updated ones are sorted by their time stamp
+    EXPECT_EQ(GetOrder(unit), (std::vector<SlotIndexType>{2U, 3U, 1U, 0U}));
+    EXPECT_EQ(unit.GetTimeStamp(0U), 3U);
+}
+
+TEST_F(EventSlotAllocationOrderFixture, UpdatedSlotWithOlderTimeStampIsSortedIn)
+{
+    // Given an order with 3 written slots
+    EventSlotAllocationOrder unit{3U, memory_.getMemoryResourceProxy()};
+    unit.Update(0U, 1U);
+    unit.Update(1U, 5U);
+    unit.Update(2U, 7U);
+
+    // When updating a slot with a time stamp, which is not the newest one
+    unit.Update(0U, 6U);
+
+    // Then it is placed according to its time stamp
+    EXPECT_EQ(GetOrder(unit), (std::vector<SlotIndexType>{1U, 0U, 2U}));
+}
+
+TEST_F(EventSlotAllocationOrderFixture, UpdatedSlotWithZeroTimeStampBecomesOldest)
+{
+    // Given an order with 3 written slots
+    EventSlotAllocationOrder unit{3U, memory_.getMemoryResourceProxy()};
+    unit.Update(0U, 1U);
+    unit.Update(1U, 2U);
+    unit.Update(2U, 3U);
+
+    // When updating the newest slot with time stamp 0 (i.e. it was discarded)
+    unit.Update(2U, 0U);
+
+    // Then it becomes the oldest one
+    EXPECT_EQ(GetOrder(unit), (std::vector<SlotIndexType>{2U, 0U, 1U}));
+}
+
+TEST_F(EventSlotAllocationOrderFixture, ClearKeepsTimeStampsAndResetsStaleFlag)
+{
+    // Given a stale order with a written slot
+    EventSlotAllocationOrder unit{2U, memory_.getMemoryResourceProxy()};
+    unit.Update(1U, 42U);
+    unit.MarkStale();
+
+    // When clearing it
+    unit.Clear();
+
+    // Then the order is empty and not stale anymore, but the time stamps are kept
+    EXPECT_EQ(unit.GetOldest(), EventSlotAllocationOrder::kNoSlot);
+    EXPECT_FALSE(unit.IsStale());
+    EXPECT_EQ(unit.GetTimeStamp(1U), 42U);
+}
+
+TEST_F(EventSlotAllocationOrderFixture, LockCanOnlyBeAcquiredOnce)
+{
+    // Given an order
+    EventSlotAllocationOrder unit{2U, memory_.getMemoryResourceProxy()};
+
+    // When acquiring the lock
+    ASSERT_TRUE(unit.TryLock());
+
+    // Then it cannot be acquired again until it is released
+    EXPECT_FALSE(unit.TryLock());
+    unit.Unlock();
+    EXPECT_TRUE(unit.TryLock());
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,129 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_listener.h"
+
+#include "platform/aas/lib/os/unistd.h"
+#include "platform/aas/mw/log/logging.h"
+
+#include <amp_utility.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+#if defined(__QNXNTO__)
+#include <sys/neutrino.h>
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace bmw::mw::com::impl::lola
+{
+
+namespace
+{
+
+void ApplyThreadPriority(const std::int32_t priority) noexcept
+{
+    sched_param parameters{};
+    parameters.sched_priority = priority;
+    const auto result = ::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &parameters);
+    if (result != 0)
+    {
+        bmw::mw::log::LogWarn("lola") << "Could not set priority" << priority
+                                      << "of receive handler thread:" << std::strerror(result);
+    }
+}
+
+void ApplyThreadCpuAffinity(const std::uint64_t cpu_affinity) noexcept
+{
+#if defined(__QNXNTO__)
+    // The runmask passed directly to ThreadCtl() only covers the first 32 CPUs.
+    const auto runmask = static_cast<std::uintptr_t>(cpu_affinity);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): ThreadCtl() takes the runmask as pointer argument
+    const auto result = ::ThreadCtl(_NTO_TCTL_RUNMASK, reinterpret_cast<void*>(runmask));
+    const auto error = (result == -1) ? errno : 0;
+#else
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (std::uint32_t cpu{0U}; cpu < 64U; ++cpu)
+    {
+        if ((cpu_affinity & (std::uint64_t{1U} << cpu)) != 0U)
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    const auto error = ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+#endif
+    if (error != 0)
+    {
+        bmw::mw::log::LogWarn("lola") << "Could not set CPU affinity" << cpu_affinity
+                                      << "of receive handler thread:" << std::strerror(error);
+    }
+}
+
+}  // namespace
+
+EventUpdateListener::EventUpdateListener(EventUpdateNotifier& update_notifier,
+                                         BindingEventReceiveHandler handler,
+                                         const ReceiveHandlerThreadAttributes& thread_attributes) noexcept
+    : update_notifier_{update_notifier},
+      listener_{update_notifier, os::Unistd::instance().getpid()},
+      handler_{std::move(handler)},
+      thread_attributes_{thread_attributes},
+      stop_requested_{false},
+      thread_pool_{1U, "mw::com EventUpdateListener"}
+{
+    thread_pool_.Post([this](const amp::stop_token& token) noexcept { Run(token); });
+}
+
+EventUpdateListener::~EventUpdateListener() noexcept
+{
+    stop_requested_.store(true);
+    // In case the reception thread entered its wait right before the flag was set, it will leave it latest after
+    // kMaxWaitTime. Listeners of other processes on the same event are not woken up.
+    listener_.Wake();
+}
+
+void EventUpdateListener::Run(const amp::stop_token& token) noexcept
+{
+    // The thread pool doesn't support thread attributes, so the thread applies them to itself.
+    if (thread_attributes_.priority.has_value())
+    {
+        ApplyThreadPriority(thread_attributes_.priority.value());
+    }
+    if (thread_attributes_.cpu_affinity.has_value())
+    {
+        ApplyThreadCpuAffinity(thread_attributes_.cpu_affinity.value());
+    }
+
+    // Only updates after the registration of the handler are of interest.
+    auto last_seen = update_notifier_.GetUpdateCounter();
+    while ((!stop_requested_.load()) && (!token.stop_requested()))
+    {
+        if (listener_.WaitForUpdate(last_seen, kMaxWaitTime))
+        {
+            // read the counter before calling the handler, so that updates during the handler call are not lost.
+            last_seen = update_notifier_.GetUpdateCounter();
+            if (!stop_requested_.load())
+            {
+                amp::ignore = handler_();
+            }
+        }
+    }
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,74 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_LISTENER_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_LISTENER_H
+
+#include "platform/aas/mw/com/impl/binding_event_receive_handler.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_notifier.h"
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
+
+#include "platform/aas/lib/concurrency/thread_pool.h"
+
+#include <amp_stop_token.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Proxy side reception thread for EventNotificationMode::kSharedMemory.
+///
+/// \details Waits on the EventUpdateNotifier of an event in shared memory and calls the registered receive handler
+/// each time the provider signalled at least one new sample. Several updates, which happen while the handler is
+/// running, result in one further handler call, as it is the case for notifications received via message passing.
+class EventUpdateListener final
+{
+  public:
+    /// \brief Upper bound for a single wait, after which the stop condition is re-checked.
+    static constexpr std::chrono::milliseconds kMaxWaitTime{100};
+
+    /// \brief Starts the reception thread.
+    /// \param thread_attributes Scheduling attributes, which the reception thread applies to itself before it starts
+    ///        waiting. An attribute, which can't be applied, is logged and the thread continues without it.
+    EventUpdateListener(EventUpdateNotifier& update_notifier,
+                        BindingEventReceiveHandler handler,
+                        const ReceiveHandlerThreadAttributes& thread_attributes = {}) noexcept;
+
+    /// \brief Stops and joins the reception thread.
+    /// \pre Must not be called from within the registered handler.
+    ~EventUpdateListener() noexcept;
+
+    EventUpdateListener(const EventUpdateListener&) = delete;
+    EventUpdateListener& operator=(const EventUpdateListener&) = delete;
+    EventUpdateListener(EventUpdateListener&&) noexcept = delete;
+    EventUpdateListener& operator=(EventUpdateListener&& other) noexcept = delete;
+
+  private:
+    void Run(const amp::stop_token& token) noexcept;
+
+    EventUpdateNotifier& update_notifier_;
+    EventUpdateNotifier::Listener listener_;
+    BindingEventReceiveHandler handler_;
+    ReceiveHandlerThreadAttributes thread_attributes_;
+    std::atomic<bool> stop_requested_;
+
+    // declared last, so that the reception thread is joined before the members it uses are destroyed.
+    concurrency::ThreadPool thread_pool_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_LISTENER_H
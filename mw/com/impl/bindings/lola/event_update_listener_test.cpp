@@ -0,0 +1,86 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_listener.h"
+
+#include "platform/aas/language/safecpp/scoped_function/scope.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+class EventUpdateListenerFixture : public ::testing::Test
+{
+  protected:
+    BindingEventReceiveHandler CreateHandler(std::promise<void>& handler_called)
+    {
+        return BindingEventReceiveHandler(scope_, [&handler_called]() noexcept { handler_called.set_value(); });
+    }
+
+    EventUpdateNotifier notifier_{};
+    safecpp::Scope<> scope_{};
+};
+
+TEST_F(EventUpdateListenerFixture, HandlerIsCalledWhenProducerNotifies)
+{
+    // Given a listener on a notifier
+    std::promise<void> handler_called{};
+    EventUpdateListener unit{notifier_, CreateHandler(handler_called)};
+
+    // When the producer notifies an update
+    notifier_.Notify();
+
+    // Then the handler is called
+    EXPECT_EQ(handler_called.get_future().wait_for(1min), std::future_status::ready);
+}
+
+TEST_F(EventUpdateListenerFixture, HandlerIsNotCalledWithoutNotification)
+{
+    // Given a listener on a notifier
+    ::testing::StrictMock<::testing::MockFunction<void()>> handler{};
+    EventUpdateListener unit{notifier_, BindingEventReceiveHandler(scope_, handler.AsStdFunction())};
+
+    // When waiting longer than a single wait of the reception thread without any notification
+    std::this_thread::sleep_for(2 * EventUpdateListener::kMaxWaitTime);
+
+    // Then the handler is never called (checked by the StrictMock)
+}
+
+TEST_F(EventUpdateListenerFixture, DestructionStopsReceptionThread)
+{
+    // Given a listener on a notifier
+    ::testing::StrictMock<::testing::MockFunction<void()>> handler{};
+    auto unit = std::make_unique<EventUpdateListener>(notifier_,
+                                                      BindingEventReceiveHandler(scope_, handler.AsStdFunction()));
+
+    // When destroying the listener
+    unit.reset();
+
+    // Then a later update does not call the handler anymore (checked by the StrictMock)
+    notifier_.Notify();
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
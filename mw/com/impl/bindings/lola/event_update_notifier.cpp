@@ -0,0 +1,242 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_notifier.h"
+
+#include <signal.h>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <ctime>
+#include <limits>
+#else
+#include <thread>
+#endif
+
+namespace bmw::mw::com::impl::lola
+{
+
+// the futex system call operates on a naturally aligned 32 bit word, which is directly modified by the atomic.
+static_assert(sizeof(std::atomic<EventUpdateNotifier::CounterType>) == sizeof(EventUpdateNotifier::CounterType),
+              "Counter must be usable as futex word");
+static_assert(std::atomic<EventUpdateNotifier::CounterType>::is_always_lock_free, "Counter must be lock-free");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Slot owner must be lock-free");
+
+namespace
+{
+
+using ListenerMask = std::uint32_t;
+
+constexpr ListenerMask kAllListeners{std::numeric_limits<ListenerMask>::max()};
+constexpr std::uint64_t kFreeSlot{0U};
+constexpr std::uint32_t kPidShift{32U};
+
+ListenerMask GetListenerBit(const amp::optional<std::size_t>& slot) noexcept
+{
+    return slot.has_value() ? (ListenerMask{1U} << slot.value()) : kAllListeners;
+}
+
+/// \brief Distinguishes this process from an earlier process with the same pid.
+std::uint32_t GetIncarnation() noexcept
+{
+    static const auto incarnation =
+        static_cast<std::uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return incarnation;
+}
+
+std::uint64_t CreateOwner(const pid_t pid) noexcept
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(pid)) << kPidShift) | GetIncarnation();
+}
+
+pid_t GetPid(const std::uint64_t owner) noexcept
+{
+    return static_cast<pid_t>(owner >> kPidShift);
+}
+
+bool IsStaleOwner(const std::uint64_t owner, const std::uint64_t registering_owner) noexcept
+{
+    if (GetPid(owner) == GetPid(registering_owner))
+    {
+        // Same process, if the incarnation matches. Otherwise the registering process got the pid of a dead one.
+        return owner != CreateOwner(GetPid(registering_owner));
+    }
+    // EPERM means, that the process exists, but belongs to another user.
+    return (::kill(GetPid(owner), 0) != 0) && (errno == ESRCH);
+}
+
+#if defined(__linux__)
+// No FUTEX_PRIVATE_FLAG, since the counter is shared between processes.
+void FutexWait(std::atomic<EventUpdateNotifier::CounterType>& word,
+               const EventUpdateNotifier::CounterType expected,
+               const std::chrono::milliseconds timeout,
+               const ListenerMask bitset) noexcept
+{
+    // FUTEX_WAIT_BITSET takes an absolute timeout based on CLOCK_MONOTONIC.
+    timespec deadline{};
+    static_cast<void>(::clock_gettime(CLOCK_MONOTONIC, &deadline));
+    constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+    const auto timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+    const auto deadline_ns = static_cast<std::int64_t>(deadline.tv_nsec) + (timeout_ns % kNanosecondsPerSecond);
+    deadline.tv_sec +=
+        static_cast<std::time_t>((timeout_ns / kNanosecondsPerSecond) + (deadline_ns / kNanosecondsPerSecond));
+    deadline.tv_nsec = static_cast<long>(deadline_ns % kNanosecondsPerSecond);
+    // EINTR, EAGAIN (value already changed) and ETIMEDOUT are all handled by the caller re-checking the counter.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): system call interface
+    static_cast<void>(::syscall(SYS_futex, &word, FUTEX_WAIT_BITSET, expected, &deadline, nullptr, bitset));
+}
+
+void FutexWake(std::atomic<EventUpdateNotifier::CounterType>& word, const ListenerMask bitset) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): system call interface
+    static_cast<void>(::syscall(
+        SYS_futex, &word, FUTEX_WAKE_BITSET, std::numeric_limits<std::int32_t>::max(), nullptr, nullptr, bitset));
+}
+#else
+// Without futex support, waiters poll the counter in short intervals.
+constexpr std::chrono::milliseconds kPollInterval{1};
+
+void FutexWait(std::atomic<EventUpdateNotifier::CounterType>& word,
+               const EventUpdateNotifier::CounterType expected,
+               const std::chrono::milliseconds timeout,
+               const ListenerMask) noexcept
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while ((word.load() == expected) && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(kPollInterval);
+    }
+}
+
+void FutexWake(std::atomic<EventUpdateNotifier::CounterType>&, const ListenerMask) noexcept {}
+#endif
+
+}  // namespace
+
+EventUpdateNotifier::Listener::Listener(EventUpdateNotifier& notifier, const pid_t pid) noexcept
+    : notifier_{notifier}, owner_{CreateOwner(pid)}, slot_{}
+{
+    notifier_.ReclaimStaleSlots(owner_);
+    slot_ = notifier_.ClaimSlot(owner_);
+}
+
+EventUpdateNotifier::Listener::~Listener() noexcept
+{
+    if (slot_.has_value())
+    {
+        notifier_.ReleaseSlot(slot_.value(), owner_);
+    }
+}
+
+bool EventUpdateNotifier::Listener::WaitForUpdate(const CounterType last_seen,
+                                                  const std::chrono::milliseconds timeout) noexcept
+{
+    // The registration and the check of the counter are sequentially consistent: Either the waiter sees the
+    // incremented counter before it blocks or the producer sees the waiter and wakes it up.
+    const auto bit = GetListenerBit(slot_);
+    if (slot_.has_value())
+    {
+        notifier_.waiting_listeners_.fetch_or(bit);
+    }
+    else
+    {
+        notifier_.waiters_without_slot_.fetch_add(1U);
+    }
+
+    if (notifier_.update_counter_.load() == last_seen)
+    {
+        FutexWait(notifier_.update_counter_, last_seen, timeout, bit);
+    }
+
+    if (slot_.has_value())
+    {
+        notifier_.waiting_listeners_.fetch_and(static_cast<ListenerMask>(~bit));
+    }
+    else
+    {
+        notifier_.waiters_without_slot_.fetch_sub(1U);
+    }
+    return notifier_.update_counter_.load(std::memory_order_acquire) != last_seen;
+}
+
+void EventUpdateNotifier::Listener::Wake() noexcept
+{
+    FutexWake(notifier_.update_counter_, GetListenerBit(slot_));
+}
+
+EventUpdateNotifier::EventUpdateNotifier() noexcept
+    : update_counter_{0U}, waiting_listeners_{0U}, waiters_without_slot_{0U}, listener_owners_{}
+{
+    for (auto& owner : listener_owners_)
+    {
+        owner.store(kFreeSlot, std::memory_order_relaxed);
+    }
+}
+
+void EventUpdateNotifier::Notify() noexcept
+{
+    // Both accesses are sequentially consistent, see Listener::WaitForUpdate().
+    update_counter_.fetch_add(1U);
+    if ((waiting_listeners_.load() != 0U) || (waiters_without_slot_.load() != 0U))
+    {
+        FutexWake(update_counter_, kAllListeners);
+    }
+}
+
+EventUpdateNotifier::CounterType EventUpdateNotifier::GetUpdateCounter() const noexcept
+{
+    return update_counter_.load(std::memory_order_acquire);
+}
+
+amp::optional<std::size_t> EventUpdateNotifier::ClaimSlot(const std::uint64_t owner) noexcept
+{
+    for (std::size_t slot{0U}; slot < listener_owners_.size(); ++slot)
+    {
+        auto expected_owner = kFreeSlot;
+        if (listener_owners_[slot].compare_exchange_strong(expected_owner, owner))
+        {
+            return slot;
+        }
+    }
+    return {};
+}
+
+void EventUpdateNotifier::ReclaimStaleSlots(const std::uint64_t owner) noexcept
+{
+    for (std::size_t slot{0U}; slot < listener_owners_.size(); ++slot)
+    {
+        auto current_owner = listener_owners_[slot].load();
+        // The slot is taken over before its bit is cleared, so that the bit of a Listener, which claims the slot in
+        // between, can't be cleared.
+        if ((current_owner != kFreeSlot) && IsStaleOwner(current_owner, owner) &&
+            listener_owners_[slot].compare_exchange_strong(current_owner, owner))
+        {
+            waiting_listeners_.fetch_and(static_cast<ListenerMask>(~GetListenerBit(slot)));
+            listener_owners_[slot].store(kFreeSlot);
+        }
+    }
+}
+
+void EventUpdateNotifier::ReleaseSlot(const std::size_t slot, const std::uint64_t owner) noexcept
+{
+    // The slot might have been reclaimed by another process, which wrongly considered this one to be dead.
+    auto expected_owner = owner;
+    static_cast<void>(listener_owners_[slot].compare_exchange_strong(expected_owner, kFreeSlot));
+}
+
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,117 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_NOTIFIER_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_NOTIFIER_H
+
+#include <amp_optional.hpp>
+
+#include <sys/types.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Wake-up counter of an event, which is stored in shared memory next to its EventDataControl.
+///
+/// \details The producer increments the counter each time a new sample has been sent. Consumers, which use
+/// EventNotificationMode::kSharedMemory, block on the counter (futex on Linux) instead of waiting for a notification
+/// message from the producer. To keep the producer side cheap, a wake-up system call is only issued if at least one
+/// Listener is waiting.
+///
+/// Each Listener owns one of kMaxListeners slots, which is tagged with the pid and the incarnation of its process.
+/// While waiting, it sets the bit of its slot in a mask, which the producer checks. A Listener, whose process crashed
+/// while waiting, leaves its bit set, so the producer would issue needless wake-up system calls. Such slots and their
+/// bits are reclaimed by the next Listener, which gets registered (e.g. after the consumer restarted): Either the
+/// owning process doesn't exist anymore or it is the registering process itself, which got the same pid again.
+class EventUpdateNotifier final
+{
+  public:
+    using CounterType = std::uint32_t;
+
+    /// \brief Number of slots for Listeners. Each slot corresponds to one bit of the futex wake-up bitset, so that a
+    /// single Listener can be woken up.
+    static constexpr std::size_t kMaxListeners{32U};
+
+    /// \brief Registration of a thread, which waits for updates of a notifier.
+    ///
+    /// \details If all slots are taken, the Listener is tracked by a plain counter. Then it can't be woken up
+    /// individually and a crash while waiting leaves the counter incremented.
+    class Listener final
+    {
+      public:
+        /// \brief Registers a Listener of the process with the given pid.
+        Listener(EventUpdateNotifier& notifier, const pid_t pid) noexcept;
+        ~Listener() noexcept;
+
+        Listener(const Listener&) = delete;
+        Listener& operator=(const Listener&) = delete;
+        Listener(Listener&&) noexcept = delete;
+        Listener& operator=(Listener&& other) noexcept = delete;
+
+        /// \brief Blocks until the counter differs from last_seen, Wake() has been called or timeout expired.
+        /// \return true if the counter differs from last_seen, false otherwise.
+        bool WaitForUpdate(const CounterType last_seen, const std::chrono::milliseconds timeout) noexcept;
+
+        /// \brief Wakes this Listener without signalling a new sample (e.g. to stop a waiting thread). Other Listeners
+        /// are not woken up, as long as this Listener owns a slot.
+        void Wake() noexcept;
+
+        /// \brief Returns the slot of this Listener or an empty optional, if all slots were taken.
+        amp::optional<std::size_t> GetSlot() const noexcept { return slot_; }
+
+      private:
+        EventUpdateNotifier& notifier_;
+        std::uint64_t owner_;
+        amp::optional<std::size_t> slot_;
+    };
+
+    EventUpdateNotifier() noexcept;
+    ~EventUpdateNotifier() noexcept = default;
+
+    EventUpdateNotifier(const EventUpdateNotifier&) = delete;
+    EventUpdateNotifier& operator=(const EventUpdateNotifier&) = delete;
+    EventUpdateNotifier(EventUpdateNotifier&&) noexcept = delete;
+    EventUpdateNotifier& operator=(EventUpdateNotifier&& other) noexcept = delete;
+
+    /// \brief Signals a new sample to all waiting consumers (producer side, thread-safe).
+    void Notify() noexcept;
+
+    /// \brief Returns the current value of the counter, which shall be handed to the next WaitForUpdate() call.
+    CounterType GetUpdateCounter() const noexcept;
+
+  private:
+    using ListenerMask = std::uint32_t;
+    static_assert(sizeof(ListenerMask) * 8U == kMaxListeners, "One bit per Listener slot");
+
+    amp::optional<std::size_t> ClaimSlot(const std::uint64_t owner) noexcept;
+    void ReclaimStaleSlots(const std::uint64_t owner) noexcept;
+    void ReleaseSlot(const std::size_t slot, const std::uint64_t owner) noexcept;
+
+    std::atomic<CounterType> update_counter_;
+    /// \brief Bit i is set while the Listener in slot i is waiting.
+    std::atomic<ListenerMask> waiting_listeners_;
+    /// \brief Number of waiting Listeners without slot.
+    std::atomic<std::uint32_t> waiters_without_slot_;
+    /// \brief pid and incarnation of the process owning the slot or 0, if the slot is free.
+    std::array<std::atomic<std::uint64_t>, kMaxListeners> listener_owners_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_EVENT_UPDATE_NOTIFIER_H
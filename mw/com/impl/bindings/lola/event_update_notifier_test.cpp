@@ -0,0 +1,221 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_notifier.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+// far above any pid assigned in practice (e.g. Linux limits pids to 4194304)
+constexpr pid_t kNonExistingPid{0x7FFFFFF0};
+
+TEST(EventUpdateNotifierTest, NotifyIncrementsCounter)
+{
+    // Given a notifier
+    EventUpdateNotifier unit{};
+    const auto initial_counter = unit.GetUpdateCounter();
+
+    // When notifying twice
+    unit.Notify();
+    unit.Notify();
+
+    // Then the counter was incremented twice
+    EXPECT_EQ(unit.GetUpdateCounter(), initial_counter + 2U);
+}
+
+TEST(EventUpdateNotifierTest, WaitReturnsImmediatelyIfCounterAlreadyChanged)
+{
+    // Given a listener on a notifier, which has been notified after the counter was read
+    EventUpdateNotifier unit{};
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+    const auto last_seen = unit.GetUpdateCounter();
+    unit.Notify();
+
+    // When waiting for an update with a very long timeout
+    const auto start = std::chrono::steady_clock::now();
+    const auto updated = listener.WaitForUpdate(last_seen, 1h);
+
+    // Then an update is reported without blocking
+    EXPECT_TRUE(updated);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1min);
+}
+
+TEST(EventUpdateNotifierTest, WaitReturnsFalseAfterTimeoutWithoutNotification)
+{
+    // Given a listener on a notifier
+    EventUpdateNotifier unit{};
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+
+    // When waiting for an update, which never comes
+    const auto updated = listener.WaitForUpdate(unit.GetUpdateCounter(), 10ms);
+
+    // Then no update is reported
+    EXPECT_FALSE(updated);
+}
+
+TEST(EventUpdateNotifierTest, NotifyWakesUpWaitingThread)
+{
+    // Given a listener on a notifier, which waits for an update
+    EventUpdateNotifier unit{};
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+    const auto last_seen = unit.GetUpdateCounter();
+    auto waiter = std::async(std::launch::async, [&listener, last_seen]() noexcept {
+        return listener.WaitForUpdate(last_seen, 1h);
+    });
+
+    // When notifying
+    unit.Notify();
+
+    // Then the waiting thread reports the update
+    ASSERT_EQ(waiter.wait_for(1min), std::future_status::ready);
+    EXPECT_TRUE(waiter.get());
+}
+
+TEST(EventUpdateNotifierTest, WakeOnlyWakesUpOwnListener)
+{
+    // Given two listeners on a notifier, which both wait for an update
+    EventUpdateNotifier unit{};
+    EventUpdateNotifier::Listener first_listener{unit, ::getpid()};
+    EventUpdateNotifier::Listener second_listener{unit, ::getpid()};
+    const auto last_seen = unit.GetUpdateCounter();
+    auto first_waiter = std::async(std::launch::async, [&first_listener, last_seen]() noexcept {
+        return first_listener.WaitForUpdate(last_seen, 1h);
+    });
+    auto second_waiter = std::async(std::launch::async, [&second_listener, last_seen]() noexcept {
+        return second_listener.WaitForUpdate(last_seen, 1h);
+    });
+    // give both threads the chance to block
+    std::this_thread::sleep_for(50ms);
+
+    // When waking the first listener
+    first_listener.Wake();
+
+    // Then only the first listener returns and it reports no update
+    ASSERT_EQ(first_waiter.wait_for(1min), std::future_status::ready);
+    EXPECT_FALSE(first_waiter.get());
+    EXPECT_EQ(second_waiter.wait_for(50ms), std::future_status::timeout);
+    EXPECT_EQ(unit.GetUpdateCounter(), last_seen);
+
+    // and the second one returns after the next update
+    unit.Notify();
+    ASSERT_EQ(second_waiter.wait_for(1min), std::future_status::ready);
+    EXPECT_TRUE(second_waiter.get());
+}
+
+TEST(EventUpdateNotifierTest, ListenersGetDistinctSlots)
+{
+    // Given a notifier
+    EventUpdateNotifier unit{};
+
+    // When registering two listeners
+    EventUpdateNotifier::Listener first_listener{unit, ::getpid()};
+    EventUpdateNotifier::Listener second_listener{unit, ::getpid()};
+
+    // Then both got a slot of their own
+    ASSERT_TRUE(first_listener.GetSlot().has_value());
+    ASSERT_TRUE(second_listener.GetSlot().has_value());
+    EXPECT_NE(first_listener.GetSlot().value(), second_listener.GetSlot().value());
+}
+
+TEST(EventUpdateNotifierTest, SlotOfDestroyedListenerIsReused)
+{
+    // Given a notifier with a listener, which has been destroyed
+    EventUpdateNotifier unit{};
+    amp::optional<std::size_t> released_slot{};
+    {
+        EventUpdateNotifier::Listener listener{unit, ::getpid()};
+        released_slot = listener.GetSlot();
+    }
+
+    // When registering another listener
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+
+    // Then it gets the released slot
+    ASSERT_TRUE(released_slot.has_value());
+    EXPECT_EQ(listener.GetSlot(), released_slot);
+}
+
+TEST(EventUpdateNotifierTest, SlotOfDeadProcessIsReclaimed)
+{
+    // Given a notifier with a listener of a process, which doesn't exist (anymore)
+    EventUpdateNotifier unit{};
+    auto dead_listener = std::make_unique<EventUpdateNotifier::Listener>(unit, kNonExistingPid);
+    ASSERT_EQ(dead_listener->GetSlot(), amp::optional<std::size_t>{0U});
+
+    // When registering a listener of this process
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+
+    // Then it takes over the slot of the dead process
+    EXPECT_EQ(listener.GetSlot(), amp::optional<std::size_t>{0U});
+
+    // and the late release of the dead listener leaves the slot with its new owner
+    dead_listener.reset();
+    EventUpdateNotifier::Listener other_listener{unit, ::getpid()};
+    EXPECT_EQ(other_listener.GetSlot(), amp::optional<std::size_t>{1U});
+}
+
+TEST(EventUpdateNotifierTest, ListenerWithoutSlotIsWokenUpByNotify)
+{
+    // Given a notifier, whose slots are all taken, and a listener without slot, which waits for an update
+    EventUpdateNotifier unit{};
+    std::vector<std::unique_ptr<EventUpdateNotifier::Listener>> listeners{};
+    for (std::size_t slot{0U}; slot < EventUpdateNotifier::kMaxListeners; ++slot)
+    {
+        listeners.push_back(std::make_unique<EventUpdateNotifier::Listener>(unit, ::getpid()));
+    }
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+    ASSERT_FALSE(listener.GetSlot().has_value());
+    const auto last_seen = unit.GetUpdateCounter();
+    auto waiter = std::async(std::launch::async, [&listener, last_seen]() noexcept {
+        return listener.WaitForUpdate(last_seen, 1h);
+    });
+
+    // When notifying
+    unit.Notify();
+
+    // Then the waiting thread reports the update
+    ASSERT_EQ(waiter.wait_for(1min), std::future_status::ready);
+    EXPECT_TRUE(waiter.get());
+}
+
+TEST(EventUpdateNotifierTest, WakeDoesNotChangeCounter)
+{
+    // Given a listener on a notifier
+    EventUpdateNotifier unit{};
+    EventUpdateNotifier::Listener listener{unit, ::getpid()};
+    const auto last_seen = unit.GetUpdateCounter();
+
+    // When waking the listener
+    listener.Wake();
+
+    // Then no update is signalled
+    EXPECT_EQ(unit.GetUpdateCounter(), last_seen);
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
@@ -32,22 +32,6 @@ namespace impl
 namespace lola
 {
 
-namespace
-{
-
-std::size_t CalculateAlignedSize(const std::size_t type_size, const std::size_t alignment)
-{
-    AMP_ASSERT_PRD_MESSAGE(alignment != 0, "Alignment must be non-zero");
-    const auto remainder = type_size % alignment;
-    if (remainder == 0)
-    {
-        return type_size;
-    }
-    return type_size + alignment - remainder;
-}
-
-}  // namespace
-
 GenericProxyEvent::GenericProxyEvent(Proxy& parent, const ElementFqId element_fq_id, const amp::string_view event_name)
     : GenericProxyEventBinding{}, proxy_event_common_{parent, element_fq_id, event_name}
 {
@@ -152,9 +136,7 @@ Result<std::size_t> GenericProxyEvent::GetNewSamplesImpl(Callback&& receiver, Tr
     auto& event_control = proxy_event_common_.GetEventControl();
     const EventMetaInfo& event_meta_info = proxy_event_common_.GetEventMetaInfo();
 
-    const auto sample_size = event_meta_info.data_type_info_.size_of_;
-    const auto sample_alignment = event_meta_info.data_type_info_.align_of_;
-    const auto aligned_size = CalculateAlignedSize(sample_size, sample_alignment);
+    const auto slot_stride = event_meta_info.slot_layout_.slot_stride;
 
     auto transaction_log_index = proxy_event_common_.GetTransactionLogIndex();
     AMP_PRECONDITION_PRD_MESSAGE(transaction_log_index.has_value(),
@@ -172,7 +154,7 @@ Result<std::size_t> GenericProxyEvent::GetNewSamplesImpl(Callback&& receiver, Tr
            arithmetic is being done on memory which can be treated as an array. */
         const auto event_slots_array = static_cast<const std::uint8_t*>(event_slots_raw_array);
         AMP_PRECONDITION_PRD_MESSAGE(nullptr != event_slots_array, "Null event slot array");
-        const auto object_start_address = &event_slots_array[aligned_size * slot_index];
+        const auto object_start_address = &event_slots_array[slot_stride * slot_index];
         /* NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic) deviation ends here */
 
         const EventSlotStatus event_slot_status{event_control.data_control[*slot]};
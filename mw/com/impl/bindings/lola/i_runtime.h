@@ -17,6 +17,7 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "platform/aas/mw/com/impl/bindings/lola/rollback_data.h"
+#include "platform/aas/mw/com/impl/configuration/event_notification_mode.h"
 #include "platform/aas/mw/com/impl/configuration/shm_size_calc_mode.h"
 #include "platform/aas/mw/com/impl/i_runtime_binding.h"
 
@@ -45,6 +46,9 @@ class IRuntime : public impl::IRuntimeBinding
     /// \brief returns configured mode, how shm-sizes shall be calculated.
     virtual ShmSizeCalculationMode GetShmSizeCalculationMode() const = 0;
 
+    /// \brief returns configured mode, how proxies shall get notified about event updates.
+    virtual EventNotificationMode GetEventNotificationMode() const = 0;
+
     virtual RollbackData& GetRollbackData() noexcept = 0;
 
     /// \brief We need our PID in several locations/frequently. So the runtime shall provide/cache it.
@@ -18,10 +18,12 @@
 #include "platform/aas/mw/com/impl/binding_event_receive_handler.h"
 #include "platform/aas/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "platform/aas/mw/com/impl/configuration/quality_type.h"
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
 
 #include "platform/aas/lib/os/unistd.h"
 
 #include <amp_callback.hpp>
+#include <amp_span.hpp>
 
 #include <cstdint>
 
@@ -60,6 +62,14 @@ class IMessagePassingService
     /// \param event_id
     virtual void NotifyEvent(const QualityType asil_level, const ElementFqId event_id) = 0;
 
+    /// \brief Notification, that all the given _event_ids_ have been updated.
+    /// \details Semantically equivalent to calling NotifyEvent() for each of the _event_ids_, but notifications towards
+    ///          the same remote LoLa process are coalesced into as few messages as possible. This API is used by LoLa
+    ///          skeletons, which collect the notifications of their events during a cycle and flush them at once.
+    /// \param asil_level asil level of the events.
+    /// \param event_ids events, which have been updated. Duplicates are notified only once per target process.
+    virtual void NotifyEvents(const QualityType asil_level, const amp::span<const ElementFqId> event_ids) = 0;
+
     /// \brief Registers a callback for event update notifications for event _event_id_
     /// \details This API is used by LoLa proxy-events in case the user has registered a receive-handler for this event.
     ///          Anytime the skeleton-event side did notify an event update (see NotifyEvent()), the registered callback
@@ -68,11 +78,16 @@ class IMessagePassingService
     /// \param event_id full qualified event id
     /// \param callback handler to be called, when event gets updated
     /// \param target_node_id node_id, where the event provider is located.
+    /// \param dispatch kThreadPool: the callback is called from a worker thread of the message passing service.
+    ///        kInline/kDedicatedThread: the callback is called directly from the thread, which sent (process local
+    ///        provider) or received the notification. In case of kDedicatedThread, the callback is expected to only
+    ///        hand the notification over to the thread of the caller.
     /// \return a registration number, which can be used to un-register the callback again.
     virtual HandlerRegistrationNoType RegisterEventNotification(const QualityType asil_level,
                                                                 const ElementFqId event_id,
                                                                 BindingEventReceiveHandler callback,
-                                                                const pid_t target_node_id) = 0;
+                                                                const pid_t target_node_id,
+                                                                const ReceiveHandlerDispatch dispatch) = 0;
 
     /// \brief Re-registers an event update notification handler for event _event_id_ in case target_node_id is a remote
     ///        pid.
@@ -15,6 +15,7 @@
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/message_passing_facade.h"
 
 #include "platform/aas/lib/os/errno_logging.h"
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_common.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/thread_abstraction.h"
 #include "platform/aas/mw/com/message_passing/receiver_factory.h"
 #include "platform/aas/mw/log/logging.h"
@@ -71,7 +72,9 @@ void bmw::mw::com::impl::lola::MessagePassingFacade::InitializeMessagePassingRec
     const std::string thread_pool_name =
         (asil_level == QualityType::kASIL_QM) ? "mw::com MessageReceiver QM" : "mw::com MessageReceiver ASIL-B";
     receiver.thread_pool_ = std::make_unique<bmw::concurrency::ThreadPool>(hw_conc, thread_pool_name);
-    const bmw::mw::com::message_passing::ReceiverConfig receiver_config{min_num_messages};
+    bmw::mw::com::message_passing::ReceiverConfig receiver_config{min_num_messages};
+    // event update notifications are idempotent: a burst of identical notifications needs to be handled only once.
+    receiver_config.coalesced_short_message_ids = {static_cast<message_passing::MessageId>(MessageType::kNotifyEvent)};
     receiver.receiver_ = message_passing::ReceiverFactory::Create(
         receiverName, *receiver.thread_pool_, allowed_user_ids, receiver_config);
 
@@ -93,13 +96,21 @@ void bmw::mw::com::impl::lola::MessagePassingFacade::NotifyEvent(const QualityTy
     notify_event_handler_.NotifyEvent(asil_level, event_id);
 }
 
+void bmw::mw::com::impl::lola::MessagePassingFacade::NotifyEvents(const QualityType asil_level,
+                                                                  const amp::span<const ElementFqId> event_ids)
+{
+    notify_event_handler_.NotifyEvents(asil_level, event_ids);
+}
+
 bmw::mw::com::impl::lola::IMessagePassingService::HandlerRegistrationNoType
 bmw::mw::com::impl::lola::MessagePassingFacade::RegisterEventNotification(const QualityType asil_level,
                                                                           const ElementFqId event_id,
                                                                           BindingEventReceiveHandler callback,
-                                                                          const pid_t target_node_id)
+                                                                          const pid_t target_node_id,
+                                                                          const ReceiveHandlerDispatch dispatch)
 {
-    return notify_event_handler_.RegisterEventNotification(asil_level, event_id, std::move(callback), target_node_id);
+    return notify_event_handler_.RegisterEventNotification(
+        asil_level, event_id, std::move(callback), target_node_id, dispatch);
 }
 
 void bmw::mw::com::impl::lola::MessagePassingFacade::ReregisterEventNotification(QualityType asil_level,
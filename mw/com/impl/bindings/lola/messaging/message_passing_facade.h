@@ -102,12 +102,16 @@ class MessagePassingFacade final : public IMessagePassingService
     /// \brief Notification, that the given _event_id_ with _asil_level_ has been updated.
     /// \details see IMessagePassingService::NotifyEvent
     void NotifyEvent(const QualityType asil_level, const ElementFqId event_id) override;
+    /// \brief Notification, that all the given _event_ids_ have been updated.
+    /// \details see IMessagePassingService::NotifyEvents
+    void NotifyEvents(const QualityType asil_level, const amp::span<const ElementFqId> event_ids) override;
     /// \brief Registers a callback for event update notifications for event _event_id_
     /// \details see IMessagePassingService::RegisterEventNotification
     HandlerRegistrationNoType RegisterEventNotification(const QualityType asil_level,
                                                         const ElementFqId event_id,
                                                         BindingEventReceiveHandler callback,
-                                                        const pid_t target_node_id) override;
+                                                        const pid_t target_node_id,
+                                                        const ReceiveHandlerDispatch dispatch) override;
 
     /// \brief Re-registers an event update notifications for event _event_id_ in case target_node_id is a remote pid.
     /// \details see IMessagePassingService::ReregisterEventNotification
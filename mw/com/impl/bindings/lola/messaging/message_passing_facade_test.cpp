@@ -238,8 +238,8 @@ TEST_F(MessagePassingFacadeFixture, NotifyOutdatedNodeId)
     unit_.value().NotifyOutdatedNodeId(QualityType::kASIL_QM, outdated_node_id, target_node_id);
 }
 
-// test case tests forwarding of call of RegisterEventNotification() to
-// NotifyEventHandler::RegisterEventNotification().
+// test case tests forwarding of call of RegisterEventNotification(, ReceiveHandlerDispatch::kThreadPool) to
+// NotifyEventHandler::RegisterEventNotification(, ReceiveHandlerDispatch::kThreadPool).
 // Since we do NOT want to introduce a mock for the NotifyEventHandler owned by the MessagePassingFacade, because
 // it would introduce polymorphism and injection APIs in the MessagePassingFacade only for testing this simple call-
 // forwarding for coverage completeness, we just stimulate the simplest possible call and annotate a call expectation
@@ -257,12 +257,15 @@ TEST_F(MessagePassingFacadeFixture, RegisterEventNotification)
     EXPECT_CALL(message_passing_control_mock_, GetNodeIdentifier()).WillOnce(Return(OUR_PID));
 
     // when calling RegisterEventNotification, we will cover call forwarding to NotifyEventHandler
-    unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, std::move(eventUpdateNotificationHandler), OUR_PID);
+    unit_.value().RegisterEventNotification(QualityType::kASIL_QM,
+                                            SOME_ELEMENT_FQ_ID,
+                                            std::move(eventUpdateNotificationHandler),
+                                            OUR_PID,
+                                            ReceiveHandlerDispatch::kThreadPool);
 }
 
 // test case tests forwarding of call of UnregisterEventNotification() to
-// NotifyEventHandler::RegisterEventNotification().
+// NotifyEventHandler::RegisterEventNotification(, ReceiveHandlerDispatch::kThreadPool).
 // Since we do NOT want to introduce a mock for the NotifyEventHandler owned by the MessagePassingFacade, because
 // it would introduce polymorphism and injection APIs in the MessagePassingFacade only for testing this simple call-
 // forwarding for coverage completeness, we just stimulate the simplest possible call and annotate a call expectation
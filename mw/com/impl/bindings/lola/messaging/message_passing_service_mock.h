@@ -34,9 +34,10 @@ class MessagePassingServiceMock : public IMessagePassingService
 {
   public:
     MOCK_METHOD(void, NotifyEvent, (QualityType, ElementFqId), (override));
+    MOCK_METHOD(void, NotifyEvents, (QualityType, amp::span<const ElementFqId>), (override));
     MOCK_METHOD(HandlerRegistrationNoType,
                 RegisterEventNotification,
-                (QualityType, ElementFqId, BindingEventReceiveHandler, pid_t),
+                (QualityType, ElementFqId, BindingEventReceiveHandler, pid_t, ReceiveHandlerDispatch),
                 (override));
     MOCK_METHOD(void, ReregisterEventNotification, (QualityType, ElementFqId, pid_t), (override));
     MOCK_METHOD(void,
@@ -39,6 +39,7 @@ enum class MessageType : message_passing::MessageId
     kUnregisterEventNotifier,    //< event notifier un-registration message sent by proxy_events
     kNotifyEvent,                //< event update notification message sent by skeleton_events
     kOutdatedNodeId,  //< outdated node id message (sent from a LoLa process in the role as consumer to the producer)
+    kNotifyEventBatch,  //< batched event update notification message sent by skeletons flushing their notifications
 };
 
 /// \brief deserializes a short-message-payload (std::uint32) containing a serialized event fq id into a ElementFqId
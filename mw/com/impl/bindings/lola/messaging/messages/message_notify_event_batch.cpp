@@ -0,0 +1,148 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_notify_event_batch.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+
+namespace
+{
+
+// Layout of the payload:
+// | service_id (2 bytes) | instance_id (2 bytes) | number of elements (1 byte) | field mask (2 bytes) | element ids |
+// Bit n of the field mask is set, if the n-th element is a field, otherwise it is an event.
+constexpr std::size_t kServiceIdOffset{0U};
+constexpr std::size_t kInstanceIdOffset{2U};
+constexpr std::size_t kNumberOfElementsOffset{4U};
+constexpr std::size_t kFieldMaskOffset{5U};
+constexpr std::size_t kElementIdsOffset{7U};
+
+static_assert((kElementIdsOffset + NotifyEventBatchMessage::kMaxElements) <=
+                  std::tuple_size<message_passing::MediumMessagePayload>::value,
+              "MediumMessage size not sufficient for NotifyEventBatchMessage.");
+static_assert(NotifyEventBatchMessage::kMaxElements <= 16U, "Field mask only has 16 bits.");
+
+constexpr std::uint16_t k8BitMask{0x00FFU};
+
+void WriteUint16(message_passing::MediumMessagePayload& payload, const std::size_t offset, const std::uint16_t value)
+{
+    payload.at(offset) = static_cast<std::uint8_t>(value >> 8U);
+    payload.at(offset + 1U) = static_cast<std::uint8_t>(value & k8BitMask);
+}
+
+std::uint16_t ReadUint16(const message_passing::MediumMessagePayload& payload, const std::size_t offset)
+{
+    return static_cast<std::uint16_t>((static_cast<std::uint16_t>(payload.at(offset)) << 8U) |
+                                      static_cast<std::uint16_t>(payload.at(offset + 1U)));
+}
+
+}  // namespace
+
+NotifyEventBatchMessage NotifyEventBatchMessage::DeserializeToNotifyEventBatchMessage(
+    const message_passing::MediumMessagePayload& message_payload,
+    const pid_t sender_node_id)
+{
+    NotifyEventBatchMessage message{ReadUint16(message_payload, kServiceIdOffset),
+                                    ReadUint16(message_payload, kInstanceIdOffset),
+                                    sender_node_id};
+    const std::uint16_t field_mask{ReadUint16(message_payload, kFieldMaskOffset)};
+    // a corrupted element count must not lead to out of bounds accesses, so it is limited to kMaxElements.
+    message.number_of_elements_ =
+        std::min(static_cast<std::size_t>(message_payload.at(kNumberOfElementsOffset)), kMaxElements);
+    for (std::size_t index = 0U; index < message.number_of_elements_; ++index)
+    {
+        message.element_ids_.at(index) = message_payload.at(kElementIdsOffset + index);
+        message.element_types_.at(index) =
+            (((field_mask >> index) & 1U) == 1U) ? ElementType::FIELD : ElementType::EVENT;
+    }
+    return message;
+}
+
+NotifyEventBatchMessage::NotifyEventBatchMessage(const ElementFqId element_fq_id, const pid_t sender_node_id) noexcept
+    : NotifyEventBatchMessage{element_fq_id.service_id_, element_fq_id.instance_id_, sender_node_id}
+{
+    element_ids_.at(0U) = element_fq_id.element_id_;
+    element_types_.at(0U) = element_fq_id.element_type_;
+    number_of_elements_ = 1U;
+}
+
+NotifyEventBatchMessage::NotifyEventBatchMessage(const std::uint16_t service_id,
+                                                 const std::uint16_t instance_id,
+                                                 const pid_t sender_node_id) noexcept
+    : service_id_{service_id},
+      instance_id_{instance_id},
+      element_ids_{},
+      element_types_{},
+      number_of_elements_{0U},
+      sender_node_id_{sender_node_id}
+{
+}
+
+bool NotifyEventBatchMessage::Add(const ElementFqId element_fq_id) noexcept
+{
+    if ((number_of_elements_ == kMaxElements) || (element_fq_id.service_id_ != service_id_) ||
+        (element_fq_id.instance_id_ != instance_id_))
+    {
+        return false;
+    }
+    element_ids_.at(number_of_elements_) = element_fq_id.element_id_;
+    element_types_.at(number_of_elements_) = element_fq_id.element_type_;
+    ++number_of_elements_;
+    return true;
+}
+
+message_passing::MediumMessage NotifyEventBatchMessage::SerializeToMediumMessage() const noexcept
+{
+    message_passing::MediumMessage message{};
+    message.id = static_cast<message_passing::MessageId>(MessageType::kNotifyEventBatch);
+    message.pid = sender_node_id_;
+
+    std::uint16_t field_mask{0U};
+    WriteUint16(message.payload, kServiceIdOffset, service_id_);
+    WriteUint16(message.payload, kInstanceIdOffset, instance_id_);
+    message.payload.at(kNumberOfElementsOffset) = static_cast<std::uint8_t>(number_of_elements_);
+    for (std::size_t index = 0U; index < number_of_elements_; ++index)
+    {
+        message.payload.at(kElementIdsOffset + index) = element_ids_.at(index);
+        if (element_types_.at(index) == ElementType::FIELD)
+        {
+            field_mask = static_cast<std::uint16_t>(field_mask | (1U << index));
+        }
+    }
+    WriteUint16(message.payload, kFieldMaskOffset, field_mask);
+    return message;
+}
+
+ElementFqId NotifyEventBatchMessage::GetElementFqId(const std::size_t index) const noexcept
+{
+    return {service_id_, element_ids_.at(index), instance_id_, element_types_.at(index)};
+}
+
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -0,0 +1,94 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_MESSAGE_NOTIFY_EVENT_BATCH_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_MESSAGE_NOTIFY_EVENT_BATCH_H
+
+#include "platform/aas/lib/os/unistd.h"
+#include "platform/aas/mw/com/impl/bindings/lola/element_fq_id.h"
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_common.h"
+#include "platform/aas/mw/com/message_passing/message.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+
+/// \brief Message sent from the provider/skeleton side to a consumer/proxy side node to notify about the update of
+///        several events/fields of the same service instance at once.
+///
+/// \details It is the batched variant of ElementFqIdMessage<MessageType::kNotifyEvent>. As all contained elements share
+///          service_id and instance_id, these are only serialized once, so that up to kMaxElements element ids fit into
+///          one medium message.
+class NotifyEventBatchMessage
+{
+  public:
+    /// \brief Max number of elements, which can be contained in one message.
+    static constexpr std::size_t kMaxElements{9U};
+
+    static NotifyEventBatchMessage DeserializeToNotifyEventBatchMessage(
+        const message_passing::MediumMessagePayload& message_payload,
+        const pid_t sender_node_id);
+
+    /// \brief ctor to create a NotifyEventBatchMessage containing the given first element (used on sender side).
+    /// \param element_fq_id first element of the batch, which defines service_id and instance_id of the batch.
+    /// \param sender_node_id node id of sender of this message
+    NotifyEventBatchMessage(const ElementFqId element_fq_id, const pid_t sender_node_id) noexcept;
+
+    /// \brief Adds the given element to the batch.
+    /// \return true if the element has been added, false if the batch is full or the element belongs to a different
+    ///         service instance.
+    bool Add(const ElementFqId element_fq_id) noexcept;
+
+    /// \brief Serializes message to a MediumMessage.
+    /// \return MediumMessage representation
+    message_passing::MediumMessage SerializeToMediumMessage() const noexcept;
+
+    std::size_t GetNumberOfElements() const noexcept { return number_of_elements_; }
+
+    /// \brief Returns the element at the given position within the batch (no bound check performed!)
+    ElementFqId GetElementFqId(const std::size_t index) const noexcept;
+
+    pid_t GetSenderNodeId() const noexcept { return sender_node_id_; }
+
+  private:
+    NotifyEventBatchMessage(const std::uint16_t service_id,
+                            const std::uint16_t instance_id,
+                            const pid_t sender_node_id) noexcept;
+
+    std::uint16_t service_id_;
+    std::uint16_t instance_id_;
+    std::array<std::uint8_t, kMaxElements> element_ids_;
+    std::array<ElementType, kMaxElements> element_types_;
+    std::size_t number_of_elements_;
+    pid_t sender_node_id_;
+};
+
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_MESSAGE_NOTIFY_EVENT_BATCH_H
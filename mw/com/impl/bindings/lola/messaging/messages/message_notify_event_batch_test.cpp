@@ -0,0 +1,137 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_notify_event_batch.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_common.h"
+
+#include <gtest/gtest.h>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+namespace
+{
+
+constexpr pid_t SENDER_NODE_ID = 777;
+constexpr std::uint16_t SERVICE_ID = 0x1234U;
+constexpr std::uint16_t INSTANCE_ID = 0xABCDU;
+
+ElementFqId CreateElementFqId(const std::uint8_t element_id, const ElementType element_type = ElementType::EVENT)
+{
+    return ElementFqId{SERVICE_ID, element_id, INSTANCE_ID, element_type};
+}
+
+TEST(MessageNotifyEventBatch, Creation)
+{
+    // given a NotifyEventBatchMessage created from one element
+    NotifyEventBatchMessage message{CreateElementFqId(1U), SENDER_NODE_ID};
+
+    // expect, that it contains exactly this element
+    ASSERT_EQ(message.GetNumberOfElements(), 1U);
+    EXPECT_EQ(message.GetElementFqId(0U), CreateElementFqId(1U));
+    EXPECT_EQ(message.GetSenderNodeId(), SENDER_NODE_ID);
+}
+
+TEST(MessageNotifyEventBatch, AddingElementsOfSameServiceInstanceSucceedsUntilFull)
+{
+    // given a NotifyEventBatchMessage created from one element
+    NotifyEventBatchMessage message{CreateElementFqId(0U), SENDER_NODE_ID};
+
+    // when adding further elements of the same service instance until the max number of elements is reached
+    for (std::uint8_t element_id = 1U; element_id < NotifyEventBatchMessage::kMaxElements; ++element_id)
+    {
+        // expect, that they get added
+        EXPECT_TRUE(message.Add(CreateElementFqId(element_id)));
+    }
+    EXPECT_EQ(message.GetNumberOfElements(), NotifyEventBatchMessage::kMaxElements);
+
+    // and that no further element can be added
+    EXPECT_FALSE(message.Add(CreateElementFqId(NotifyEventBatchMessage::kMaxElements)));
+    EXPECT_EQ(message.GetNumberOfElements(), NotifyEventBatchMessage::kMaxElements);
+}
+
+TEST(MessageNotifyEventBatch, AddingElementOfDifferentServiceInstanceFails)
+{
+    // given a NotifyEventBatchMessage created from one element
+    NotifyEventBatchMessage message{CreateElementFqId(1U), SENDER_NODE_ID};
+
+    // expect, that elements of a different service or a different instance can't be added
+    EXPECT_FALSE(message.Add(ElementFqId{SERVICE_ID + 1U, 2U, INSTANCE_ID, ElementType::EVENT}));
+    EXPECT_FALSE(message.Add(ElementFqId{SERVICE_ID, 2U, INSTANCE_ID + 1U, ElementType::EVENT}));
+    EXPECT_EQ(message.GetNumberOfElements(), 1U);
+}
+
+TEST(MessageNotifyEventBatch, SerializeToMediumMessage)
+{
+    // given a NotifyEventBatchMessage
+    NotifyEventBatchMessage message{CreateElementFqId(1U), SENDER_NODE_ID};
+
+    // when serializing to MediumMessage
+    const auto medium_message = message.SerializeToMediumMessage();
+
+    // expect, that MediumMessage members reflect the message type and sender
+    EXPECT_EQ(medium_message.id, static_cast<message_passing::MessageId>(MessageType::kNotifyEventBatch));
+    EXPECT_EQ(medium_message.pid, SENDER_NODE_ID);
+}
+
+TEST(MessageNotifyEventBatch, Roundtrip)
+{
+    // given a NotifyEventBatchMessage containing events and fields
+    NotifyEventBatchMessage message{CreateElementFqId(1U), SENDER_NODE_ID};
+    ASSERT_TRUE(message.Add(CreateElementFqId(5U, ElementType::FIELD)));
+    ASSERT_TRUE(message.Add(CreateElementFqId(255U)));
+
+    // when serializing to MediumMessage and deserializing it again
+    const auto medium_message = message.SerializeToMediumMessage();
+    const auto deserialized_message =
+        NotifyEventBatchMessage::DeserializeToNotifyEventBatchMessage(medium_message.payload, medium_message.pid);
+
+    // expect, that all elements including their element type are restored
+    ASSERT_EQ(deserialized_message.GetNumberOfElements(), 3U);
+    EXPECT_EQ(deserialized_message.GetSenderNodeId(), SENDER_NODE_ID);
+    for (std::size_t index = 0U; index < message.GetNumberOfElements(); ++index)
+    {
+        EXPECT_EQ(deserialized_message.GetElementFqId(index), message.GetElementFqId(index));
+        EXPECT_EQ(deserialized_message.GetElementFqId(index).element_type_,
+                  message.GetElementFqId(index).element_type_);
+    }
+}
+
+TEST(MessageNotifyEventBatch, DeserializingCorruptedElementCountIsLimited)
+{
+    // given a MediumMessagePayload with an element count exceeding the max number of elements
+    message_passing::MediumMessagePayload payload{};
+    payload.at(4U) = 0xFFU;
+
+    // when deserializing it
+    const auto message = NotifyEventBatchMessage::DeserializeToNotifyEventBatchMessage(payload, SENDER_NODE_ID);
+
+    // expect, that the number of elements is limited to the max number of elements
+    EXPECT_EQ(message.GetNumberOfElements(), NotifyEventBatchMessage::kMaxElements);
+}
+
+}  // namespace
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -22,12 +22,14 @@
 #include "platform/aas/mw/log/logging.h"
 
 #include <amp_assert.hpp>
+#include <amp_optional.hpp>
 
 #include <algorithm>
 #include <array>
 #include <iterator>
 #include <memory>
 #include <thread>
+#include <tuple>
 #include <utility>
 
 bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventHandler(
@@ -88,6 +90,12 @@ void bmw::mw::com::impl::lola::NotifyEventHandler::RegisterMessageReceivedCallba
             [this, asil_level](const message_passing::ShortMessagePayload payload, const pid_t sender_pid) {
                 this->HandleOutdatedNodeIdMsg(payload, asil_level, sender_pid);
             }));
+    receiver.Register(
+        static_cast<message_passing::MessageId>(MessageType::kNotifyEventBatch),
+        amp::callback<void(const message_passing::MediumMessagePayload, const pid_t)>(
+            [this, asil_level](const message_passing::MediumMessagePayload payload, const pid_t sender_pid) {
+                this->HandleNotifyEventBatchMsg(payload, asil_level, sender_pid);
+            }));
 }
 
 
@@ -105,23 +113,67 @@ void bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEvent(const QualityType
     NotifyEventRemote(asil_level, event_id, control_data);
 
     // Notification of local proxy_events/user receive handlers is decoupled via worker-threads, as user level receive
-    // handlers may have an unknown/non-deterministic long runtime.
-    
-    std::shared_lock<std::shared_mutex> read_lock(control_data.event_update_handlers_mutex_);
-    
-    auto search = control_data.event_update_handlers_.find(event_id);
-    if ((search != control_data.event_update_handlers_.end()) && (search->second.empty() == false))
+    // handlers may have an unknown/non-deterministic long runtime. Only handlers, which explicitly opted out of the
+    // worker-threads, are called directly.
+    NotifyEventLocallyAsync(event_id, control_data);
+}
+
+void bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEvents(const QualityType asil_level,
+                                                                const amp::span<const ElementFqId> event_ids)
+{
+    AMP_ASSERT_PRD_MESSAGE(
+        (asil_level == QualityType::kASIL_QM) || ((asil_level == QualityType::kASIL_B) && asil_b_capability_),
+        "Invalid asil level.");
+    auto& control_data = asil_level == QualityType::kASIL_QM ? control_data_qm_ : control_data_asil_;
+
+    // an event updated several times within one batch gets notified only once.
+    std::vector<ElementFqId> unique_event_ids{};
+    unique_event_ids.reserve(static_cast<std::size_t>(event_ids.size()));
+    for (const auto& event_id : event_ids)
     {
-        read_lock.unlock();
-        control_data.thread_pool_->Post(
-            [this](const amp::stop_token& token, const QualityType asilLevel, const ElementFqId element_id) {
+        if (std::find(unique_event_ids.cbegin(), unique_event_ids.cend(), event_id) == unique_event_ids.cend())
+        {
+            unique_event_ids.push_back(event_id);
+        }
+    }
+
+    // same order as in NotifyEvent(): synchronous message-sending first, then the decoupled local notification.
+    NotifyEventsRemote(asil_level, amp::span<const ElementFqId>{unique_event_ids}, control_data);
+
+    for (const auto& event_id : unique_event_ids)
+    {
+        NotifyEventLocallyAsync(event_id, control_data);
+    }
+}
+
+void bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventLocallyAsync(
+    const ElementFqId event_id,
+    NotifyEventHandler::EventNotificationControlData& event_notification_ctrl)
+{
+    const auto handlers_for_event = GetEventUpdateHandlers(event_notification_ctrl, event_id);
+    if ((handlers_for_event == nullptr) || handlers_for_event->empty())
+    {
+        return;
+    }
+
+    const bool has_thread_pool_handlers =
+        std::any_of(handlers_for_event->cbegin(),
+                    handlers_for_event->cend(),
+                    [](const std::shared_ptr<RegisteredNotificationHandler>& registered_handler) -> bool {
+                        return registered_handler->dispatch == ReceiveHandlerDispatch::kThreadPool;
+                    });
+    if (has_thread_pool_handlers)
+    {
+        event_notification_ctrl.thread_pool_->Post(
+            [handlers_for_event](const amp::stop_token& token) {
                 // ignoring the result (number of actually notified local proxy-events),
                 // as we don't have any expectation, how many are there.
-                amp::ignore = this->NotifyEventLocally(token, asilLevel, element_id);
-            },
-            asil_level,
-            event_id);
+                amp::ignore = CallEventUpdateHandlers(token, *handlers_for_event, HandlerSelection::kThreadPool);
+            });
     }
+
+    // handlers, which opted out of the thread pool, are called by the thread, which sent the notification.
+    amp::ignore = CallEventUpdateHandlers(token_, *handlers_for_event, HandlerSelection::kDirect);
 }
 
 
@@ -134,7 +186,8 @@ bmw::mw::com::impl::lola::NotifyEventHandler::RegisterEventNotification(
     
     BindingEventReceiveHandler callback,
     
-    const pid_t target_node_id)
+    const pid_t target_node_id,
+    const ReceiveHandlerDispatch dispatch)
 
 {
     AMP_ASSERT_PRD_MESSAGE(
@@ -151,18 +204,22 @@ bmw::mw::com::impl::lola::NotifyEventHandler::RegisterEventNotification(
     // 
     const IMessagePassingService::HandlerRegistrationNoType registration_no = control_data.cur_registration_no_++;
     
-    RegisteredNotificationHandler newHandler{std::move(callback), registration_no};
-    
+    auto newHandler = std::make_shared<RegisteredNotificationHandler>(
+        RegisteredNotificationHandler{std::move(callback), registration_no, dispatch});
+
+    // copy-on-write: notifications, which are currently running, keep on using the list they have picked up.
     auto search = control_data.event_update_handlers_.find(event_id);
     if (search != control_data.event_update_handlers_.end())
     {
-        search->second.push_back(std::move(newHandler));
+        auto new_handlers = std::make_shared<RegisteredNotificationHandlers>(*search->second);
+        new_handlers->push_back(std::move(newHandler));
+        search->second = std::move(new_handlers);
     }
     else
     {
-        auto result =
-            control_data.event_update_handlers_.emplace(event_id, std::vector<RegisteredNotificationHandler>{});
-        result.first->second.push_back(std::move(newHandler));
+        auto new_handlers = std::make_shared<RegisteredNotificationHandlers>();
+        new_handlers->push_back(std::move(newHandler));
+        amp::ignore = control_data.event_update_handlers_.emplace(event_id, std::move(new_handlers));
     }
     write_lock.unlock();
 
@@ -341,16 +398,21 @@ bool bmw::mw::com::impl::lola::NotifyEventHandler::SearchHandlerForNotification(
     {
         // we can do a binary search here, as the registered handlers in this vector are inherently sorted as we emplace
         // always back with monotonically increasing registration number.
-        auto result = std::lower_bound(search->second.begin(),
-                                       search->second.end(),
+        const auto& handlers = *search->second;
+        auto result = std::lower_bound(handlers.cbegin(),
+                                       handlers.cend(),
                                        registration_no,
-                                       [](const RegisteredNotificationHandler& regHandler,
+                                       [](const std::shared_ptr<RegisteredNotificationHandler>& regHandler,
                                           const IMessagePassingService::HandlerRegistrationNoType value) -> bool {
-                                           return regHandler.register_no < value;
+                                           return regHandler->register_no < value;
                                        });
-        if ((result != search->second.end()) && (result->register_no == registration_no))
+        if ((result != handlers.cend()) && ((*result)->register_no == registration_no))
         {
-            amp::ignore = search->second.erase(result);
+            // copy-on-write: a notification, which currently runs on the old list, may still call the removed handler
+            // once. This is harmless, as the handler is a scoped function, whose scope is owned by the proxy-event.
+            auto new_handlers = std::make_shared<RegisteredNotificationHandlers>(handlers.cbegin(), result);
+            new_handlers->insert(new_handlers->end(), std::next(result), handlers.cend());
+            search->second = std::move(new_handlers);
             found = true;
         }
     }
@@ -505,52 +567,149 @@ void bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventRemote(
     }
 }
 
-std::uint32_t bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventLocally(const amp::stop_token& token,
-                                                                               const QualityType asil_level,
-                                                                               const ElementFqId event_id)
+void bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventsRemote(
+    const QualityType asil_level,
+    const amp::span<const ElementFqId> event_ids,
+    NotifyEventHandler::EventNotificationControlData& event_notification_ctrl)
 {
-    auto& control_data = asil_level == QualityType::kASIL_QM ? control_data_qm_ : control_data_asil_;
-    std::uint32_t handlers_called{0U};
-
-    std::shared_lock<std::shared_mutex> read_lock(control_data.event_update_handlers_mutex_);
-    auto search = control_data.event_update_handlers_.find(event_id);
-    if ((search != control_data.event_update_handlers_.end()) && (!search->second.empty()))
+    // collect all (node, event) pairs, which need to be notified ...
+    std::vector<std::pair<pid_t, ElementFqId>> notifications{};
+    NodeIdTmpBufferType nodeIdentifiersTmp;
+    for (const auto& event_id : event_ids)
     {
-        auto& handlers_for_event = search->second;
-        IMessagePassingService::HandlerRegistrationNoType reg_no_start = handlers_for_event.front().register_no;
-        // call first handler under current lock
-        amp::ignore = handlers_for_event.front().handler();
-        handlers_called++;
-
-        // unlock and call remaining handlers one by one in a loop, each time re-acquiring the read lock.
-        read_lock.unlock();
-        bool handler_left{true};
-        
+        pid_t start_node_id{0};
+        std::pair<std::uint8_t, bool> num_ids_copied;
+        std::uint8_t loop_count{0U};
         do
         {
-            read_lock.lock();
-            auto result = std::upper_bound(handlers_for_event.begin(),
-                                           handlers_for_event.end(),
-                                           reg_no_start,
-                                           [](const IMessagePassingService::HandlerRegistrationNoType value,
-                                              const RegisteredNotificationHandler& regHandler) -> bool {
-                                               
-                                               return (value < regHandler.register_no);
-                                               
-                                           });
-            if (result != handlers_for_event.end())
+            if (loop_count == 255U)
             {
-                amp::ignore = result->handler();
-                reg_no_start = result->register_no;
-                handlers_called++;
+                bmw::mw::log::LogError("lola")
+                    << "An overflow in counting the node identifiers to notifies event update.";
+                break;
             }
             else
             {
-                handler_left = false;
+                loop_count++;
             }
-            read_lock.unlock();
-        } while (handler_left && (token.stop_requested() == false));
-        
+
+            num_ids_copied = CopyNodeIdentifiers(event_id,
+                                                 event_notification_ctrl.event_update_interested_nodes_,
+                                                 event_notification_ctrl.event_update_interested_nodes_mutex_,
+                                                 nodeIdentifiersTmp,
+                                                 start_node_id);
+            for (std::uint8_t i = 0U; i < num_ids_copied.first; i++)
+            {
+                notifications.emplace_back(nodeIdentifiersTmp.at(i), event_id);
+            }
+            if (num_ids_copied.second)
+            {
+                start_node_id = nodeIdentifiersTmp.back() + 1;
+            }
+        } while (num_ids_copied.second);
+    }
+
+    // ... and group them by node and service instance, so that each batch message can be filled up completely.
+    std::stable_sort(notifications.begin(),
+                     notifications.end(),
+                     [](const std::pair<pid_t, ElementFqId>& lhs, const std::pair<pid_t, ElementFqId>& rhs) -> bool {
+                         return std::tie(lhs.first, lhs.second.service_id_, lhs.second.instance_id_) <
+                                std::tie(rhs.first, rhs.second.service_id_, rhs.second.instance_id_);
+                     });
+
+    const pid_t own_node_id{mp_control_.GetNodeIdentifier()};
+    amp::optional<NotifyEventBatchMessage> batch{};
+    pid_t batch_node_id{0};
+    for (const auto& notification : notifications)
+    {
+        if (batch.has_value() && (batch_node_id == notification.first) && batch.value().Add(notification.second))
+        {
+            continue;
+        }
+        if (batch.has_value())
+        {
+            SendNotifyEventBatch(asil_level, batch_node_id, batch.value());
+        }
+        batch.emplace(notification.second, own_node_id);
+        batch_node_id = notification.first;
+    }
+    if (batch.has_value())
+    {
+        SendNotifyEventBatch(asil_level, batch_node_id, batch.value());
+    }
+}
+
+void bmw::mw::com::impl::lola::NotifyEventHandler::SendNotifyEventBatch(const QualityType asil_level,
+                                                                        const pid_t target_node_id,
+                                                                        const NotifyEventBatchMessage& batch) const
+{
+    auto sender = mp_control_.GetMessagePassingSender(asil_level, target_node_id);
+    AMP_ASSERT_PRD_MESSAGE(sender != nullptr,
+                           "sender is  a nullpointer. This should not have happend. GetMessagePassingSender should "
+                           "allways return a valid shared pointer.");
+    // a single notification is sent as short message, which is cheaper to transmit than a medium message.
+    const auto result =
+        (batch.GetNumberOfElements() == 1U)
+            ? sender->Send(
+                  NotifyEventUpdateMessage{batch.GetElementFqId(0U), batch.GetSenderNodeId()}.SerializeToShortMessage())
+            : sender->Send(batch.SerializeToMediumMessage());
+    if (!result.has_value())
+    {
+        bmw::mw::log::LogError("lola") << "NotifyEventHandler: Sending NotifyEventBatchMessage to node_id "
+                                       << target_node_id << " with asil_level " << ToString(asil_level)
+                                       << " failed with error: " << result.error();
+    }
+}
+
+std::uint32_t bmw::mw::com::impl::lola::NotifyEventHandler::NotifyEventLocally(const amp::stop_token& token,
+                                                                               const QualityType asil_level,
+                                                                               const ElementFqId event_id)
+{
+    auto& control_data = asil_level == QualityType::kASIL_QM ? control_data_qm_ : control_data_asil_;
+    const auto handlers_for_event = GetEventUpdateHandlers(control_data, event_id);
+    if (handlers_for_event == nullptr)
+    {
+        return 0U;
+    }
+    return CallEventUpdateHandlers(token, *handlers_for_event, HandlerSelection::kAll);
+}
+
+std::shared_ptr<const bmw::mw::com::impl::lola::NotifyEventHandler::RegisteredNotificationHandlers>
+bmw::mw::com::impl::lola::NotifyEventHandler::GetEventUpdateHandlers(
+    EventNotificationControlData& event_notification_ctrl,
+    const ElementFqId event_id)
+{
+    // the lock is only held to pick up the current handler list. The handlers are then called without any lock, so
+    // that (un)registrations are neither blocked by nor block a running notification.
+    std::shared_lock<std::shared_mutex> read_lock(event_notification_ctrl.event_update_handlers_mutex_);
+    auto search = event_notification_ctrl.event_update_handlers_.find(event_id);
+    if (search == event_notification_ctrl.event_update_handlers_.end())
+    {
+        return nullptr;
+    }
+    return search->second;
+}
+
+std::uint32_t bmw::mw::com::impl::lola::NotifyEventHandler::CallEventUpdateHandlers(
+    const amp::stop_token& token,
+    const RegisteredNotificationHandlers& handlers,
+    const HandlerSelection selection)
+{
+    std::uint32_t handlers_called{0U};
+    for (const auto& registered_handler : handlers)
+    {
+        const bool uses_thread_pool = registered_handler->dispatch == ReceiveHandlerDispatch::kThreadPool;
+        if (((selection == HandlerSelection::kThreadPool) && (!uses_thread_pool)) ||
+            ((selection == HandlerSelection::kDirect) && uses_thread_pool))
+        {
+            continue;
+        }
+        amp::ignore = registered_handler->handler();
+        handlers_called++;
+        if (token.stop_requested())
+        {
+            break;
+        }
     }
     return handlers_called;
 }
@@ -580,6 +739,31 @@ void bmw::mw::com::impl::lola::NotifyEventHandler::HandleNotifyEventMsg(
     }
 }
 
+void bmw::mw::com::impl::lola::NotifyEventHandler::HandleNotifyEventBatchMsg(
+    const message_passing::MediumMessagePayload msg_payload,
+    const QualityType asil_level,
+    const pid_t sender_node_id)
+{
+    AMP_ASSERT_PRD_MESSAGE(
+        (asil_level == QualityType::kASIL_QM) || ((asil_level == QualityType::kASIL_B) && asil_b_capability_),
+        "Invalid asil level.");
+
+    const auto message = NotifyEventBatchMessage::DeserializeToNotifyEventBatchMessage(msg_payload, sender_node_id);
+
+    for (std::size_t index = 0U; (index < message.GetNumberOfElements()) && (token_.stop_requested() == false); ++index)
+    {
+        const auto event_id = message.GetElementFqId(index);
+        if (NotifyEventLocally(token_, asil_level, event_id) == 0U)
+        {
+            bmw::mw::log::LogWarn("lola")
+                << "NotifyEventHandler: Received NotifyEventBatchMessage for event: " << event_id.ToString()
+                << " from node " << sender_node_id
+                << " although we don't have currently any registered handlers. Might be an acceptable "
+                   "race, if it happens seldom!";
+        }
+    }
+}
+
 void bmw::mw::com::impl::lola::NotifyEventHandler::HandleRegisterNotificationMsg(
     const message_passing::ShortMessagePayload msg_payload,
     const QualityType asil_level,
@@ -23,11 +23,13 @@
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_common.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_element_fq_id.h"
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_notify_event_batch.h"
 #include "platform/aas/mw/com/impl/configuration/quality_type.h"
 #include "platform/aas/mw/com/message_passing/i_receiver.h"
 #include "platform/aas/mw/com/message_passing/message.h"
 
 #include <amp_callback.hpp>
+#include <amp_span.hpp>
 #include <amp_stop_token.hpp>
 
 #include <atomic>
@@ -81,7 +83,18 @@ class NotifyEventHandler final : public HandlerBase
     /// \param max_samples maximum number of event samples, which shall be used/buffered from caller perspective
     
     void NotifyEvent(const QualityType asil_level, const ElementFqId event_id);
-    
+
+    /// \brief Notify that all events _event_ids_ have been updated.
+    ///
+    /// \details This API is used by process local LoLa skeletons, which coalesce the update notifications of their
+    /// events. In contrast to calling NotifyEvent() for each event, all notifications towards the same remote LoLa
+    /// process are sent within as few NotifyEventBatchMessage as possible.
+    ///
+    /// \param asil_level needed/intended ASIL level. ASIL_B can only be used, if calling process is ASIL_B qualified
+    ///                   and target provides service/event ASIL_B qualified.
+    /// \param event_ids identification of events to notify
+    void NotifyEvents(const QualityType asil_level, const amp::span<const ElementFqId> event_ids);
+
 
     /// \brief Add event update notification callback
     /// \details This API is used by process local LoLa proxy-events.
@@ -90,6 +103,7 @@ class NotifyEventHandler final : public HandlerBase
     /// \param event_id fully qualified event id, for which event notification shall be registered
     /// \param callback callback to be registered
     /// \param target_node_id node id (pid) of providing LoLa process.
+    /// \param dispatch whether the callback is called from thread_pool_ or directly by the notifying thread.
     
     /* RegisterEventNotification implements IMessagePassingService::RegisterEventNotification */
     IMessagePassingService::HandlerRegistrationNoType RegisterEventNotification(
@@ -97,7 +111,8 @@ class NotifyEventHandler final : public HandlerBase
         const QualityType asil_level,
         const ElementFqId event_id,
         BindingEventReceiveHandler callback,
-        const pid_t target_node_id);
+        const pid_t target_node_id,
+        const ReceiveHandlerDispatch dispatch);
 
     /// \brief Re-registers an event update notifications for event _event_id_ in case target_node_id is a remote pid.
     /// \details see see IMessagePassingService::ReregisterEventNotification
@@ -132,6 +147,7 @@ class NotifyEventHandler final : public HandlerBase
         BindingEventReceiveHandler handler;
         // 
         IMessagePassingService::HandlerRegistrationNoType register_no{};
+        ReceiveHandlerDispatch dispatch{ReceiveHandlerDispatch::kThreadPool};
     };
 
     /// \brief Counter for registered event receive notifications for the given (target) node.
@@ -143,7 +159,12 @@ class NotifyEventHandler final : public HandlerBase
         std::uint16_t counter;
     };
 
-    using EventUpdateNotifierMapType = std::unordered_map<ElementFqId, std::vector<RegisteredNotificationHandler>>;
+    /// \brief Immutable list of handlers (copy-on-write), sorted by registration number. Registration/unregistration
+    ///        publish a modified copy, so that an event notification can call the handlers of the list it has picked
+    ///        up without holding any lock. A handler stays alive as long as any such list still references it.
+    using RegisteredNotificationHandlers = std::vector<std::shared_ptr<RegisteredNotificationHandler>>;
+    using EventUpdateNotifierMapType =
+        std::unordered_map<ElementFqId, std::shared_ptr<const RegisteredNotificationHandlers>>;
     using EventUpdateNodeIdMapType = std::unordered_map<ElementFqId, std::set<pid_t>>;
     using EventUpdateRegistrationCountMapType = std::unordered_map<ElementFqId, NodeCounter>;
     /// \brief tmp buffer for copying ids under lock.
@@ -154,6 +175,8 @@ class NotifyEventHandler final : public HandlerBase
     {
         /// \brief map holding per event_id a list of notification/receive handlers registered by local proxy-event
         ///        instances, which need to be called, when the event with given _event_id_ is updated.
+        /// \note The mutex below only protects the map and the exchange of its handler lists. The handlers themselves
+        ///       are called without lock.
         EventUpdateNotifierMapType event_update_handlers_;
 
         // 
@@ -218,6 +241,24 @@ class NotifyEventHandler final : public HandlerBase
                            const ElementFqId event_id,
                            EventNotificationControlData& event_notification_ctrl);
 
+    /// \brief Notifies the update of several events towards other LoLa processes interested in.
+    /// \details Notifications for the same node are coalesced into NotifyEventBatchMessage(s). If only one event has
+    ///          to be notified to a node, the plain NotifyEventUpdateMessage is sent instead.
+    /// \param asil_level asil level of updated events.
+    /// \param event_ids full qualified event ids (free of duplicates)
+    void NotifyEventsRemote(const QualityType asil_level,
+                            const amp::span<const ElementFqId> event_ids,
+                            EventNotificationControlData& event_notification_ctrl);
+
+    /// \brief Sends the given batch of event update notifications to the given node.
+    void SendNotifyEventBatch(const QualityType asil_level,
+                              const pid_t target_node_id,
+                              const NotifyEventBatchMessage& batch) const;
+
+    /// \brief Notifies the local receive handlers for a local event update: Handlers registered with
+    ///        ReceiveHandlerDispatch::kThreadPool are called from the worker threads, all others directly.
+    void NotifyEventLocallyAsync(const ElementFqId event_id, EventNotificationControlData& event_notification_ctrl);
+
     /// \brief Notifies all registered receive handlers (of local proxy events) about an event update.
     /// \param token
     /// \param asil_level
@@ -229,6 +270,25 @@ class NotifyEventHandler final : public HandlerBase
                                      const QualityType asil_level,
                                      const ElementFqId event_id);
 
+    /// \brief Selects, which of the registered handlers shall be called by CallEventUpdateHandlers().
+    enum class HandlerSelection : std::uint8_t
+    {
+        kAll,
+        kThreadPool,
+        kDirect,
+    };
+
+    /// \brief Returns the list of handlers currently registered for the given event or nullptr if there are none.
+    static std::shared_ptr<const RegisteredNotificationHandlers> GetEventUpdateHandlers(
+        EventNotificationControlData& event_notification_ctrl,
+        const ElementFqId event_id);
+
+    /// \brief Calls the selected handlers out of the given ones.
+    /// \return count of handlers, that have been called.
+    static std::uint32_t CallEventUpdateHandlers(const amp::stop_token& token,
+                                                 const RegisteredNotificationHandlers& handlers,
+                                                 const HandlerSelection selection);
+
     /// \brief internal handler method, when a notify-event message has been received on a receiver.
     /// \details It notifies process local LoLa proxy event instances, which have registered a notification callback for
     ///          the event_id contained in the message.
@@ -242,6 +302,15 @@ class NotifyEventHandler final : public HandlerBase
                               const QualityType asil_level,
                               const pid_t sender_node_id);
 
+    /// \brief internal handler method, when a notify-event-batch message has been received on a receiver.
+    /// \details Same as HandleNotifyEventMsg(), but for each of the events contained in the batch.
+    /// \param msg_payload payload of notify-event-batch message
+    /// \param asil_level asil level of provider (deduced from receiver instance, where message has been received)
+    /// \param sender_node_id node_id of sender (process)
+    void HandleNotifyEventBatchMsg(const bmw::mw::com::message_passing::MediumMessagePayload msg_payload,
+                                   const QualityType asil_level,
+                                   const pid_t sender_node_id);
+
     /// \brief internal handler method, when a register-event-notification message has been received.
     /// \param msg_payload payload of register-event-notification message
     /// \param asil_level asil level of consumer (deduced from receiver instance, where message has been received)
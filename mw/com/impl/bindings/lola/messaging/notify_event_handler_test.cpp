@@ -16,6 +16,7 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/message_passing_control_mock.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_common.h"
+#include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_notify_event_batch.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/messages/message_outdated_nodeid.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/thread_abstraction.h"
 #include "platform/aas/mw/com/message_passing/receiver_mock.h"
@@ -27,6 +28,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <chrono>
 #include <cstring>
 #include <memory>
@@ -110,6 +112,12 @@ class NotifyEventHandlerFixture : public ::testing::Test
                              (An<message_passing::IReceiver::ShortMessageReceivedCallback>())))
             .Times(1)
             .WillOnce(Invoke(this, &NotifyEventHandlerFixture::RegisterOutdatedNodeIdReceivedQmCB));
+        // ... and kNotifyEventBatch
+        EXPECT_CALL(receiver_mock_,
+                    Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kNotifyEventBatch),
+                             (An<message_passing::IReceiver::MediumMessageReceivedCallback>())))
+            .Times(1)
+            .WillOnce(Invoke(this, &NotifyEventHandlerFixture::RegisterNotifyEventBatchReceivedQmCB));
 
         // when calling RegisterMessageReceivedCallbacks
         unit_.value().RegisterMessageReceivedCallbacks(QualityType::kASIL_QM, receiver_mock_);
@@ -137,6 +145,11 @@ class NotifyEventHandlerFixture : public ::testing::Test
                         Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kOutdatedNodeId),
                                  (An<message_passing::IReceiver::ShortMessageReceivedCallback>())))
                 .Times(1);
+            // ... and kNotifyEventBatch
+            EXPECT_CALL(receiver_mock_,
+                        Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kNotifyEventBatch),
+                                 (An<message_passing::IReceiver::MediumMessageReceivedCallback>())))
+                .Times(1);
 
             // when calling RegisterMessageReceivedCallbacks
             unit_.value().RegisterMessageReceivedCallbacks(QualityType::kASIL_B, receiver_mock_);
@@ -171,15 +184,23 @@ class NotifyEventHandlerFixture : public ::testing::Test
         outdated_node_id_message_received_ = std::move(callback);
     }
 
+    void RegisterNotifyEventBatchReceivedQmCB(message_passing::MessageId id,
+                                              message_passing::IReceiver::MediumMessageReceivedCallback callback)
+    {
+        EXPECT_EQ(id, static_cast<message_passing::MessageId>(MessageType::kNotifyEventBatch));
+        event_notify_batch_message_received_ = std::move(callback);
+    }
+
     IMessagePassingService::HandlerRegistrationNoType LocalEventNotificationForLocalEventIsRegistered(
         QualityType asil_level,
-        ElementFqId element_id)
+        ElementFqId element_id,
+        ReceiveHandlerDispatch dispatch = ReceiveHandlerDispatch::kThreadPool)
     {
         auto eventUpdateNotificationHandler = BindingEventReceiveHandler(
             event_receive_handler_scope_, [this]() noexcept { notify_event_callback_counter_++; });
 
         return unit_.value().RegisterEventNotification(
-            asil_level, element_id, std::move(eventUpdateNotificationHandler), LOCAL_NODE_ID);
+            asil_level, element_id, std::move(eventUpdateNotificationHandler), LOCAL_NODE_ID, dispatch);
     }
 
     IMessagePassingService::HandlerRegistrationNoType LocalEventNotificationForRemoteEventIsRegistered(
@@ -205,7 +226,11 @@ class NotifyEventHandlerFixture : public ::testing::Test
             }));
 
         return unit_.value().RegisterEventNotification(
-            asil_level, element_id, std::move(eventUpdateNotificationHandler), REMOTE_NODE_ID);
+            asil_level,
+            element_id,
+            std::move(eventUpdateNotificationHandler),
+            REMOTE_NODE_ID,
+            ReceiveHandlerDispatch::kThreadPool);
     }
 
     void RemoteEventNotificationIsRegistered(QualityType, ElementFqId element_id, pid_t remote_node_id = REMOTE_NODE_ID)
@@ -245,6 +270,7 @@ class NotifyEventHandlerFixture : public ::testing::Test
     message_passing::IReceiver::ShortMessageReceivedCallback unregister_event_notifier_message_received_;
     message_passing::IReceiver::ShortMessageReceivedCallback event_notify_message_received_;
     message_passing::IReceiver::ShortMessageReceivedCallback outdated_node_id_message_received_;
+    message_passing::IReceiver::MediumMessageReceivedCallback event_notify_batch_message_received_;
 
     std::vector<pid_t> remote_node_ids_{};
     safecpp::Scope<> event_receive_handler_scope_{};
@@ -287,6 +313,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterQMReceiveCallbacks)
                 Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kOutdatedNodeId),
                          (An<message_passing::IReceiver::ShortMessageReceivedCallback>())))
         .Times(1);
+    // ... and kNotifyEventBatch get registered
+    EXPECT_CALL(receiver_mock_,
+                Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kNotifyEventBatch),
+                         (An<message_passing::IReceiver::MediumMessageReceivedCallback>())))
+        .Times(1);
 
     // when calling RegisterMessageReceivedCallbacks
     unit_.value().RegisterMessageReceivedCallbacks(QualityType::kASIL_QM, receiver_mock_);
@@ -317,6 +348,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterASILReceiveCallbacks)
                 Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kOutdatedNodeId),
                          (An<message_passing::IReceiver::ShortMessageReceivedCallback>())))
         .Times(1);
+    // ... and kNotifyEventBatch get registered
+    EXPECT_CALL(receiver_mock_,
+                Register(static_cast<std::underlying_type_t<MessageType>>(MessageType::kNotifyEventBatch),
+                         (An<message_passing::IReceiver::MediumMessageReceivedCallback>())))
+        .Times(1);
 
     // when calling RegisterMessageReceivedCallbacks
     unit_.value().RegisterMessageReceivedCallbacks(QualityType::kASIL_B, receiver_mock_);
@@ -336,7 +372,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterNotification_LocalEvent)
 
     // when registering a receive-handler for a local event
     unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, std::move(eventUpdateNotificationHandler), LOCAL_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        std::move(eventUpdateNotificationHandler),
+        LOCAL_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 }
 
 TEST_F(NotifyEventHandlerFixture, RegisterNotification_RemoteEvent)
@@ -363,7 +403,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterNotification_RemoteEvent)
 
     // when registering a receive-handler for a event on a remote node
     unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, std::move(eventUpdateNotificationHandler), REMOTE_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        std::move(eventUpdateNotificationHandler),
+        REMOTE_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 }
 
 /**
@@ -395,7 +439,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterNotification_RemoteEvent_SendError)
 
     // when registering a receive-handler for a event on a remote node
     unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, std::move(eventUpdateNotificationHandler), REMOTE_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        std::move(eventUpdateNotificationHandler),
+        REMOTE_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 }
 
 TEST_F(NotifyEventHandlerFixture, RegisterMultipleNotification_RemoteEvent)
@@ -414,7 +462,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterMultipleNotification_RemoteEvent)
 
     // when there is an additional/2nd notification-registration for the same event
     unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, BindingEventReceiveHandler{}, REMOTE_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        BindingEventReceiveHandler{},
+        REMOTE_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 }
 
 TEST_F(NotifyEventHandlerFixture, RegisterMultipleNotificationNewNode_RemoteEvent)
@@ -434,7 +486,11 @@ TEST_F(NotifyEventHandlerFixture, RegisterMultipleNotificationNewNode_RemoteEven
 
     // when there is an additional/2nd notification-registration for the same event but now for a new/different node id
     unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, BindingEventReceiveHandler{}, NEW_REMOTE_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        BindingEventReceiveHandler{},
+        NEW_REMOTE_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 }
 
 TEST_F(NotifyEventHandlerFixture, NotifyEvent_LocalReceiverOnly)
@@ -460,6 +516,21 @@ TEST_F(NotifyEventHandlerFixture, NotifyEvent_LocalReceiverOnly)
     };
 }
 
+TEST_F(NotifyEventHandlerFixture, NotifyEvent_LocalInlineReceiverIsCalledSynchronously)
+{
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with a registered event-receive-handler/event-notification, which opted out of the thread pool
+    LocalEventNotificationForLocalEventIsRegistered(
+        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, ReceiveHandlerDispatch::kInline);
+
+    // when notifying the event
+    unit_.value().NotifyEvent(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
+
+    // expect, that the event-notification has already been called, when NotifyEvent returns
+    EXPECT_EQ(notify_event_callback_counter_, 1);
+}
+
 TEST_F(NotifyEventHandlerFixture, UnregisterNotification_LocalEvent)
 {
     // given a NotifyEventHandler without ASIL support
@@ -809,6 +880,116 @@ TEST_F(NotifyEventHandlerFixture, NotifyEvent_HighNumberRemoteReceiversOnly)
     unit_.value().NotifyEvent(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
 }
 
+TEST_F(NotifyEventHandlerFixture, NotifyEvents_LocalReceiverOnly)
+{
+    const ElementFqId other_element_fq_id{1, 2, 1, ElementType::FIELD};
+
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with registered event-receive-handlers for two local events
+    LocalEventNotificationForLocalEventIsRegistered(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
+    LocalEventNotificationForLocalEventIsRegistered(QualityType::kASIL_QM, other_element_fq_id);
+
+    // when notifying both events at once, where one of them is contained twice
+    const std::array<ElementFqId, 3U> event_ids{SOME_ELEMENT_FQ_ID, other_element_fq_id, SOME_ELEMENT_FQ_ID};
+    unit_.value().NotifyEvents(QualityType::kASIL_QM, amp::span<const ElementFqId>{event_ids});
+
+    // expect, that the event-notification of each event has been called once
+    while (notify_event_callback_counter_ != 2)
+    {
+        std::this_thread::yield();
+    };
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(notify_event_callback_counter_, 2);
+}
+
+TEST_F(NotifyEventHandlerFixture, NotifyEvents_RemoteReceiverGetsOneBatchMessage)
+{
+    const ElementFqId other_element_fq_id{1, 2, 1, ElementType::FIELD};
+
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with registered receive-handlers
+    ReceiveHandlersAreRegistered(false);
+    // and registered event notifications of a remote node for two events of the same service instance
+    RemoteEventNotificationIsRegistered(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
+    RemoteEventNotificationIsRegistered(QualityType::kASIL_QM, other_element_fq_id);
+
+    // expect that GetMessagePassingSender() is called only once
+    EXPECT_CALL(mp_control_mock_, GetMessagePassingSender(QualityType::kASIL_QM, REMOTE_NODE_ID))
+        .WillOnce(Return(getSenderMock()));
+
+    // and expect, that no NotifyEventUpdateMessage is sent
+    EXPECT_CALL(*sender_mock_, Send(An<const message_passing::ShortMessage&>())).Times(0);
+
+    // but one NotifyEventBatchMessage containing both events
+    EXPECT_CALL(*sender_mock_, Send(An<const message_passing::MediumMessage&>()))
+        .WillOnce(Invoke([&other_element_fq_id](const message_passing::MediumMessage& msg) {
+            amp::expected_blank<bmw::os::Error> blank{};
+            EXPECT_EQ(msg.id, static_cast<message_passing::MessageId>(MessageType::kNotifyEventBatch));
+            EXPECT_EQ(msg.pid, LOCAL_NODE_ID);
+            const auto batch = NotifyEventBatchMessage::DeserializeToNotifyEventBatchMessage(msg.payload, msg.pid);
+            EXPECT_EQ(batch.GetNumberOfElements(), 2U);
+            EXPECT_EQ(batch.GetElementFqId(0U), SOME_ELEMENT_FQ_ID);
+            EXPECT_EQ(batch.GetElementFqId(1U), other_element_fq_id);
+            return blank;
+        }));
+
+    // when notifying both events at once, where one of them is contained twice
+    const std::array<ElementFqId, 3U> event_ids{SOME_ELEMENT_FQ_ID, other_element_fq_id, SOME_ELEMENT_FQ_ID};
+    unit_.value().NotifyEvents(QualityType::kASIL_QM, amp::span<const ElementFqId>{event_ids});
+}
+
+TEST_F(NotifyEventHandlerFixture, NotifyEvents_SingleRemoteNotificationIsSentAsNotifyEventMessage)
+{
+    const ElementFqId other_element_fq_id{1, 2, 1, ElementType::FIELD};
+
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with registered receive-handlers
+    ReceiveHandlersAreRegistered(false);
+    // and a registered event notification of a remote node for only one of two events
+    RemoteEventNotificationIsRegistered(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
+
+    // expect that GetMessagePassingSender() to be called
+    EXPECT_CALL(mp_control_mock_, GetMessagePassingSender(QualityType::kASIL_QM, REMOTE_NODE_ID))
+        .WillOnce(Return(getSenderMock()));
+
+    // and expect, that a NotifyEventUpdateMessage is sent out for event SOME_ELEMENT_FQ_ID
+    EXPECT_CALL(*sender_mock_, Send(An<const message_passing::ShortMessage&>()))
+        .WillOnce(Invoke([](const message_passing::ShortMessage& msg) {
+            amp::expected_blank<bmw::os::Error> blank{};
+            EXPECT_EQ(msg.id, static_cast<message_passing::MessageId>(MessageType::kNotifyEvent));
+            EXPECT_EQ(msg.payload, ElementFqIdToShortMsgPayload(SOME_ELEMENT_FQ_ID));
+            return blank;
+        }));
+
+    // when notifying both events at once
+    const std::array<ElementFqId, 2U> event_ids{SOME_ELEMENT_FQ_ID, other_element_fq_id};
+    unit_.value().NotifyEvents(QualityType::kASIL_QM, amp::span<const ElementFqId>{event_ids});
+}
+
+TEST_F(NotifyEventHandlerFixture, ReceiveEventBatchNotification)
+{
+    const ElementFqId other_element_fq_id{1, 2, 1, ElementType::FIELD};
+
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with registered receive-handlers
+    ReceiveHandlersAreRegistered(false);
+    // and there are locally registered event notifications for two remote events
+    LocalEventNotificationForRemoteEventIsRegistered(QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID);
+    LocalEventNotificationForRemoteEventIsRegistered(QualityType::kASIL_QM, other_element_fq_id);
+
+    // when a NotifyEventBatchMessage (id = kNotifyEventBatch) is received for both event ids
+    NotifyEventBatchMessage batch{SOME_ELEMENT_FQ_ID, REMOTE_NODE_ID};
+    ASSERT_TRUE(batch.Add(other_element_fq_id));
+    event_notify_batch_message_received_(batch.SerializeToMediumMessage().payload, REMOTE_NODE_ID);
+
+    // expect, that the notification of both events has been called
+    EXPECT_EQ(notify_event_callback_counter_, 2);
+}
+
 TEST_F(NotifyEventHandlerFixture, ReceiveEventNotification_OneNotifier)
 {
     // given a NotifyEventHandler without ASIL support
@@ -857,7 +1038,11 @@ TEST_F(NotifyEventHandlerFixture, ReceiveEventNotification_TwoNotifier)
         event_receive_handler_scope, [this]() noexcept { notify_event_callback_counter_++; });
 
     amp::ignore = unit_.value().RegisterEventNotification(
-        QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, std::move(eventUpdateNotificationHandler), REMOTE_NODE_ID);
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        std::move(eventUpdateNotificationHandler),
+        REMOTE_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
 
     // when a NotifyEventMessage (id = kNotifyEvent) is received for this event id
     message_passing::ShortMessagePayload payload = ElementFqIdToShortMsgPayload(SOME_ELEMENT_FQ_ID);
@@ -867,6 +1052,37 @@ TEST_F(NotifyEventHandlerFixture, ReceiveEventNotification_TwoNotifier)
     EXPECT_EQ(notify_event_callback_counter_, 2);
 }
 
+TEST_F(NotifyEventHandlerFixture, ReceiveEventNotification_HandlerUnregistersItself)
+{
+    // given a NotifyEventHandler without ASIL support
+    PrepareUnit(false);
+    // with registered receive-handlers
+    ReceiveHandlersAreRegistered(false);
+    // and a local event notification, which unregisters itself, when it gets called
+    IMessagePassingService::HandlerRegistrationNoType registration_no{};
+    safecpp::Scope<> event_receive_handler_scope{};
+    auto eventUpdateNotificationHandler =
+        BindingEventReceiveHandler(event_receive_handler_scope, [this, &registration_no]() noexcept {
+            notify_event_callback_counter_++;
+            unit_.value().UnregisterEventNotification(
+                QualityType::kASIL_QM, SOME_ELEMENT_FQ_ID, registration_no, LOCAL_NODE_ID);
+        });
+    registration_no = unit_.value().RegisterEventNotification(
+        QualityType::kASIL_QM,
+        SOME_ELEMENT_FQ_ID,
+        std::move(eventUpdateNotificationHandler),
+        LOCAL_NODE_ID,
+        ReceiveHandlerDispatch::kThreadPool);
+
+    // when a NotifyEventMessage (id = kNotifyEvent) is received twice for this event id
+    message_passing::ShortMessagePayload payload = ElementFqIdToShortMsgPayload(SOME_ELEMENT_FQ_ID);
+    event_notify_message_received_(payload, REMOTE_NODE_ID);
+    event_notify_message_received_(payload, REMOTE_NODE_ID);
+
+    // expect, that the handler has been called only once (and the unregistration from within the handler didn't block)
+    EXPECT_EQ(notify_event_callback_counter_, 1);
+}
+
 TEST_F(NotifyEventHandlerFixture, ReceiveUnregisterEventNotification)
 {
     // given a NotifyEventHandler without ASIL support
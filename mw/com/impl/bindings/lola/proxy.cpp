@@ -20,6 +20,7 @@
 #include "platform/aas/mw/com/impl/bindings/lola/partial_restart_path_builder.h"
 #include "platform/aas/mw/com/impl/bindings/lola/service_data_control.h"
 #include "platform/aas/mw/com/impl/bindings/lola/service_data_storage.h"
+#include "platform/aas/mw/com/impl/bindings/lola/shm_page_backing.h"
 #include "platform/aas/mw/com/impl/bindings/lola/shm_path_builder.h"
 #include "platform/aas/mw/com/impl/bindings/lola/transaction_log_rollback_executor.h"
 #include "platform/aas/mw/com/impl/configuration/lola_event_instance_deployment.h"
@@ -77,6 +78,25 @@ const LolaServiceInstanceDeployment* GetLoLaInstanceDeployment(const bmw::mw::co
     return instance_deployment;
 }
 
+/// \brief Returns the deployment of the event or field with the given name or nullptr, if there is none.
+auto FindServiceElementDeployment(const LolaServiceInstanceDeployment& instance_deployment,
+                                  const amp::string_view service_element_name) noexcept
+    -> const LolaEventInstanceDeployment*
+{
+    const std::string element_name{service_element_name.data(), service_element_name.size()};
+    const auto event_it = instance_deployment.events_.find(element_name);
+    if (event_it != instance_deployment.events_.cend())
+    {
+        return &event_it->second;
+    }
+    const auto field_it = instance_deployment.fields_.find(element_name);
+    if (field_it != instance_deployment.fields_.cend())
+    {
+        return &field_it->second;
+    }
+    return nullptr;
+}
+
 const LolaServiceTypeDeployment* GetLoLaServiceTypeDeployment(const bmw::mw::com::impl::HandleType& handle) noexcept
 {
     const auto* lola_service_deployment = amp::get_if<LolaServiceTypeDeployment>(
@@ -112,6 +132,12 @@ CreateSharedMemory(const LolaServiceInstanceDeployment* instance_deployment,
         return std::make_pair(nullptr, nullptr);
     }
 
+    // static cast is safe here as SharedMemoryFactory::Open() returns SharedMemoryResources!
+    ApplyShmPageBacking(
+        *std::static_pointer_cast<memory::shared::ISharedMemoryResource>(control), true, *instance_deployment);
+    ApplyShmPageBacking(
+        *std::static_pointer_cast<memory::shared::ISharedMemoryResource>(data), false, *instance_deployment);
+
     return std::make_pair(control, data);
 }
 
@@ -384,6 +410,18 @@ EventMetaInfo Proxy::GetEventMetaInfo(const ElementFqId element_fq_id) const noe
     }
 }
 
+amp::optional<EventPerformanceCounters::Snapshot> Proxy::GetEventPerformanceCounters(
+    const ElementFqId element_fq_id) const noexcept
+{
+    auto& service_data_control = GetServiceDataControl(control_);
+    const auto event_entry = service_data_control.event_controls_.find(element_fq_id);
+    if (event_entry == service_data_control.event_controls_.end())
+    {
+        return amp::nullopt;
+    }
+    return event_entry->second.data_control.GetPerformanceCountersSnapshot();
+}
+
 bool Proxy::IsEventProvided(const amp::string_view event_name) const noexcept
 {
     auto& service_data_control = GetServiceDataControl(control_);
@@ -423,11 +461,32 @@ pid_t Proxy::GetSourcePid() const noexcept
     return service_data_storage.skeleton_pid_;
 }
 
+std::uint32_t Proxy::GetOfferEpoch() const noexcept
+{
+    auto& service_data_storage = GetServiceDataStorage(data_);
+    return service_data_storage.offer_epoch_.load(std::memory_order_acquire);
+}
+
 const InstanceSpecifier& Proxy::GetInstanceSpecifier() const noexcept
 {
     return handle_.GetDeploymentInformation().instance_specifier_;
 }
 
+ReceiveHandlerDispatch Proxy::GetReceiveHandlerDispatch(const amp::string_view service_element_name) const noexcept
+{
+    const auto* const deployment =
+        FindServiceElementDeployment(*GetLoLaInstanceDeployment(handle_), service_element_name);
+    return (deployment != nullptr) ? deployment->receive_handler_dispatch_ : ReceiveHandlerDispatch::kThreadPool;
+}
+
+ReceiveHandlerThreadAttributes Proxy::GetReceiveHandlerThreadAttributes(
+    const amp::string_view service_element_name) const noexcept
+{
+    const auto* const deployment =
+        FindServiceElementDeployment(*GetLoLaInstanceDeployment(handle_), service_element_name);
+    return (deployment != nullptr) ? deployment->receive_handler_thread_attributes_ : ReceiveHandlerThreadAttributes{};
+}
+
 }  // namespace lola
 }  // namespace impl
 }  // namespace com
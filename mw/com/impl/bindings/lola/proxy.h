@@ -18,6 +18,7 @@
 #include "platform/aas/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "platform/aas/mw/com/impl/bindings/lola/event_control.h"
 #include "platform/aas/mw/com/impl/bindings/lola/event_meta_info.h"
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
 #include "platform/aas/mw/com/impl/handle_type.h"
 #include "platform/aas/mw/com/impl/instance_identifier.h"
 #include "platform/aas/mw/com/impl/proxy_binding.h"
@@ -31,8 +32,10 @@
 #include "platform/aas/lib/os/glob.h"
 #include "platform/aas/lib/result/result.h"
 
+#include <amp_optional.hpp>
 #include <amp_string_view.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -125,6 +128,16 @@ class Proxy : public ProxyBinding
     /// \return An event data meta info.
     EventMetaInfo GetEventMetaInfo(const ElementFqId element_fq_id) const noexcept;
 
+    /// Retrieves the performance counters of an event.
+    ///
+    /// The counters are read from the control shared memory of the quality level this proxy is connected to. They
+    /// include the activity of the skeleton and of all proxies of this quality level, not only of this proxy.
+    ///
+    /// \param element_fq_id The Event ID.
+    /// \return Snapshot of the counters or an empty optional if the event couldn't be found.
+    amp::optional<EventPerformanceCounters::Snapshot> GetEventPerformanceCounters(
+        const ElementFqId element_fq_id) const noexcept;
+
     /// Checks whether the event corresponding to event_name is provided
     ///
     /// It does this by checking whether the event corresponding to event_name exists in shared memory.
@@ -156,8 +169,22 @@ class Proxy : public ProxyBinding
     /// \return
     pid_t GetSourcePid() const noexcept;
 
+    /// \brief Returns the number of completed offers of the provider/skeleton side, this proxy is "connected" with.
+    /// \details Changes, whenever the skeleton re-offers the service instance on the same shm-objects, e.g. after it
+    /// resumed a suspended offer.
+    std::uint32_t GetOfferEpoch() const noexcept;
+
     const InstanceSpecifier& GetInstanceSpecifier() const noexcept;
 
+    /// \brief Returns the configured dispatch policy for the receive handler of the given event/field.
+    /// \return The configured policy or ReceiveHandlerDispatch::kThreadPool, if there is no deployment for the name.
+    ReceiveHandlerDispatch GetReceiveHandlerDispatch(const amp::string_view service_element_name) const noexcept;
+
+    /// \brief Returns the configured attributes of the dedicated receive handler thread of the given event/field.
+    /// \return The configured attributes or no attributes, if there is no deployment for the name.
+    ReceiveHandlerThreadAttributes GetReceiveHandlerThreadAttributes(
+        const amp::string_view service_element_name) const noexcept;
+
   private:
     void ServiceAvailabilityChangeHandler(const bool is_service_available) noexcept;
 
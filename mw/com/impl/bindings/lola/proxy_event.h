@@ -18,6 +18,7 @@
 #include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
 #include "platform/aas/mw/com/impl/bindings/lola/proxy_event_common.h"
 #include "platform/aas/mw/com/impl/proxy_event_binding.h"
+#include "platform/aas/mw/com/impl/sample_batch.h"
 #include "platform/aas/mw/com/impl/sample_reference_tracker.h"
 #include "platform/aas/mw/com/impl/tracing/i_tracing_runtime.h"
 
@@ -26,16 +27,21 @@
 
 #include <amp_assert.hpp>
 #include <amp_optional.hpp>
+#include <amp_span.hpp>
 #include <amp_string_view.hpp>
 #include <amp_variant.hpp>
 
+#include <atomic>
+#include <cstring>
 #include <exception>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace bmw
 {
@@ -55,7 +61,7 @@ namespace lola
 ///
 /// \tparam SampleType Data type that is transmitted
 template <typename SampleType>
-class ProxyEvent final : public ProxyEventBinding<SampleType>
+class ProxyEvent final : public ProxyEventBinding<SampleType>, public ISampleBatchOwner
 {
     template <typename T>
     friend class ProxyEventAttorney;
@@ -94,6 +100,23 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
     Result<std::size_t> GetNumNewSamplesAvailable() const noexcept override;
     Result<std::size_t> GetNewSamples(Callback&& receiver, TrackerGuardFactory& tracker) noexcept override;
 
+    /// \brief Copies the newest sample out of its slot without referencing the slot (seqlock-style read).
+    ///
+    /// \details Neither the slot state nor the TransactionLog is modified, so concurrent readers don't contend on
+    /// shared cache lines. If the producer overwrites the slot while it is copied, the copy is detected as torn and the
+    /// read is retried. Only supported for trivially copyable sample types.
+    Result<SampleType> GetLatestValue() const noexcept override;
+
+    /// \brief Collects the new samples like GetNewSamples(), but hands them out as one SampleBatch.
+    ///
+    /// \details The slots of the batch are referenced in the same way as for GetNewSamples(). Only one batch can be
+    /// handed out at a time, as the batch views on storage owned by this class. The storage is allocated on first use
+    /// and reused afterwards.
+    Result<SampleBatch<SampleType>> GetNewSamplesBatch(TrackerGuardFactory& tracker) noexcept override;
+
+    /// \brief Dereferences all slots of the batch, which is currently handed out.
+    void ReleaseSampleBatch() noexcept override;
+
     ResultBlank SetReceiveHandler(BindingEventReceiveHandler handler) noexcept override
     {
         return proxy_event_common_.SetReceiveHandler(std::move(handler));
@@ -115,8 +138,19 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
   private:
     Result<std::size_t> GetNewSamplesImpl(Callback&& receiver, TrackerGuardFactory& tracker) noexcept;
     Result<std::size_t> GetNumNewSamplesAvailableImpl() const noexcept;
+    Result<SampleType> GetLatestValueImpl() const noexcept;
+    Result<SampleBatch<SampleType>> GetNewSamplesBatchImpl(TrackerGuardFactory& tracker) noexcept;
+
+    /// \brief Max number of attempts to copy the latest sample, before giving up due to a producer, which overwrites
+    ///        the slot faster than it can be copied.
+    static constexpr std::size_t kMaxLatestValueReadRetries{100U};
 
     ProxyEventCommon proxy_event_common_;
+
+    // storage of the SampleBatch, which is currently handed out.
+    std::vector<const SampleType*> batch_samples_{};
+    std::vector<EventDataControl::SlotIndexType> batch_slots_{};
+    std::atomic<bool> batch_handed_out_{false};
 };
 
 template <typename SampleType>
@@ -206,6 +240,134 @@ inline Result<std::size_t> ProxyEvent<SampleType>::GetNewSamplesImpl(Callback&&
     return num_collected_slots;
 }
 
+template <typename SampleType>
+inline Result<SampleBatch<SampleType>> ProxyEvent<SampleType>::GetNewSamplesBatch(TrackerGuardFactory& tracker) noexcept
+{
+    const auto subscription_state = proxy_event_common_.GetSubscriptionState();
+    if (subscription_state == SubscriptionState::kSubscribed)
+    {
+        return GetNewSamplesBatchImpl(tracker);
+    }
+    else
+    {
+        return MakeUnexpected(ComErrc::kNotSubscribed,
+                              "Attempt to call GetNewSamplesBatch without successful subscription.");
+    }
+}
+
+template <typename SampleType>
+inline Result<SampleBatch<SampleType>> ProxyEvent<SampleType>::GetNewSamplesBatchImpl(
+    TrackerGuardFactory& tracker) noexcept
+{
+    if (batch_handed_out_.exchange(true))
+    {
+        return MakeUnexpected(ComErrc::kMaxSamplesReached,
+                              "Only one SampleBatch per event can be handed out at a time.");
+    }
+
+    const auto max_sample_count = tracker.GetNumAvailableGuards();
+    const auto slot_indices = proxy_event_common_.GetNewSamplesSlotIndices(max_sample_count);
+
+    const void* const event_data_storage = proxy_event_common_.GetRawEventDataStorage();
+    if (event_data_storage == nullptr)
+    {
+        bmw::mw::log::LogFatal("lola") << __func__ << __LINE__
+                                       << "Unable to find data channel for given event instance. Terminating.";
+        std::terminate();
+    }
+    AMP_PRECONDITION_PRD_MESSAGE(
+        proxy_event_common_.GetTransactionLogIndex().has_value(),
+        "GetNewSamplesBatchImpl should only be called after a TransactionLog has been registered.");
+
+    const auto* const samples = static_cast<const EventDataStorage<SampleType>*>(event_data_storage);
+    batch_samples_.clear();
+    batch_slots_.clear();
+    // only allocates on the first call or if max_sample_count has grown since.
+    batch_samples_.reserve(max_sample_count);
+    batch_slots_.reserve(max_sample_count);
+    for (auto slot = slot_indices.begin; slot != slot_indices.end; ++slot)
+    {
+        batch_samples_.push_back(&samples->at(*slot));
+        batch_slots_.push_back(*slot);
+    }
+
+    return SampleBatch<SampleType>{amp::span<const SampleType* const>{batch_samples_.data(), batch_samples_.size()},
+                                   tracker.TakeGuards(batch_samples_.size()),
+                                   *this};
+}
+
+template <typename SampleType>
+inline void ProxyEvent<SampleType>::ReleaseSampleBatch() noexcept
+{
+    auto& event_data_control = proxy_event_common_.GetEventControl().data_control;
+    const auto transaction_log_index = proxy_event_common_.GetTransactionLogIndex();
+    AMP_PRECONDITION_PRD_MESSAGE(transaction_log_index.has_value(),
+                                 "A SampleBatch must be released before its TransactionLog is unregistered.");
+    for (const auto slot : batch_slots_)
+    {
+        event_data_control.DereferenceEvent(slot, transaction_log_index.value());
+    }
+    batch_samples_.clear();
+    batch_slots_.clear();
+    batch_handed_out_.store(false);
+}
+
+template <typename SampleType>
+inline Result<SampleType> ProxyEvent<SampleType>::GetLatestValue() const noexcept
+{
+    const auto subscription_state = proxy_event_common_.GetSubscriptionState();
+    if (subscription_state == SubscriptionState::kSubscribed)
+    {
+        return GetLatestValueImpl();
+    }
+    else
+    {
+        return MakeUnexpected(ComErrc::kNotSubscribed,
+                              "Attempt to call GetLatestValue without successful subscription.");
+    }
+}
+
+template <typename SampleType>
+inline Result<SampleType> ProxyEvent<SampleType>::GetLatestValueImpl() const noexcept
+{
+    // The sample is copied while the producer may overwrite it, which is only valid for types that can be copied
+    // bytewise.
+    if constexpr (std::is_trivially_copyable<SampleType>::value && std::is_default_constructible<SampleType>::value)
+    {
+        const void* const event_data_storage = proxy_event_common_.GetRawEventDataStorage();
+        if (event_data_storage == nullptr)
+        {
+            bmw::mw::log::LogFatal("lola") << __func__ << __LINE__
+                                           << "Unable to find data channel for given event instance. Terminating.";
+            std::terminate();
+        }
+        const auto& event_data_control = proxy_event_common_.GetEventControl().data_control;
+        const auto* const samples = static_cast<const EventDataStorage<SampleType>*>(event_data_storage);
+
+        for (std::size_t retry_counter{0U}; retry_counter < kMaxLatestValueReadRetries; ++retry_counter)
+        {
+            const auto newest_event = event_data_control.FindNewestEvent();
+            if (!newest_event.has_value())
+            {
+                return MakeUnexpected(ComErrc::kFieldValueIsNotValid, "No sample has been sent yet.");
+            }
+
+            SampleType sample_copy{};
+            std::memcpy(&sample_copy, &samples->at(newest_event->first), sizeof(SampleType));
+            if (event_data_control.IsEventUnchanged(newest_event->first, newest_event->second))
+            {
+                return sample_copy;
+            }
+        }
+        return MakeUnexpected(ComErrc::kBindingFailure, "Latest sample got overwritten during every read attempt.");
+    }
+    else
+    {
+        return MakeUnexpected(ComErrc::kBindingFailure,
+                              "GetLatestValue is only supported for trivially copyable sample types.");
+    }
+}
+
 }  // namespace lola
 }  // namespace impl
 }  // namespace com
@@ -61,7 +61,9 @@ ProxyEventCommon::ProxyEventCommon(Proxy& parent, const ElementFqId element_fq_i
                                         event_fq_id_,
                                         GetEventSourcePid(),
                                         event_control_,
-                                        transaction_log_id_}
+                                        transaction_log_id_,
+                                        parent_.GetReceiveHandlerDispatch(event_name),
+                                        parent_.GetReceiveHandlerThreadAttributes(event_name)}
 {
 }
 
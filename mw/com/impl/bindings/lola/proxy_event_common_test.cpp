@@ -86,7 +86,7 @@ class LolaProxyEventCommonFixture : public ProxyMockedMemoryFixture
 
         EXPECT_CALL(event_handler_, Call());
 
-        EXPECT_CALL(*mock_service_, RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, kDummyPid))
+        EXPECT_CALL(*mock_service_, RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, kDummyPid, _))
             .WillOnce(::testing::Invoke([&](auto, auto, BindingEventReceiveHandler handler, auto) {
                 handler();
                 return my_handler_no;
@@ -201,7 +201,7 @@ TYPED_TEST(LolaProxyEventCommonFixture, UnsubscribingWillUnregisterEventHandler)
 
     // Expecting that a receive handler will be registered
     EXPECT_CALL(*this->mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, this->kDummyPid))
+                RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, this->kDummyPid, _))
         .WillOnce(Return(my_handler_no));
 
     // and the same receive handler will be unregistered
@@ -245,7 +245,7 @@ TYPED_TEST(LolaProxyEventCommonFixture, DestroyingTheProxyEventWillUnregisterEve
 
     // Expecting that a receive handler will be registered
     EXPECT_CALL(*this->mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, this->kDummyPid))
+                RegisterEventNotification(QualityType::kASIL_QM, kElementFqId, _, this->kDummyPid, _))
         .WillOnce(Return(my_handler_no));
 
     // and the same receive handler will be unregistered
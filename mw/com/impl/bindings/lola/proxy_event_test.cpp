@@ -415,6 +415,142 @@ TYPED_TEST(LolaProxyEventFixture, GetBindingType)
     EXPECT_EQ(Base::test_proxy_event_.GetBindingType(), BindingType::kLoLa);
 }
 
+using LolaProxyEventLatestValueFixture = LolaProxyEventResources;
+TEST_F(LolaProxyEventLatestValueFixture, GetLatestValueReturnsNewestSampleWithoutReferencingIt)
+{
+    RecordProperty("Verifies", "");
+    RecordProperty("Description", "Checks that GetLatestValue copies the newest sample without referencing its slot.");
+    RecordProperty("TestType", "Requirements-based test");
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a subscribed ProxyEvent and two samples sent by the provider
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    PutData(1U, 1U);
+    const auto newest_slot = PutData(42U, 2U);
+    proxy_event.Subscribe(1U);
+
+    // When getting the latest value
+    const auto latest_value = proxy_event.GetLatestValue();
+
+    // Then the value of the newest sample is returned
+    ASSERT_TRUE(latest_value.has_value());
+    EXPECT_EQ(latest_value.value(), 42U);
+
+    // and the slot of the newest sample is not referenced
+    EXPECT_EQ(event_control_->data_control[newest_slot].GetReferenceCount(), 0U);
+
+    // and the sample is still reported as new sample, since GetNewSamples() wasn't called
+    const auto num_new_samples = proxy_event.GetNumNewSamplesAvailable();
+    ASSERT_TRUE(num_new_samples.has_value());
+    EXPECT_EQ(num_new_samples.value(), 2U);
+    proxy_event.Unsubscribe();
+}
+
+TEST_F(LolaProxyEventLatestValueFixture, GetLatestValueFailsIfNoSampleWasSent)
+{
+    // Given a subscribed ProxyEvent without any sample sent by the provider
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    proxy_event.Subscribe(1U);
+
+    // When getting the latest value
+    const auto latest_value = proxy_event.GetLatestValue();
+
+    // Then an error is returned, which indicates that there is no valid value
+    ASSERT_FALSE(latest_value.has_value());
+    EXPECT_EQ(latest_value.error(), ComErrc::kFieldValueIsNotValid);
+    proxy_event.Unsubscribe();
+}
+
+TEST_F(LolaProxyEventLatestValueFixture, GetLatestValueFailsWhenNotSubscribed)
+{
+    // Given a ProxyEvent, which is not subscribed, and a sample sent by the provider
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    PutData();
+
+    // When getting the latest value
+    const auto latest_value = proxy_event.GetLatestValue();
+
+    // Then an error is returned, which indicates the missing subscription
+    ASSERT_FALSE(latest_value.has_value());
+    EXPECT_EQ(latest_value.error(), ComErrc::kNotSubscribed);
+}
+
+using LolaProxyEventSampleBatchFixture = LolaProxyEventResources;
+TEST_F(LolaProxyEventSampleBatchFixture, GetNewSamplesBatchProvidesAllNewSamplesAndReleasesThemTogether)
+{
+    // Given a subscribed ProxyEvent and two samples sent by the provider
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    const auto first_slot = PutData(1U, 1U);
+    const auto second_slot = PutData(2U, 2U);
+    proxy_event.Subscribe(2U);
+    SampleReferenceTracker sample_reference_tracker{2U};
+    TrackerGuardFactory guard_factory{sample_reference_tracker.Allocate(2U)};
+
+    {
+        // When getting the new samples as one batch
+        auto batch = proxy_event.GetNewSamplesBatch(guard_factory);
+
+        // Then both samples are provided in the order they have been sent
+        ASSERT_TRUE(batch.has_value());
+        ASSERT_EQ(batch.value().size(), 2U);
+        EXPECT_EQ(batch.value()[0U], 1U);
+        EXPECT_EQ(batch.value()[1U], 2U);
+
+        // and both slots and references are in use until the batch is destroyed
+        EXPECT_EQ(event_control_->data_control[first_slot].GetReferenceCount(), 1U);
+        EXPECT_EQ(event_control_->data_control[second_slot].GetReferenceCount(), 1U);
+        EXPECT_EQ(sample_reference_tracker.GetNumAvailableSamples(), 0U);
+    }
+
+    // and all of them are released together with the batch
+    EXPECT_EQ(event_control_->data_control[first_slot].GetReferenceCount(), 0U);
+    EXPECT_EQ(event_control_->data_control[second_slot].GetReferenceCount(), 0U);
+    EXPECT_EQ(sample_reference_tracker.GetNumAvailableSamples(), 2U);
+    proxy_event.Unsubscribe();
+}
+
+TEST_F(LolaProxyEventSampleBatchFixture, OnlyOneSampleBatchCanBeHandedOutAtATime)
+{
+    // Given a subscribed ProxyEvent, of which a batch is currently handed out
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    PutData(1U, 1U);
+    proxy_event.Subscribe(2U);
+    SampleReferenceTracker sample_reference_tracker{2U};
+    TrackerGuardFactory guard_factory{sample_reference_tracker.Allocate(2U)};
+    {
+        auto first_batch = proxy_event.GetNewSamplesBatch(guard_factory);
+        ASSERT_TRUE(first_batch.has_value());
+
+        // When getting a second batch
+        const auto second_batch = proxy_event.GetNewSamplesBatch(guard_factory);
+
+        // Then an error is returned
+        ASSERT_FALSE(second_batch.has_value());
+        EXPECT_EQ(second_batch.error(), ComErrc::kMaxSamplesReached);
+    }
+
+    // and a further batch can be received after the first one has been destroyed
+    EXPECT_TRUE(proxy_event.GetNewSamplesBatch(guard_factory).has_value());
+    proxy_event.Unsubscribe();
+}
+
+TEST_F(LolaProxyEventSampleBatchFixture, GetNewSamplesBatchFailsWhenNotSubscribed)
+{
+    // Given a ProxyEvent, which is not subscribed, and a sample sent by the provider
+    ProxyEvent<TestSampleType> proxy_event{*parent_, element_fq_id_, event_name_};
+    PutData();
+    SampleReferenceTracker sample_reference_tracker{1U};
+    TrackerGuardFactory guard_factory{sample_reference_tracker.Allocate(1U)};
+
+    // When getting the new samples as one batch
+    const auto batch = proxy_event.GetNewSamplesBatch(guard_factory);
+
+    // Then an error is returned, which indicates the missing subscription
+    ASSERT_FALSE(batch.has_value());
+    EXPECT_EQ(batch.error(), ComErrc::kNotSubscribed);
+}
+
 using LolaProxyEventDeathFixture = LolaProxyEventResources;
 TEST_F(LolaProxyEventDeathFixture, FailOnEventNotFound)
 {
@@ -513,6 +513,66 @@ TEST_F(ProxyTransactionLogRollbackFixture, FailureInRollingBackExistingTransacti
     EXPECT_EQ(parent_, nullptr);
 }
 
+class ProxyReceiveHandlerDispatchFixture : public ProxyMockedMemoryFixture
+{
+  protected:
+    const ReceiveHandlerThreadAttributes kDedicatedThreadAttributes{42, 0x03U};
+
+    ProxyReceiveHandlerDispatchFixture() noexcept
+    {
+        LolaEventInstanceDeployment inline_event_deployment{};
+        inline_event_deployment.receive_handler_dispatch_ = ReceiveHandlerDispatch::kInline;
+        LolaFieldInstanceDeployment dedicated_thread_field_deployment{};
+        dedicated_thread_field_deployment.receive_handler_dispatch_ = ReceiveHandlerDispatch::kDedicatedThread;
+        dedicated_thread_field_deployment.receive_handler_thread_attributes_ = kDedicatedThreadAttributes;
+
+        const ServiceInstanceDeployment service_instance_deployment{
+            service,
+            LolaServiceInstanceDeployment{LolaServiceInstanceId{kLolaServiceInstanceId},
+                                          {{"inline_event", inline_event_deployment},
+                                           {"default_event", LolaEventInstanceDeployment{}}},
+                                          {{"dedicated_thread_field", dedicated_thread_field_deployment}}},
+            QualityType::kASIL_QM,
+            kInstanceSpecifier};
+        InitialiseProxyWithCreate(make_InstanceIdentifier(service_instance_deployment, kServiceTypeDeployment));
+    }
+};
+
+TEST_F(ProxyReceiveHandlerDispatchFixture, ReturnsConfiguredDispatchOfEventsAndFields)
+{
+    // Given a proxy, whose deployment configures a receive handler dispatch for an event and a field
+    ASSERT_NE(parent_, nullptr);
+
+    // When asking for the receive handler dispatch of these service elements
+    // Then the configured values are returned
+    EXPECT_EQ(parent_->GetReceiveHandlerDispatch("inline_event"), ReceiveHandlerDispatch::kInline);
+    EXPECT_EQ(parent_->GetReceiveHandlerDispatch("dedicated_thread_field"), ReceiveHandlerDispatch::kDedicatedThread);
+}
+
+TEST_F(ProxyReceiveHandlerDispatchFixture, DefaultsToThreadPool)
+{
+    // Given a proxy
+    ASSERT_NE(parent_, nullptr);
+
+    // When asking for the receive handler dispatch of an event without configured dispatch or of an unknown element
+    // Then the thread pool is used
+    EXPECT_EQ(parent_->GetReceiveHandlerDispatch("default_event"), ReceiveHandlerDispatch::kThreadPool);
+    EXPECT_EQ(parent_->GetReceiveHandlerDispatch("unknown_event"), ReceiveHandlerDispatch::kThreadPool);
+}
+
+TEST_F(ProxyReceiveHandlerDispatchFixture, ReturnsConfiguredThreadAttributes)
+{
+    // Given a proxy, whose deployment configures receive handler thread attributes for a field
+    ASSERT_NE(parent_, nullptr);
+
+    // When asking for the receive handler thread attributes of the field, an event without attributes and an unknown
+    // element
+    // Then the configured attributes are returned for the field and no attributes for the others
+    EXPECT_EQ(parent_->GetReceiveHandlerThreadAttributes("dedicated_thread_field"), kDedicatedThreadAttributes);
+    EXPECT_EQ(parent_->GetReceiveHandlerThreadAttributes("default_event"), ReceiveHandlerThreadAttributes{});
+    EXPECT_EQ(parent_->GetReceiveHandlerThreadAttributes("unknown_event"), ReceiveHandlerThreadAttributes{});
+}
+
 }  // namespace
 }  // namespace lola
 }  // namespace impl
@@ -52,7 +52,7 @@ Runtime::Runtime(const Configuration& config,
                           ? amp::optional<MessagePassingFacade::AsilSpecificCfg>{Runtime::GetMessagePassingCfg(
                                 QualityType::kASIL_B)}
                           : amp::nullopt},
-      service_discovery_client_{long_running_threads_},
+      service_discovery_client_{long_running_threads_, Runtime::GetServiceRegistryUsers()},
       tracing_runtime_{std::move(lola_tracing_runtime)},
       rollback_data_{},
       pid_{os::Unistd::instance().getpid()},
@@ -148,11 +148,47 @@ bool Runtime::AggregateAllowedUsers(std::set<uid_t>& aggregated_allowed_users,
     return false;
 }
 
+std::vector<uid_t> Runtime::GetServiceRegistryUsers() const
+{
+    std::set<uid_t> aggregated_allowed_users;
+
+    for (const auto& instanceDeplElement : configuration_.GetServiceInstances())
+    {
+        const auto* const instance_deployment =
+            amp::get_if<LolaServiceInstanceDeployment>(&instanceDeplElement.second.bindingInfo_);
+        if (instance_deployment == nullptr)
+        {
+            continue;
+        }
+        // Like the shm-objects of the skeleton, an instance without any configured users isn't restricted at all.
+        if (instance_deployment->allowed_consumer_.empty() && instance_deployment->allowed_provider_.empty() &&
+            (instance_deployment->strict_permissions_ == false))
+        {
+            return {};
+        }
+        for (const auto asil_level : {QualityType::kASIL_QM, QualityType::kASIL_B})
+        {
+            if (AggregateAllowedUsers(aggregated_allowed_users, instance_deployment->allowed_consumer_, asil_level) ||
+                AggregateAllowedUsers(aggregated_allowed_users, instance_deployment->allowed_provider_, asil_level))
+            {
+                return {};
+            }
+        }
+    }
+
+    return std::vector<uid_t>(aggregated_allowed_users.begin(), aggregated_allowed_users.end());
+}
+
 ShmSizeCalculationMode Runtime::GetShmSizeCalculationMode() const
 {
     return configuration_.GetGlobalConfiguration().GetShmSizeCalcMode();
 }
 
+EventNotificationMode Runtime::GetEventNotificationMode() const
+{
+    return configuration_.GetGlobalConfiguration().GetEventNotificationMode();
+}
+
 IServiceDiscoveryClient& Runtime::GetServiceDiscoveryClient() noexcept
 {
     return service_discovery_client_;
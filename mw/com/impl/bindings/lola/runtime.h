@@ -79,6 +79,8 @@ class Runtime final : public IRuntime
 
     ShmSizeCalculationMode GetShmSizeCalculationMode() const override;
 
+    EventNotificationMode GetEventNotificationMode() const override;
+
     IServiceDiscoveryClient& GetServiceDiscoveryClient() noexcept override;
 
     RollbackData& GetRollbackData() noexcept override;
@@ -105,6 +107,11 @@ class Runtime final : public IRuntime
     static bool AggregateAllowedUsers(std::set<uid_t>& aggregated_allowed_users,
                                       const std::unordered_map<QualityType, std::vector<uid_t>>& allowed_user_ids,
                                       const QualityType asil_level);
+
+    /// \brief Aggregates the allowed consumers and providers of all service instances of both quality types. They are
+    ///        granted access to the node wide service registry.
+    /// \return aggregated user ids or an empty vector, if any service instance doesn't restrict its users.
+    std::vector<uid_t> GetServiceRegistryUsers() const;
     pid_t pid_;
     uid_t uid_;
 };
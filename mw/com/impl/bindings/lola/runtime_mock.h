@@ -42,6 +42,8 @@ class RuntimeMock : public IRuntime
     // 
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, override));
     // 
+    MOCK_METHOD(EventNotificationMode, GetEventNotificationMode, (), (const, override));
+    // 
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (noexcept, override));
     // 
     MOCK_METHOD(impl::tracing::ITracingRuntimeBinding*, GetTracingRuntime, (), (noexcept, override));
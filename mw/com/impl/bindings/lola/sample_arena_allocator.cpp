@@ -0,0 +1,198 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/sample_arena_allocator.h"
+
+#include <amp_assert.hpp>
+
+#include <iterator>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+std::size_t GetAllocationSize(const std::size_t size) noexcept
+{
+    return ((size + SampleArenaAllocator::kAlignment - 1U) / SampleArenaAllocator::kAlignment) *
+           SampleArenaAllocator::kAlignment;
+}
+
+}  // namespace
+
+SampleArenaAllocator::SampleArenaAllocator(const amp::span<std::uint8_t> arena) noexcept
+    : mutex_{}, arena_begin_{arena.data()}, arena_size_{0U}, free_ranges_{}
+{
+    const auto size = static_cast<std::size_t>(arena.size());
+    if (size == 0U)
+    {
+        return;
+    }
+
+    // The address is only used to calculate the alignment, it is never converted back to a pointer.
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(arena.data()) % kAlignment;
+    const std::size_t padding = (misalignment == 0U) ? 0U : (kAlignment - misalignment);
+    if (padding >= size)
+    {
+        return;
+    }
+    arena_begin_ = &arena[static_cast<std::size_t>(padding)];
+    arena_size_ = ((size - padding) / kAlignment) * kAlignment;
+    if (arena_size_ > 0U)
+    {
+        static_cast<void>(free_ranges_.emplace(0U, arena_size_));
+    }
+}
+
+amp::optional<amp::span<std::uint8_t>> SampleArenaAllocator::Allocate(const std::size_t size) noexcept
+{
+    if (size == 0U)
+    {
+        return amp::span<std::uint8_t>{arena_begin_, 0U};
+    }
+    const auto allocation_size = GetAllocationSize(size);
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto free_range = free_ranges_.begin(); free_range != free_ranges_.end(); ++free_range)
+    {
+        if (free_range->second < allocation_size)
+        {
+            continue;
+        }
+        const auto offset = free_range->first;
+        if (free_range->second > allocation_size)
+        {
+            static_cast<void>(free_ranges_.emplace_hint(
+                std::next(free_range), offset + allocation_size, free_range->second - allocation_size));
+        }
+        static_cast<void>(free_ranges_.erase(free_range));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is within the arena.
+        return amp::span<std::uint8_t>{arena_begin_ + offset, size};
+    }
+    return amp::nullopt;
+}
+
+void SampleArenaAllocator::Free(const amp::span<std::uint8_t> range) noexcept
+{
+    if (range.size() == 0U)
+    {
+        return;
+    }
+    const auto range_offset = FindOffset(range);
+    AMP_PRECONDITION_PRD_MESSAGE(range_offset.has_value(), "SampleArenaAllocator: Range has not been allocated");
+    const auto offset = range_offset.value();
+    const auto allocation_size = GetAllocationSize(static_cast<std::size_t>(range.size()));
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto next = free_ranges_.lower_bound(offset);
+    AMP_PRECONDITION_PRD_MESSAGE((next == free_ranges_.end()) || ((offset + allocation_size) <= next->first),
+                                 "SampleArenaAllocator: Freed range overlaps a free range");
+
+    auto merged = free_ranges_.end();
+    if (next != free_ranges_.begin())
+    {
+        const auto previous = std::prev(next);
+        AMP_PRECONDITION_PRD_MESSAGE((previous->first + previous->second) <= offset,
+                                     "SampleArenaAllocator: Freed range overlaps a free range");
+        if ((previous->first + previous->second) == offset)
+        {
+            previous->second += allocation_size;
+            merged = previous;
+        }
+    }
+    if (merged == free_ranges_.end())
+    {
+        merged = free_ranges_.emplace_hint(next, offset, allocation_size);
+    }
+    if ((next != free_ranges_.end()) && ((merged->first + merged->second) == next->first))
+    {
+        merged->second += next->second;
+        static_cast<void>(free_ranges_.erase(next));
+    }
+}
+
+bool SampleArenaAllocator::MarkAllocated(const amp::span<std::uint8_t> range) noexcept
+{
+    if (range.size() == 0U)
+    {
+        return true;
+    }
+    const auto range_offset = FindOffset(range);
+    if (!range_offset.has_value())
+    {
+        return false;
+    }
+    const auto offset = range_offset.value();
+    const auto allocation_size = GetAllocationSize(static_cast<std::size_t>(range.size()));
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto free_range = free_ranges_.upper_bound(offset);
+    if (free_range == free_ranges_.begin())
+    {
+        return false;
+    }
+    free_range = std::prev(free_range);
+    const auto free_range_end = free_range->first + free_range->second;
+    if (free_range_end < (offset + allocation_size))
+    {
+        return false;
+    }
+
+    if (free_range_end > (offset + allocation_size))
+    {
+        static_cast<void>(free_ranges_.emplace_hint(
+            std::next(free_range), offset + allocation_size, free_range_end - (offset + allocation_size)));
+    }
+    if (free_range->first < offset)
+    {
+        free_range->second = offset - free_range->first;
+    }
+    else
+    {
+        static_cast<void>(free_ranges_.erase(free_range));
+    }
+    return true;
+}
+
+std::size_t SampleArenaAllocator::GetFreeSize() const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    std::size_t free_size{0U};
+    for (const auto& free_range : free_ranges_)
+    {
+        free_size += free_range.second;
+    }
+    return free_size;
+}
+
+amp::optional<std::size_t> SampleArenaAllocator::FindOffset(const amp::span<std::uint8_t> range) const noexcept
+{
+    // The addresses are only compared, they are never converted back to pointers.
+    const auto range_begin = reinterpret_cast<std::uintptr_t>(range.data());
+    const auto arena_begin = reinterpret_cast<std::uintptr_t>(arena_begin_);
+    if ((range_begin < arena_begin) ||
+        (((range_begin - arena_begin) + static_cast<std::size_t>(range.size())) > arena_size_))
+    {
+        return amp::nullopt;
+    }
+    const auto offset = static_cast<std::size_t>(range_begin - arena_begin);
+    if ((offset % kAlignment) != 0U)
+    {
+        return amp::nullopt;
+    }
+    return offset;
+}
+
+}  // namespace bmw::mw::com::impl::lola
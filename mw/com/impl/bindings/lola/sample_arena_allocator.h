@@ -0,0 +1,87 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_ARENA_ALLOCATOR_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_ARENA_ALLOCATOR_H
+
+#include <amp_optional.hpp>
+#include <amp_span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Producer side bookkeeping of the free bytes within the sample arena of an event.
+///
+/// \details The sample arena is a byte array in the data shared memory, from which the DynamicSamples of an event get
+/// their data. Each allocated range belongs to exactly one sample slot: It is allocated after the slot has been
+/// acquired for writing and freed, when the slot gets acquired for writing the next time. A slot can only be acquired,
+/// if no consumer references it. So the range of a sample is never reused while a consumer still reads it, and the
+/// consumers don't need to access this bookkeeping at all. It is therefore kept in the process local memory of the
+/// producer.
+///
+/// Free ranges are kept ordered by their offset and are merged with their neighbours on Free(). Allocate() takes the
+/// first free range, which is big enough. All ranges start at a multiple of kAlignment. Since shared memory is always
+/// mapped page-aligned, the ranges have this alignment in every process.
+class SampleArenaAllocator final
+{
+  public:
+    /// \brief Alignment of all allocated ranges. Allocation sizes are rounded up to a multiple of it.
+    static constexpr std::size_t kAlignment{alignof(std::max_align_t)};
+
+    /// \brief Creates the bookkeeping for the given arena, which is completely free.
+    explicit SampleArenaAllocator(const amp::span<std::uint8_t> arena) noexcept;
+    ~SampleArenaAllocator() noexcept = default;
+
+    SampleArenaAllocator(const SampleArenaAllocator&) = delete;
+    SampleArenaAllocator& operator=(const SampleArenaAllocator&) = delete;
+    SampleArenaAllocator(SampleArenaAllocator&&) noexcept = delete;
+    SampleArenaAllocator& operator=(SampleArenaAllocator&& other) noexcept = delete;
+
+    /// \brief Allocates a range of the given size (thread-safe).
+    /// \return the allocated range or an empty optional, if there is no free range of this size.
+    amp::optional<amp::span<std::uint8_t>> Allocate(const std::size_t size) noexcept;
+
+    /// \brief Returns a range, which has been allocated via Allocate() or MarkAllocated(), to the arena (thread-safe).
+    void Free(const amp::span<std::uint8_t> range) noexcept;
+
+    /// \brief Marks a range as allocated, which is already referenced by a sample (thread-safe).
+    /// \details Used to restore the bookkeeping from the samples, when the arena is re-used after a restart of the
+    ///          producer.
+    /// \return false, if the range is not within the arena or not completely free.
+    bool MarkAllocated(const amp::span<std::uint8_t> range) noexcept;
+
+    /// \brief Returns the number of free bytes (thread-safe).
+    std::size_t GetFreeSize() const noexcept;
+
+  private:
+    /// \brief Returns the offset of the range within the arena or an empty optional, if the range can't have been
+    ///        allocated from this arena.
+    amp::optional<std::size_t> FindOffset(const amp::span<std::uint8_t> range) const noexcept;
+
+    mutable std::mutex mutex_;
+    std::uint8_t* arena_begin_;
+    std::size_t arena_size_;
+    /// \brief Free ranges as offset from arena_begin_ to size.
+    std::map<std::size_t, std::size_t> free_ranges_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_ARENA_ALLOCATOR_H
@@ -0,0 +1,188 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/sample_arena_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr std::size_t kArenaSize{8U * SampleArenaAllocator::kAlignment};
+
+class SampleArenaAllocatorFixture : public ::testing::Test
+{
+  protected:
+    alignas(SampleArenaAllocator::kAlignment) std::uint8_t arena_[kArenaSize]{};
+    SampleArenaAllocator unit_{amp::span<std::uint8_t>{arena_, kArenaSize}};
+};
+
+TEST_F(SampleArenaAllocatorFixture, NewArenaIsCompletelyFree)
+{
+    // Given a new allocator
+    // Then the whole arena is free
+    EXPECT_EQ(unit_.GetFreeSize(), kArenaSize);
+}
+
+TEST_F(SampleArenaAllocatorFixture, AllocatesAlignedRangesOfRequestedSize)
+{
+    // When allocating two ranges
+    const auto first_range = unit_.Allocate(3U);
+    const auto second_range = unit_.Allocate(SampleArenaAllocator::kAlignment + 1U);
+
+    // Then both have the requested size and are placed one after the other at aligned addresses
+    ASSERT_TRUE(first_range.has_value());
+    ASSERT_TRUE(second_range.has_value());
+    EXPECT_EQ(first_range->size(), 3U);
+    EXPECT_EQ(second_range->size(), SampleArenaAllocator::kAlignment + 1U);
+    EXPECT_EQ(first_range->data(), &arena_[0U]);
+    EXPECT_EQ(second_range->data(), &arena_[SampleArenaAllocator::kAlignment]);
+
+    // and the allocated sizes are rounded up to the alignment
+    EXPECT_EQ(unit_.GetFreeSize(), kArenaSize - (3U * SampleArenaAllocator::kAlignment));
+}
+
+TEST_F(SampleArenaAllocatorFixture, AllocationFailsIfNoFreeRangeIsBigEnough)
+{
+    // Given an arena, of which half is allocated
+    ASSERT_TRUE(unit_.Allocate(kArenaSize / 2U).has_value());
+
+    // When allocating more than the other half
+    const auto range = unit_.Allocate((kArenaSize / 2U) + 1U);
+
+    // Then the allocation fails
+    EXPECT_FALSE(range.has_value());
+}
+
+TEST_F(SampleArenaAllocatorFixture, FreedRangesAreMergedWithTheirNeighbours)
+{
+    // Given an arena, which is split into three allocated ranges
+    const auto first_range = unit_.Allocate(2U * SampleArenaAllocator::kAlignment);
+    const auto second_range = unit_.Allocate(2U * SampleArenaAllocator::kAlignment);
+    const auto third_range = unit_.Allocate(4U * SampleArenaAllocator::kAlignment);
+    ASSERT_TRUE(first_range.has_value());
+    ASSERT_TRUE(second_range.has_value());
+    ASSERT_TRUE(third_range.has_value());
+    ASSERT_EQ(unit_.GetFreeSize(), 0U);
+
+    // When freeing the outer ranges first and then the middle one
+    unit_.Free(first_range.value());
+    unit_.Free(third_range.value());
+    unit_.Free(second_range.value());
+
+    // Then the whole arena can be allocated at once again
+    EXPECT_EQ(unit_.GetFreeSize(), kArenaSize);
+    EXPECT_TRUE(unit_.Allocate(kArenaSize).has_value());
+}
+
+TEST_F(SampleArenaAllocatorFixture, AllocatesFirstFreeRangeWhichIsBigEnough)
+{
+    // Given an arena with a free range of one and of two alignment units
+    const auto first_range = unit_.Allocate(SampleArenaAllocator::kAlignment);
+    ASSERT_TRUE(unit_.Allocate(SampleArenaAllocator::kAlignment).has_value());
+    const auto third_range = unit_.Allocate(2U * SampleArenaAllocator::kAlignment);
+    ASSERT_TRUE(unit_.Allocate(4U * SampleArenaAllocator::kAlignment).has_value());
+    ASSERT_TRUE(first_range.has_value());
+    ASSERT_TRUE(third_range.has_value());
+    unit_.Free(first_range.value());
+    unit_.Free(third_range.value());
+
+    // When allocating two alignment units
+    const auto range = unit_.Allocate(2U * SampleArenaAllocator::kAlignment);
+
+    // Then the range freed by the third allocation is re-used
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->data(), third_range->data());
+}
+
+TEST_F(SampleArenaAllocatorFixture, ZeroSizedAllocationAlwaysSucceeds)
+{
+    // Given a completely allocated arena
+    ASSERT_TRUE(unit_.Allocate(kArenaSize).has_value());
+
+    // When allocating zero bytes
+    const auto range = unit_.Allocate(0U);
+
+    // Then an empty range is returned
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->size(), 0U);
+
+    // and freeing it has no effect
+    unit_.Free(range.value());
+    EXPECT_EQ(unit_.GetFreeSize(), 0U);
+}
+
+TEST_F(SampleArenaAllocatorFixture, MarkAllocatedRemovesRangeFromFreeRanges)
+{
+    // When marking a range in the middle of the arena as allocated
+    const amp::span<std::uint8_t> range{&arena_[2U * SampleArenaAllocator::kAlignment], 5U};
+    EXPECT_TRUE(unit_.MarkAllocated(range));
+
+    // Then it is not free anymore
+    EXPECT_EQ(unit_.GetFreeSize(), kArenaSize - SampleArenaAllocator::kAlignment);
+    EXPECT_FALSE(unit_.MarkAllocated(range));
+
+    // and the free ranges before and after it can be allocated
+    EXPECT_TRUE(unit_.Allocate(2U * SampleArenaAllocator::kAlignment).has_value());
+    EXPECT_TRUE(unit_.Allocate(5U * SampleArenaAllocator::kAlignment).has_value());
+    EXPECT_EQ(unit_.GetFreeSize(), 0U);
+}
+
+TEST_F(SampleArenaAllocatorFixture, UnalignedArenaIsAlignedByAllocator)
+{
+    // Given an allocator for an arena, which doesn't start at an aligned address
+    SampleArenaAllocator unit{amp::span<std::uint8_t>{&arena_[1U], kArenaSize - 1U}};
+
+    // When allocating a range
+    const auto range = unit.Allocate(1U);
+
+    // Then it starts at the first aligned address within the arena
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->data(), &arena_[SampleArenaAllocator::kAlignment]);
+    EXPECT_EQ(unit.GetFreeSize(), kArenaSize - (2U * SampleArenaAllocator::kAlignment));
+}
+
+TEST_F(SampleArenaAllocatorFixture, MarkAllocatedRejectsRangeOutsideOfArena)
+{
+    // Given a range, which ends behind the arena
+    const amp::span<std::uint8_t> range{&arena_[kArenaSize - SampleArenaAllocator::kAlignment],
+                                        SampleArenaAllocator::kAlignment + 1U};
+
+    // When marking it as allocated
+    // Then this is rejected and the arena stays free
+    EXPECT_FALSE(unit_.MarkAllocated(range));
+    EXPECT_EQ(unit_.GetFreeSize(), kArenaSize);
+}
+
+using SampleArenaAllocatorDeathTest = SampleArenaAllocatorFixture;
+TEST_F(SampleArenaAllocatorDeathTest, FreeingRangeTwiceTerminates)
+{
+    // Given a range, which has been freed
+    const auto range = unit_.Allocate(1U);
+    ASSERT_TRUE(range.has_value());
+    unit_.Free(range.value());
+
+    // When freeing it again
+    // Then the program terminates
+    EXPECT_DEATH(unit_.Free(range.value()), ".*");
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
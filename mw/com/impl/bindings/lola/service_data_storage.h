@@ -24,6 +24,9 @@
 
 #include "platform/aas/lib/os/unistd.h"
 
+#include <atomic>
+#include <cstdint>
+
 namespace bmw::mw::com::impl::lola
 {
 
@@ -31,13 +34,19 @@ class ServiceDataStorage
 {
   public:
     explicit ServiceDataStorage(const bmw::memory::shared::MemoryResourceProxy* const proxy)
-        : events_(proxy), events_metainfo_(proxy), skeleton_pid_{bmw::os::Unistd::instance().getpid()}
+        : events_(proxy),
+          events_metainfo_(proxy),
+          skeleton_pid_{bmw::os::Unistd::instance().getpid()},
+          offer_epoch_{0U}
     {
     }
 
     bmw::memory::shared::Map<ElementFqId, bmw::memory::shared::OffsetPtr<void>> events_;
     bmw::memory::shared::Map<ElementFqId, EventMetaInfo> events_metainfo_;
     pid_t skeleton_pid_;
+    /// \brief Number of completed offers of this data shm-object. It is only modified by the skeleton, but read by
+    /// proxies at any time, so it is stored with release and loaded with acquire semantics.
+    std::atomic<std::uint32_t> offer_epoch_;
 };
 
 }  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,306 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+
+#include "platform/aas/lib/memory/shared/shared_memory_factory.h"
+#include "platform/aas/lib/os/acl.h"
+#include "platform/aas/mw/log/logging.h"
+
+#include <amp_assert.hpp>
+#include <amp_utility.hpp>
+
+#include <unordered_set>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr auto kServiceRegistryShmName{"/lola-service-registry"};
+constexpr ServiceRegistryEntry::key_type kUnusedKey{0U};
+
+constexpr std::uint64_t kMask16Bit{0xFFFFU};
+constexpr std::uint32_t kStatusShift{48U};
+constexpr std::uint32_t kQualityShift{32U};
+constexpr std::uint32_t kServiceIdShift{16U};
+
+ServiceRegistryKey CreateRegistryKey(const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
+{
+    const auto service_id =
+        enriched_instance_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>().value();
+    const auto instance_id =
+        enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>().value();
+    return ServiceRegistryKey{service_id, instance_id, enriched_instance_identifier.GetQualityType()};
+}
+
+}  // namespace
+
+bool operator==(const ServiceRegistryKey& lhs, const ServiceRegistryKey& rhs) noexcept
+{
+    return (lhs.service_id == rhs.service_id) && (lhs.instance_id == rhs.instance_id) &&
+           (lhs.quality_type == rhs.quality_type);
+}
+
+std::pair<ServiceRegistryEntry::EntryStatus, ServiceRegistryKey> ServiceRegistryEntry::GetStatusAndKeyAtomic()
+    const noexcept
+{
+    const auto key_status = key_status_.load();
+    const auto status = static_cast<EntryStatus>((key_status >> kStatusShift) & kMask16Bit);
+    const ServiceRegistryKey key{static_cast<LolaServiceId>((key_status >> kServiceIdShift) & kMask16Bit),
+                                 static_cast<LolaServiceInstanceId::InstanceId>(key_status & kMask16Bit),
+                                 static_cast<QualityType>((key_status >> kQualityShift) & kMask16Bit)};
+    return {status, key};
+}
+
+ServiceRegistryEntry::key_type ServiceRegistryEntry::CreateKey(const EntryStatus status,
+                                                               const ServiceRegistryKey& key) noexcept
+{
+    key_type result = static_cast<std::uint16_t>(status);
+    result = (result << kStatusShift) | (static_cast<key_type>(key.quality_type) << kQualityShift);
+    result |= static_cast<key_type>(key.service_id) << kServiceIdShift;
+    result |= static_cast<key_type>(key.instance_id);
+    return result;
+}
+
+bool ServiceRegistryTable::Register(const ServiceRegistryKey& key, const pid_t pid) noexcept
+{
+    if (TryTakeOverEntry(key, pid))
+    {
+        return true;
+    }
+
+    for (std::size_t index{0U}; index < entries_.size(); ++index)
+    {
+        auto& entry = entries_[index];
+        auto expected_key = kUnusedKey;
+        // only try to claim entries, which look unused to not write to cache lines of used entries.
+        if ((entry.key_status_.load() == kUnusedKey) &&
+            entry.key_status_.compare_exchange_strong(
+                expected_key, ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUpdating, key)))
+        {
+            RaiseUsedEntries(index + 1U);
+            entry.pid_.store(pid);
+            entry.key_status_.store(ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUsed, key));
+            return true;
+        }
+    }
+
+    MarkDegraded();
+    return false;
+}
+
+void ServiceRegistryTable::Unregister(const ServiceRegistryKey& key, const pid_t pid) noexcept
+{
+    const auto used_key = ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUsed, key);
+    const auto updating_key = ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUpdating, key);
+    const auto used_entries = used_entries_.load();
+    for (std::size_t index{0U}; index < used_entries; ++index)
+    {
+        auto& entry = entries_[index];
+        auto expected_key = used_key;
+        // The entry is locked before checking the pid, so that it can't be taken over by another provider in between.
+        if ((entry.key_status_.load() == used_key) &&
+            entry.key_status_.compare_exchange_strong(expected_key, updating_key))
+        {
+            entry.key_status_.store((entry.pid_.load() == pid) ? kUnusedKey : used_key);
+        }
+    }
+}
+
+bool ServiceRegistryTable::IsOffered(const ServiceRegistryKey& key) const noexcept
+{
+    const auto used_key = ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUsed, key);
+    const auto used_entries = used_entries_.load();
+    for (std::size_t index{0U}; index < used_entries; ++index)
+    {
+        if (entries_[index].key_status_.load() == used_key)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<LolaServiceInstanceId::InstanceId> ServiceRegistryTable::GetOfferedInstanceIds(
+    const LolaServiceId service_id,
+    const QualityType quality_type) const noexcept
+{
+    std::vector<LolaServiceInstanceId::InstanceId> instance_ids{};
+    const auto used_entries = used_entries_.load();
+    for (std::size_t index{0U}; index < used_entries; ++index)
+    {
+        const auto status_key = entries_[index].GetStatusAndKeyAtomic();
+        const auto& entry_key = status_key.second;
+        if ((status_key.first == ServiceRegistryEntry::EntryStatus::kUsed) && (entry_key.service_id == service_id) &&
+            (entry_key.quality_type == quality_type))
+        {
+            instance_ids.push_back(entry_key.instance_id);
+        }
+    }
+    return instance_ids;
+}
+
+void ServiceRegistryTable::MarkDegraded() noexcept
+{
+    degraded_.store(true);
+}
+
+bool ServiceRegistryTable::IsDegraded() const noexcept
+{
+    return degraded_.load();
+}
+
+bool ServiceRegistryTable::TryTakeOverEntry(const ServiceRegistryKey& key, const pid_t pid) noexcept
+{
+    const auto used_key = ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUsed, key);
+    const auto updating_key = ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUpdating, key);
+    const auto used_entries = used_entries_.load();
+    for (std::size_t index{0U}; index < used_entries; ++index)
+    {
+        auto& entry = entries_[index];
+        auto expected_key = used_key;
+        const auto current_key = entry.key_status_.load();
+        if (current_key == updating_key)
+        {
+            // Someone crashed while claiming/updating an entry for our service instance. As we are offering this
+            // service instance now, the entry is ours.
+            bmw::mw::log::LogWarn("lola") << "ServiceRegistry: Found entry for offered service instance in state "
+                                             "kUpdating. Taking over entry.";
+            entry.pid_.store(pid);
+            entry.key_status_.store(used_key);
+            return true;
+        }
+        if ((current_key == used_key) && entry.key_status_.compare_exchange_strong(expected_key, updating_key))
+        {
+            // Entry left behind by a previous provider, which didn't stop its offer (e.g. due to a crash).
+            entry.pid_.store(pid);
+            entry.key_status_.store(used_key);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ServiceRegistryTable::RaiseUsedEntries(const std::size_t used_entries) noexcept
+{
+    auto current_used_entries = used_entries_.load();
+    while ((current_used_entries < used_entries) &&
+           !used_entries_.compare_exchange_weak(current_used_entries, static_cast<std::uint32_t>(used_entries)))
+    {
+    }
+}
+
+ServiceRegistry::ServiceRegistry(std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource,
+                                 ServiceRegistryTable& table) noexcept
+    : memory_resource_{std::move(memory_resource)}, table_{&table}
+{
+}
+
+ServiceRegistry::ServiceRegistry(ServiceRegistryTable& table) noexcept : ServiceRegistry{nullptr, table} {}
+
+amp::optional<ServiceRegistry> ServiceRegistry::OpenOrCreate(const std::vector<uid_t>& allowed_users) noexcept
+{
+    std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource =
+        memory::shared::SharedMemoryFactory::Open(kServiceRegistryShmName, true);
+    if (memory_resource == nullptr)
+    {
+        memory::shared::SharedMemoryFactory::UserPermissionsMap permissions{};
+        for (const auto& user_identifier : allowed_users)
+        {
+            permissions[bmw::os::Acl::Permission::kRead].push_back(user_identifier);
+            permissions[bmw::os::Acl::Permission::kWrite].push_back(user_identifier);
+        }
+
+        memory_resource = memory::shared::SharedMemoryFactory::Create(
+            kServiceRegistryShmName,
+            [](std::shared_ptr<memory::shared::ManagedMemoryResource> memory) {
+                amp::ignore = memory->construct<ServiceRegistryTable>();
+            },
+            sizeof(ServiceRegistryTable) + alignof(ServiceRegistryTable),
+            permissions.empty() ? memory::shared::SharedMemoryFactory::WorldWritable{}
+                                : memory::shared::SharedMemoryFactory::UserPermissions{permissions});
+    }
+    if (memory_resource == nullptr)
+    {
+        // Another process may have created the registry in the meantime.
+        memory_resource = memory::shared::SharedMemoryFactory::Open(kServiceRegistryShmName, true);
+    }
+    if (memory_resource == nullptr)
+    {
+        bmw::mw::log::LogWarn("lola") << "Could not open service registry. Falling back to flag file crawling.";
+        return {};
+    }
+
+    auto* const table = static_cast<ServiceRegistryTable*>(memory_resource->getUsableBaseAddress());
+    AMP_ASSERT_PRD_MESSAGE(table != nullptr, "Could not retrieve service registry table.");
+    return ServiceRegistry{std::move(memory_resource), *table};
+}
+
+bool ServiceRegistry::Register(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                               const pid_t pid) noexcept
+{
+    const auto registered = table_->Register(CreateRegistryKey(enriched_instance_identifier), pid);
+    if (!registered)
+    {
+        bmw::mw::log::LogWarn("lola") << "Service registry is full. FindService falls back to flag file crawling.";
+    }
+    return registered;
+}
+
+void ServiceRegistry::Unregister(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                 const pid_t pid) noexcept
+{
+    table_->Unregister(CreateRegistryKey(enriched_instance_identifier), pid);
+}
+
+amp::optional<std::vector<HandleType>> ServiceRegistry::GetKnownHandles(
+    const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept
+{
+    const auto quality_type = enriched_instance_identifier.GetQualityType();
+    if (((quality_type != QualityType::kASIL_QM) && (quality_type != QualityType::kASIL_B)) ||
+        table_->IsDegraded())
+    {
+        return {};
+    }
+
+    std::vector<HandleType> handles{};
+    const auto service_id =
+        enriched_instance_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>().value();
+    const auto handle_instance_id = enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>();
+    if (handle_instance_id.has_value())
+    {
+        if (table_->IsOffered(ServiceRegistryKey{service_id, handle_instance_id.value(), quality_type}))
+        {
+            handles.push_back(make_HandleType(enriched_instance_identifier.GetInstanceIdentifier(),
+                                              LolaServiceInstanceId{handle_instance_id.value()}));
+        }
+    }
+    else
+    {
+        const auto instance_ids = table_->GetOfferedInstanceIds(service_id, quality_type);
+        const std::unordered_set<LolaServiceInstanceId::InstanceId> unique_instance_ids{instance_ids.cbegin(),
+                                                                                        instance_ids.cend()};
+        for (const auto instance_id : unique_instance_ids)
+        {
+            handles.push_back(make_HandleType(enriched_instance_identifier.GetInstanceIdentifier(),
+                                              LolaServiceInstanceId{instance_id}));
+        }
+    }
+
+    return handles;
+}
+
+}  // namespace bmw::mw::com::impl::lola
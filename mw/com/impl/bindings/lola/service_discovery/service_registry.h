@@ -0,0 +1,164 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
+
+#include "platform/aas/mw/com/impl/configuration/lola_service_id.h"
+#include "platform/aas/mw/com/impl/configuration/lola_service_instance_id.h"
+#include "platform/aas/mw/com/impl/configuration/quality_type.h"
+#include "platform/aas/mw/com/impl/enriched_instance_identifier.h"
+#include "platform/aas/mw/com/impl/handle_type.h"
+
+#include "platform/aas/lib/memory/shared/managed_memory_resource.h"
+
+#include <amp_optional.hpp>
+
+#include <sys/types.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Identifies one offered service instance of a given quality within the ServiceRegistryTable.
+struct ServiceRegistryKey
+{
+    LolaServiceId service_id;
+    LolaServiceInstanceId::InstanceId instance_id;
+    QualityType quality_type;
+};
+
+bool operator==(const ServiceRegistryKey& lhs, const ServiceRegistryKey& rhs) noexcept;
+
+/// \brief Entry of the ServiceRegistryTable.
+/// \details Status and ServiceRegistryKey are encoded into one atomic key, so that entries can be claimed lock-free
+///          in the same way as UidPidMappingEntry does it.
+class ServiceRegistryEntry
+{
+  public:
+    enum class EntryStatus : std::uint16_t
+    {
+        kUnused = 0U,
+        kUsed,
+        kUpdating,
+    };
+
+    /// \brief our key-type is a combination of 2 byte status, 2 byte quality, 2 byte service id and 2 byte instance id
+    using key_type = std::uint64_t;
+    static_assert(std::atomic<key_type>::is_always_lock_free);
+    static_assert(std::atomic<pid_t>::is_always_lock_free);
+    static_assert(sizeof(LolaServiceId) <= 2U);
+    static_assert(sizeof(LolaServiceInstanceId::InstanceId) <= 2U);
+
+    std::pair<EntryStatus, ServiceRegistryKey> GetStatusAndKeyAtomic() const noexcept;
+    static key_type CreateKey(const EntryStatus status, const ServiceRegistryKey& key) noexcept;
+
+    std::atomic<key_type> key_status_{};
+    std::atomic<pid_t> pid_{};
+};
+
+/// \brief Fixed size table of all service instances, which are currently offered via LoLa on this node.
+/// \details The table is placed in a shared-memory object, which is shared by all LoLa processes. Providers register
+///          their offers in it (in addition to the flag files) and consumers look them up with plain atomic loads
+///          instead of crawling the flag file directories. Entries are always claimed from the start of the table, so
+///          lookups only need to scan up to the highest entry ever claimed.
+///          Entries of a provider, which crashed, stay in the table until the same service instance is offered again -
+///          the same is true for its flag files. If an offer can't be registered (e.g. because the table ran full), the
+///          table is marked as degraded and can't be used for lookups anymore, since it doesn't contain all offers.
+///          Consumers then have to fall back to the flag files.
+class ServiceRegistryTable final
+{
+  public:
+    static constexpr std::size_t kMaxEntries{512U};
+
+    ServiceRegistryTable() noexcept = default;
+    ~ServiceRegistryTable() noexcept = default;
+
+    ServiceRegistryTable(const ServiceRegistryTable&) = delete;
+    ServiceRegistryTable& operator=(const ServiceRegistryTable&) = delete;
+    ServiceRegistryTable(ServiceRegistryTable&&) noexcept = delete;
+    ServiceRegistryTable& operator=(ServiceRegistryTable&&) noexcept = delete;
+
+    /// \brief Registers an offer of the given provider pid. An existing entry with the same key (e.g. left behind by a
+    ///        crashed provider) gets taken over.
+    /// \return true if the offer could be registered, false if the table is full. In the latter case the table is
+    ///         marked as degraded.
+    bool Register(const ServiceRegistryKey& key, const pid_t pid) noexcept;
+
+    /// \brief Removes the offer with the given key, if it is still registered for the given pid.
+    void Unregister(const ServiceRegistryKey& key, const pid_t pid) noexcept;
+
+    bool IsOffered(const ServiceRegistryKey& key) const noexcept;
+
+    /// \brief Returns the instance ids of all offered instances of the given service and quality. The result may
+    ///        contain duplicates, if two providers raced offering the same instance.
+    std::vector<LolaServiceInstanceId::InstanceId> GetOfferedInstanceIds(const LolaServiceId service_id,
+                                                                         const QualityType quality_type) const noexcept;
+
+    /// \brief Marks the table as not containing all offers anymore. This can't be undone.
+    void MarkDegraded() noexcept;
+
+    /// \brief Returns true, if an offer couldn't be registered, so that lookups have to use the flag files.
+    bool IsDegraded() const noexcept;
+
+  private:
+    bool TryTakeOverEntry(const ServiceRegistryKey& key, const pid_t pid) noexcept;
+    void RaiseUsedEntries(const std::size_t used_entries) noexcept;
+
+    std::atomic<std::uint32_t> used_entries_{0U};
+    std::atomic<bool> degraded_{false};
+    std::array<ServiceRegistryEntry, kMaxEntries> entries_{};
+};
+
+/// \brief Accessor for the node wide ServiceRegistryTable in shared-memory.
+class ServiceRegistry final
+{
+  public:
+    /// \brief Opens the shared-memory object of the service registry or creates it, if it doesn't exist yet.
+    /// \param allowed_users users, which get read and write access to a newly created shared-memory object in addition
+    ///        to its owner. If empty, the shared-memory object is created world writable.
+    /// \return the service registry or an empty optional, if the shared-memory object couldn't be opened/created.
+    static amp::optional<ServiceRegistry> OpenOrCreate(const std::vector<uid_t>& allowed_users) noexcept;
+
+    /// \brief Accessor for a table, which isn't placed in the node wide shared-memory object (e.g. one owned by a
+    ///        test). The table has to outlive the accessor.
+    explicit ServiceRegistry(ServiceRegistryTable& table) noexcept;
+
+    bool Register(const EnrichedInstanceIdentifier& enriched_instance_identifier, const pid_t pid) noexcept;
+    void Unregister(const EnrichedInstanceIdentifier& enriched_instance_identifier, const pid_t pid) noexcept;
+
+    /// \brief Looks up the handles of all offered instances matching the given identifier.
+    /// \return the handles or an empty optional, if the registry can't answer the search (table degraded or invalid
+    ///         quality type), so that the caller has to crawl the flag files instead.
+    amp::optional<std::vector<HandleType>> GetKnownHandles(
+        const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept;
+
+  private:
+    ServiceRegistry(std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource,
+                    ServiceRegistryTable& table) noexcept;
+
+    std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource_;
+    ServiceRegistryTable* table_;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
@@ -0,0 +1,181 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using ::testing::UnorderedElementsAre;
+
+constexpr LolaServiceId kServiceId1{1U};
+constexpr LolaServiceId kServiceId2{2U};
+constexpr pid_t kPid1{100};
+constexpr pid_t kPid2{200};
+
+const ServiceRegistryKey kKey1Qm{kServiceId1, 1U, QualityType::kASIL_QM};
+const ServiceRegistryKey kKey1AsilB{kServiceId1, 1U, QualityType::kASIL_B};
+const ServiceRegistryKey kKey2Qm{kServiceId1, 2U, QualityType::kASIL_QM};
+const ServiceRegistryKey kKeyOtherServiceQm{kServiceId2, 1U, QualityType::kASIL_QM};
+
+class ServiceRegistryTableFixture : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<ServiceRegistryTable> unit_{std::make_unique<ServiceRegistryTable>()};
+};
+
+TEST(ServiceRegistryEntryTest, KeyRoundTripsThroughEntry)
+{
+    // Given an entry, which contains a key in state kUsed
+    const ServiceRegistryKey key{0xABCDU, 0x1234U, QualityType::kASIL_B};
+    ServiceRegistryEntry entry{};
+    entry.key_status_.store(ServiceRegistryEntry::CreateKey(ServiceRegistryEntry::EntryStatus::kUsed, key));
+
+    // When reading status and key back
+    const auto status_key = entry.GetStatusAndKeyAtomic();
+
+    // Then all parts are restored
+    EXPECT_EQ(status_key.first, ServiceRegistryEntry::EntryStatus::kUsed);
+    EXPECT_EQ(status_key.second, key);
+}
+
+TEST_F(ServiceRegistryTableFixture, RegisteredOfferIsFound)
+{
+    // Given an empty table
+
+    // When registering an offer
+    EXPECT_TRUE(unit_->Register(kKey1Qm, kPid1));
+
+    // Then exactly this offer is found
+    EXPECT_TRUE(unit_->IsOffered(kKey1Qm));
+    EXPECT_FALSE(unit_->IsOffered(kKey1AsilB));
+    EXPECT_FALSE(unit_->IsOffered(kKey2Qm));
+    EXPECT_FALSE(unit_->IsOffered(kKeyOtherServiceQm));
+}
+
+TEST_F(ServiceRegistryTableFixture, ReturnsAllOfferedInstancesOfServiceAndQuality)
+{
+    // Given offers of different instances, services and qualities
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid1));
+    ASSERT_TRUE(unit_->Register(kKey1AsilB, kPid1));
+    ASSERT_TRUE(unit_->Register(kKey2Qm, kPid2));
+    ASSERT_TRUE(unit_->Register(kKeyOtherServiceQm, kPid2));
+
+    // When getting the offered instances of the first service with quality QM
+    const auto instance_ids = unit_->GetOfferedInstanceIds(kServiceId1, QualityType::kASIL_QM);
+
+    // Then only the QM instances of this service are returned
+    EXPECT_THAT(instance_ids, UnorderedElementsAre(1U, 2U));
+}
+
+TEST_F(ServiceRegistryTableFixture, UnregisteredOfferIsNotFoundAnymore)
+{
+    // Given a registered offer
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid1));
+
+    // When unregistering it
+    unit_->Unregister(kKey1Qm, kPid1);
+
+    // Then it is not found anymore
+    EXPECT_FALSE(unit_->IsOffered(kKey1Qm));
+    EXPECT_TRUE(unit_->GetOfferedInstanceIds(kServiceId1, QualityType::kASIL_QM).empty());
+}
+
+TEST_F(ServiceRegistryTableFixture, OfferOfOtherProviderIsNotUnregistered)
+{
+    // Given an offer, which has been taken over by a second provider
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid1));
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid2));
+
+    // When the first provider unregisters its offer
+    unit_->Unregister(kKey1Qm, kPid1);
+
+    // Then the offer of the second provider is still found
+    EXPECT_TRUE(unit_->IsOffered(kKey1Qm));
+}
+
+TEST_F(ServiceRegistryTableFixture, ReofferTakesOverStaleEntry)
+{
+    // Given an offer, which has been left behind by a crashed provider
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid1));
+
+    // When the service instance is offered again
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid2));
+
+    // Then the instance is only contained once
+    EXPECT_THAT(unit_->GetOfferedInstanceIds(kServiceId1, QualityType::kASIL_QM), UnorderedElementsAre(1U));
+}
+
+TEST_F(ServiceRegistryTableFixture, FreedEntriesAreReused)
+{
+    // Given a completely filled table, from which one offer has been removed again
+    for (std::size_t index{0U}; index < ServiceRegistryTable::kMaxEntries; ++index)
+    {
+        const ServiceRegistryKey key{kServiceId2, static_cast<LolaServiceInstanceId::InstanceId>(index),
+                                     QualityType::kASIL_QM};
+        ASSERT_TRUE(unit_->Register(key, kPid1));
+    }
+    unit_->Unregister(ServiceRegistryKey{kServiceId2, 0U, QualityType::kASIL_QM}, kPid1);
+
+    // When registering another offer
+    const auto registered = unit_->Register(kKey1Qm, kPid1);
+
+    // Then the offer is registered in the freed entry and the table is not degraded
+    EXPECT_TRUE(registered);
+    EXPECT_TRUE(unit_->IsOffered(kKey1Qm));
+    EXPECT_FALSE(unit_->IsDegraded());
+}
+
+TEST_F(ServiceRegistryTableFixture, FullTableIsMarkedAsDegraded)
+{
+    // Given a completely filled table
+    for (std::size_t index{0U}; index < ServiceRegistryTable::kMaxEntries; ++index)
+    {
+        const ServiceRegistryKey key{kServiceId2, static_cast<LolaServiceInstanceId::InstanceId>(index),
+                                     QualityType::kASIL_QM};
+        ASSERT_TRUE(unit_->Register(key, kPid1));
+    }
+    EXPECT_FALSE(unit_->IsDegraded());
+
+    // When registering another offer
+    const auto registered = unit_->Register(kKey1Qm, kPid1);
+
+    // Then registration fails and the table is marked as degraded
+    EXPECT_FALSE(registered);
+    EXPECT_TRUE(unit_->IsDegraded());
+}
+
+TEST_F(ServiceRegistryTableFixture, DegradedTableStaysDegradedAfterOffersAreRemoved)
+{
+    // Given a table with a registered offer
+    ASSERT_TRUE(unit_->Register(kKey1Qm, kPid1));
+
+    // When the table is marked as degraded and the offer is removed
+    unit_->MarkDegraded();
+    unit_->Unregister(kKey1Qm, kPid1);
+
+    // Then the table is still degraded
+    EXPECT_TRUE(unit_->IsDegraded());
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
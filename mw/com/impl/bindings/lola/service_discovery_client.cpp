@@ -22,6 +22,7 @@
 #include <amp_expected.hpp>
 #include <amp_variant.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace bmw
@@ -37,6 +38,13 @@ namespace lola
 
 namespace
 {
+#ifdef __QNXNTO__
+const filesystem::Path kServiceRegistryDegradedMarker{
+    "/tmp_discovery/mw_com_lola/service_discovery/service_registry_degraded"};
+#else
+const filesystem::Path kServiceRegistryDegradedMarker{"/tmp/mw_com_lola/service_discovery/service_registry_degraded"};
+#endif
+
 using underlying_type_readmask = std::underlying_type<os::InotifyEvent::ReadMask>::type;
 
 auto ReadMaskSet(const os::InotifyEvent& event, const os::InotifyEvent::ReadMask mask) noexcept -> bool
@@ -44,6 +52,24 @@ auto ReadMaskSet(const os::InotifyEvent& event, const os::InotifyEvent::ReadMask
     return static_cast<underlying_type_readmask>(event.GetMask() & mask) != 0;
 }
 
+/// \brief Removes the creation event of the same flag file from the creation events of the current batch.
+/// \return true, if the deletion event was netted out against such a creation event.
+auto NetOutCreationEvent(std::vector<os::InotifyEvent>& creation_events,
+                         const os::InotifyEvent& deletion_event) noexcept -> bool
+{
+    const auto creation_event = std::find_if(
+        creation_events.cbegin(), creation_events.cend(), [&deletion_event](const os::InotifyEvent& event) noexcept {
+            return (event.GetWatchDescriptor() == deletion_event.GetWatchDescriptor()) &&
+                   (event.GetName() == deletion_event.GetName());
+        });
+    if (creation_event == creation_events.cend())
+    {
+        return false;
+    }
+    static_cast<void>(creation_events.erase(creation_event));
+    return true;
+}
+
 std::vector<HandleType> GetKnownHandles(EnrichedInstanceIdentifier enriched_instance_identifier,
                                         QualityAwareContainer<KnownInstancesContainer> known_instances) noexcept
 {
@@ -68,20 +94,24 @@ std::vector<HandleType> GetKnownHandles(EnrichedInstanceIdentifier enriched_inst
 
 }  // namespace
 
-ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_running_threads) noexcept
+ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_running_threads,
+                                               const std::vector<uid_t>& service_registry_users) noexcept
     : ServiceDiscoveryClient(long_running_threads,
                              std::make_unique<os::InotifyInstanceImpl>(),
                              std::make_unique<os::internal::UnistdImpl>(),
-                             filesystem::FilesystemFactory{}.CreateInstance())
+                             filesystem::FilesystemFactory{}.CreateInstance(),
+                             ServiceRegistry::OpenOrCreate(service_registry_users))
 {
 }
 
 ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_running_threads,
                                                std::unique_ptr<os::InotifyInstance> inotify_instance,
                                                std::unique_ptr<os::Unistd> unistd,
-                                               filesystem::Filesystem filesystem) noexcept
+                                               filesystem::Filesystem filesystem,
+                                               amp::optional<ServiceRegistry> service_registry) noexcept
     : IServiceDiscoveryClient{},
       offer_disambiguator_{std::chrono::steady_clock::now().time_since_epoch().count()},
+      service_registry_{std::move(service_registry)},
       i_notify_{std::move(inotify_instance)},
       unistd_{std::move(unistd)},
       filesystem_{std::move(filesystem)},
@@ -102,6 +132,22 @@ ServiceDiscoveryClient::~ServiceDiscoveryClient()
     // Shut down worker thread correctly to avoid concurrency issues during destruction
     worker_thread_result_.Abort();
     amp::ignore = worker_thread_result_.Wait();
+
+    // Offers, which haven't been stopped, are withdrawn by destroying their flag files. Withdraw them from the service
+    // registry as well.
+    std::lock_guard lock{flag_files_mutex_};
+    for (const auto& flag_files : flag_files_)
+    {
+        const EnrichedInstanceIdentifier enriched_instance_identifier{flag_files.first};
+        if (flag_files.second.asil_b.has_value())
+        {
+            UnregisterOffer(enriched_instance_identifier, QualityType::kASIL_B);
+        }
+        if (flag_files.second.asil_qm.has_value())
+        {
+            UnregisterOffer(enriched_instance_identifier, QualityType::kASIL_QM);
+        }
+    }
 }
 
 auto ServiceDiscoveryClient::OfferService(InstanceIdentifier instance_identifier) noexcept -> ResultBlank
@@ -157,6 +203,11 @@ auto ServiceDiscoveryClient::OfferService(InstanceIdentifier instance_identifier
 
     {
         std::lock_guard lock{flag_files_mutex_};
+        if (flag_files.asil_b.has_value())
+        {
+            RegisterOffer(enriched_instance_identifier, QualityType::kASIL_B);
+        }
+        RegisterOffer(enriched_instance_identifier, QualityType::kASIL_QM);
         flag_files_.emplace(enriched_instance_identifier.GetInstanceIdentifier(), std::move(flag_files));
     }
 
@@ -183,9 +234,21 @@ auto ServiceDiscoveryClient::StopOfferService(InstanceIdentifier instance_identi
         switch (quality_type_selector)
         {
             case IServiceDiscovery::QualityTypeSelector::kBoth:
+                if (flag_file_iterator->second.asil_b.has_value())
+                {
+                    UnregisterOffer(enriched_instance_identifier, QualityType::kASIL_B);
+                }
+                if (flag_file_iterator->second.asil_qm.has_value())
+                {
+                    UnregisterOffer(enriched_instance_identifier, QualityType::kASIL_QM);
+                }
                 flag_files_.erase(flag_file_iterator);
                 break;
             case IServiceDiscovery::QualityTypeSelector::kAsilQm:
+                if (flag_file_iterator->second.asil_qm.has_value())
+                {
+                    UnregisterOffer(enriched_instance_identifier, QualityType::kASIL_QM);
+                }
                 flag_file_iterator->second.asil_qm.reset();
                 break;
             default:
@@ -196,6 +259,49 @@ auto ServiceDiscoveryClient::StopOfferService(InstanceIdentifier instance_identi
     return {};
 }
 
+auto ServiceDiscoveryClient::RegisterOffer(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                           const QualityType quality_type) noexcept -> void
+{
+    if (service_registry_.has_value())
+    {
+        const EnrichedInstanceIdentifier quality_enriched_instance_identifier{enriched_instance_identifier,
+                                                                             quality_type};
+        // A failed registration marks the table as degraded.
+        amp::ignore = service_registry_->Register(quality_enriched_instance_identifier, unistd_->getpid());
+        return;
+    }
+
+    // Consumers, which could open the service registry, would miss this offer. So they are told via the marker file to
+    // crawl the flag files. The directory of the marker file exists, as the flag file of the offer has been created.
+    const auto marker_result = filesystem_.streams->Open(kServiceRegistryDegradedMarker, std::ios_base::out);
+    if (!marker_result.has_value())
+    {
+        mw::log::LogError("lola") << "Failed to create" << kServiceRegistryDegradedMarker.Native() << ":"
+                                  << marker_result.error() << ". FindService() may miss offers of this process.";
+    }
+}
+
+auto ServiceDiscoveryClient::IsServiceRegistryUsable() const noexcept -> bool
+{
+    if (!service_registry_.has_value())
+    {
+        return false;
+    }
+    // A single stat, which is far cheaper than crawling the flag files. If it fails, the marker might exist.
+    const auto marker_exists = filesystem_.standard->Exists(kServiceRegistryDegradedMarker);
+    return marker_exists.has_value() && (!marker_exists.value());
+}
+
+auto ServiceDiscoveryClient::UnregisterOffer(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                             const QualityType quality_type) noexcept -> void
+{
+    if (service_registry_.has_value())
+    {
+        service_registry_->Unregister(EnrichedInstanceIdentifier{enriched_instance_identifier, quality_type},
+                                      unistd_->getpid());
+    }
+}
+
 auto ServiceDiscoveryClient::StopFindService(FindServiceHandle find_service_handle) noexcept -> ResultBlank
 {
     {
@@ -229,11 +335,14 @@ auto ServiceDiscoveryClient::TransferNewSearchRequest(NewSearchRequest search_re
 
     const auto added_search_request = search_requests_.emplace(find_service_handle,
                                                                std::make_tuple(std::move(watch_descriptor_placeholder),
-                                                                               std::move(on_service_found_callback),
+                                                                               SearchSubscribers{},
                                                                                instance_identifier,
                                                                                previous_handles));
     AMP_PRECONDITION_PRD_MESSAGE(added_search_request.second,
                                  "The FindServiceHandle should be unique for every call to StartFindService");
+    SubscribeToSearchRequest(find_service_handle, std::move(on_service_found_callback), added_search_request.first);
+    amp::ignore = search_requests_by_identifier_.emplace(LolaServiceInstanceIdentifier{instance_identifier},
+                                                         find_service_handle);
 
     for (const auto& watch_descriptor : watch_descriptors)
     {
@@ -259,13 +368,25 @@ auto ServiceDiscoveryClient::TransferObsoleteSearchRequests() noexcept -> void
 auto ServiceDiscoveryClient::TransferObsoleteSearchRequest(const FindServiceHandle& find_service_handle) noexcept
     -> void
 {
-    const auto search_iterator = search_requests_.find(find_service_handle);
-    if (search_iterator == search_requests_.end())
+    const auto subscription_iterator = search_subscriptions_.find(find_service_handle);
+    if (subscription_iterator == search_subscriptions_.end())
     {
         mw::log::LogWarn("lola") << "Could not find search request for:"
                                  << FindServiceHandleView{find_service_handle}.getUid();
         return;
     }
+    const auto search_key = subscription_iterator->second;
+    search_subscriptions_.erase(subscription_iterator);
+
+    const auto search_iterator = search_requests_.find(search_key);
+    AMP_ASSERT_PRD_MESSAGE(search_iterator != search_requests_.end(), "Subscribed to unknown search request");
+    auto& subscribers = std::get<SearchSubscribers>(search_iterator->second);
+    amp::ignore = subscribers.erase(find_service_handle);
+    if (!(subscribers.empty()))
+    {
+        // Other searches are still subscribed to the search request, so its watches have to stay.
+        return;
+    }
 
     // Intentional copy since it allows us to iterate over the watches while we modify the original set in
     // UnlinkWatchWithSearchRequest(). This could be optimised, but would make the algorithm even more complex.
@@ -275,8 +396,7 @@ auto ServiceDiscoveryClient::TransferObsoleteSearchRequest(const FindServiceHand
         const auto watch_iterator = watches_.find(watch);
         if (watch_iterator == watches_.end())
         {
-            mw::log::LogError("lola") << "Could not find watch for:"
-                                      << FindServiceHandleView{find_service_handle}.getUid();
+            mw::log::LogError("lola") << "Could not find watch for:" << FindServiceHandleView{search_key}.getUid();
             continue;
         }
 
@@ -291,7 +411,18 @@ auto ServiceDiscoveryClient::TransferObsoleteSearchRequest(const FindServiceHand
         }
     }
 
-    search_requests_.erase(find_service_handle);
+    const auto identifier_search_keys = search_requests_by_identifier_.equal_range(
+        LolaServiceInstanceIdentifier{std::get<EnrichedInstanceIdentifier>(search_iterator->second)});
+    for (auto it = identifier_search_keys.first; it != identifier_search_keys.second; ++it)
+    {
+        if (it->second == search_key)
+        {
+            search_requests_by_identifier_.erase(it);
+            break;
+        }
+    }
+
+    search_requests_.erase(search_iterator);
 }
 
 auto ServiceDiscoveryClient::HandleEvents(
@@ -335,7 +466,17 @@ auto ServiceDiscoveryClient::HandleEvents(
 
         if (inode_was_removed)
         {
-            deletion_events.push_back(event);
+            // A flag file, which was created and deleted again within this batch, is netted out. Otherwise the
+            // deletion would be handled before the creation and leave a stale instance behind.
+            const auto watch_iterator = watches_.find(event.GetWatchDescriptor());
+            const bool is_instance_watch =
+                (watch_iterator != watches_.end()) && std::get<EnrichedInstanceIdentifier>(watch_iterator->second)
+                                                          .GetBindingSpecificInstanceId<LolaServiceInstanceId>()
+                                                          .has_value();
+            if (!(flag_file_was_removed && is_instance_watch && NetOutCreationEvent(creation_events, event)))
+            {
+                deletion_events.push_back(event);
+            }
         }
         else if (inode_was_created)
         {
@@ -361,14 +502,21 @@ auto ServiceDiscoveryClient::HandleEvents(
         }
     }
 
-    HandleDeletionEvents(deletion_events);
+    // The handlers are called once after both passes, so that each search is notified at most once per batch and
+    // only if its handles changed in total.
+    std::unordered_set<FindServiceHandle> impacted_searches{};
+
+    HandleDeletionEvents(deletion_events, impacted_searches);
+
+    HandleCreationEvents(creation_events, impacted_searches);
 
-    HandleCreationEvents(creation_events);
+    CallHandlers(impacted_searches);
 }
 
-auto ServiceDiscoveryClient::HandleDeletionEvents(const std::vector<os::InotifyEvent>& events) noexcept -> void
+auto ServiceDiscoveryClient::HandleDeletionEvents(const std::vector<os::InotifyEvent>& events,
+                                                  std::unordered_set<FindServiceHandle>& impacted_searches) noexcept
+    -> void
 {
-    std::unordered_set<FindServiceHandle> impacted_searches{};
     for (const auto& event : events)
     {
         const auto watch_descriptor = event.GetWatchDescriptor();
@@ -397,13 +545,12 @@ auto ServiceDiscoveryClient::HandleDeletionEvents(const std::vector<os::InotifyE
             }
         }
     }
-
-    CallHandlers(impacted_searches);
 }
 
-auto ServiceDiscoveryClient::HandleCreationEvents(const std::vector<os::InotifyEvent>& events) noexcept -> void
+auto ServiceDiscoveryClient::HandleCreationEvents(const std::vector<os::InotifyEvent>& events,
+                                                  std::unordered_set<FindServiceHandle>& impacted_searches) noexcept
+    -> void
 {
-    std::unordered_set<FindServiceHandle> impacted_searches{};
     for (const auto& event : events)
     {
         const auto watch_descriptor = event.GetWatchDescriptor();
@@ -425,8 +572,6 @@ auto ServiceDiscoveryClient::HandleCreationEvents(const std::vector<os::InotifyE
 
         impacted_searches.insert(search_keys.cbegin(), search_keys.cend());
     }
-
-    CallHandlers(impacted_searches);
 }
 
 auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHandle>& search_keys) noexcept -> void
@@ -439,12 +584,6 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
             continue;
         }
 
-        const auto obsolete_search_iterator = obsolete_search_requests_.find(search_key);
-        if (obsolete_search_iterator != obsolete_search_requests_.cend())
-        {
-            continue;
-        }
-
         const auto& enriched_instance_identifier = std::get<EnrichedInstanceIdentifier>(search_iterator->second);
         std::vector<HandleType> known_handles{};
         switch (enriched_instance_identifier.GetQualityType())
@@ -470,20 +609,74 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
             continue;
         }
 
-        mw::log::LogDebug("lola") << "LoLa SD: Starting asynchronous call to handler for FindServiceHandle"
-                                  << FindServiceHandleView{search_key}.getUid() << "with" << known_handles.size()
-                                  << "handles";
-
         previous_handles = new_handles;
 
-        const auto& handler = std::get<FindServiceHandler<HandleType>>(search_iterator->second);
-        handler(std::move(known_handles), search_key);
+        // The handles are only looked up once per search request and then handed to all subscribed searches. A handler
+        // may subscribe further searches to this search request, which already got the new handles synchronously.
+        const auto& subscribers = std::get<SearchSubscribers>(search_iterator->second);
+        std::vector<FindServiceHandle> subscriber_handles{};
+        subscriber_handles.reserve(subscribers.size());
+        for (const auto& subscriber : subscribers)
+        {
+            subscriber_handles.push_back(subscriber.first);
+        }
 
-        mw::log::LogDebug("lola") << "LoLa SD: Asynchronous call to handler for FindServiceHandle"
-                                  << FindServiceHandleView{search_key}.getUid() << "finished";
+        for (const auto& subscriber_handle : subscriber_handles)
+        {
+            const auto obsolete_search_iterator = obsolete_search_requests_.find(subscriber_handle);
+            if (obsolete_search_iterator != obsolete_search_requests_.cend())
+            {
+                continue;
+            }
+
+            const auto subscriber = subscribers.find(subscriber_handle);
+            if (subscriber == subscribers.cend())
+            {
+                continue;
+            }
+
+            mw::log::LogDebug("lola") << "LoLa SD: Starting asynchronous call to handler for FindServiceHandle"
+                                      << FindServiceHandleView{subscriber_handle}.getUid() << "with"
+                                      << known_handles.size() << "handles";
+
+            subscriber->second(known_handles, subscriber_handle);
+
+            mw::log::LogDebug("lola") << "LoLa SD: Asynchronous call to handler for FindServiceHandle"
+                                      << FindServiceHandleView{subscriber_handle}.getUid() << "finished";
+        }
     }
 }
 
+auto ServiceDiscoveryClient::FindSearchRequest(const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
+    -> SearchRequestsContainer::iterator
+{
+    const auto identifier_search_keys =
+        search_requests_by_identifier_.equal_range(LolaServiceInstanceIdentifier{enriched_instance_identifier});
+    for (auto it = identifier_search_keys.first; it != identifier_search_keys.second; ++it)
+    {
+        const auto search_iterator = search_requests_.find(it->second);
+        if ((search_iterator != search_requests_.end()) &&
+            (std::get<EnrichedInstanceIdentifier>(search_iterator->second) == enriched_instance_identifier))
+        {
+            return search_iterator;
+        }
+    }
+    return search_requests_.end();
+}
+
+auto ServiceDiscoveryClient::SubscribeToSearchRequest(const FindServiceHandle find_service_handle,
+                                                      FindServiceHandler<HandleType> handler,
+                                                      const SearchRequestsContainer::iterator& search_iterator) noexcept
+    -> void
+{
+    const auto subscription_result = search_subscriptions_.emplace(find_service_handle, search_iterator->first);
+    AMP_PRECONDITION_PRD_MESSAGE(subscription_result.second,
+                                 "The FindServiceHandle should be unique for every call to StartFindService");
+    auto& subscribers = std::get<SearchSubscribers>(search_iterator->second);
+    const auto subscriber_result = subscribers.emplace(find_service_handle, std::move(handler));
+    AMP_ASSERT_PRD_MESSAGE(subscriber_result.second, "Search is already subscribed to search request");
+}
+
 auto ServiceDiscoveryClient::StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
                                         const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
     -> WatchesContainer::iterator
@@ -583,55 +776,74 @@ ResultBlank ServiceDiscoveryClient::StartFindService(FindServiceHandle find_serv
                               << FindServiceHandleView{find_service_handle}.getUid();
 
     std::vector<HandleType> known_handles{};
-    std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier> watch_descriptors{};
-    QualityAwareContainer<KnownInstancesContainer> known_instances{};
-    // Check if the exact same search is already in progress. If it is, we can just duplicate the search request and
-    // reuse cache data.
-    const auto identifier = LolaServiceInstanceIdentifier(enriched_instance_identifier);
-    const auto watched_identifier = watched_identifiers_.find(identifier);
-    if (watched_identifier != watched_identifiers_.end() && watched_identifier->second.watch_descriptor.has_value())
+    // If there is already a search request for the exact same identifier, we just subscribe to it. It already has all
+    // watches in place and reports the handles it knows.
+    auto search_iterator = FindSearchRequest(enriched_instance_identifier);
+    if (search_iterator != search_requests_.end())
     {
-        known_handles = GetKnownHandles(enriched_instance_identifier, known_instances_);
-
-        auto add_watch = [this, &watch_descriptors](const os::InotifyWatchDescriptor& watch_descriptor) {
-            const auto matching_watch = watches_.find(watch_descriptor);
-            AMP_ASSERT_PRD_MESSAGE(matching_watch != watches_.cend(), "Did not find matching watch");
-            watch_descriptors.emplace(watch_descriptor, std::get<EnrichedInstanceIdentifier>(matching_watch->second));
-        };
-
-        add_watch(watched_identifier->second.watch_descriptor.value());
-        std::for_each(watched_identifier->second.child_watches.cbegin(),
-                      watched_identifier->second.child_watches.cend(),
-                      add_watch);
+        mw::log::LogDebug("lola") << "LoLa SD: Subscribing FindServiceHandle"
+                                  << FindServiceHandleView{find_service_handle}.getUid() << "to search request"
+                                  << FindServiceHandleView{search_iterator->first}.getUid();
+        SubscribeToSearchRequest(find_service_handle, std::move(handler), search_iterator);
+        const auto& previous_handles = std::get<std::unordered_set<HandleType>>(search_iterator->second);
+        known_handles.assign(previous_handles.cbegin(), previous_handles.cend());
     }
     else
     {
-        auto crawler_result = FlagFileCrawler{*i_notify_}.CrawlAndWatch(enriched_instance_identifier);
-        if (!crawler_result.has_value())
+        std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier> watch_descriptors{};
+        QualityAwareContainer<KnownInstancesContainer> known_instances{};
+        // Check if a search, which covers the same instance(s), is already in progress. If it is, we can reuse its
+        // watches and cache data.
+        const auto identifier = LolaServiceInstanceIdentifier(enriched_instance_identifier);
+        const auto watched_identifier = watched_identifiers_.find(identifier);
+        if (watched_identifier != watched_identifiers_.end() && watched_identifier->second.watch_descriptor.has_value())
+        {
+            known_handles = GetKnownHandles(enriched_instance_identifier, known_instances_);
+
+            auto add_watch = [this, &watch_descriptors](const os::InotifyWatchDescriptor& watch_descriptor) {
+                const auto matching_watch = watches_.find(watch_descriptor);
+                AMP_ASSERT_PRD_MESSAGE(matching_watch != watches_.cend(), "Did not find matching watch");
+                watch_descriptors.emplace(watch_descriptor,
+                                          std::get<EnrichedInstanceIdentifier>(matching_watch->second));
+            };
+
+            add_watch(watched_identifier->second.watch_descriptor.value());
+            std::for_each(watched_identifier->second.child_watches.cbegin(),
+                          watched_identifier->second.child_watches.cend(),
+                          add_watch);
+        }
+        else
         {
-            return bmw::MakeUnexpected(ComErrc::kBindingFailure, "Failed to crawl filesystem");
+            auto crawler_result = FlagFileCrawler{*i_notify_}.CrawlAndWatch(enriched_instance_identifier);
+            if (!crawler_result.has_value())
+            {
+                return bmw::MakeUnexpected(ComErrc::kBindingFailure, "Failed to crawl filesystem");
+            }
+
+            auto& [found_watch_descriptors, found_known_instances] = crawler_result.value();
+            known_handles = GetKnownHandles(enriched_instance_identifier, found_known_instances);
+            watch_descriptors = std::move(found_watch_descriptors);
+            known_instances = std::move(found_known_instances);
         }
 
-        auto& [found_watch_descriptors, found_known_instances] = crawler_result.value();
-        known_handles = GetKnownHandles(enriched_instance_identifier, found_known_instances);
-        watch_descriptors = std::move(found_watch_descriptors);
-        known_instances = std::move(found_known_instances);
+        auto& stored_search_request =
+            TransferNewSearchRequest({find_service_handle,
+                                      enriched_instance_identifier,
+                                      std::move(watch_descriptors),
+                                      std::move(handler),
+                                      std::move(known_instances),
+                                      std::unordered_set<HandleType>{known_handles.cbegin(), known_handles.cend()}});
+        search_iterator = search_requests_.find(stored_search_request.first);
     }
 
-    const auto& stored_search_request =
-        TransferNewSearchRequest({find_service_handle,
-                                  enriched_instance_identifier,
-                                  std::move(watch_descriptors),
-                                  std::move(handler),
-                                  std::move(known_instances),
-                                  std::unordered_set<HandleType>{known_handles.cbegin(), known_handles.cend()}});
-
     if (!(known_handles.empty()))
     {
         mw::log::LogDebug("lola") << "LoLa SD: Synchronously calling handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid();
-        const auto& stored_handler = std::get<FindServiceHandler<HandleType>>(stored_search_request.second);
-        stored_handler(known_handles, find_service_handle);
+        const auto& subscribers = std::get<SearchSubscribers>(search_iterator->second);
+        const auto stored_handler = subscribers.find(find_service_handle);
+        AMP_ASSERT_PRD_MESSAGE(stored_handler != subscribers.cend(), "Search is not subscribed to its search request");
+        stored_handler->second(known_handles, find_service_handle);
         mw::log::LogDebug("lola") << "LoLa SD: Synchronous call to handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid() << "finished";
     }
@@ -730,11 +942,21 @@ void ServiceDiscoveryClient::OnInstanceFlagFileRemoved(const WatchesContainer::i
 Result<ServiceHandleContainer<HandleType>> ServiceDiscoveryClient::FindService(
     EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
 {
-    std::lock_guard worker_lock{worker_mutex_};
-
     mw::log::LogDebug("lola") << "LoLa SD: find service for"
                               << GetSearchPathForIdentifier(enriched_instance_identifier);
 
+    // The service registry is read lock-free, so the worker lock isn't needed. Only if the registry can't answer the
+    // search, we fall back to crawling the flag files.
+    if (IsServiceRegistryUsable())
+    {
+        auto known_handles = service_registry_->GetKnownHandles(enriched_instance_identifier);
+        if (known_handles.has_value())
+        {
+            return std::move(known_handles).value();
+        }
+    }
+
+    std::lock_guard worker_lock{worker_mutex_};
     auto crawler_result = FlagFileCrawler{*i_notify_}.Crawl(enriched_instance_identifier);
     if (!crawler_result.has_value())
     {
@@ -21,12 +21,14 @@
 #include "platform/aas/mw/com/impl/bindings/lola/service_discovery/known_instances_container.h"
 #include "platform/aas/mw/com/impl/bindings/lola/service_discovery/lola_service_instance_identifier.h"
 #include "platform/aas/mw/com/impl/bindings/lola/service_discovery/quality_aware_container.h"
+#include "platform/aas/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
 #include "platform/aas/mw/com/impl/find_service_handler.h"
 
 #include "platform/aas/lib/concurrency/executor.h"
 #include "platform/aas/lib/filesystem/filesystem.h"
 #include "platform/aas/lib/os/utils/inotify/inotify_instance_impl.h"
 
+#include <amp_optional.hpp>
 #include <amp_stop_token.hpp>
 
 #include <atomic>
@@ -35,6 +37,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace bmw
 {
@@ -50,9 +53,14 @@ namespace lola
 class ServiceDiscoveryClient final : public IServiceDiscoveryClient
 {
   public:
+    /// \brief Handlers of all FindServiceHandles, which are subscribed to the same search request.
+    using SearchSubscribers = std::unordered_map<FindServiceHandle, FindServiceHandler<HandleType>>;
+    /// \brief Search requests, which act as availability monitors: There is only one search request per
+    ///        EnrichedInstanceIdentifier, which is keyed by the FindServiceHandle of the search that created it. All
+    ///        further searches for the same EnrichedInstanceIdentifier subscribe to it.
     using SearchRequestsContainer = std::unordered_map<FindServiceHandle,
                                                        std::tuple<std::unordered_set<os::InotifyWatchDescriptor>,
-                                                                  FindServiceHandler<HandleType>,
+                                                                  SearchSubscribers,
                                                                   EnrichedInstanceIdentifier,
                                                                   std::unordered_set<HandleType>>>;
     using WatchesContainer =
@@ -67,11 +75,16 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
 
     using Disambiguator = std::chrono::steady_clock::time_point::rep;
 
-    explicit ServiceDiscoveryClient(concurrency::Executor&) noexcept;
+    /// \param service_registry_users users, which are granted access to the service registry, if this instance creates
+    ///        it. Empty, if the access to the service registry shall not be restricted.
+    ServiceDiscoveryClient(concurrency::Executor&, const std::vector<uid_t>& service_registry_users) noexcept;
+    /// \param service_registry registry of offered service instances, which shall be used instead of the node wide
+    ///        one. Empty, if offers shall only be looked up via the flag files.
     ServiceDiscoveryClient(concurrency::Executor&,
                            std::unique_ptr<os::InotifyInstance>,
                            std::unique_ptr<os::Unistd>,
-                           filesystem::Filesystem) noexcept;
+                           filesystem::Filesystem,
+                           amp::optional<ServiceRegistry> service_registry) noexcept;
 
     ServiceDiscoveryClient(const ServiceDiscoveryClient&) noexcept = delete;
     ServiceDiscoveryClient& operator=(const ServiceDiscoveryClient&) noexcept = delete;
@@ -99,6 +112,12 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
 
     std::mutex flag_files_mutex_{};
 
+    /// \brief Node wide registry of offered service instances, which allows FindService() to answer without crawling
+    ///        the flag files. Empty, if the registry couldn't be opened. Offers are registered/unregistered together
+    ///        with their flag files under flag_files_mutex_. Offers, which can't be registered, mark the registry as
+    ///        degraded (see IsServiceRegistryUsable()).
+    amp::optional<ServiceRegistry> service_registry_{};
+
     /**
      * It is important to consider the synchronization scheme in this class. All below attributes except for mutexes and
      * the following containers are considered to be exclusively accessed by the worker thread:
@@ -120,6 +139,13 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
      */
     SearchRequestsContainer search_requests_{};
 
+    /// \brief Maps the FindServiceHandle of each search to the key of the search request it is subscribed to.
+    std::unordered_map<FindServiceHandle, FindServiceHandle> search_subscriptions_{};
+
+    /// \brief Keys of the search requests per LolaServiceInstanceIdentifier, so that a new search can find an existing
+    ///        search request for the same EnrichedInstanceIdentifier without checking all of them.
+    std::unordered_multimap<LolaServiceInstanceIdentifier, FindServiceHandle> search_requests_by_identifier_{};
+
     using NewSearchRequest = std::tuple<FindServiceHandle,
                                         EnrichedInstanceIdentifier,
                                         std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier>,
@@ -158,8 +184,23 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     concurrency::TaskResult<void> worker_thread_result_{};
     concurrency::Executor& long_running_threads_;
 
+    void RegisterOffer(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                       const QualityType quality_type) noexcept;
+    /// \brief Returns true, if FindService() can be answered from the service registry.
+    /// \details A provider, which couldn't open the service registry, can't mark the table as degraded. It leaves a
+    /// node wide marker file instead, whose existence is checked here.
+    bool IsServiceRegistryUsable() const noexcept;
+    void UnregisterOffer(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                         const QualityType quality_type) noexcept;
+
     void CallHandlers(const std::unordered_set<FindServiceHandle>& search_keys) noexcept;
 
+    SearchRequestsContainer::iterator FindSearchRequest(
+        const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept;
+    void SubscribeToSearchRequest(const FindServiceHandle find_service_handle,
+                                  FindServiceHandler<HandleType> handler,
+                                  const SearchRequestsContainer::iterator& search_iterator) noexcept;
+
     WatchesContainer::iterator StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
                                           const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept;
 
@@ -186,8 +227,10 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     void HandleEvents(const amp::expected<amp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>,
                                           os::Error>& expected_events) noexcept;
 
-    void HandleDeletionEvents(const std::vector<os::InotifyEvent>& events) noexcept;
-    void HandleCreationEvents(const std::vector<os::InotifyEvent>& events) noexcept;
+    void HandleDeletionEvents(const std::vector<os::InotifyEvent>& events,
+                              std::unordered_set<FindServiceHandle>& impacted_searches) noexcept;
+    void HandleCreationEvents(const std::vector<os::InotifyEvent>& events,
+                              std::unordered_set<FindServiceHandle>& impacted_searches) noexcept;
 };
 
 }  // namespace lola
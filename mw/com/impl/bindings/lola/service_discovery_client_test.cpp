@@ -14,6 +14,8 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/service_discovery_client.h"
 
+#include "platform/aas/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+
 #include "platform/aas/lib/concurrency/executor_mock.h"
 #include "platform/aas/lib/concurrency/long_running_threads_container.h"
 #include "platform/aas/lib/filesystem/factory/filesystem_factory_fake.h"
@@ -190,8 +192,11 @@ class ServiceDiscoveryClientFixture : public ::testing::Test
     ServiceDiscoveryClient CreateAServiceDiscoveryClient()
     {
         auto inotify_instance_facade = std::make_unique<os::InotifyInstanceFacade>(inotify_instance_mock_);
-        return ServiceDiscoveryClient{
-            long_running_threads_container_, std::move(inotify_instance_facade), std::move(unistd_), filesystem_};
+        return ServiceDiscoveryClient{long_running_threads_container_,
+                                      std::move(inotify_instance_facade),
+                                      std::move(unistd_),
+                                      filesystem_,
+                                      ServiceRegistry{*service_registry_table_}};
     }
 
     filesystem::Path GetFlagFilePrefix(const LolaServiceId service_id, const LolaServiceInstanceId instance_id) noexcept
@@ -215,6 +220,9 @@ class ServiceDiscoveryClientFixture : public ::testing::Test
     std::unique_ptr<os::InotifyInstanceImpl> inotify_instance_{};
     ::testing::NiceMock<os::InotifyInstanceMock> inotify_instance_mock_{};
 
+    /// \brief Service registry of the test, so that it neither depends on nor modifies the node wide one.
+    std::unique_ptr<ServiceRegistryTable> service_registry_table_{std::make_unique<ServiceRegistryTable>()};
+
     concurrency::LongRunningThreadsContainer long_running_threads_container_{};
 };
 
@@ -244,8 +252,11 @@ class ServiceDiscoveryClientWithFakeFileSystemFixture : public ServiceDiscoveryC
     ServiceDiscoveryClient CreateAServiceDiscoveryClient()
     {
         auto inotify_instance_facade = std::make_unique<os::InotifyInstanceFacade>(inotify_instance_mock_);
-        return ServiceDiscoveryClient{
-            long_running_threads_container_, std::move(inotify_instance_facade), std::move(unistd_), filesystem_mock_};
+        return ServiceDiscoveryClient{long_running_threads_container_,
+                                      std::move(inotify_instance_facade),
+                                      std::move(unistd_),
+                                      filesystem_mock_,
+                                      ServiceRegistry{*service_registry_table_}};
     }
 
     ServiceDiscoveryClientWithFakeFileSystemFixture& SaveTheFlagFilePath()
@@ -533,6 +544,29 @@ TEST_F(ServiceDiscoveryClientFixture, CallingStartFindServiceForAnyInstanceIdsAd
         handle, [](auto, auto) noexcept {}, EnrichedInstanceIdentifier{kInstanceIdentifierAny});
 }
 
+TEST_F(ServiceDiscoveryClientFixture, SearchesForSameIdentifierShareOneWatch)
+{
+    // Given a ServiceDiscoveryClient
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Expecting that a watch is added to the instance path only once
+    const auto expected_instance_directory_path =
+        GenerateExpectedInstanceDirectoryPath(kServiceId.service_id_, kInstanceId1.id_).Native();
+    const amp::string_view expected_instance_directory_path_view{expected_instance_directory_path.data(),
+                                                                 expected_instance_directory_path.size()};
+    EXPECT_CALL(inotify_instance_mock_, AddWatch(expected_instance_directory_path_view, _)).Times(1);
+
+    // When calling StartFindService twice with the same InstanceIdentifier
+    const auto start_find_service_result_1 = service_discovery_client.StartFindService(
+        make_FindServiceHandle(1U), [](auto, auto) noexcept {}, EnrichedInstanceIdentifier{kInstanceIdentifier1});
+    const auto start_find_service_result_2 = service_discovery_client.StartFindService(
+        make_FindServiceHandle(2U), [](auto, auto) noexcept {}, EnrichedInstanceIdentifier{kInstanceIdentifier1});
+
+    // Then both searches are started
+    EXPECT_TRUE(start_find_service_result_1.has_value());
+    EXPECT_TRUE(start_find_service_result_2.has_value());
+}
+
 TEST_F(ServiceDiscoveryClientFixture, StartsReadingInotifyInstanceOnConstruction)
 {
     std::promise<void> barrier{};
@@ -623,7 +657,7 @@ TEST_F(ServiceDiscoveryClientFixture, BailsOutOnInotifyQueueOverflow)
     const auto test_function = [this] {
         auto inotify_instance_facade = std::make_unique<os::InotifyInstanceFacade>(inotify_instance_mock_);
         const ServiceDiscoveryClient service_discovery_client{
-            long_running_threads_container_, std::move(inotify_instance_facade), std::move(unistd_), filesystem_};
+            long_running_threads_container_, std::move(inotify_instance_facade), std::move(unistd_), filesystem_, {}};
         // We expect to die in an async thread - so a timeout is fine to violate the test if we do not die.
         std::this_thread::sleep_for(std::chrono::hours{1});
     };
@@ -716,6 +750,98 @@ TEST_F(ServiceDiscoveryClientFixture, FindServiceReturnNoHandleIfServiceNotFound
     EXPECT_EQ(find_service_result.value().size(), 0);
 }
 
+TEST_F(ServiceDiscoveryClientFixture, FindServiceReturnNoHandleAfterServiceOfferWasStopped)
+{
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given a service, which was offered and whose offer was stopped again
+    ASSERT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+    ASSERT_TRUE(
+        service_discovery_client.StopOfferService(kInstanceIdentifier1, IServiceDiscovery::QualityTypeSelector::kBoth)
+            .has_value());
+
+    // When finding the service one shot
+    const auto find_service_result =
+        service_discovery_client.FindService(EnrichedInstanceIdentifier{kInstanceIdentifier1});
+
+    // Then no service is found
+    ASSERT_TRUE(find_service_result.has_value());
+    EXPECT_EQ(find_service_result.value().size(), 0);
+}
+
+TEST_F(ServiceDiscoveryClientFixture, FindServiceCrawlsFlagFilesIfServiceRegistryIsMarkedAsDegraded)
+{
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given the flag file of an offer, which isn't registered in the service registry, and the marker file, which a
+    // provider leaves if it can't register its offers
+    CreateRegularFile(filesystem_, kOldFlagFile);
+    CreateRegularFile(filesystem_, kTmpPath / "service_registry_degraded");
+
+    // When finding the service one shot
+    const auto find_service_result =
+        service_discovery_client.FindService(EnrichedInstanceIdentifier{kInstanceIdentifier1});
+
+    // Then the offer is found via its flag file
+    ASSERT_TRUE(find_service_result.has_value());
+    ASSERT_EQ(find_service_result.value().size(), 1);
+    EXPECT_EQ(find_service_result.value()[0], kHandle1);
+}
+
+TEST_F(ServiceDiscoveryClientFixture, FindServiceReturnsAsilBHandleAfterQmOfferWasStopped)
+{
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given an ASIL-B service, whose ASIL-QM offer was stopped
+    ASSERT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier3).has_value());
+    ASSERT_TRUE(
+        service_discovery_client.StopOfferService(kInstanceIdentifier3, IServiceDiscovery::QualityTypeSelector::kAsilQm)
+            .has_value());
+
+    // When finding the service one shot with ASIL-B and with ASIL-QM
+    const auto find_asil_b_result =
+        service_discovery_client.FindService(EnrichedInstanceIdentifier{kInstanceIdentifier3});
+    const auto find_asil_qm_result = service_discovery_client.FindService(
+        EnrichedInstanceIdentifier{EnrichedInstanceIdentifier{kInstanceIdentifier3}, QualityType::kASIL_QM});
+
+    // Then the service is only found with ASIL-B
+    ASSERT_TRUE(find_asil_b_result.has_value());
+    ASSERT_EQ(find_asil_b_result.value().size(), 1);
+    EXPECT_EQ(find_asil_b_result.value()[0], kHandle3);
+    ASSERT_TRUE(find_asil_qm_result.has_value());
+    EXPECT_EQ(find_asil_qm_result.value().size(), 0);
+}
+
+TEST_F(ServiceDiscoveryClientFixture, OfferServiceRegistersOfferInTheGivenServiceRegistry)
+{
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // When offering a service
+    ASSERT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+
+    // Then the offer is registered in the service registry, which was handed over to the client
+    EXPECT_TRUE(service_registry_table_->IsOffered(
+        ServiceRegistryKey{kServiceId.service_id_, kInstanceId1.id_, QualityType::kASIL_QM}));
+}
+
+TEST_F(ServiceDiscoveryClientFixture, FindServiceAnswersFromTheGivenServiceRegistry)
+{
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given an offer, which is only registered in the service registry handed over to the client, but has no flag file
+    const ServiceRegistryKey key{kServiceId.service_id_, kInstanceId1.id_, QualityType::kASIL_QM};
+    ASSERT_TRUE(service_registry_table_->Register(key, os::internal::UnistdImpl{}.getpid()));
+
+    // When finding the service one shot
+    const auto find_service_result =
+        service_discovery_client.FindService(EnrichedInstanceIdentifier{kInstanceIdentifier1});
+
+    // Then the offer is found via the service registry
+    ASSERT_TRUE(find_service_result.has_value());
+    ASSERT_EQ(find_service_result.value().size(), 1);
+    EXPECT_EQ(find_service_result.value()[0], kHandle1);
+}
+
 TEST_F(ServiceDiscoveryClientFixture, CallsCorrectHandlerForDifferentInstanceIDs)
 {
     RecordProperty("Verifies", "4");
@@ -1001,6 +1127,81 @@ TEST_F(ServiceDiscoveryClientFixture, RemovesWatchOnStopFindService)
     barrier.get_future().wait();
 }
 
+TEST_F(ServiceDiscoveryClientFixture, CallsHandlersOfAllSearchesForSameIdentifier)
+{
+    std::promise<void> service_found_barrier_1{};
+    std::promise<void> service_found_barrier_2{};
+
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given two searches for the same InstanceIdentifier
+    const FindServiceHandle handle_1{make_FindServiceHandle(1U)};
+    const FindServiceHandle handle_2{make_FindServiceHandle(2U)};
+    ASSERT_TRUE(service_discovery_client
+                    .StartFindService(
+                        handle_1,
+                        [&service_found_barrier_1, &handle_1](auto container, auto handle) noexcept {
+                            EXPECT_EQ(container.size(), 1);
+                            EXPECT_EQ(container.front(), kHandle1);
+                            EXPECT_EQ(handle, handle_1);
+                            service_found_barrier_1.set_value();
+                        },
+                        EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+    ASSERT_TRUE(service_discovery_client
+                    .StartFindService(
+                        handle_2,
+                        [&service_found_barrier_2, &handle_2](auto container, auto handle) noexcept {
+                            EXPECT_EQ(container.size(), 1);
+                            EXPECT_EQ(container.front(), kHandle1);
+                            EXPECT_EQ(handle, handle_2);
+                            service_found_barrier_2.set_value();
+                        },
+                        EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+
+    // When the service is offered
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+
+    // Then the handlers of both searches are called with their own FindServiceHandle
+    service_found_barrier_1.get_future().wait();
+    service_found_barrier_2.get_future().wait();
+}
+
+TEST_F(ServiceDiscoveryClientFixture, SearchForSameIdentifierIsStillServedAfterFirstSearchIsStopped)
+{
+    std::promise<void> service_found_barrier{};
+    MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)> find_service_handler_1{};
+    EXPECT_CALL(find_service_handler_1, Call(_, _)).Times(0);
+
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given two searches for the same InstanceIdentifier, of which the first one is stopped again
+    const FindServiceHandle handle_1{make_FindServiceHandle(1U)};
+    const FindServiceHandle handle_2{make_FindServiceHandle(2U)};
+    ASSERT_TRUE(service_discovery_client
+                    .StartFindService(handle_1,
+                                      CreateWrappedMockFindServiceHandler(find_service_handler_1),
+                                      EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+    ASSERT_TRUE(service_discovery_client
+                    .StartFindService(
+                        handle_2,
+                        [&service_found_barrier](auto container, auto) noexcept {
+                            EXPECT_EQ(container.size(), 1);
+                            service_found_barrier.set_value();
+                        },
+                        EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+    ASSERT_TRUE(service_discovery_client.StopFindService(handle_1).has_value());
+
+    // When the service is offered
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+
+    // Then only the handler of the second search is called
+    service_found_barrier.get_future().wait();
+}
+
 TEST_F(ServiceDiscoveryClientFixture, DoesNotCallHandlerIfFindServiceIsStopped)
 {
     RecordProperty("ParentRequirement", "4");
@@ -1179,6 +1380,97 @@ TEST_F(ServiceDiscoveryClientFixture, DoesNotCallHandlerIfFindServiceIsStoppedBu
     handler_destruction_barrier.get_future().wait();
 }
 
+TEST_F(ServiceDiscoveryClientFixture, DoesNotCallHandlerIfServiceIsReofferedWithinOneBatch)
+{
+    std::promise<void> events_queued_barrier{};
+    auto events_queued_barrier_future = events_queued_barrier.get_future();
+    std::promise<void> batch_handled_barrier{};
+
+    EXPECT_CALL(inotify_instance_mock_, Read())
+        .WillOnce([this, &events_queued_barrier_future] {
+            events_queued_barrier_future.wait();
+            return inotify_instance_->Read();
+        })
+        .WillOnce([&batch_handled_barrier] {
+            batch_handled_barrier.set_value();
+            return amp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>{};
+        })
+        .WillRepeatedly([] { return amp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>{}; });
+
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given a handler, which is only called once for the already offered service
+    StrictMock<MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>> find_service_handler{};
+    EXPECT_CALL(find_service_handler, Call(_, _)).Times(1);
+
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+    EXPECT_TRUE(service_discovery_client
+                    .StartFindService(make_FindServiceHandle(1U),
+                                      CreateWrappedMockFindServiceHandler(find_service_handler),
+                                      EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+
+    // When the service is stopped and offered again while the events end up in one batch
+    EXPECT_TRUE(
+        service_discovery_client.StopOfferService(kInstanceIdentifier1, IServiceDiscovery::QualityTypeSelector::kBoth)
+            .has_value());
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+    events_queued_barrier.set_value();
+
+    // Then the handler is not called again after the batch was handled, since the handles didn't change in total
+    batch_handled_barrier.get_future().wait();
+}
+
+TEST_F(ServiceDiscoveryClientFixture, DoesNotCallHandlerIfServiceIsOfferedAndStoppedWithinOneBatch)
+{
+    std::promise<void> events_queued_barrier{};
+    auto events_queued_barrier_future = events_queued_barrier.get_future();
+    std::promise<void> batch_handled_barrier{};
+
+    EXPECT_CALL(inotify_instance_mock_, Read())
+        .WillOnce([this, &events_queued_barrier_future] {
+            events_queued_barrier_future.wait();
+            return inotify_instance_->Read();
+        })
+        .WillOnce([&batch_handled_barrier] {
+            batch_handled_barrier.set_value();
+            return amp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>{};
+        })
+        .WillRepeatedly([] { return amp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>{}; });
+
+    auto service_discovery_client = CreateAServiceDiscoveryClient();
+
+    // Given a search for an instance, which is withdrawn after the search started
+    StrictMock<MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>> find_service_handler{};
+    EXPECT_CALL(find_service_handler, Call(_, _))
+        .WillOnce(WithArg<0>(Invoke([](const auto& handles) {
+            EXPECT_EQ(handles.size(), 1);
+        })))
+        .WillOnce(WithArg<0>(Invoke([](const auto& handles) {
+            EXPECT_TRUE(handles.empty());
+        })));
+
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+    EXPECT_TRUE(service_discovery_client
+                    .StartFindService(make_FindServiceHandle(1U),
+                                      CreateWrappedMockFindServiceHandler(find_service_handler),
+                                      EnrichedInstanceIdentifier{kInstanceIdentifier1})
+                    .has_value());
+    EXPECT_TRUE(
+        service_discovery_client.StopOfferService(kInstanceIdentifier1, IServiceDiscovery::QualityTypeSelector::kBoth)
+            .has_value());
+
+    // When the service is offered and stopped again, while all events end up in one batch
+    EXPECT_TRUE(service_discovery_client.OfferService(kInstanceIdentifier1).has_value());
+    EXPECT_TRUE(
+        service_discovery_client.StopOfferService(kInstanceIdentifier1, IServiceDiscovery::QualityTypeSelector::kBoth)
+            .has_value());
+    events_queued_barrier.set_value();
+
+    // Then the handler is called only once more after the batch was handled, without any handles
+    batch_handled_barrier.get_future().wait();
+}
+
 TEST_F(ServiceDiscoveryClientFixture, DoesNotCallHandlerIfServiceOfferIsStoppedBeforeSearchStarts)
 {
     RecordProperty("Verifies", "4");
@@ -0,0 +1,263 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/shm_page_backing.h"
+
+#include "platform/aas/mw/log/logging.h"
+
+#include <amp_optional.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+amp::optional<std::size_t> GetShmObjectSize(memory::shared::ISharedMemoryResource& memory_resource) noexcept
+{
+    struct stat file_status
+    {
+    };
+    if (::fstat(memory_resource.GetFileDescriptor(), &file_status) != 0)
+    {
+        return amp::nullopt;
+    }
+    return static_cast<std::size_t>(file_status.st_size);
+}
+
+/// \brief Maps all pages of the given range without modifying their content.
+void Prefault(void* const base_address, const std::size_t size, const bool writable) noexcept
+{
+#if defined(MADV_POPULATE_WRITE)
+    if (::madvise(base_address, size, writable ? MADV_POPULATE_WRITE : MADV_POPULATE_READ) == 0)
+    {
+        return;
+    }
+#else
+    static_cast<void>(writable);
+#endif
+    // Fallback for kernels/OSs without MADV_POPULATE_*: reading one byte per page maps the page.
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const volatile std::uint8_t* const bytes = static_cast<const volatile std::uint8_t*>(base_address);
+    for (std::size_t offset{0U}; offset < size; offset += page_size)
+    {
+        static_cast<void>(bytes[offset]);
+    }
+}
+
+#if defined(__linux__)
+/// \brief Returns, whether the mapping contains at least one complete huge page, which is aligned to kShmHugePageSize.
+bool ContainsAlignedHugePage(const void* const base_address, const std::size_t size) noexcept
+{
+    const auto begin = reinterpret_cast<std::uintptr_t>(base_address);
+    const auto first_huge_page = ((begin + kShmHugePageSize) - 1U) & ~(kShmHugePageSize - 1U);
+    return (first_huge_page >= begin) && ((first_huge_page - begin) <= size) &&
+           ((size - (first_huge_page - begin)) >= kShmHugePageSize);
+}
+
+/// \brief Reads the selected value of /sys/kernel/mm/transparent_hugepage/shmem_enabled, which is put in brackets,
+/// e.g. "always within_size [advise] never deny force".
+amp::optional<std::string> ReadShmemHugePageSetting() noexcept
+{
+    std::ifstream shmem_enabled{"/sys/kernel/mm/transparent_hugepage/shmem_enabled"};
+    std::string value{};
+    while (shmem_enabled >> value)
+    {
+        if ((value.size() > 2U) && (value.front() == '[') && (value.back() == ']'))
+        {
+            return value.substr(1U, value.size() - 2U);
+        }
+    }
+    return amp::nullopt;
+}
+
+/// \brief Requests huge pages for the mapping and logs, if they can't be applied.
+void AdviseHugePages(void* const base_address, const std::size_t size, const amp::string_view shm_object_name) noexcept
+{
+    if (!ContainsAlignedHugePage(base_address, size))
+    {
+        bmw::mw::log::LogWarn("lola") << "shm-object" << shm_object_name << "can't be backed by huge pages, as its"
+                                      << size << "bytes mapping doesn't contain a complete, aligned huge page of"
+                                      << kShmHugePageSize << "bytes.";
+        return;
+    }
+    if (::madvise(base_address, size, MADV_HUGEPAGE) != 0)
+    {
+        bmw::mw::log::LogWarn("lola") << "Requesting huge pages for shm-object" << shm_object_name
+                                      << "failed:" << std::strerror(errno);
+        return;
+    }
+    const auto shmem_huge_page_setting = ReadShmemHugePageSetting();
+    if (shmem_huge_page_setting.has_value() &&
+        ((shmem_huge_page_setting.value() == "never") || (shmem_huge_page_setting.value() == "deny")))
+    {
+        bmw::mw::log::LogWarn("lola") << "Huge pages requested for shm-object" << shm_object_name
+                                      << "have no effect, as /sys/kernel/mm/transparent_hugepage/shmem_enabled is"
+                                      << shmem_huge_page_setting.value();
+    }
+}
+
+struct MappedPageSizes
+{
+    std::size_t kernel_page_size_kb;
+    std::size_t shmem_pmd_mapped_kb;
+};
+
+/// \brief Looks up the page sizes of the mapping starting at the given address in /proc/self/smaps.
+amp::optional<MappedPageSizes> ReadMappedPageSizes(const void* const base_address) noexcept
+{
+    std::ifstream smaps{"/proc/self/smaps"};
+    const auto base = reinterpret_cast<std::uintptr_t>(base_address);
+    MappedPageSizes page_sizes{};
+    bool found_mapping{false};
+    std::string line{};
+    while (std::getline(smaps, line))
+    {
+        std::istringstream line_stream{line};
+        // Each mapping starts with a line "<start>-<end> ...", all further lines of it have the form "<key>: <value>".
+        std::uintptr_t start{};
+        char separator{};
+        if ((line_stream >> std::hex >> start >> separator) && (separator == '-'))
+        {
+            if (found_mapping)
+            {
+                break;
+            }
+            found_mapping = (start == base);
+            continue;
+        }
+        if (!found_mapping)
+        {
+            continue;
+        }
+
+        line_stream.clear();
+        line_stream.str(line);
+        std::string key{};
+        std::size_t value_kb{};
+        if (line_stream >> key >> std::dec >> value_kb)
+        {
+            if (key == "KernelPageSize:")
+            {
+                page_sizes.kernel_page_size_kb = value_kb;
+            }
+            else if (key == "ShmemPmdMapped:")
+            {
+                page_sizes.shmem_pmd_mapped_kb = value_kb;
+            }
+        }
+    }
+    if (!found_mapping)
+    {
+        return amp::nullopt;
+    }
+    return page_sizes;
+}
+#endif
+
+}  // namespace
+
+std::size_t RoundUpToHugePageSize(const std::size_t size) noexcept
+{
+    return ((size + kShmHugePageSize) - 1U) & ~(kShmHugePageSize - 1U);
+}
+
+void ApplyShmPageBacking(memory::shared::ISharedMemoryResource& memory_resource,
+                         const bool writable,
+                         const LolaServiceInstanceDeployment& deployment) noexcept
+{
+    if ((!deployment.shm_huge_pages_) && (deployment.shm_prefault_mode_ == ShmPrefaultMode::kNone))
+    {
+        return;
+    }
+
+    const auto* const path = memory_resource.getPath();
+    const std::string shm_object_name = (path != nullptr) ? *path : std::string{"(anonymous)"};
+    void* const base_address = memory_resource.getBaseAddress();
+    const auto size = GetShmObjectSize(memory_resource);
+    if ((base_address == nullptr) || (!size.has_value()))
+    {
+        bmw::mw::log::LogWarn("lola") << "Could not determine mapping of shm-object" << shm_object_name
+                                      << ". Ignoring its page backing settings.";
+        return;
+    }
+    ApplyShmPageBacking(base_address, size.value(), shm_object_name, writable, deployment);
+}
+
+void ApplyShmPageBacking(void* const base_address,
+                         const std::size_t size,
+                         const amp::string_view shm_object_name,
+                         const bool writable,
+                         const LolaServiceInstanceDeployment& deployment) noexcept
+{
+    if ((!deployment.shm_huge_pages_) && (deployment.shm_prefault_mode_ == ShmPrefaultMode::kNone))
+    {
+        return;
+    }
+
+    if (deployment.shm_huge_pages_)
+    {
+#if defined(__linux__)
+        AdviseHugePages(base_address, size, shm_object_name);
+#else
+        bmw::mw::log::LogWarn("lola") << "Huge pages for shm-object" << shm_object_name
+                                      << "are not supported on this OS.";
+#endif
+    }
+
+    if (deployment.shm_prefault_mode_ == ShmPrefaultMode::kLock)
+    {
+        // mlock() maps all pages as well. Only if locking isn't permitted, they get mapped without locking.
+        if (::mlock(base_address, size) != 0)
+        {
+            bmw::mw::log::LogWarn("lola") << "Locking shm-object" << shm_object_name
+                                          << "failed:" << std::strerror(errno) << ". Only pre-faulting it.";
+            Prefault(base_address, size, writable);
+        }
+    }
+    else if (deployment.shm_prefault_mode_ == ShmPrefaultMode::kPopulate)
+    {
+        Prefault(base_address, size, writable);
+    }
+
+#if defined(__linux__)
+    const auto page_sizes = ReadMappedPageSizes(base_address);
+    if (page_sizes.has_value())
+    {
+        bmw::mw::log::LogInfo("lola") << "Page backing of shm-object" << shm_object_name << "(" << size
+                                      << "bytes, prefault:" << deployment.shm_prefault_mode_
+                                      << "): page size" << page_sizes->kernel_page_size_kb << "kB,"
+                                      << page_sizes->shmem_pmd_mapped_kb << "kB mapped via huge pages";
+        return;
+    }
+#endif
+    bmw::mw::log::LogInfo("lola") << "Page backing of shm-object" << shm_object_name << "(" << size
+                                  << "bytes, prefault:" << deployment.shm_prefault_mode_ << "): page size"
+                                  << ::sysconf(_SC_PAGESIZE) << "bytes";
+}
+
+}  // namespace bmw::mw::com::impl::lola
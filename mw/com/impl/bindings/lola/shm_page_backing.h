@@ -0,0 +1,69 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_PAGE_BACKING_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_PAGE_BACKING_H
+
+#include "platform/aas/mw/com/impl/configuration/lola_service_instance_deployment.h"
+
+#include "platform/aas/lib/memory/shared/i_shared_memory_resource.h"
+
+#include <amp_string_view.hpp>
+
+#include <cstddef>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief Size of a transparent huge page backing shmem on Linux with 4 KiB base pages (PMD size).
+constexpr std::size_t kShmHugePageSize{2U * 1024U * 1024U};
+
+/// \brief Rounds the size of an shm-object up to whole huge pages.
+///
+/// \details Only complete huge pages, which are aligned within the mapping, can be backed by a huge page. So an
+/// shm-object, which shall be backed by huge pages, gets created with a multiple of kShmHugePageSize. The kernel aligns
+/// the mapping of such an shm-object to a huge page boundary, if huge pages are enabled for shmem.
+std::size_t RoundUpToHugePageSize(const std::size_t size) noexcept;
+
+/// \brief Applies the page backing settings of a service instance deployment to one of its mapped shm-objects.
+///
+/// \details Huge pages are requested as transparent huge pages via madvise(MADV_HUGEPAGE), since the
+/// SharedMemoryFactory creates the shm-objects in a tmpfs and not in a hugetlbfs. The kernel only uses them, if
+/// /sys/kernel/mm/transparent_hugepage/shmem_enabled is set to "advise" or "always". Huge pages are only supported on
+/// Linux. Pre-faulting maps all pages of the shm-object right away without modifying its content.
+/// All settings are best effort: A failure gets logged and the shm-object stays usable. This includes the cases, in
+/// which huge pages can't be applied: The mapping doesn't contain a complete, aligned huge page or huge pages are
+/// disabled for shmem. If any setting is active, the page size backing the shm-object is logged afterwards.
+///
+/// \param memory_resource the mapped shm-object
+/// \param writable whether the shm-object has been mapped writable
+/// \param deployment deployment of the service instance the shm-object belongs to
+void ApplyShmPageBacking(memory::shared::ISharedMemoryResource& memory_resource,
+                         const bool writable,
+                         const LolaServiceInstanceDeployment& deployment) noexcept;
+
+/// \brief Applies the page backing settings to the given mapping. See the overload above.
+///
+/// \param base_address start of the mapping, which has to be aligned to the base page size
+/// \param size size of the mapping in bytes
+/// \param shm_object_name name of the mapped shm-object, only used for logging
+void ApplyShmPageBacking(void* const base_address,
+                         const std::size_t size,
+                         const amp::string_view shm_object_name,
+                         const bool writable,
+                         const LolaServiceInstanceDeployment& deployment) noexcept;
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_PAGE_BACKING_H
@@ -0,0 +1,228 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/shm_page_backing.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfPages{16U};
+
+/// \brief Shared anonymous mapping, which is backed by shmem like the shm-objects.
+class SharedMapping
+{
+  public:
+    explicit SharedMapping(const std::size_t size) noexcept
+        : size_{size}, base_address_{::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)}
+    {
+    }
+    ~SharedMapping() noexcept
+    {
+        if (base_address_ != MAP_FAILED)
+        {
+            static_cast<void>(::munlock(base_address_, size_));
+            static_cast<void>(::munmap(base_address_, size_));
+        }
+    }
+    SharedMapping(const SharedMapping&) = delete;
+    SharedMapping& operator=(const SharedMapping&) = delete;
+    SharedMapping(SharedMapping&&) = delete;
+    SharedMapping& operator=(SharedMapping&&) = delete;
+
+    bool IsValid() const noexcept { return base_address_ != MAP_FAILED; }
+    void* GetBaseAddress() const noexcept { return base_address_; }
+    std::size_t GetSize() const noexcept { return size_; }
+
+    std::size_t GetNumberOfResidentPages() const noexcept
+    {
+        const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        std::vector<unsigned char> residency((size_ + page_size - 1U) / page_size);
+        if (::mincore(base_address_, size_, residency.data()) != 0)
+        {
+            return 0U;
+        }
+        std::size_t number_of_resident_pages{0U};
+        for (const auto page_residency : residency)
+        {
+            if ((page_residency & 1U) != 0U)
+            {
+                ++number_of_resident_pages;
+            }
+        }
+        return number_of_resident_pages;
+    }
+
+    /// \brief Returns, whether the mapping is flagged for huge pages ("hg" in the VmFlags of /proc/self/smaps).
+    bool IsAdvisedForHugePages() const noexcept
+    {
+        std::ifstream smaps{"/proc/self/smaps"};
+        const auto base = reinterpret_cast<std::uintptr_t>(base_address_);
+        bool found_mapping{false};
+        std::string line{};
+        while (std::getline(smaps, line))
+        {
+            std::istringstream line_stream{line};
+            std::uintptr_t start{};
+            char separator{};
+            if ((line_stream >> std::hex >> start >> separator) && (separator == '-'))
+            {
+                if (found_mapping)
+                {
+                    return false;
+                }
+                found_mapping = (start == base);
+                continue;
+            }
+            if (found_mapping && (line.rfind("VmFlags:", 0U) == 0U))
+            {
+                return (line.find(" hg") != std::string::npos);
+            }
+        }
+        return false;
+    }
+
+  private:
+    std::size_t size_;
+    void* base_address_;
+};
+
+LolaServiceInstanceDeployment CreateDeployment(const bool shm_huge_pages, const ShmPrefaultMode shm_prefault_mode)
+{
+    LolaServiceInstanceDeployment deployment{};
+    deployment.shm_huge_pages_ = shm_huge_pages;
+    deployment.shm_prefault_mode_ = shm_prefault_mode;
+    return deployment;
+}
+
+bool AreTransparentHugePagesSupported()
+{
+    return std::ifstream{"/sys/kernel/mm/transparent_hugepage/shmem_enabled"}.good();
+}
+
+std::size_t GetPageSize()
+{
+    return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+TEST(ShmPageBackingTest, RoundsUpToWholeHugePages)
+{
+    EXPECT_EQ(RoundUpToHugePageSize(0U), 0U);
+    EXPECT_EQ(RoundUpToHugePageSize(1U), kShmHugePageSize);
+    EXPECT_EQ(RoundUpToHugePageSize(kShmHugePageSize), kShmHugePageSize);
+    EXPECT_EQ(RoundUpToHugePageSize(kShmHugePageSize + 1U), 2U * kShmHugePageSize);
+}
+
+TEST(ShmPageBackingTest, PopulateMapsAllPagesWithoutModifyingThem)
+{
+    // Given a mapping, of which no page has been touched yet
+    SharedMapping mapping{kNumberOfPages * GetPageSize()};
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_EQ(mapping.GetNumberOfResidentPages(), 0U);
+
+    // When applying a deployment, which pre-faults the shm-objects
+    ApplyShmPageBacking(mapping.GetBaseAddress(),
+                        mapping.GetSize(),
+                        "test",
+                        true,
+                        CreateDeployment(false, ShmPrefaultMode::kPopulate));
+
+    // Then all pages are mapped
+    EXPECT_EQ(mapping.GetNumberOfResidentPages(), kNumberOfPages);
+
+    // and their content is still zero
+    const auto* const bytes = static_cast<const std::uint8_t*>(mapping.GetBaseAddress());
+    for (std::size_t offset{0U}; offset < mapping.GetSize(); ++offset)
+    {
+        ASSERT_EQ(bytes[offset], 0U);
+    }
+}
+
+TEST(ShmPageBackingTest, LockMapsAllPagesEvenIfLockingIsNotPermitted)
+{
+    // Given a mapping, of which no page has been touched yet
+    SharedMapping mapping{kNumberOfPages * GetPageSize()};
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_EQ(mapping.GetNumberOfResidentPages(), 0U);
+
+    // When applying a deployment, which locks the shm-objects
+    ApplyShmPageBacking(
+        mapping.GetBaseAddress(), mapping.GetSize(), "test", true, CreateDeployment(false, ShmPrefaultMode::kLock));
+
+    // Then all pages are mapped, either by mlock() or by the pre-faulting fallback
+    EXPECT_EQ(mapping.GetNumberOfResidentPages(), kNumberOfPages);
+}
+
+TEST(ShmPageBackingTest, NoneDoesNotTouchThePages)
+{
+    // Given a mapping, of which no page has been touched yet
+    SharedMapping mapping{kNumberOfPages * GetPageSize()};
+    ASSERT_TRUE(mapping.IsValid());
+
+    // When applying a deployment without any page backing setting
+    ApplyShmPageBacking(
+        mapping.GetBaseAddress(), mapping.GetSize(), "test", true, CreateDeployment(false, ShmPrefaultMode::kNone));
+
+    // Then no page is mapped and huge pages aren't requested
+    EXPECT_EQ(mapping.GetNumberOfResidentPages(), 0U);
+    EXPECT_FALSE(mapping.IsAdvisedForHugePages());
+}
+
+TEST(ShmPageBackingTest, HugePagesAreAdvisedForMappingContainingAnAlignedHugePage)
+{
+    if (!AreTransparentHugePagesSupported())
+    {
+        GTEST_SKIP() << "Transparent huge pages are not supported by the kernel.";
+    }
+
+    // Given a mapping of two huge pages, which contains at least one complete, aligned huge page
+    SharedMapping mapping{2U * kShmHugePageSize};
+    ASSERT_TRUE(mapping.IsValid());
+
+    // When applying a deployment with huge pages
+    ApplyShmPageBacking(
+        mapping.GetBaseAddress(), mapping.GetSize(), "test", true, CreateDeployment(true, ShmPrefaultMode::kNone));
+
+    // Then huge pages are requested for the mapping
+    EXPECT_TRUE(mapping.IsAdvisedForHugePages());
+}
+
+TEST(ShmPageBackingTest, HugePagesAreNotAdvisedForMappingSmallerThanAHugePage)
+{
+    // Given a mapping, which is smaller than a huge page
+    SharedMapping mapping{kNumberOfPages * GetPageSize()};
+    ASSERT_TRUE(mapping.IsValid());
+
+    // When applying a deployment with huge pages
+    ApplyShmPageBacking(
+        mapping.GetBaseAddress(), mapping.GetSize(), "test", true, CreateDeployment(true, ShmPrefaultMode::kNone));
+
+    // Then huge pages aren't requested, since they couldn't be applied anyway
+    EXPECT_FALSE(mapping.IsAdvisedForHugePages());
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
@@ -0,0 +1,188 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/shm_size_cache.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/path_builder.h"
+
+#include "platform/aas/lib/os/stat.h"
+#include "platform/aas/lib/os/unistd.h"
+#include "platform/aas/mw/log/logging.h"
+
+#include <sys/stat.h>
+
+#include <string>
+#include <utility>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+namespace
+{
+
+#if defined(__QNXNTO__)
+constexpr auto kShmSizeCacheDir{"/tmp_discovery/mw_com_lola/shm_size_cache/"};
+#else
+constexpr auto kShmSizeCacheDir{"/tmp/mw_com_lola/shm_size_cache/"};
+#endif
+
+/// \brief The common parent of the cache directories of all users.
+constexpr os::Stat::Mode kAllPermissions{os::Stat::Mode::kReadWriteExecUser | os::Stat::Mode::kReadWriteExecGroup |
+                                         os::Stat::Mode::kReadWriteExecOthers};
+/// \brief The cache directory of a user.
+constexpr os::Stat::Mode kOwnerPermissions{os::Stat::Mode::kReadWriteExecUser};
+
+/// \brief Has to be incremented on each change of the file format.
+constexpr std::uint32_t kFileFormatVersion{2U};
+
+/// \brief Written as last token, so that a partially written file is detected.
+constexpr auto kEndMarker{"end"};
+
+/// \brief Checks, that path is owned by the current user and can't be modified by anybody else.
+bool IsTrustworthy(const filesystem::Path& path) noexcept
+{
+    os::StatBuffer buffer{};
+    const auto stat_result = os::Stat::instance().stat(path.Native().c_str(), buffer);
+    if (!stat_result.has_value())
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Could not stat" << path.Native() << ":" << stat_result.error();
+        return false;
+    }
+    const auto is_owned_by_current_user = (buffer.st_uid == os::Unistd::instance().getuid());
+    const auto write_by_others_mask = static_cast<decltype(buffer.st_mode)>(S_IWGRP | S_IWOTH);
+    const auto is_writable_by_others = ((buffer.st_mode & write_by_others_mask) != 0);
+    if ((!is_owned_by_current_user) || is_writable_by_others)
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Ignoring" << path.Native()
+                                      << "as it is not exclusively owned by the current user.";
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+filesystem::Path ShmSizeCache::GetCacheFilePath(const uid_t uid,
+                                                const std::uint16_t service_id,
+                                                const LolaServiceInstanceId::InstanceId instance_id) noexcept
+{
+    return filesystem::Path{EmitWithPrefix(kShmSizeCacheDir, [uid, service_id, instance_id](auto& out) {
+        out << uid << '/';
+        AppendServiceAndInstance(out, service_id, instance_id);
+    })};
+}
+
+ShmSizeCache::ShmSizeCache(filesystem::Filesystem& filesystem, filesystem::Path cache_file_path) noexcept
+    : filesystem_{filesystem}, cache_file_path_{std::move(cache_file_path)}
+{
+}
+
+auto ShmSizeCache::Read(const std::uint64_t key) const noexcept -> amp::optional<Entry>
+{
+    const auto exists_result = filesystem_.standard->Exists(cache_file_path_);
+    if ((!exists_result.has_value()) || (!exists_result.value()))
+    {
+        return amp::nullopt;
+    }
+    if ((!IsTrustworthy(cache_file_path_.ParentPath())) || (!IsTrustworthy(cache_file_path_)))
+    {
+        return amp::nullopt;
+    }
+
+    auto stream_result = filesystem_.streams->Open(cache_file_path_, std::ios_base::in);
+    if (!stream_result.has_value())
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Could not open" << cache_file_path_.Native() << ":"
+                                      << stream_result.error();
+        return amp::nullopt;
+    }
+    auto& stream = *stream_result.value();
+
+    std::uint32_t file_format_version{};
+    std::uint64_t stored_key{};
+    Entry entry{};
+    bool has_control_asil_b_size{};
+    std::size_t control_asil_b_size{};
+    std::string end_marker{};
+    stream >> file_format_version >> stored_key >> entry.data_size >> entry.control_qm_size >>
+        has_control_asil_b_size >> control_asil_b_size >> end_marker;
+    if (stream.fail() || (file_format_version != kFileFormatVersion) || (end_marker != kEndMarker))
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Ignoring invalid cache file" << cache_file_path_.Native();
+        return amp::nullopt;
+    }
+    if (stored_key != key)
+    {
+        bmw::mw::log::LogDebug("lola") << "ShmSizeCache: Deployment changed since" << cache_file_path_.Native()
+                                       << "has been written.";
+        return amp::nullopt;
+    }
+
+    if (has_control_asil_b_size)
+    {
+        entry.control_asil_b_size = control_asil_b_size;
+    }
+    return entry;
+}
+
+void ShmSizeCache::Write(const std::uint64_t key, const Entry& entry) const noexcept
+{
+    const auto user_cache_dir = cache_file_path_.ParentPath();
+    const auto create_dir_result = filesystem_.utils->CreateDirectories(user_cache_dir.ParentPath(), kAllPermissions);
+    const auto create_user_dir_result = create_dir_result.has_value()
+                                            ? filesystem_.utils->CreateDirectories(user_cache_dir, kOwnerPermissions)
+                                            : create_dir_result;
+    if (!create_user_dir_result.has_value())
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Could not create directory for" << cache_file_path_.Native()
+                                      << ":" << create_user_dir_result.error();
+        return;
+    }
+    // Somebody else might have created the directory before, in which case we must not place our file into it.
+    if (!IsTrustworthy(user_cache_dir))
+    {
+        return;
+    }
+
+    auto stream_result = filesystem_.streams->Open(cache_file_path_, std::ios_base::out | std::ios_base::trunc);
+    if (!stream_result.has_value())
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Could not open" << cache_file_path_.Native() << ":"
+                                      << stream_result.error();
+        return;
+    }
+    auto& stream = *stream_result.value();
+
+    stream << kFileFormatVersion << ' ' << key << ' ' << entry.data_size << ' ' << entry.control_qm_size << ' '
+           << entry.control_asil_b_size.has_value() << ' ' << entry.control_asil_b_size.value_or(0U) << ' '
+           << kEndMarker << '\n';
+    stream.flush();
+    if (stream.fail())
+    {
+        bmw::mw::log::LogWarn("lola") << "ShmSizeCache: Could not write" << cache_file_path_.Native();
+    }
+}
+
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -0,0 +1,86 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
+
+#include "platform/aas/mw/com/impl/configuration/lola_service_instance_id.h"
+
+#include "platform/aas/lib/filesystem/filesystem.h"
+
+#include <amp_optional.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/types.h>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace lola
+{
+
+/// \brief File based cache for the sizes of the shm-objects of a service instance, which have been calculated via
+/// ShmSizeCalculationMode::kSimulation.
+///
+/// \details One entry is stored per service instance together with a key. The caller derives the key from everything
+/// the sizes depend on, so that an entry is only used as long as none of it changed. Any failure to read or write the
+/// cache file is treated like a cache miss.
+/// Each user has its own cache directory, which is only accessible by its owner. Cache files and directories, which
+/// are not owned by the current user or are writable by others, are ignored, as their content can't be trusted.
+class ShmSizeCache final
+{
+  public:
+    struct Entry
+    {
+        std::size_t data_size;
+        std::size_t control_qm_size;
+        amp::optional<std::size_t> control_asil_b_size;
+    };
+
+    /// \brief Returns the path of the cache file of the given service instance within the cache directory of the user.
+    static filesystem::Path GetCacheFilePath(const uid_t uid,
+                                             const std::uint16_t service_id,
+                                             const LolaServiceInstanceId::InstanceId instance_id) noexcept;
+
+    ShmSizeCache(filesystem::Filesystem& filesystem, filesystem::Path cache_file_path) noexcept;
+
+    /// \brief Reads the cached entry.
+    /// \param key Key of the current deployment
+    /// \return The cached entry, if it exists and has been written with the same key, otherwise nullopt.
+    amp::optional<Entry> Read(const std::uint64_t key) const noexcept;
+
+    /// \brief Replaces the cached entry.
+    /// \param key Key of the current deployment
+    /// \param entry Sizes calculated for the current deployment
+    void Write(const std::uint64_t key, const Entry& entry) const noexcept;
+
+  private:
+    filesystem::Filesystem& filesystem_;
+    filesystem::Path cache_file_path_;
+};
+
+}  // namespace lola
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
@@ -0,0 +1,210 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/bindings/lola/shm_size_cache.h"
+
+#include "platform/aas/lib/filesystem/factory/filesystem_factory_fake.h"
+#include "platform/aas/lib/os/mocklib/stat_mock.h"
+#include "platform/aas/lib/os/mocklib/unistdmock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+
+#include <string>
+
+namespace bmw::mw::com::impl::lola
+{
+namespace
+{
+
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::WithArg;
+
+constexpr std::uint64_t kKey{0xCAFEU};
+constexpr uid_t kOurUid{1234U};
+constexpr uid_t kOtherUid{4321U};
+
+class ShmSizeCacheFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ON_CALL(*unistd_mock_, getuid()).WillByDefault(Return(kOurUid));
+        EXPECT_CALL(*unistd_mock_, getuid()).Times(::testing::AnyNumber());
+        SetCacheOwnership(kOurUid, S_IRWXU);
+    }
+
+    /// \brief Lets all files and directories of the cache appear to have the given owner and permissions.
+    void SetCacheOwnership(const uid_t owner, const mode_t mode)
+    {
+        ON_CALL(*stat_mock_, stat)
+            .WillByDefault(WithArg<1>(Invoke([owner, mode](os::StatBuffer& buffer) {
+                buffer.st_uid = owner;
+                buffer.st_mode = mode;
+                return amp::expected_blank<os::Error>{};
+            })));
+        EXPECT_CALL(*stat_mock_, stat).Times(::testing::AnyNumber());
+    }
+
+    void WriteCacheFile(const std::string& content)
+    {
+        const auto cache_dir_path = cache_file_path_.ParentPath();
+        ASSERT_TRUE(filesystem_factory_fake_.GetStandard().CreateDirectories(cache_dir_path).has_value());
+        auto stream = filesystem_.streams->Open(cache_file_path_, std::ios_base::out);
+        ASSERT_TRUE(stream.has_value());
+        *stream.value() << content;
+    }
+
+    os::MockGuard<os::StatMock> stat_mock_{};
+    os::MockGuard<os::UnistdMock> unistd_mock_{};
+    filesystem::FilesystemFactoryFake filesystem_factory_fake_{};
+    filesystem::Filesystem filesystem_{filesystem_factory_fake_.CreateInstance()};
+    filesystem::Path cache_file_path_{ShmSizeCache::GetCacheFilePath(kOurUid, 1U, 2U)};
+    ShmSizeCache unit_{filesystem_, cache_file_path_};
+};
+
+TEST(ShmSizeCacheTest, CacheFilePathContainsServiceAndInstanceId)
+{
+    // When getting the path of the cache file of a service instance
+    const auto path = ShmSizeCache::GetCacheFilePath(kOurUid, 0x10U, 0x20U);
+
+    // Then its file name identifies the service instance
+    EXPECT_EQ(path, path.ParentPath() / "0000000000000016-00032");
+}
+
+TEST(ShmSizeCacheTest, CacheFilePathIsWithinDirectoryOfUser)
+{
+    // When getting the path of the cache file of a service instance for two different users
+    const auto our_path = ShmSizeCache::GetCacheFilePath(kOurUid, 0x10U, 0x20U);
+    const auto other_path = ShmSizeCache::GetCacheFilePath(kOtherUid, 0x10U, 0x20U);
+
+    // Then the files are placed into different directories, which are named after the uid
+    const auto cache_dir = our_path.ParentPath().ParentPath();
+    EXPECT_EQ(our_path.ParentPath(), cache_dir / filesystem::Path{std::to_string(kOurUid)});
+    EXPECT_EQ(other_path.ParentPath(), cache_dir / filesystem::Path{std::to_string(kOtherUid)});
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsNothingWithoutCacheFile)
+{
+    // Given no cache file
+
+    // When reading the cache
+    const auto entry = unit_.Read(kKey);
+
+    // Then nothing is returned
+    EXPECT_FALSE(entry.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsWrittenEntryForSameKey)
+{
+    // Given a cache, to which an entry has been written
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, 300U});
+
+    // When reading the cache with the same key
+    const auto entry = unit_.Read(kKey);
+
+    // Then the written sizes are returned
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->data_size, 100U);
+    EXPECT_EQ(entry->control_qm_size, 200U);
+    ASSERT_TRUE(entry->control_asil_b_size.has_value());
+    EXPECT_EQ(entry->control_asil_b_size.value(), 300U);
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsEntryWithoutAsilBSize)
+{
+    // Given a cache, to which an entry without ASIL-B control has been written
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, amp::nullopt});
+
+    // When reading the cache with the same key
+    const auto entry = unit_.Read(kKey);
+
+    // Then the entry has no ASIL-B control size
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_FALSE(entry->control_asil_b_size.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsNothingForDifferentKey)
+{
+    // Given a cache, to which an entry has been written
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, 300U});
+
+    // When reading the cache with another key, as the deployment has changed
+    const auto entry = unit_.Read(kKey + 1U);
+
+    // Then nothing is returned
+    EXPECT_FALSE(entry.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsNothingForIncompleteCacheFile)
+{
+    // Given a cache file, which has only partially been written
+    WriteCacheFile("1 51966 100 200");
+
+    // When reading the cache with the key of the file
+    const auto entry = unit_.Read(kKey);
+
+    // Then nothing is returned
+    EXPECT_FALSE(entry.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsNothingForCacheFileOfOtherUser)
+{
+    // Given a cache, to which an entry has been written
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, 300U});
+
+    // and which is owned by another user
+    SetCacheOwnership(kOtherUid, S_IRWXU);
+
+    // When reading the cache with the same key
+    const auto entry = unit_.Read(kKey);
+
+    // Then nothing is returned, as the content can't be trusted
+    EXPECT_FALSE(entry.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, ReadReturnsNothingForCacheFileWritableByOthers)
+{
+    // Given a cache, to which an entry has been written
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, 300U});
+
+    // and which can be modified by other users
+    SetCacheOwnership(kOurUid, S_IRWXU | S_IWGRP | S_IWOTH);
+
+    // When reading the cache with the same key
+    const auto entry = unit_.Read(kKey);
+
+    // Then nothing is returned, as the content can't be trusted
+    EXPECT_FALSE(entry.has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, WriteDoesNotPlaceFileIntoCacheDirectoryOfOtherUser)
+{
+    // Given that the cache directory has been created by another user
+    SetCacheOwnership(kOtherUid, S_IRWXU);
+
+    // When writing an entry to the cache
+    unit_.Write(kKey, ShmSizeCache::Entry{100U, 200U, 300U});
+
+    // Then no cache file is created
+    const auto exists_result = filesystem_.standard->Exists(cache_file_path_);
+    ASSERT_TRUE(exists_result.has_value());
+    EXPECT_FALSE(exists_result.value());
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::impl::lola
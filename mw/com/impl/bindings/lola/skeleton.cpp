@@ -14,7 +14,12 @@
 
 #include "platform/aas/mw/com/impl/bindings/lola/skeleton.h"
 
+#include "platform/aas/mw/com/impl/bindings/lola/event_control_slots.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_allocation_order.h"
+#include "platform/aas/mw/com/impl/bindings/lola/shm_page_backing.h"
 #include "platform/aas/mw/com/impl/bindings/lola/shm_path_builder.h"
+#include "platform/aas/mw/com/impl/bindings/lola/shm_size_cache.h"
 #include "platform/aas/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
 #include "platform/aas/mw/com/impl/configuration/lola_service_type_deployment.h"
 #include "platform/aas/mw/com/impl/skeleton_event_binding.h"
@@ -32,8 +37,13 @@
 
 #include <amp_assert.hpp>
 #include <amp_overload.hpp>
+#include <amp_span.hpp>
 #include <amp_variant.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -53,6 +63,25 @@ namespace
 {
 constexpr std::size_t STL_CONTAINER_STORAGE_NEEDS = 1024U;
 constexpr std::size_t STL_CONTAINER_ELEMENT_STORAGE_NEEDS = sizeof(void*);
+
+/// \brief Storage, which the estimation of shm-object sizes adds to the size of the allocated objects.
+struct AllocatorOverhead
+{
+    /// \brief Added once per potentially allocating container to compensate for "pre-allocation".
+    std::size_t container_storage_needs;
+    /// \brief Added per element of a map for its node.
+    std::size_t element_storage_needs;
+};
+
+/// \brief Overhead of the upper bound estimation.
+constexpr AllocatorOverhead kEstimatedAllocatorOverhead{STL_CONTAINER_STORAGE_NEEDS,
+                                                        STL_CONTAINER_ELEMENT_STORAGE_NEEDS};
+/// \brief Without overhead, the estimation yields the bytes, which get allocated in any case.
+constexpr AllocatorOverhead kNoAllocatorOverhead{0U, 0U};
+
+/// \brief Has to be incremented on each change of the data structures placed into the shm-objects or of the way they
+/// are allocated, which is not reflected by the sizes of the data types, which are part of the ShmSizeCache key.
+constexpr std::uint32_t kShmObjectLayoutVersion{1U};
 const filesystem::Path TMP_DIR{"/tmp/mw_com_lola"};
 
 /// \brief log with INFO level the ACL of the given SharedMemoryResource
@@ -169,10 +198,12 @@ std::uint64_t CalculateMemoryResourceId(const LolaServiceTypeDeployment& service
 /// \brief Calculates (estimates) size needed for shm-object for control.
 /// \param instance_deployment deployment info needed for "max-samples" lookup
 /// \param events events the skeleton provides
+/// \param overhead storage added for allocating containers and their elements
 /// \return estimated size in bytes
 std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment& instance_deployment,
                                            const SkeletonBinding::SkeletonEventBindings& events,
-                                           const SkeletonBinding::SkeletonFieldBindings& fields) noexcept
+                                           const SkeletonBinding::SkeletonFieldBindings& fields,
+                                           const AllocatorOverhead& overhead) noexcept
 {
     // Strategy to calculate the upper bound size needs of the data structures, we are going to place into ShmResource:
     // We add size needs of the "management space" the SharedMemoryResource needs itself and then the size of the
@@ -183,7 +214,7 @@ std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment&
     //   form of STL_CONTAINER_ELEMENT_STORAGE_NEEDS.
     std::size_t control_resource_size{};
     control_resource_size += sizeof(ServiceDataControl);
-    control_resource_size += STL_CONTAINER_STORAGE_NEEDS;
+    control_resource_size += overhead.container_storage_needs;
 
     // ServiceDataControl contains an UidPidMapping, which again contains a DynamicArray with kMaxUidPidMappings
     // elements of MappingEntries
@@ -191,13 +222,17 @@ std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment&
 
     // For the moment, fields are equivalent to events in terms of shared memory footprint. Therefore, we can use the
     // same calculation to estimate the element size of an event or field.
-    constexpr auto CalculateServiceElementSize = [](const std::size_t max_samples) -> std::size_t {
+    const auto CalculateServiceElementSize = [&overhead](const std::size_t max_samples,
+                                                         const SlotStatusLayout slot_status_layout) -> std::size_t {
         std::size_t map_element_size = sizeof(decltype(ServiceDataControl::event_controls_)::value_type);
-        map_element_size += STL_CONTAINER_ELEMENT_STORAGE_NEEDS;
-        // the mapped type again is a vector, so add STL_CONTAINER_STORAGE_NEEDS
-        map_element_size += STL_CONTAINER_STORAGE_NEEDS;
-        // and it contains max_samples_ control slots
-        map_element_size += (max_samples * sizeof(EventDataControl::EventControlSlots::value_type));
+        map_element_size += overhead.element_storage_needs;
+        // the mapped type again is a vector, so add the container storage needs
+        map_element_size += overhead.container_storage_needs;
+        // and it contains max_samples_ control slots, whose footprint depends on the configured layout
+        map_element_size += EventControlSlots::GetRequiredStorageSize(max_samples, slot_status_layout);
+        // and an EventSlotAllocationOrder, which consists of several containers with max_samples_ entries each
+        map_element_size += (EventSlotAllocationOrder::kNumberOfContainers * overhead.container_storage_needs);
+        map_element_size += (max_samples * EventSlotAllocationOrder::kStorageSizePerSlot);
         return map_element_size;
     };
 
@@ -207,7 +242,7 @@ std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment&
         AMP_ASSERT_PRD_MESSAGE(search != instance_deployment.events_.cend(),
                                "Deployment doesn't contain event with given name!");
         const auto max_samples = static_cast<std::size_t>(search->second.GetNumberOfSampleSlots().value());
-        control_resource_size += CalculateServiceElementSize(max_samples);
+        control_resource_size += CalculateServiceElementSize(max_samples, search->second.slot_status_layout_);
     }
 
     for (const auto& field : fields)
@@ -216,7 +251,8 @@ std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment&
         AMP_ASSERT_PRD_MESSAGE(search != instance_deployment.fields_.cend(),
                                "Deployment doesn't contain field with given name!");
         const auto max_samples = static_cast<std::size_t>(search->second.GetNumberOfSampleSlots().value());
-        control_resource_size += CalculateServiceElementSize(static_cast<std::size_t>(max_samples));
+        control_resource_size +=
+            CalculateServiceElementSize(static_cast<std::size_t>(max_samples), search->second.slot_status_layout_);
     }
     return control_resource_size;
 }
@@ -224,33 +260,42 @@ std::size_t EstimateControlShmResourceSize(const LolaServiceInstanceDeployment&
 /// \brief Calculates (estimates) size needed for shm-object for data.
 /// \param instance_deployment deployment info needed for "max-samples" lookup
 /// \param events events the skeleton provides
+/// \param overhead storage added for allocating containers and their elements
 /// \return estimated size in bytes
 std::size_t EstimateDataShmResourceSize(const LolaServiceInstanceDeployment& instance_deployment,
                                         const SkeletonBinding::SkeletonEventBindings& events,
-                                        const SkeletonBinding::SkeletonFieldBindings& fields) noexcept
+                                        const SkeletonBinding::SkeletonFieldBindings& fields,
+                                        const AllocatorOverhead& overhead) noexcept
 {
     // Explanation of estimation algo/approach -> see comment in EstimateControlShmResourceSize()
 
     std::size_t data_resource_size{};
     data_resource_size += sizeof(bmw::mw::com::impl::lola::ServiceDataStorage);
     // since ServiceDataStorage contains two std::maps ->
-    data_resource_size += (2U * STL_CONTAINER_STORAGE_NEEDS);
+    data_resource_size += (2U * overhead.container_storage_needs);
 
     // For the moment, fields are equivalent to events in terms of shared memory footprint. Therefore, we can use the
     // same calculation to estimate the element size of an event or field.
-    constexpr auto CalculateServiceElementSize = [](const std::size_t max_samples,
-                                                    const std::size_t max_size) -> std::size_t {
+    const auto CalculateServiceElementSize = [&overhead](const std::size_t max_samples,
+                                                         const EventDataSlotLayout& slot_layout,
+                                                         const std::size_t sample_arena_size) -> std::size_t {
         // 1st the storage size per event_map_element
         std::size_t event_map_element_size = sizeof(decltype(ServiceDataStorage::events_)::value_type);
-        event_map_element_size += STL_CONTAINER_ELEMENT_STORAGE_NEEDS;
-        // the mapped type again is a vector, so add STL_CONTAINER_STORAGE_NEEDS
-        event_map_element_size += STL_CONTAINER_STORAGE_NEEDS;
-        // and it contains max_samples_ data slots
-        event_map_element_size += (max_samples * max_size);
+        event_map_element_size += overhead.element_storage_needs;
+        // the mapped type again is a vector, so add the container storage needs
+        event_map_element_size += overhead.container_storage_needs;
+        // and it contains max_samples_ data slots, whose footprint depends on the slot layout
+        event_map_element_size += slot_layout.GetRequiredStorageSize(max_samples);
         // 2nd the storage size per meta_info_map_element
         std::size_t meta_info_map_element_size = sizeof(decltype(ServiceDataStorage::events_metainfo_)::value_type);
-        meta_info_map_element_size += STL_CONTAINER_ELEMENT_STORAGE_NEEDS;
-        return event_map_element_size + meta_info_map_element_size;
+        meta_info_map_element_size += overhead.element_storage_needs;
+        // 3rd the optional sample arena, which again is a vector
+        std::size_t sample_arena_storage_size{0U};
+        if (sample_arena_size > 0U)
+        {
+            sample_arena_storage_size = overhead.container_storage_needs + sample_arena_size;
+        }
+        return event_map_element_size + meta_info_map_element_size + sample_arena_storage_size;
     };
     for (const auto& event : events)
     {
@@ -258,8 +303,11 @@ std::size_t EstimateDataShmResourceSize(const LolaServiceInstanceDeployment& ins
         AMP_ASSERT_PRD_MESSAGE(search != instance_deployment.events_.cend(),
                                "Deployment doesn't contain event with given name!");
         const auto max_samples = static_cast<std::size_t>(search->second.GetNumberOfSampleSlots().value());
-        const auto max_size = event.second.get().GetMaxSize();
-        data_resource_size += CalculateServiceElementSize(max_samples, max_size);
+        const auto slot_layout = EventDataSlotLayout::Create(event.second.get().GetMaxSize(),
+                                                             event.second.get().GetMaxAlign(),
+                                                             search->second.slot_alignment_.value_or(1U));
+        const auto sample_arena_size = static_cast<std::size_t>(search->second.sample_arena_size_.value_or(0U));
+        data_resource_size += CalculateServiceElementSize(max_samples, slot_layout, sample_arena_size);
     }
 
     for (const auto& field : fields)
@@ -268,12 +316,97 @@ std::size_t EstimateDataShmResourceSize(const LolaServiceInstanceDeployment& ins
         AMP_ASSERT_PRD_MESSAGE(search != instance_deployment.fields_.cend(),
                                "Deployment doesn't contain field with given name!");
         const auto max_samples = static_cast<std::size_t>(search->second.GetNumberOfSampleSlots().value());
-        const auto max_size = field.second.get().GetMaxSize();
-        data_resource_size += CalculateServiceElementSize(max_samples, max_size);
+        const auto slot_layout = EventDataSlotLayout::Create(field.second.get().GetMaxSize(),
+                                                             field.second.get().GetMaxAlign(),
+                                                             search->second.slot_alignment_.value_or(1U));
+        data_resource_size += CalculateServiceElementSize(max_samples, slot_layout, 0U);
     }
     return data_resource_size;
 }
 
+/// \brief Calculates a 64 bit FNV-1a hash, which, unlike std::hash, yields the same value with every toolchain.
+std::uint64_t CalculateStableHash(const std::string& input) noexcept
+{
+    constexpr std::uint64_t kFnvOffsetBasis{14695981039346656037U};
+    constexpr std::uint64_t kFnvPrime{1099511628211U};
+    std::uint64_t hash{kFnvOffsetBasis};
+    for (const auto character : input)
+    {
+        hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(character));
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+/// \brief Derives the key of the ShmSizeCache from everything the simulated shm-object sizes depend on.
+/// \details These are the deployment, the size and alignment of the sample type of each event/field and a fingerprint
+/// of the layout of the data structures placed into the shm-objects by this build.
+std::uint64_t CalculateShmSizeCacheKey(const InstanceIdentifier& identifier,
+                                       const SkeletonBinding::SkeletonEventBindings& events,
+                                       const SkeletonBinding::SkeletonFieldBindings& fields) noexcept
+{
+    std::stringstream key_source{};
+    const auto serialized_identifier = identifier.ToString();
+    key_source << std::string{serialized_identifier.data(), serialized_identifier.size()};
+
+    const auto AppendServiceElements = [&key_source](const char* const element_tag,
+                                                     const SkeletonBinding::SkeletonEventBindings& elements) {
+        for (const auto& element : elements)
+        {
+            key_source << '|' << element_tag << ':' << std::string{element.first.data(), element.first.size()}
+                       << ':' << element.second.get().GetMaxSize() << ':' << element.second.get().GetMaxAlign();
+        }
+    };
+    AppendServiceElements("event", events);
+    AppendServiceElements("field", fields);
+
+    key_source << "|layout:" << kShmObjectLayoutVersion << ':' << sizeof(ServiceDataControl) << ':'
+               << sizeof(decltype(ServiceDataControl::event_controls_)::value_type) << ':'
+               << sizeof(EventDataControl) << ':' << sizeof(EventSlotAllocationOrder) << ':'
+               << EventSlotAllocationOrder::kStorageSizePerSlot << ':' << sizeof(UidPidMappingEntry) << ':'
+               << sizeof(ServiceDataStorage) << ':' << sizeof(decltype(ServiceDataStorage::events_)::value_type)
+               << ':' << sizeof(decltype(ServiceDataStorage::events_metainfo_)::value_type) << ':'
+               << sizeof(EventDataStorage<std::uint8_t>) << ':' << alignof(std::max_align_t);
+#if defined(__VERSION__)
+    // The allocator overhead within the shm-objects depends on the standard library implementation.
+    key_source << "|toolchain:" << __VERSION__;
+#endif
+
+    return CalculateStableHash(key_source.str());
+}
+
+/// \brief Checks, that each cached size lies between the bytes, which get allocated in any case, and the upper bound
+/// estimation. Sizes outside of this range stem from a corrupted cache entry and must not be used.
+bool IsWithinEstimatedRange(const ShmSizeCache::Entry& entry,
+                            const LolaServiceInstanceDeployment& instance_deployment,
+                            const SkeletonBinding::SkeletonEventBindings& events,
+                            const SkeletonBinding::SkeletonFieldBindings& fields,
+                            const bool has_asil_b_support) noexcept
+{
+    const auto IsWithin = [](const std::size_t size, const std::size_t lower_bound, const std::size_t upper_bound) {
+        return (size >= lower_bound) && (size <= upper_bound);
+    };
+    const auto control_lower_bound =
+        EstimateControlShmResourceSize(instance_deployment, events, fields, kNoAllocatorOverhead);
+    const auto control_upper_bound =
+        EstimateControlShmResourceSize(instance_deployment, events, fields, kEstimatedAllocatorOverhead);
+    const auto data_lower_bound =
+        EstimateDataShmResourceSize(instance_deployment, events, fields, kNoAllocatorOverhead);
+    const auto data_upper_bound =
+        EstimateDataShmResourceSize(instance_deployment, events, fields, kEstimatedAllocatorOverhead);
+
+    if (entry.control_asil_b_size.has_value() != has_asil_b_support)
+    {
+        return false;
+    }
+    if (has_asil_b_support && (!IsWithin(entry.control_asil_b_size.value(), control_lower_bound, control_upper_bound)))
+    {
+        return false;
+    }
+    return IsWithin(entry.control_qm_size, control_lower_bound, control_upper_bound) &&
+           IsWithin(entry.data_size, data_lower_bound, data_upper_bound);
+}
+
 bool CreatePartialRestartDirectory(
     const bmw::filesystem::Filesystem& filesystem,
     const std::unique_ptr<IPartialRestartPathBuilder>& partial_restart_path_builder) noexcept
@@ -426,7 +559,16 @@ Skeleton::Skeleton(const InstanceIdentifier& identifier,
       service_instance_usage_marker_file_{},
       service_instance_existence_flock_mutex_and_lock_{std::move(service_instance_existence_flock_mutex_and_lock)},
       was_old_shm_region_reopened_{false},
-      filesystem_{std::move(filesystem)}
+      is_offer_suspended_{false},
+      was_suspended_offer_resumed_{false},
+      filesystem_{std::move(filesystem)},
+      event_notification_coalescing_enabled_{false},
+      pending_event_notifications_mutex_{},
+      pending_event_notifications_qm_{},
+      pending_event_notifications_asil_b_{},
+      flush_event_notifications_mutex_{},
+      flushed_event_notifications_qm_{},
+      flushed_event_notifications_asil_b_{}
 {
 }
 
@@ -440,6 +582,17 @@ auto Skeleton::PrepareOffer(SkeletonEventBindings& events,
         enriched_instance_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>().value();
     const auto instance_id = enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>().value();
 
+    ReserveEventNotificationBuffers(events.size() + fields.size());
+
+    was_suspended_offer_resumed_ = is_offer_suspended_;
+    if (is_offer_suspended_)
+    {
+        bmw::mw::log::LogDebug("lola") << "Resuming suspended offer of Skeleton (S:" << service_id
+                                       << "I:" << instance_id << ")";
+        ResumeSuspendedOffer(std::move(register_shm_object_trace_callback));
+        return {};
+    }
+
     service_instance_usage_marker_file_ =
         CreateOrOpenServiceInstanceUsageMarkerFile(identifier_, partial_restart_path_builder_);
     if (!service_instance_usage_marker_file_.has_value())
@@ -487,12 +640,39 @@ auto Skeleton::PrepareOffer(SkeletonEventBindings& events,
 
 ResultBlank Skeleton::FinalizeOffer() noexcept
 {
+    // All service elements have been registered, so the offer of the shm-objects is complete.
+    if (storage_ != nullptr)
+    {
+        // The skeleton is the only writer, so no read-modify-write operation is needed.
+        const auto offer_epoch = storage_->offer_epoch_.load(std::memory_order_relaxed);
+        storage_->offer_epoch_.store(offer_epoch + 1U, std::memory_order_release);
+    }
     return {};
 }
 
+void Skeleton::ResumeSuspendedOffer(
+    amp::optional<RegisterShmObjectTraceCallback> register_shm_object_trace_callback) noexcept
+{
+    is_offer_suspended_ = false;
+
+    // The shm-objects have been unregistered from tracing on suspension, so they have to be registered again.
+    // static cast is safe here as storage_resource_ is a SharedMemoryResource, while an offer is suspended!
+    const auto data_resource = std::static_pointer_cast<bmw::memory::shared::ISharedMemoryResource>(storage_resource_);
+    if (data_resource->IsShmInTypedMemory() && register_shm_object_trace_callback.has_value())
+    {
+        register_shm_object_trace_callback.value()(tracing::TracingRuntime::kDummyElementNameForShmRegisterCallback,
+                                                   tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback,
+                                                   data_resource->GetFileDescriptor(),
+                                                   data_resource->getBaseAddress());
+    }
+}
+
 auto Skeleton::PrepareStopOffer(amp::optional<UnregisterShmObjectTraceCallback> unregister_shm_object_callback) noexcept
     -> void
 {
+    // notifications collected for the last cycle shall not get lost, when the service is stop offered.
+    FlushEventNotifications();
+
     if (unregister_shm_object_callback.has_value())
     {
         unregister_shm_object_callback.value()(
@@ -500,6 +680,8 @@ auto Skeleton::PrepareStopOffer(amp::optional<UnregisterShmObjectTraceCallback>
             tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback);
     }
 
+    is_offer_suspended_ = false;
+
     memory::shared::ExclusiveFlockMutex service_instance_usage_mutex{*service_instance_usage_marker_file_};
     std::unique_lock<memory::shared::ExclusiveFlockMutex> service_instance_usage_lock{service_instance_usage_mutex,
                                                                                       std::defer_lock};
@@ -522,6 +704,23 @@ auto Skeleton::PrepareStopOffer(amp::optional<UnregisterShmObjectTraceCallback>
     control_asil_b_ = nullptr;
 }
 
+auto Skeleton::PrepareSuspendOffer(
+    amp::optional<UnregisterShmObjectTraceCallback> unregister_shm_object_callback) noexcept -> void
+{
+    FlushEventNotifications();
+
+    if (unregister_shm_object_callback.has_value())
+    {
+        unregister_shm_object_callback.value()(
+            amp::string_view{tracing::TracingRuntime::kDummyElementNameForShmRegisterCallback},
+            tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback);
+    }
+
+    // The shm-objects stay mapped and the service instance usage marker file stays open. Consumers, which are still
+    // connected, keep their mappings and find the same event data again, once the offer gets resumed.
+    is_offer_suspended_ = true;
+}
+
 auto Skeleton::CreateSharedMemory(
     SkeletonEventBindings& events,
     SkeletonFieldBindings& fields,
@@ -529,23 +728,29 @@ auto Skeleton::CreateSharedMemory(
 {
     const auto storage_size_calc_result = CalculateShmResourceStorageSizes(events, fields);
     const auto& service_instance_deployment = GetLolaServiceInstanceDeployment(identifier_);
+    // Only complete huge pages can be backed by a huge page, so the shm-objects get rounded up to whole ones.
+    const auto get_shm_object_size = [&service_instance_deployment](const std::size_t storage_size) noexcept {
+        return service_instance_deployment.shm_huge_pages_ ? RoundUpToHugePageSize(storage_size) : storage_size;
+    };
 
-    if (!CreateSharedMemoryForControl(
-            service_instance_deployment, QualityType::kASIL_QM, storage_size_calc_result.control_qm_size))
+    if (!CreateSharedMemoryForControl(service_instance_deployment,
+                                      QualityType::kASIL_QM,
+                                      get_shm_object_size(storage_size_calc_result.control_qm_size)))
     {
         return MakeUnexpected(ComErrc::kErroneousFileHandle, "Could not create shared memory object for control QM");
     }
 
     if (detail_skeleton::HasAsilBSupport(identifier_) &&
-        (!CreateSharedMemoryForControl(
-            service_instance_deployment, QualityType::kASIL_B, storage_size_calc_result.control_asil_b_size.value())))
+        (!CreateSharedMemoryForControl(service_instance_deployment,
+                                       QualityType::kASIL_B,
+                                       get_shm_object_size(storage_size_calc_result.control_asil_b_size.value()))))
     {
         return MakeUnexpected(ComErrc::kErroneousFileHandle,
                               "Could not create shared memory object for control ASIL-B");
     }
 
     if (!CreateSharedMemoryForData(service_instance_deployment,
-                                   storage_size_calc_result.data_size,
+                                   get_shm_object_size(storage_size_calc_result.data_size),
                                    std::move(register_shm_object_trace_callback)))
     {
         return MakeUnexpected(ComErrc::kErroneousFileHandle, "Could not create shared memory object for data");
@@ -607,6 +812,7 @@ bool Skeleton::CreateSharedMemoryForData(
     }
     data_storage_path_ = path;
     LogAclOfShmObj(memory_resource);
+    ApplyShmPageBacking(*memory_resource, true, instance);
     if (memory_resource->IsShmInTypedMemory())
     {
         // only if the memory_resource could be successfully allocated in typed-memory, we call back the
@@ -665,6 +871,8 @@ bool Skeleton::CreateSharedMemoryForControl(const LolaServiceInstanceDeployment&
     // static cast is safe here as at this stage members control_qm_resource_/control_asil_resource_ are
     // SharedMemoryResources!
     LogAclOfShmObj(std::static_pointer_cast<bmw::memory::shared::ISharedMemoryResource>(control_resource));
+    ApplyShmPageBacking(
+        *std::static_pointer_cast<bmw::memory::shared::ISharedMemoryResource>(control_resource), true, instance);
     return true;
 }
 
@@ -680,6 +888,9 @@ bool Skeleton::OpenSharedMemoryForData(
     }
     data_storage_path_ = path;
     storage_resource_ = memory_resource;
+    ApplyShmPageBacking(*std::static_pointer_cast<bmw::memory::shared::ISharedMemoryResource>(memory_resource),
+                        true,
+                        GetLolaServiceInstanceDeployment(identifier_));
 
     storage_ = GetServiceDataStorage(memory_resource);
 
@@ -716,6 +927,11 @@ bool Skeleton::OpenSharedMemoryForControl(const QualityType asil_level) noexcept
         return false;
     }
     data_control_path = path;
+    // static cast is safe here as at this stage members control_qm_resource_/control_asil_resource_ are
+    // SharedMemoryResources!
+    ApplyShmPageBacking(*std::static_pointer_cast<bmw::memory::shared::ISharedMemoryResource>(control_resource),
+                        true,
+                        GetLolaServiceInstanceDeployment(identifier_));
 
     auto& control = (asil_level == QualityType::kASIL_QM) ? control_qm_ : control_asil_b_;
 
@@ -801,17 +1017,54 @@ Skeleton::ShmResourceStorageSizes Skeleton::CalculateShmResourceStorageSizesBySi
     return ShmResourceStorageSizes{control_data_size, control_qm_size, control_asil_b_size};
 }
 
+Skeleton::ShmResourceStorageSizes Skeleton::CalculateShmResourceStorageSizesBySimulationOrCache(
+    SkeletonEventBindings& events,
+    SkeletonFieldBindings& fields) noexcept
+{
+    const auto& service_type_deployment = GetLolaServiceTypeDeployment(identifier_);
+    const auto& service_instance_deployment = GetLolaServiceInstanceDeployment(identifier_);
+    const auto cache_file_path = ShmSizeCache::GetCacheFilePath(GetLoLaRuntime().GetUid(),
+                                                                service_type_deployment.service_id_,
+                                                                service_instance_deployment.instance_id_.value().id_);
+    const ShmSizeCache shm_size_cache{filesystem_, cache_file_path};
+    const auto cache_key = CalculateShmSizeCacheKey(identifier_, events, fields);
+
+    const auto cached_sizes = shm_size_cache.Read(cache_key);
+    if (cached_sizes.has_value())
+    {
+        // Too small sizes would let the offer fail, when the events allocate their storage. So rather simulate again.
+        if (IsWithinEstimatedRange(cached_sizes.value(),
+                                   service_instance_deployment,
+                                   events,
+                                   fields,
+                                   detail_skeleton::HasAsilBSupport(identifier_)))
+        {
+            bmw::mw::log::LogDebug("lola") << "Skipping simulation of shm-object sizes for " << identifier_.ToString()
+                                           << " as they are cached.";
+            return ShmResourceStorageSizes{
+                cached_sizes->data_size, cached_sizes->control_qm_size, cached_sizes->control_asil_b_size};
+        }
+        bmw::mw::log::LogWarn("lola") << "Ignoring cached shm-object sizes for " << identifier_.ToString()
+                                      << " as they are outside of the estimated range.";
+    }
+
+    const auto result = CalculateShmResourceStorageSizesBySimulation(events, fields);
+    shm_size_cache.Write(cache_key, {result.data_size, result.control_qm_size, result.control_asil_b_size});
+    return result;
+}
+
 Skeleton::ShmResourceStorageSizes Skeleton::CalculateShmResourceStorageSizesByEstimation(
     SkeletonEventBindings& events,
     SkeletonFieldBindings& fields) const noexcept
 {
-    const auto control_qm_size =
-        EstimateControlShmResourceSize(GetLolaServiceInstanceDeployment(identifier_), events, fields);
+    const auto control_qm_size = EstimateControlShmResourceSize(
+        GetLolaServiceInstanceDeployment(identifier_), events, fields, kEstimatedAllocatorOverhead);
     const auto control_asil_b_size = detail_skeleton::HasAsilBSupport(identifier_)
                                          ? amp::optional<std::size_t>{control_qm_size}
                                          : amp::optional<std::size_t>{};
 
-    const auto data_size = EstimateDataShmResourceSize(GetLolaServiceInstanceDeployment(identifier_), events, fields);
+    const auto data_size = EstimateDataShmResourceSize(
+        GetLolaServiceInstanceDeployment(identifier_), events, fields, kEstimatedAllocatorOverhead);
 
     return ShmResourceStorageSizes{data_size, control_qm_size, control_asil_b_size};
 }
@@ -820,7 +1073,7 @@ Skeleton::ShmResourceStorageSizes Skeleton::CalculateShmResourceStorageSizes(Ske
                                                                              SkeletonFieldBindings& fields) noexcept
 {
     const auto result = GetLoLaRuntime().GetShmSizeCalculationMode() == ShmSizeCalculationMode::kSimulation
-                            ? CalculateShmResourceStorageSizesBySimulation(events, fields)
+                            ? CalculateShmResourceStorageSizesBySimulationOrCache(events, fields)
                             : CalculateShmResourceStorageSizesByEstimation(events, fields);
 
     bmw::mw::log::LogInfo("lola") << "Calculated sizes of shm-objects for " << identifier_.ToString()
@@ -860,6 +1113,50 @@ amp::optional<EventMetaInfo> Skeleton::GetEventMetaInfo(const ElementFqId elemen
     }
 }
 
+amp::optional<EventPerformanceCounters::Snapshot> Skeleton::GetEventPerformanceCounters(
+    const ElementFqId element_fq_id,
+    const QualityType quality_type) const noexcept
+{
+    const ServiceDataControl* const control = (quality_type == QualityType::kASIL_B) ? control_asil_b_ : control_qm_;
+    if (control == nullptr)
+    {
+        return amp::nullopt;
+    }
+
+    const auto search = control->event_controls_.find(element_fq_id);
+    if (search == control->event_controls_.cend())
+    {
+        return amp::nullopt;
+    }
+    return search->second.data_control.GetPerformanceCountersSnapshot();
+}
+
+amp::optional<std::vector<SlotHolderDiagnostics>> Skeleton::GetSlotHolderDiagnostics(
+    const ElementFqId element_fq_id,
+    const QualityType quality_type) const noexcept
+{
+    const ServiceDataControl* const control = (quality_type == QualityType::kASIL_B) ? control_asil_b_ : control_qm_;
+    if (control == nullptr)
+    {
+        return amp::nullopt;
+    }
+
+    const auto search = control->event_controls_.find(element_fq_id);
+    if (search == control->event_controls_.cend())
+    {
+        return amp::nullopt;
+    }
+    auto slots = search->second.data_control.GetSlotHolderDiagnostics();
+    for (auto& slot : slots)
+    {
+        for (auto& holder : slot.holders)
+        {
+            holder.pid = control->uid_pid_mapping_.GetPid(holder.transaction_log_id);
+        }
+    }
+    return slots;
+}
+
 QualityType Skeleton::GetInstanceQualityType() const noexcept
 {
     return InstanceIdentifierView{identifier_}.GetServiceInstanceDeployment().asilLevel_;
@@ -881,6 +1178,85 @@ void Skeleton::CleanupSharedMemoryAfterCrash() noexcept
     }
 }
 
+void Skeleton::SetEventNotificationCoalescing(const bool enabled) noexcept
+{
+    std::lock_guard<std::mutex> flush_lock{flush_event_notifications_mutex_};
+    {
+        std::lock_guard<std::mutex> lock{pending_event_notifications_mutex_};
+        event_notification_coalescing_enabled_.store(enabled);
+        if (!enabled)
+        {
+            TakePendingEventNotifications();
+        }
+    }
+    SendTakenEventNotifications();
+}
+
+void Skeleton::FlushEventNotifications() noexcept
+{
+    std::lock_guard<std::mutex> flush_lock{flush_event_notifications_mutex_};
+    {
+        std::lock_guard<std::mutex> lock{pending_event_notifications_mutex_};
+        TakePendingEventNotifications();
+    }
+    SendTakenEventNotifications();
+}
+
+void Skeleton::ReserveEventNotificationBuffers(const std::size_t number_of_service_elements) noexcept
+{
+    // Each event/field is collected at most once per flush.
+    std::lock_guard<std::mutex> flush_lock{flush_event_notifications_mutex_};
+    std::lock_guard<std::mutex> lock{pending_event_notifications_mutex_};
+    pending_event_notifications_qm_.reserve(number_of_service_elements);
+    pending_event_notifications_asil_b_.reserve(number_of_service_elements);
+    flushed_event_notifications_qm_.reserve(number_of_service_elements);
+    flushed_event_notifications_asil_b_.reserve(number_of_service_elements);
+}
+
+void Skeleton::TakePendingEventNotifications() noexcept
+{
+    // The flushed buffers are empty, so swapping hands them over as the new pending buffers with their capacity.
+    pending_event_notifications_qm_.swap(flushed_event_notifications_qm_);
+    pending_event_notifications_asil_b_.swap(flushed_event_notifications_asil_b_);
+}
+
+void Skeleton::SendTakenEventNotifications() noexcept
+{
+    auto& messaging = GetLoLaRuntime().GetLolaMessaging();
+    if (!flushed_event_notifications_qm_.empty())
+    {
+        messaging.NotifyEvents(QualityType::kASIL_QM, amp::span<const ElementFqId>{flushed_event_notifications_qm_});
+        // clear() keeps the capacity, so the next cycles don't need to allocate anymore.
+        flushed_event_notifications_qm_.clear();
+    }
+    if (!flushed_event_notifications_asil_b_.empty())
+    {
+        messaging.NotifyEvents(QualityType::kASIL_B, amp::span<const ElementFqId>{flushed_event_notifications_asil_b_});
+        flushed_event_notifications_asil_b_.clear();
+    }
+}
+
+void Skeleton::NotifyEvent(const QualityType asil_level, const ElementFqId element_fq_id) noexcept
+{
+    if (event_notification_coalescing_enabled_.load())
+    {
+        std::unique_lock<std::mutex> lock{pending_event_notifications_mutex_};
+        // coalescing might have been disabled meanwhile. In this case the notification is sent directly below.
+        if (event_notification_coalescing_enabled_.load())
+        {
+            auto& pending_notifications = (asil_level == QualityType::kASIL_QM) ? pending_event_notifications_qm_
+                                                                                : pending_event_notifications_asil_b_;
+            if (std::find(pending_notifications.cbegin(), pending_notifications.cend(), element_fq_id) ==
+                pending_notifications.cend())
+            {
+                pending_notifications.push_back(element_fq_id);
+            }
+            return;
+        }
+    }
+    GetLoLaRuntime().GetLolaMessaging().NotifyEvent(asil_level, element_fq_id);
+}
+
 void Skeleton::DisconnectQmConsumers() noexcept
 {
     AMP_ASSERT_PRD_MESSAGE(GetInstanceQualityType() == QualityType::kASIL_B,
@@ -26,6 +26,7 @@
 #include "platform/aas/mw/com/impl/bindings/lola/skeleton_event_properties.h"
 #include "platform/aas/mw/com/impl/configuration/lola_event_id.h"
 #include "platform/aas/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "platform/aas/mw/com/impl/dynamic_sample.h"
 #include "platform/aas/mw/com/impl/instance_identifier.h"
 #include "platform/aas/mw/com/impl/runtime.h"
 #include "platform/aas/mw/com/impl/skeleton_binding.h"
@@ -42,10 +43,16 @@
 #include <amp_optional.hpp>
 #include <amp_string_view.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace bmw
 {
@@ -93,8 +100,24 @@ class Skeleton final : public SkeletonBinding
     void PrepareStopOffer(
         amp::optional<UnregisterShmObjectTraceCallback> unregister_shm_object_callback) noexcept override final;
 
+    /// \brief Keeps the shm-objects and the service instance usage marker file of the current offer, so that the next
+    /// PrepareOffer() only has to resume the offer.
+    void PrepareSuspendOffer(
+        amp::optional<UnregisterShmObjectTraceCallback> unregister_shm_object_callback) noexcept override final;
+
     BindingType GetBindingType() const noexcept override final { return BindingType::kLoLa; };
 
+    void SetEventNotificationCoalescing(const bool enabled) noexcept override final;
+
+    void FlushEventNotifications() noexcept override final;
+
+    /// \brief Notifies the update of the given event/field towards all interested consumers.
+    /// \details If event notification coalescing is enabled, the notification is only collected and sent out with the
+    ///          next FlushEventNotifications() call. A notification, which is already pending, is not collected twice.
+    /// \param asil_level asil level of the notification
+    /// \param element_fq_id identification of the updated event/field
+    void NotifyEvent(const QualityType asil_level, const ElementFqId element_fq_id) noexcept;
+
     /// \brief Enables dynamic registration of Events at the Skeleton.
     /// \tparam SampleType The type of the event
     /// \param element_fq_id The full qualified of the element (event or field) that shall be registered
@@ -106,7 +129,8 @@ class Skeleton final : public SkeletonBinding
     /// (first: where to store data, second: control data
     ///         access) If PrepareOffer created the shared memory, then will create an EventDataControl (for QM and
     ///         optionally for ASIL B) and an EventDataStorage which will be returned. If PrepareOffer opened the shared
-    ///         memory, then the opened event data from the existing shared memory will be returned.
+    ///         memory or resumed a suspended offer, then the existing event data from the shared memory will be
+    ///         returned.
     template <typename SampleType>
     std::pair<EventDataStorage<SampleType>*, EventDataControlComposite> Register(
         const ElementFqId element_fq_id,
@@ -118,6 +142,25 @@ class Skeleton final : public SkeletonBinding
     /// \return Events meta-info, if it has been registered, null else.
     amp::optional<EventMetaInfo> GetEventMetaInfo(const ElementFqId element_fq_id) const noexcept;
 
+    /// \brief Returns the performance counters of the given registered event for the given quality level.
+    /// \details Only loads the counters from the control shared memory, so it can be called while the event is in use.
+    /// \param element_fq_id identification of the event.
+    /// \param quality_type quality level of the control shared memory to read the counters from.
+    /// \return Snapshot of the counters, if the event has been registered for the quality level, null else.
+    amp::optional<EventPerformanceCounters::Snapshot> GetEventPerformanceCounters(
+        const ElementFqId element_fq_id,
+        const QualityType quality_type) const noexcept;
+
+    /// \brief Reports, which consumers reference the slots of the given registered event for the given quality level.
+    /// \details See EventDataControl::GetSlotHolderDiagnostics(). In addition, the pids of the holders are looked up in
+    ///          the uid-pid mapping of the service instance.
+    /// \param element_fq_id identification of the event.
+    /// \param quality_type quality level of the control shared memory to read the slots from.
+    /// \return Diagnostics of all referenced slots, if the event has been registered for the quality level, null else.
+    amp::optional<std::vector<SlotHolderDiagnostics>> GetSlotHolderDiagnostics(
+        const ElementFqId element_fq_id,
+        const QualityType quality_type) const noexcept;
+
     QualityType GetInstanceQualityType() const noexcept;
 
     /// \brief Cleans up all allocated slots for this SkeletonEvent of any previous running instance
@@ -131,6 +174,9 @@ class Skeleton final : public SkeletonBinding
     void DisconnectQmConsumers() noexcept;
 
   private:
+    /// \brief Resumes the offer suspended by PrepareSuspendOffer() by reusing its shm-objects.
+    void ResumeSuspendedOffer(
+        amp::optional<RegisterShmObjectTraceCallback> register_shm_object_trace_callback) noexcept;
     ResultBlank OpenExistingSharedMemory(
         amp::optional<RegisterShmObjectTraceCallback> register_shm_object_trace_callback) noexcept;
     ResultBlank CreateSharedMemory(
@@ -180,6 +226,11 @@ class Skeleton final : public SkeletonBinding
     /// \return storage sizes for the different shm-objects
     ShmResourceStorageSizes CalculateShmResourceStorageSizesBySimulation(SkeletonEventBindings& events,
                                                                          SkeletonFieldBindings& fields) noexcept;
+    /// \brief Takes the sizes from the ShmSizeCache, if they have been simulated for the same deployment before.
+    /// Otherwise, calculates them via CalculateShmResourceStorageSizesBySimulation() and stores them in the cache.
+    /// \return storage sizes for the different shm-objects
+    ShmResourceStorageSizes CalculateShmResourceStorageSizesBySimulationOrCache(SkeletonEventBindings& events,
+                                                                                SkeletonFieldBindings& fields) noexcept;
     /// \brief Calculates needed sizes for shm-objects for data and ctrl via estimation based on sizeof info of related
     /// data types.
     /// \return storage sizes for the different shm-objects
@@ -189,6 +240,19 @@ class Skeleton final : public SkeletonBinding
     void RemoveSharedMemory() noexcept;
     void RemoveStaleSharedMemoryArtefacts() const noexcept;
 
+    /// \brief Reserves the notification buffers for the given number of events and fields, so that collecting and
+    /// flushing notifications doesn't allocate.
+    void ReserveEventNotificationBuffers(const std::size_t number_of_service_elements) noexcept;
+
+    /// \brief Takes over the pending event update notifications into the flushed buffers.
+    /// \pre flush_event_notifications_mutex_ and pending_event_notifications_mutex_ are locked.
+    void TakePendingEventNotifications() noexcept;
+
+    /// \brief Sends out the notifications taken over by TakePendingEventNotifications().
+    /// \pre flush_event_notifications_mutex_ is locked, pending_event_notifications_mutex_ is not, so that
+    ///      NotifyEvent() can collect new notifications meanwhile.
+    void SendTakenEventNotifications() noexcept;
+
     InstanceIdentifier identifier_;
 
     amp::optional<std::string> data_storage_path_;
@@ -210,8 +274,22 @@ class Skeleton final : public SkeletonBinding
         service_instance_existence_flock_mutex_and_lock_;
 
     bool was_old_shm_region_reopened_;
+    bool is_offer_suspended_;
+    bool was_suspended_offer_resumed_;
 
     bmw::filesystem::Filesystem filesystem_;
+
+    /// \brief Is only read without lock for the fast path of NotifyEvent(). Modifications are done under
+    ///        pending_event_notifications_mutex_, so that no notification gets collected after the final flush.
+    std::atomic<bool> event_notification_coalescing_enabled_;
+    std::mutex pending_event_notifications_mutex_;
+    std::vector<ElementFqId> pending_event_notifications_qm_;
+    std::vector<ElementFqId> pending_event_notifications_asil_b_;
+    /// \brief Serializes flushes, which send the notifications from the flushed buffers. Locked before
+    ///        pending_event_notifications_mutex_.
+    std::mutex flush_event_notifications_mutex_;
+    std::vector<ElementFqId> flushed_event_notifications_qm_;
+    std::vector<ElementFqId> flushed_event_notifications_asil_b_;
 };
 
 namespace detail_skeleton
@@ -230,7 +308,19 @@ std::pair<EventDataStorage<SampleType>*, EventDataControlComposite> Skeleton::Re
     // If the skeleton previously crashed and there are active proxies connected to the old shared memory, then we
     // re-open that shared memory in PrepareOffer(). In that case, we should retrieved the EventDataControl and
     // EventDataStorage from the shared memory and attempt to rollback the Skeleton tracing transaction log.
-    if (was_old_shm_region_reopened_)
+    // If PrepareOffer() resumed a suspended offer of this skeleton, the event data is still intact and there is nothing
+    // to rollback.
+    if (was_suspended_offer_resumed_)
+    {
+        auto [typed_event_data_storage_ptr, event_data_control_composite] =
+            OpenEventDataFromOpenedSharedMemory<SampleType>(element_fq_id);
+
+        auto& event_data_control_qm = event_data_control_composite.GetQmEventDataControl();
+        impl::tracing::RegisterTracingTransactionLog(skeleton_event_tracing_data, event_data_control_qm);
+
+        return {typed_event_data_storage_ptr, event_data_control_composite};
+    }
+    else if (was_old_shm_region_reopened_)
     {
         auto [typed_event_data_storage_ptr, event_data_control_composite] =
             OpenEventDataFromOpenedSharedMemory<SampleType>(element_fq_id);
@@ -303,20 +393,45 @@ std::pair<EventDataStorage<SampleType>*, EventDataControlComposite> Skeleton::Cr
     const ElementFqId element_fq_id,
     const SkeletonEventProperties& element_properties) noexcept
 {
-    auto* typed_event_data_storage_ptr = storage_resource_->construct<EventDataStorage<SampleType>>(
-        element_properties.number_of_slots, storage_resource_->getMemoryResourceProxy());
+    auto* typed_event_data_storage_ptr =
+        storage_resource_->construct<EventDataStorage<SampleType>>(element_properties.number_of_slots,
+                                                                   storage_resource_->getMemoryResourceProxy(),
+                                                                   element_properties.min_slot_alignment);
 
     auto inserted_data_slots = storage_->events_.emplace(std::piecewise_construct,
                                                          std::forward_as_tuple(element_fq_id),
                                                          std::forward_as_tuple(typed_event_data_storage_ptr));
     AMP_ASSERT_PRD_MESSAGE(inserted_data_slots.second, "Couldn't register/emplace event-storage in data-section.");
 
+    std::uint8_t* sample_arena{nullptr};
+    std::size_t sample_arena_size{0U};
+    if (element_properties.sample_arena_size > 0U)
+    {
+        // Only DynamicSamples reference data in the sample arena.
+        if constexpr (std::is_same<SampleType, impl::DynamicSample>::value)
+        {
+            auto* const sample_arena_ptr = storage_resource_->construct<EventSampleArena>(
+                element_properties.sample_arena_size, storage_resource_->getMemoryResourceProxy());
+            sample_arena = sample_arena_ptr->data();
+            sample_arena_size = element_properties.sample_arena_size;
+        }
+        else
+        {
+            ::bmw::mw::log::LogWarn("lola") << "Ignoring sampleArenaSize of event" << element_fq_id
+                                            << ", as its sample type isn't DynamicSample.";
+        }
+    }
+
     constexpr DataTypeMetaInfo sample_meta_info{sizeof(SampleType), alignof(SampleType)};
     auto* event_data_raw_array = typed_event_data_storage_ptr->data();
     auto inserted_meta_info =
         storage_->events_metainfo_.emplace(std::piecewise_construct,
                                            std::forward_as_tuple(element_fq_id),
-                                           std::forward_as_tuple(sample_meta_info, event_data_raw_array));
+                                           std::forward_as_tuple(sample_meta_info,
+                                                                 typed_event_data_storage_ptr->GetSlotLayout(),
+                                                                 event_data_raw_array,
+                                                                 sample_arena,
+                                                                 sample_arena_size));
     AMP_ASSERT_PRD_MESSAGE(inserted_meta_info.second, "Couldn't register/emplace event-meta-info in data-section.");
 
     auto control_qm =
@@ -325,7 +440,8 @@ std::pair<EventDataStorage<SampleType>*, EventDataControlComposite> Skeleton::Cr
                                              std::forward_as_tuple(element_properties.number_of_slots,
                                                                    element_properties.max_subscribers,
                                                                    element_properties.enforce_max_samples,
-                                                                   control_qm_resource_->getMemoryResourceProxy()));
+                                                                   control_qm_resource_->getMemoryResourceProxy(),
+                                                                   element_properties.slot_status_layout));
     AMP_ASSERT_PRD_MESSAGE(control_qm.second, "Couldn't register/emplace event-meta-info in data-section.");
 
     EventDataControl* control_asil_result{nullptr};
@@ -337,7 +453,8 @@ std::pair<EventDataStorage<SampleType>*, EventDataControlComposite> Skeleton::Cr
             std::forward_as_tuple(element_properties.number_of_slots,
                                   element_properties.max_subscribers,
                                   element_properties.enforce_max_samples,
-                                  control_asil_resource_->getMemoryResourceProxy()));
+                                  control_asil_resource_->getMemoryResourceProxy(),
+                                  element_properties.slot_status_layout));
 
         control_asil_result = &iterator.first->second.data_control;
     }
@@ -20,8 +20,10 @@
 #include "platform/aas/mw/com/impl/bindings/lola/event_data_storage.h"
 #include "platform/aas/mw/com/impl/bindings/lola/i_runtime.h"
 #include "platform/aas/mw/com/impl/bindings/lola/sample_allocatee_ptr.h"
+#include "platform/aas/mw/com/impl/bindings/lola/sample_arena_allocator.h"
 #include "platform/aas/mw/com/impl/bindings/lola/skeleton.h"
 #include "platform/aas/mw/com/impl/bindings/lola/skeleton_event_properties.h"
+#include "platform/aas/mw/com/impl/dynamic_sample.h"
 #include "platform/aas/mw/com/impl/plumbing/sample_allocatee_ptr.h"
 #include "platform/aas/mw/com/impl/runtime.h"
 #include "platform/aas/mw/com/impl/skeleton_event_binding.h"
@@ -32,11 +34,19 @@
 
 #include <amp_assert.hpp>
 #include <amp_optional.hpp>
+#include <amp_span.hpp>
 #include <amp_string_view.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace bmw
 {
@@ -90,6 +100,18 @@ class SkeletonEvent final : public SkeletonEventBinding<SampleType>
 
     Result<impl::SampleAllocateePtr<SampleType>> Allocate() noexcept override;
 
+    /// \brief Allocates a slot and a range of the given size from the sample arena of the event. Only supported for
+    /// events of type DynamicSample, which have a sample arena configured.
+    Result<impl::SampleAllocateePtr<SampleType>> AllocateDynamic(const std::size_t data_size) noexcept override;
+
+    /// \brief Acquires the slots for all samples within one walk over the event slots. Either all or no samples get
+    /// allocated.
+    ResultBlank AllocateBatch(amp::span<impl::SampleAllocateePtr<SampleType>> samples) noexcept override;
+
+    /// \brief Marks the slots of all samples as ready with consecutive timestamps and notifies the consumers once.
+    ResultBlank SendBatch(amp::span<impl::SampleAllocateePtr<SampleType>> samples,
+                          amp::optional<SendTraceCallback> send_trace_callback) noexcept override;
+
     /// @requirement 
     ResultBlank PrepareOffer() noexcept override;
 
@@ -105,7 +127,29 @@ class SkeletonEvent final : public SkeletonEventBinding<SampleType>
     ElementFqId GetElementFQId() const noexcept { return event_fqn_; };
 
   private:
-    static lola::IRuntime& GetLoLaRuntime();
+    /// \brief Maximum number of slots, which AllocateBatch() acquires within one walk over the slots. The slot indices
+    /// of one walk are kept on the stack, bigger batches are acquired in several walks.
+    static constexpr std::size_t kMaxBatchSlotsPerWalk{32U};
+
+    /// \brief Disconnects the QM consumers, if the allocation of a slot wasn't possible for them.
+    void HandleQmDisconnect(const bool is_qm_disconnected) noexcept;
+    /// \brief Notifies all consumers about an update of the event.
+    void NotifyConsumers() noexcept;
+    /// \brief Logs, which consumers reference the slots of this event.
+    void LogSlotHolders() const noexcept;
+    /// \brief Logs the slot holders on the first failed allocation since the last successful one.
+    /// \details A producer, which retries in a loop while a consumer keeps its samples, would otherwise flood the log
+    /// and take the TransactionLogSet mutex on each retry.
+    void LogSlotHoldersOnce() noexcept;
+    /// \brief Returns the arena range of the sample in the given slot, which has just been acquired for writing.
+    /// \details A slot is only acquired for writing, if no consumer references it anymore. So its previous data can be
+    /// reused.
+    void ReleaseSampleData(const EventDataControl::SlotIndexType slot_index) noexcept;
+    /// \brief Allocates a range of the given size from the sample arena. If the arena has no fitting free range, the
+    /// ranges of the samples, which no consumer references, are reclaimed oldest first. Their slots get discarded.
+    amp::optional<amp::span<std::uint8_t>> AllocateSampleData(const std::size_t data_size) noexcept;
+    /// \brief (Re)creates the sample arena allocator and marks the ranges still referenced by the slots as allocated.
+    void InitializeSampleArena() noexcept;
 
     Skeleton& parent_;
     const ElementFqId event_fqn_;
@@ -116,6 +160,10 @@ class SkeletonEvent final : public SkeletonEventBinding<SampleType>
     EventSlotStatus::EventTimeStamp current_timestamp_;
     bool qm_disconnect_;
     amp::optional<impl::tracing::SkeletonEventTracingData> skeleton_event_tracing_data_;
+    /// \brief Whether the slot holders have been logged since the last successful allocation.
+    bool slot_holders_logged_;
+    /// \brief Hands out the ranges of the sample arena. Only exists for DynamicSample events with a sample arena.
+    std::unique_ptr<SampleArenaAllocator> sample_arena_allocator_;
 };
 
 template <typename SampleType>
@@ -134,7 +182,9 @@ SkeletonEvent<SampleType>::SkeletonEvent(
       event_data_control_composite_{amp::nullopt},
       current_timestamp_{1},
       qm_disconnect_{false},
-      skeleton_event_tracing_data_{skeleton_event_tracing_data}
+      skeleton_event_tracing_data_{skeleton_event_tracing_data},
+      slot_holders_logged_{false},
+      sample_arena_allocator_{nullptr}
 {
 }
 
@@ -142,6 +192,14 @@ template <typename SampleType>
 ResultBlank SkeletonEvent<SampleType>::Send(const SampleType& value,
                                             amp::optional<SendTraceCallback> send_trace_callback) noexcept
 {
+    if (sample_arena_allocator_ != nullptr)
+    {
+        // The data of a copied DynamicSample would not be within the sample arena and therefore not be accessible by
+        // the consumers.
+        ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Samples of an event with sample arena can only be sent "
+                                            "after AllocateDynamic().";
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
     auto allocated_slot_result = Allocate();
     if (!(allocated_slot_result.has_value()))
     {
@@ -168,15 +226,103 @@ ResultBlank SkeletonEvent<SampleType>::Send(impl::SampleAllocateePtr<SampleType>
     {
         (*send_trace_callback)(sample);
     }
+    NotifyConsumers();
+    return {};
+}
+
+template <typename SampleType>
+ResultBlank SkeletonEvent<SampleType>::SendBatch(amp::span<impl::SampleAllocateePtr<SampleType>> samples,
+                                                 amp::optional<SendTraceCallback> send_trace_callback) noexcept
+{
+    if (samples.size() == 0U)
+    {
+        return {};
+    }
+
+    for (auto& sample : samples)
+    {
+        const impl::SampleAllocateePtrView<SampleType> view{sample};
+        auto ptr = view.template As<lola::SampleAllocateePtr<SampleType>>();
+        AMP_ASSERT_PRD(nullptr != ptr);
+        ++current_timestamp_;
+        event_data_control_composite_->EventReady(ptr->GetReferencedSlot(), current_timestamp_);
+
+        if (send_trace_callback.has_value())
+        {
+            (*send_trace_callback)(sample);
+        }
+    }
+    NotifyConsumers();
+
+    for (auto& sample : samples)
+    {
+        sample = nullptr;
+    }
+    return {};
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::NotifyConsumers() noexcept
+{
+    // The shared-memory wake-up counters are signalled directly (not coalesced), as this is only a system call if a
+    // consumer is currently waiting on them.
     if (!qm_disconnect_)
     {
-        GetLoLaRuntime().GetLolaMessaging().NotifyEvent(QualityType::kASIL_QM, event_fqn_);
+        auto& qm_event_data_control = event_data_control_composite_->GetQmEventDataControl();
+        qm_event_data_control.GetUpdateNotifier().Notify();
+        qm_event_data_control.GetPerformanceCounters().RecordNotification();
+        parent_.NotifyEvent(QualityType::kASIL_QM, event_fqn_);
     }
     if (parent_.GetInstanceQualityType() == QualityType::kASIL_B)
     {
-        GetLoLaRuntime().GetLolaMessaging().NotifyEvent(QualityType::kASIL_B, event_fqn_);
+        auto asil_b_event_data_control = event_data_control_composite_->GetAsilBEventDataControl();
+        if (asil_b_event_data_control.has_value())
+        {
+            asil_b_event_data_control.value()->GetUpdateNotifier().Notify();
+            asil_b_event_data_control.value()->GetPerformanceCounters().RecordNotification();
+        }
+        parent_.NotifyEvent(QualityType::kASIL_B, event_fqn_);
+    }
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::LogSlotHolders() const noexcept
+{
+    for (const auto quality_type : {QualityType::kASIL_QM, QualityType::kASIL_B})
+    {
+        const auto slots = parent_.GetSlotHolderDiagnostics(event_fqn_, quality_type);
+        if (!slots.has_value())
+        {
+            continue;
+        }
+        for (const auto& slot : slots.value())
+        {
+            for (const auto& holder : slot.holders)
+            {
+                ::bmw::mw::log::LogError("lola")
+                    << "SkeletonEvent: Slot" << slot.slot_index << "of event" << event_fqn_ << "is referenced"
+                    << holder.number_of_references << "times by uid" << holder.transaction_log_id << "with pid"
+                    << (holder.pid.has_value() ? holder.pid.value() : pid_t{-1}) << "since"
+                    << slot.held_publish_cycles << "publish cycles.";
+            }
+            if (slot.referenced_by_skeleton_tracing)
+            {
+                ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Slot" << slot.slot_index << "of event"
+                                                 << event_fqn_ << "is referenced by tracing since"
+                                                 << slot.held_publish_cycles << "publish cycles.";
+            }
+        }
+    }
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::LogSlotHoldersOnce() noexcept
+{
+    if (!slot_holders_logged_)
+    {
+        LogSlotHolders();
+        slot_holders_logged_ = true;
     }
-    return {};
 }
 
 template <typename SampleType>
@@ -188,18 +334,12 @@ Result<impl::SampleAllocateePtr<SampleType>> SkeletonEvent<SampleType>::Allocate
         return MakeUnexpected(ComErrc::kBindingFailure);
     }
     const auto slot = event_data_control_composite_->AllocateNextSlot();
-
-    if ((qm_disconnect_ == false) && slot.second)
-    {
-        qm_disconnect_ = true;
-        bmw::mw::log::LogWarn("lola")
-            << __func__ << __LINE__
-            << "Disconnecting unsafe QM consumers as slot allocation failed on an ASIL-B enabled event: " << event_fqn_;
-        parent_.DisconnectQmConsumers();
-    }
+    HandleQmDisconnect(slot.second);
 
     if (slot.first.has_value())
     {
+        slot_holders_logged_ = false;
+        ReleaseSampleData(slot.first.value());
         return MakeSampleAllocateePtr(SampleAllocateePtr<SampleType>(
             &event_data_storage_->at(slot.first.value()), *event_data_control_composite_, slot.first.value()));
     }
@@ -213,10 +353,205 @@ Result<impl::SampleAllocateePtr<SampleType>> SkeletonEvent<SampleType>::Allocate
                 << "SkeletonEvent: Allocation of event slot failed. Hint: enforceMaxSamples was "
                    "disabled by config. Might be the root cause!";
         }
+        LogSlotHoldersOnce();
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+}
+
+template <typename SampleType>
+ResultBlank SkeletonEvent<SampleType>::AllocateBatch(amp::span<impl::SampleAllocateePtr<SampleType>> samples) noexcept
+{
+    if (event_data_control_composite_.has_value() == false)
+    {
+        ::bmw::mw::log::LogError("lola") << "Tried to allocate event batch, but the EventDataControl does not exist!";
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+    const auto number_of_samples = static_cast<std::size_t>(samples.size());
+    if (number_of_samples > event_properties_.number_of_slots)
+    {
+        ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Allocation of" << number_of_samples
+                                         << "event slots failed, as the event has only"
+                                         << event_properties_.number_of_slots << "slots.";
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+
+    std::array<EventDataControl::SlotIndexType, kMaxBatchSlotsPerWalk> slot_indices_buffer{};
+    std::size_t number_of_allocated_samples{0U};
+    while (number_of_allocated_samples < number_of_samples)
+    {
+        const auto number_of_requested_slots =
+            std::min(number_of_samples - number_of_allocated_samples, kMaxBatchSlotsPerWalk);
+        const amp::span<EventDataControl::SlotIndexType> slot_indices{slot_indices_buffer.data(),
+                                                                      number_of_requested_slots};
+        const auto allocated_slots = event_data_control_composite_->AllocateNextSlots(slot_indices);
+        HandleQmDisconnect(allocated_slots.second);
+
+        const auto number_of_allocated_slots = allocated_slots.first;
+        if (number_of_allocated_slots < number_of_requested_slots)
+        {
+            for (std::size_t index{0U}; index < number_of_allocated_slots; ++index)
+            {
+                event_data_control_composite_->Discard(slot_indices[index]);
+            }
+            // Discards the slots acquired by the previous walks.
+            for (std::size_t index{0U}; index < number_of_allocated_samples; ++index)
+            {
+                samples[index] = nullptr;
+            }
+            if (event_properties_.enforce_max_samples == false)
+            {
+                ::bmw::mw::log::LogError("lola")
+                    << "SkeletonEvent: Allocation of event slots failed. Hint: enforceMaxSamples was "
+                       "disabled by config. Might be the root cause!";
+            }
+            LogSlotHoldersOnce();
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+
+        for (const auto slot_index : slot_indices)
+        {
+            ReleaseSampleData(slot_index);
+            samples[number_of_allocated_samples] = MakeSampleAllocateePtr(SampleAllocateePtr<SampleType>(
+                &event_data_storage_->at(slot_index), *event_data_control_composite_, slot_index));
+            ++number_of_allocated_samples;
+        }
+    }
+    slot_holders_logged_ = false;
+    return {};
+}
+
+template <typename SampleType>
+Result<impl::SampleAllocateePtr<SampleType>> SkeletonEvent<SampleType>::AllocateDynamic(
+    const std::size_t data_size) noexcept
+{
+    if constexpr (std::is_same<SampleType, impl::DynamicSample>::value)
+    {
+        if (sample_arena_allocator_ == nullptr)
+        {
+            ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Dynamic allocation failed, as event" << event_fqn_
+                                             << "has no sample arena. Hint: configure sampleArenaSize.";
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+        auto allocated_slot_result = Allocate();
+        if (!(allocated_slot_result.has_value()))
+        {
+            return allocated_slot_result;
+        }
+        const auto data = AllocateSampleData(data_size);
+        if (!(data.has_value()))
+        {
+            // The slot gets discarded by the destruction of allocated_slot_result.
+            ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Allocation of" << data_size
+                                             << "bytes from the sample arena of event" << event_fqn_ << "failed. Only"
+                                             << sample_arena_allocator_->GetFreeSize()
+                                             << "bytes are free after reclaiming the ranges of all unreferenced slots.";
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+        *(allocated_slot_result.value()) = impl::DynamicSample{data->data(), static_cast<std::size_t>(data->size())};
+        return allocated_slot_result;
+    }
+    else
+    {
+        static_cast<void>(data_size);
+        ::bmw::mw::log::LogError("lola") << "SkeletonEvent: Dynamic allocation is only supported for events of type "
+                                            "DynamicSample.";
         return MakeUnexpected(ComErrc::kBindingFailure);
     }
 }
 
+template <typename SampleType>
+amp::optional<amp::span<std::uint8_t>> SkeletonEvent<SampleType>::AllocateSampleData(
+    const std::size_t data_size) noexcept
+{
+    auto data = sample_arena_allocator_->Allocate(data_size);
+    if (data.has_value())
+    {
+        return data;
+    }
+
+    // The range of a sample is only freed, when its slot gets acquired for writing again. So the arena may be exhausted
+    // by the ranges of samples, which no consumer references anymore. Their slots are acquired oldest first, until the
+    // requested range fits. All of them are held until the end, as a discarded slot is the oldest one again.
+    std::vector<EventDataControl::SlotIndexType> reclaimed_slots{};
+    reclaimed_slots.reserve(event_properties_.number_of_slots);
+    while (!(data.has_value()))
+    {
+        const auto slot = event_data_control_composite_->TryAllocateNextSlot();
+        if (!(slot.has_value()))
+        {
+            break;
+        }
+        reclaimed_slots.push_back(slot.value());
+        ReleaseSampleData(slot.value());
+        data = sample_arena_allocator_->Allocate(data_size);
+    }
+    for (const auto slot_index : reclaimed_slots)
+    {
+        event_data_control_composite_->Discard(slot_index);
+    }
+    return data;
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::ReleaseSampleData(const EventDataControl::SlotIndexType slot_index) noexcept
+{
+    if constexpr (std::is_same<SampleType, impl::DynamicSample>::value)
+    {
+        if (sample_arena_allocator_ != nullptr)
+        {
+            auto& sample = event_data_storage_->at(slot_index);
+            sample_arena_allocator_->Free(sample.GetData());
+            sample = impl::DynamicSample{};
+        }
+    }
+    else
+    {
+        static_cast<void>(slot_index);
+    }
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::InitializeSampleArena() noexcept
+{
+    sample_arena_allocator_.reset();
+    if constexpr (std::is_same<SampleType, impl::DynamicSample>::value)
+    {
+        const auto event_meta_info = parent_.GetEventMetaInfo(event_fqn_);
+        if ((!event_meta_info.has_value()) || (event_meta_info->sample_arena_size_ == 0U))
+        {
+            return;
+        }
+        auto* const arena_begin = static_cast<std::uint8_t*>(event_meta_info->sample_arena_.get());
+        sample_arena_allocator_ = std::make_unique<SampleArenaAllocator>(
+            amp::span<std::uint8_t>{arena_begin, event_meta_info->sample_arena_size_});
+
+        // After a restart or re-offer the slots may still reference data, which consumers could read.
+        for (std::size_t slot_index{0U}; slot_index < event_data_storage_->size(); ++slot_index)
+        {
+            auto& sample = event_data_storage_->at(slot_index);
+            if (!sample_arena_allocator_->MarkAllocated(sample.GetData()))
+            {
+                ::bmw::mw::log::LogWarn("lola") << "SkeletonEvent: Slot" << slot_index << "of event" << event_fqn_
+                                                << "references invalid sample arena data. Dropping it.";
+                sample = impl::DynamicSample{};
+            }
+        }
+    }
+}
+
+template <typename SampleType>
+void SkeletonEvent<SampleType>::HandleQmDisconnect(const bool is_qm_disconnected) noexcept
+{
+    if ((qm_disconnect_ == false) && is_qm_disconnected)
+    {
+        qm_disconnect_ = true;
+        bmw::mw::log::LogWarn("lola")
+            << __func__ << __LINE__
+            << "Disconnecting unsafe QM consumers as slot allocation failed on an ASIL-B enabled event: " << event_fqn_;
+        parent_.DisconnectQmConsumers();
+    }
+}
+
 template <typename SampleType>
 ResultBlank SkeletonEvent<SampleType>::PrepareOffer() noexcept
 {
@@ -226,6 +561,7 @@ ResultBlank SkeletonEvent<SampleType>::PrepareOffer() noexcept
     AMP_ASSERT_PRD_MESSAGE(event_data_control_composite_.has_value(),
                            "Defensive programming as event_data_control_composite_ is set by Register above.");
     current_timestamp_ = event_data_control_composite_.value().GetLatestTimestamp();
+    InitializeSampleArena();
     return {};
 }
 
@@ -238,19 +574,6 @@ void SkeletonEvent<SampleType>::PrepareStopOffer() noexcept
     }
 }
 
-template <typename SampleType>
-lola::IRuntime& SkeletonEvent<SampleType>::GetLoLaRuntime()
-{
-    auto* const lola_runtime =
-        dynamic_cast<lola::IRuntime*>(mw::com::impl::Runtime::getInstance().GetBindingRuntime(BindingType::kLoLa));
-    if (lola_runtime == nullptr)
-    {
-        ::bmw::mw::log::LogFatal("lola") << "SkeletonEvent: No lola runtime available.";
-        std::terminate();
-    }
-    return *lola_runtime;
-}
-
 }  // namespace lola
 }  // namespace impl
 }  // namespace com
@@ -15,6 +15,8 @@
 #ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SKELETON_EVENT_PROPERTIES_H
 #define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SKELETON_EVENT_PROPERTIES_H
 
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
+
 #include <cstddef>
 
 namespace bmw
@@ -33,6 +35,12 @@ struct SkeletonEventProperties
     std::size_t number_of_slots;
     std::size_t max_subscribers;
     bool enforce_max_samples;
+    SlotStatusLayout slot_status_layout{SlotStatusLayout::kPacked};
+    /// \brief minimum alignment of each sample slot in the data shared memory. Has to be a power of two.
+    std::size_t min_slot_alignment{1U};
+    /// \brief size of the sample arena in the data shared memory, from which DynamicSamples get their data. No sample
+    ///        arena gets created, if it is zero.
+    std::size_t sample_arena_size{0U};
 };
 
 }  // namespace lola
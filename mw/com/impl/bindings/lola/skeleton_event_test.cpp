@@ -20,11 +20,14 @@
 
 #include "platform/aas/lib/filesystem/filesystem.h"
 
+#include <amp_assert.hpp>
 #include <amp_string_view.hpp>
 #include <amp_variant.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -146,6 +149,386 @@ TEST_F(SkeletonEventAllocateFixture, SkeletonEventWithNotMaxSamplesEnforcementAl
     EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
 }
 
+using SkeletonEventAllocateBatchFixture = SkeletonEventFixture;
+TEST_F(SkeletonEventAllocateBatchFixture, CannotAllocateBatchBeforeCallingOffer)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an un-offered event in an offered service
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+
+    // When allocating a batch of samples
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(2U);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation fails
+    ASSERT_FALSE(allocate_result.has_value());
+    EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
+}
+
+TEST_F(SkeletonEventAllocateBatchFixture, AllocatesAllSlotsInOneBatch)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+
+    // When allocating a batch of as many samples as there are slots
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(max_samples_);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation succeeds and each sample points to its own slot
+    ASSERT_TRUE(allocate_result.has_value());
+    for (std::size_t index{0U}; index < samples.size(); ++index)
+    {
+        ASSERT_NE(samples[index].Get(), nullptr);
+        for (std::size_t other_index{index + 1U}; other_index < samples.size(); ++other_index)
+        {
+            EXPECT_NE(samples[index].Get(), samples[other_index].Get());
+        }
+    }
+}
+
+TEST_F(SkeletonEventAllocateBatchFixture, FailingBatchAllocatesNoSlot)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service, of which 3 out of 5 slots are allocated
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> single_samples{};
+    for (std::size_t counter = 0; counter < 3U; ++counter)
+    {
+        auto allocate_result = skeleton_event_->Allocate();
+        ASSERT_TRUE(allocate_result.has_value());
+        single_samples.push_back(std::move(allocate_result).value());
+    }
+
+    // Expecting that the QM consumers get disconnected, as the slots aren't sufficient for them
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_, IServiceDiscovery::QualityTypeSelector::kAsilQm)).Times(1);
+
+    // When allocating a batch of 3 samples
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(3U);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation fails
+    ASSERT_FALSE(allocate_result.has_value());
+    EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
+
+    // and the 2 remaining slots can still be allocated
+    EXPECT_TRUE(skeleton_event_->Allocate().has_value());
+    EXPECT_TRUE(skeleton_event_->Allocate().has_value());
+}
+
+TEST_F(SkeletonEventAllocateBatchFixture, AllocatesBatchBiggerThanOneWalkOverTheSlots)
+{
+    const bool enforce_max_samples{true};
+    const std::size_t number_of_slots{40U};
+
+    // Given an offered event in an offered service with more slots than are acquired within one walk over the slots
+    InitialiseSkeletonEvent(
+        fake_element_fq_id_, fake_event_name_, number_of_slots, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+
+    // When allocating a batch of as many samples as there are slots
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(number_of_slots);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation succeeds and each sample points to its own slot
+    ASSERT_TRUE(allocate_result.has_value());
+    for (std::size_t index{0U}; index < samples.size(); ++index)
+    {
+        ASSERT_NE(samples[index].Get(), nullptr);
+        for (std::size_t other_index{index + 1U}; other_index < samples.size(); ++other_index)
+        {
+            EXPECT_NE(samples[index].Get(), samples[other_index].Get());
+        }
+    }
+}
+
+TEST_F(SkeletonEventAllocateBatchFixture, FailingBatchBiggerThanOneWalkOverTheSlotsAllocatesNoSlot)
+{
+    const bool enforce_max_samples{true};
+    const std::size_t number_of_slots{40U};
+
+    // Given an offered event in an offered service with 40 slots, of which 1 is allocated
+    InitialiseSkeletonEvent(
+        fake_element_fq_id_, fake_event_name_, number_of_slots, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+    auto single_sample_result = skeleton_event_->Allocate();
+    ASSERT_TRUE(single_sample_result.has_value());
+
+    // Expecting that the QM consumers get disconnected, as the slots aren't sufficient for them
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_, IServiceDiscovery::QualityTypeSelector::kAsilQm)).Times(1);
+
+    // When allocating a batch of 40 samples
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(number_of_slots);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation fails and none of the samples holds a slot
+    ASSERT_FALSE(allocate_result.has_value());
+    EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
+    for (const auto& sample : samples)
+    {
+        EXPECT_FALSE(static_cast<bool>(sample));
+    }
+
+    // and the 39 remaining slots can still be allocated in one batch
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> remaining_samples(number_of_slots - 1U);
+    EXPECT_TRUE(skeleton_event_->AllocateBatch({remaining_samples.data(), remaining_samples.size()}).has_value());
+}
+
+TEST_F(SkeletonEventAllocateBatchFixture, BatchBiggerThanNumberOfSlotsFails)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+
+    // When allocating a batch of more samples than there are slots
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(max_samples_ + 1U);
+    const auto allocate_result = skeleton_event_->AllocateBatch({samples.data(), samples.size()});
+
+    // Then the allocation fails
+    ASSERT_FALSE(allocate_result.has_value());
+    EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
+}
+
+class SkeletonEventAllocateDynamicFixture : public SkeletonEventFixture
+{
+  protected:
+    /// \brief Size of the data of each sample, which is a multiple of SampleArenaAllocator::kAlignment.
+    static constexpr std::size_t kSampleDataSize{64U};
+    /// \brief Sample arena, which can hold the data of two samples.
+    static constexpr std::size_t kSampleArenaSize{2U * kSampleDataSize};
+
+    void InitialiseAndOfferDynamicSkeletonEvent()
+    {
+        dynamic_skeleton_event_ = std::make_unique<SkeletonEvent<impl::DynamicSample>>(
+            *skeleton_,
+            fake_element_fq_id_,
+            fake_event_name_,
+            SkeletonEventProperties{
+                max_samples_, max_subscribers_, true, SlotStatusLayout::kPacked, 1U, kSampleArenaSize});
+        ASSERT_TRUE(dynamic_skeleton_event_->PrepareOffer().has_value());
+    }
+
+    void SendDynamicSample(const std::uint8_t value)
+    {
+        auto allocate_result = dynamic_skeleton_event_->AllocateDynamic(kSampleDataSize);
+        ASSERT_TRUE(allocate_result.has_value());
+        auto sample = std::move(allocate_result).value();
+        auto data = sample->GetData();
+        ASSERT_EQ(data.size(), kSampleDataSize);
+        for (auto& byte : data)
+        {
+            byte = value;
+        }
+        ASSERT_TRUE(dynamic_skeleton_event_->Send(std::move(sample), amp::nullopt).has_value());
+    }
+
+    /// \brief Returns the ASIL-B control of the event, via which the tests act as consumer.
+    EventDataControl& GetConsumerEventDataControl()
+    {
+        auto* const event_control = GetEventControl(fake_element_fq_id_, QualityType::kASIL_B);
+        AMP_ASSERT_PRD(event_control != nullptr);
+        return event_control->data_control;
+    }
+
+    /// \brief Returns, whether the sample in the given slot has the data sent by SendDynamicSample(value).
+    bool HasSampleData(const EventDataControl::SlotIndexType slot_index, const std::uint8_t value)
+    {
+        auto& event_data_storage = GetEventStorageFromServiceDataStorage<impl::DynamicSample>(
+            fake_element_fq_id_, *SkeletonAttorney{*skeleton_}.GetServiceDataStorage());
+        const auto data = static_cast<const impl::DynamicSample&>(event_data_storage.at(slot_index)).GetData();
+        if (data.size() != kSampleDataSize)
+        {
+            return false;
+        }
+        for (const auto byte : data)
+        {
+            if (byte != value)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::unique_ptr<SkeletonEvent<impl::DynamicSample>> dynamic_skeleton_event_{};
+};
+
+TEST_F(SkeletonEventAllocateDynamicFixture, AllocateDynamicFailsForStaticallySizedSampleType)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event, whose sample type is not DynamicSample
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+
+    // When allocating a sample with dynamic size
+    const auto allocate_result = skeleton_event_->AllocateDynamic(16U);
+
+    // Then the allocation fails
+    ASSERT_FALSE(allocate_result.has_value());
+    EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
+}
+
+TEST_F(SkeletonEventAllocateDynamicFixture, ConsumerReadsDataOfSentDynamicSample)
+{
+    // Given an offered event of type DynamicSample with a sample arena
+    InitialiseAndOfferDynamicSkeletonEvent();
+    const auto event_meta_info = skeleton_->GetEventMetaInfo(fake_element_fq_id_);
+    ASSERT_TRUE(event_meta_info.has_value());
+    ASSERT_EQ(event_meta_info->sample_arena_size_, kSampleArenaSize);
+
+    // When allocating a sample with dynamic size, filling and sending it
+    SendDynamicSample(0xA5U);
+
+    // Then a consumer can reference the sample
+    auto& consumer_event_data_control = GetConsumerEventDataControl();
+    const auto transaction_log_index =
+        consumer_event_data_control.GetTransactionLogSet().RegisterProxyElement(TransactionLogId{10U}).value();
+    const auto slot_index = consumer_event_data_control.ReferenceNextEvent(0U, transaction_log_index);
+    ASSERT_TRUE(slot_index.has_value());
+
+    // and read its data
+    EXPECT_TRUE(HasSampleData(slot_index.value(), 0xA5U));
+
+    // which lies within the sample arena
+    auto& event_data_storage = GetEventStorageFromServiceDataStorage<impl::DynamicSample>(
+        fake_element_fq_id_, *SkeletonAttorney{*skeleton_}.GetServiceDataStorage());
+    const auto* const data = event_data_storage.at(slot_index.value()).GetData().data();
+    const auto* const arena_begin = static_cast<const std::uint8_t*>(event_meta_info->sample_arena_.get());
+    EXPECT_GE(data, arena_begin);
+    EXPECT_LE(data + kSampleDataSize, arena_begin + kSampleArenaSize);
+
+    consumer_event_data_control.DereferenceEvent(slot_index.value(), transaction_log_index);
+}
+
+TEST_F(SkeletonEventAllocateDynamicFixture, ReclaimsArenaRangesOfUnreferencedSlots)
+{
+    // Given an offered event of type DynamicSample, whose sample arena is completely used by two sent samples, which
+    // no consumer references
+    InitialiseAndOfferDynamicSkeletonEvent();
+    SendDynamicSample(1U);
+    SendDynamicSample(2U);
+
+    // When sending a third sample
+    SendDynamicSample(3U);
+
+    // Then the range of the oldest sample has been reclaimed, so that the consumer finds the two newest samples
+    auto& consumer_event_data_control = GetConsumerEventDataControl();
+    EXPECT_EQ(consumer_event_data_control.GetNumNewEvents(0U), 2U);
+    const auto transaction_log_index =
+        consumer_event_data_control.GetTransactionLogSet().RegisterProxyElement(TransactionLogId{10U}).value();
+    std::array<EventDataControl::SlotIndexType, 2U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 2U> time_stamps{};
+    ASSERT_EQ(consumer_event_data_control.ReferenceNextEvents(
+                  0U, transaction_log_index, {slot_indices.data(), 2U}, {time_stamps.data(), 2U}),
+              2U);
+
+    // and both have their own data
+    EXPECT_TRUE(HasSampleData(slot_indices[0], 3U));
+    EXPECT_TRUE(HasSampleData(slot_indices[1], 2U));
+
+    consumer_event_data_control.DereferenceEvent(slot_indices[0], transaction_log_index);
+    consumer_event_data_control.DereferenceEvent(slot_indices[1], transaction_log_index);
+}
+
+TEST_F(SkeletonEventAllocateDynamicFixture, AllocateDynamicRecoversAfterConsumerReleasesExhaustedArena)
+{
+    // Given an offered event of type DynamicSample, whose sample arena is completely used by two sent samples
+    InitialiseAndOfferDynamicSkeletonEvent();
+    SendDynamicSample(1U);
+    SendDynamicSample(2U);
+
+    // and a consumer, which references both samples
+    auto& consumer_event_data_control = GetConsumerEventDataControl();
+    const auto transaction_log_index =
+        consumer_event_data_control.GetTransactionLogSet().RegisterProxyElement(TransactionLogId{10U}).value();
+    std::array<EventDataControl::SlotIndexType, 2U> slot_indices{};
+    std::array<EventSlotStatus::EventTimeStamp, 2U> time_stamps{};
+    ASSERT_EQ(consumer_event_data_control.ReferenceNextEvents(
+                  0U, transaction_log_index, {slot_indices.data(), 2U}, {time_stamps.data(), 2U}),
+              2U);
+
+    // Expecting that the QM consumers don't get disconnected, as they don't hold any slot
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_, IServiceDiscovery::QualityTypeSelector::kAsilQm))
+        .Times(0);
+
+    // When allocating another sample with dynamic size
+    const auto failed_allocate_result = dynamic_skeleton_event_->AllocateDynamic(kSampleDataSize);
+
+    // Then the allocation fails
+    ASSERT_FALSE(failed_allocate_result.has_value());
+    EXPECT_EQ(failed_allocate_result.error(), ComErrc::kBindingFailure);
+
+    // and the referenced samples are unchanged
+    EXPECT_TRUE(HasSampleData(slot_indices[0], 2U));
+    EXPECT_TRUE(HasSampleData(slot_indices[1], 1U));
+
+    // When the consumer releases the samples
+    consumer_event_data_control.DereferenceEvent(slot_indices[0], transaction_log_index);
+    consumer_event_data_control.DereferenceEvent(slot_indices[1], transaction_log_index);
+
+    // Then allocating another sample with dynamic size succeeds again
+    EXPECT_TRUE(dynamic_skeleton_event_->AllocateDynamic(kSampleDataSize).has_value());
+}
+
+using SkeletonEventSendBatchFixture = SkeletonEventFixture;
+TEST_F(SkeletonEventSendBatchFixture, SendBatchPublishesAllSamplesWithOneNotification)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service, for which a batch of 3 samples was allocated
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples(3U);
+    ASSERT_TRUE(skeleton_event_->AllocateBatch({samples.data(), samples.size()}).has_value());
+
+    // Expecting that the consumers get notified only once per quality level
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_QM, fake_element_fq_id_)).Times(1);
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_B, fake_element_fq_id_)).Times(1);
+
+    // When sending the batch
+    const auto send_result = skeleton_event_->SendBatch({samples.data(), samples.size()}, amp::nullopt);
+
+    // Then sending succeeds and the samples have been handed over
+    ASSERT_TRUE(send_result.has_value());
+    for (const auto& sample : samples)
+    {
+        EXPECT_EQ(sample.Get(), nullptr);
+    }
+
+    // and all samples are available for the consumers with consecutive timestamps
+    auto* const event_control = GetEventControl(fake_element_fq_id_, QualityType::kASIL_B);
+    ASSERT_NE(event_control, nullptr);
+    EXPECT_EQ(event_control->data_control.GetNumNewEvents(0U), 3U);
+    EXPECT_EQ(event_control->data_control.GetNumNewEvents(3U), 1U);
+}
+
+TEST_F(SkeletonEventSendBatchFixture, SendingEmptyBatchDoesNotNotify)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    skeleton_event_->PrepareOffer();
+
+    // Expecting that no consumer gets notified
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(_, _)).Times(0);
+
+    // When sending an empty batch
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> samples{};
+    const auto send_result = skeleton_event_->SendBatch({samples.data(), samples.size()}, amp::nullopt);
+
+    // Then sending succeeds
+    EXPECT_TRUE(send_result.has_value());
+}
+
 using SkeletonEventPrepareOfferFixture = SkeletonEventFixture;
 TEST_F(SkeletonEventPrepareOfferFixture, SubscriptionsAcceptedIfMaxSamplesCanBeProvided)
 {
@@ -743,6 +743,115 @@ TEST_F(SkeletonPrepareStopOfferFixture, PrepareStopOfferDoesNotRemoveUsageMarker
     EXPECT_FALSE(*was_usage_marker_file_closed);
 }
 
+using SkeletonPrepareSuspendOfferFixture = SkeletonTestMockedSharedMemoryFixture;
+TEST_F(SkeletonPrepareSuspendOfferFixture, PrepareSuspendOfferCallsUnregisterShmObjectTraceCallback)
+{
+    MockFunction<void(amp::string_view, impl::tracing::ServiceElementType)> unregister_shm_object_trace_callback{};
+    amp::optional<SkeletonBinding::RegisterShmObjectTraceCallback> register_shm_object_trace_callback{};
+    SkeletonBinding::SkeletonEventBindings events{};
+    SkeletonBinding::SkeletonFieldBindings fields{};
+
+    // Given a Skeleton constructed from a valid identifier referencing a QM deployment
+    InitialiseSkeleton(GetValidInstanceIdentifier());
+
+    // and that opening and flocking the service instance usage marker file succeeds
+    ExpectServiceUsageMarkerFileCreatedOrOpenedAndClosed(kServiceInstanceUsageFilePath,
+                                                         kServiceInstanceUsageFileDescriptor);
+    ExpectServiceUsageMarkerFileFlockAcquired(kServiceInstanceUsageFileDescriptor);
+
+    // and that creating the QM control and data segments succeeds
+    ExpectControlSegmentCreated(QualityType::kASIL_QM);
+    ExpectDataSegmentCreated();
+
+    // Expecting that the UnregisterShmObjectTraceCallback is called once
+    EXPECT_CALL(unregister_shm_object_trace_callback,
+                Call(amp::string_view{tracing::TracingRuntime::kDummyElementNameForShmRegisterCallback},
+                     tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback));
+
+    // When PrepareOffer succeeds
+    EXPECT_TRUE(skeleton_->PrepareOffer(events, fields, std::move(register_shm_object_trace_callback)).has_value());
+
+    // and the offer is suspended with the optional UnregisterShmObjectTraceCallback set
+    skeleton_->PrepareSuspendOffer(unregister_shm_object_trace_callback.AsStdFunction());
+}
+
+TEST_F(SkeletonPrepareSuspendOfferFixture, PrepareOfferAfterPrepareSuspendOfferReusesSharedMemory)
+{
+    SkeletonBinding::SkeletonEventBindings events{};
+    SkeletonBinding::SkeletonFieldBindings fields{};
+
+    // Given a Skeleton constructed from a valid identifier referencing a QM deployment
+    InitialiseSkeleton(GetValidInstanceIdentifier());
+
+    // and that opening and flocking the service instance usage marker file succeeds only once in the first PrepareOffer
+    ExpectServiceUsageMarkerFileCreatedOrOpenedAndClosed(kServiceInstanceUsageFilePath,
+                                                         kServiceInstanceUsageFileDescriptor);
+    ExpectServiceUsageMarkerFileFlockAcquired(kServiceInstanceUsageFileDescriptor);
+
+    // and that the QM control and data segments are only created once
+    ExpectControlSegmentCreated(QualityType::kASIL_QM);
+    ExpectDataSegmentCreated();
+
+    // Expecting that the shared memory is neither re-opened nor removed
+    EXPECT_CALL(shared_memory_factory_mock_, Open(_, _, _)).Times(0);
+    EXPECT_CALL(shared_memory_factory_mock_, Remove(_)).Times(0);
+
+    // When the service is offered
+    EXPECT_TRUE(skeleton_->PrepareOffer(events, fields, {}).has_value());
+    EXPECT_TRUE(skeleton_->FinalizeOffer().has_value());
+    SkeletonAttorney skeleton_attorney{*skeleton_};
+    auto* const service_data_storage = skeleton_attorney.GetServiceDataStorage();
+    ASSERT_NE(service_data_storage, nullptr);
+    const auto first_offer_epoch = service_data_storage->offer_epoch_.load();
+
+    // and the offer is suspended and offered again
+    skeleton_->PrepareSuspendOffer({});
+    EXPECT_TRUE(skeleton_->PrepareOffer(events, fields, {}).has_value());
+    EXPECT_TRUE(skeleton_->FinalizeOffer().has_value());
+
+    // Then the same ServiceDataStorage is still used
+    EXPECT_EQ(skeleton_attorney.GetServiceDataStorage(), service_data_storage);
+
+    // and its offer epoch has been incremented
+    EXPECT_EQ(service_data_storage->offer_epoch_.load(), first_offer_epoch + 1U);
+}
+
+TEST_F(SkeletonPrepareSuspendOfferFixture, PrepareStopOfferAfterPrepareSuspendOfferRemovesSharedMemory)
+{
+    SkeletonBinding::SkeletonEventBindings events{};
+    SkeletonBinding::SkeletonFieldBindings fields{};
+
+    // Given a Skeleton constructed from a valid identifier referencing a QM deployment
+    InitialiseSkeleton(GetValidInstanceIdentifier());
+
+    // and that opening the service instance usage marker file succeeds
+    ExpectServiceUsageMarkerFileCreatedOrOpenedAndClosed(kServiceInstanceUsageFilePath,
+                                                         kServiceInstanceUsageFileDescriptor);
+
+    // and that flocking the service instance usage marker file succeeds in PrepareOffer and in PrepareStopOffer
+    EXPECT_CALL(*fcntl_mock_, flock(kServiceInstanceUsageFileDescriptor, kNonBlockingExclusiveLockOperation))
+        .Times(2)
+        .WillRepeatedly(Return(amp::blank{}));
+    EXPECT_CALL(*fcntl_mock_, flock(kServiceInstanceUsageFileDescriptor, kUnlockOperation))
+        .Times(2)
+        .WillRepeatedly(Return(amp::blank{}));
+
+    // and that creating the QM control and data segments succeeds
+    ExpectControlSegmentCreated(QualityType::kASIL_QM);
+    ExpectDataSegmentCreated();
+
+    // Then the shared memory will be cleaned up in PrepareStopOffer
+    EXPECT_CALL(shared_memory_factory_mock_, Remove(test::kControlChannelPathQm));
+    EXPECT_CALL(shared_memory_factory_mock_, Remove(test::kDataChannelPath));
+
+    // When PrepareOffer succeeds
+    EXPECT_TRUE(skeleton_->PrepareOffer(events, fields, {}).has_value());
+
+    // and the offer is suspended and then stopped
+    skeleton_->PrepareSuspendOffer({});
+    skeleton_->PrepareStopOffer({});
+}
+
 class SkeletonRegisterParamaterisedFixture : public SkeletonTestMockedSharedMemoryFixture,
                                              public ::testing::WithParamInterface<ElementType>
 {
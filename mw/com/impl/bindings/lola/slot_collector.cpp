@@ -20,6 +20,9 @@
 #include "platform/aas/mw/com/impl/binding_event_receive_handler.h"
 #include "platform/aas/mw/com/impl/runtime.h"
 
+#include <amp_span.hpp>
+
+#include <algorithm>
 #include <iterator>
 #include <utility>
 
@@ -40,6 +43,7 @@ SlotCollector::SlotCollector(EventDataControl& event_data_control,
     : event_data_control_{event_data_control},
       last_ts_{0},
       collected_slots_(max_slots),
+      collected_time_stamps_(max_slots),
       transaction_log_index_{transaction_log_index}
 {
 }
@@ -53,43 +57,25 @@ SlotCollector::SlotIndices SlotCollector::GetNewSamplesSlotIndices(const std::si
 {
     const auto collected_slots_end_const_iterator = CollectSlots(max_count);
 
-    EventSlotStatus::EventTimeStamp highest_delivered{last_ts_};
-    for (auto slot = std::make_reverse_iterator(collected_slots_end_const_iterator); slot != collected_slots_.crend();
-         ++slot)
+    // CollectSlots() orders the slots from newest to oldest, so the first collected time stamp is the highest one.
+    if (collected_slots_end_const_iterator != collected_slots_.cbegin())
     {
-        const EventSlotStatus slot_status{event_data_control_.get()[*slot]};
-        highest_delivered = std::max(highest_delivered, slot_status.GetTimeStamp());
+        last_ts_ = std::max(last_ts_, collected_time_stamps_.front());
     }
 
-    last_ts_ = highest_delivered;
-
     return {std::make_reverse_iterator(collected_slots_end_const_iterator), collected_slots_.crend()};
 }
 
 SlotCollector::SlotIndexVector::const_iterator SlotCollector::CollectSlots(const std::size_t max_count) noexcept
 {
-    EventSlotStatus::EventTimeStamp current_highest = EventSlotStatus::TIMESTAMP_MAX;
-    auto collected_slot = collected_slots_.begin();
-    bool collected_slots_remaining = (collected_slot != collected_slots_.end());
-    for (std::size_t count = 0; ((count < max_count) && collected_slots_remaining); ++count)
-    {
-        const amp::optional<EventDataControl::SlotIndexType> slot =
-            event_data_control_.get().ReferenceNextEvent(last_ts_, transaction_log_index_, current_highest);
-        if (slot.has_value())
-        {
-            const EventSlotStatus event_status{event_data_control_.get()[*slot]};
-            current_highest = event_status.GetTimeStamp();
-            *collected_slot = *slot;
-            ++collected_slot;
-        }
-        else
-        {
-            break;
-        }
-        collected_slots_remaining = collected_slot != collected_slots_.end();
-    }
+    const std::size_t count = std::min(max_count, collected_slots_.size());
+    const std::size_t num_collected = event_data_control_.get().ReferenceNextEvents(
+        last_ts_,
+        transaction_log_index_,
+        amp::span<EventDataControl::SlotIndexType>{collected_slots_.data(), count},
+        amp::span<EventSlotStatus::EventTimeStamp>{collected_time_stamps_.data(), count});
 
-    return collected_slot;
+    return std::next(collected_slots_.cbegin(), static_cast<SlotIndexVector::difference_type>(num_collected));
 }
 
 }  // namespace lola
@@ -87,6 +87,7 @@ class SlotCollector final
     std::reference_wrapper<EventDataControl> event_data_control_;
     EventSlotStatus::EventTimeStamp last_ts_;
     SlotIndexVector collected_slots_;  // Pre-allocated scratchpad memory to present the events in-order to the user.
+    std::vector<EventSlotStatus::EventTimeStamp> collected_time_stamps_;  // Time stamps of collected_slots_.
     TransactionLogSet::TransactionLogIndex transaction_log_index_;
 };
 
@@ -0,0 +1,64 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SLOT_HOLDER_DIAGNOSTICS_H
+#define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SLOT_HOLDER_DIAGNOSTICS_H
+
+#include "platform/aas/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "platform/aas/mw/com/impl/bindings/lola/transaction_log_id.h"
+
+#include <amp_optional.hpp>
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bmw::mw::com::impl::lola
+{
+
+/// \brief A consumer application, which references a slot.
+// NOLINTNEXTLINE(bmw-struct-usage-compliance): Intended struct semantic.
+struct SlotHolder
+{
+    /// \brief TransactionLogId (i.e. uid) of the consumer application.
+    TransactionLogId transaction_log_id;
+    /// \brief Current pid of the consumer application, if it is known.
+    amp::optional<pid_t> pid;
+    /// \brief Number of proxy event instances of the consumer application, which reference the slot.
+    std::size_t number_of_references;
+};
+
+/// \brief Diagnostic information about a slot, which is referenced by consumers.
+// NOLINTNEXTLINE(bmw-struct-usage-compliance): Intended struct semantic.
+struct SlotHolderDiagnostics
+{
+    std::uint16_t slot_index;
+    /// \brief Time stamp of the sample in the slot.
+    EventSlotStatus::EventTimeStamp time_stamp;
+    /// \brief Number of samples, which have been published since the sample in the slot.
+    EventSlotStatus::EventTimeStamp held_publish_cycles;
+    /// \brief Reference count of the slot. It may be higher than the references of all holders, if a consumer is just
+    ///        referencing or dereferencing the slot.
+    EventSlotStatus::SubscriberCount reference_count;
+    /// \brief Whether the skeleton references the slot for tracing.
+    bool referenced_by_skeleton_tracing;
+    std::vector<SlotHolder> holders;
+};
+
+}  // namespace bmw::mw::com::impl::lola
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SLOT_HOLDER_DIAGNOSTICS_H
@@ -55,8 +55,32 @@ void EventReceiveHandlerManager::Register(BindingEventReceiveHandler handler) no
 {
     Unregister();
     auto& lola_runtime = GetLolaRuntime();
+    if (lola_runtime.GetEventNotificationMode() == EventNotificationMode::kSharedMemory)
+    {
+        update_listener_ = std::make_unique<EventUpdateListener>(update_notifier_, std::move(handler));
+        return;
+    }
+    if (dispatch_ == ReceiveHandlerDispatch::kDedicatedThread)
+    {
+        dedicated_thread_notifier_ = std::make_unique<EventUpdateNotifier>();
+        update_listener_ = std::make_unique<EventUpdateListener>(
+            *dedicated_thread_notifier_, std::move(handler), thread_attributes_);
+        // The handler registered with the messaging only wakes up the dedicated thread, so it is cheap enough to be
+        // called inline by the notifying thread.
+        dedicated_thread_scope_ = safecpp::Scope<>{};
+        auto* const notifier = dedicated_thread_notifier_.get();
+        BindingEventReceiveHandler wake_up_handler{dedicated_thread_scope_,
+                                                   [notifier]() noexcept { notifier->Notify(); }};
+        registration_number_ = lola_runtime.GetLolaMessaging().RegisterEventNotification(
+            asil_level_,
+            element_fq_id_,
+            std::move(wake_up_handler),
+            event_source_pid_,
+            ReceiveHandlerDispatch::kInline);
+        return;
+    }
     registration_number_ = lola_runtime.GetLolaMessaging().RegisterEventNotification(
-        asil_level_, element_fq_id_, std::move(handler), event_source_pid_);
+        asil_level_, element_fq_id_, std::move(handler), event_source_pid_, dispatch_);
 }
 
 void EventReceiveHandlerManager::Reregister(
@@ -82,6 +106,10 @@ void EventReceiveHandlerManager::Unregister() noexcept
             asil_level_, element_fq_id_, registration_number_.value(), event_source_pid_);
         registration_number_ = amp::nullopt;
     }
+    // A wake-up handler, which is currently called by a notifying thread, is waited for, before its notifier is gone.
+    dedicated_thread_scope_.Expire();
+    update_listener_.reset();
+    dedicated_thread_notifier_.reset();
 }
 
 std::string CreateLoggingString(std::string&& string,
@@ -16,14 +16,20 @@
 #define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_SUBSCRIPTION_HELPERS_H
 
 #include "platform/aas/mw/com/impl/binding_event_receive_handler.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_listener.h"
+#include "platform/aas/mw/com/impl/bindings/lola/event_update_notifier.h"
 #include "platform/aas/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "platform/aas/mw/com/impl/bindings/lola/slot_collector.h"
 #include "platform/aas/mw/com/impl/bindings/lola/subscription_state_machine_states.h"
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
+
+#include "platform/aas/language/safecpp/scoped_function/scope.h"
 
 #include <amp_callback.hpp>
 #include <amp_optional.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 
 namespace bmw
@@ -46,14 +52,30 @@ using HandlerRegistrationNoType = IMessagePassingService::HandlerRegistrationNoT
  * Since only one Event Receive Handler can be registered at once, Register() will first Unregister any existing Event
  * Receive Handlers. Unregister() will unregister the most recently registered Event Receive Handler (registered with
  * the Register() call.
+ *
+ * In EventNotificationMode::kSharedMemory the handler is not registered with the MessagePassingFacade at all. Instead,
+ * an EventUpdateListener waits on the EventUpdateNotifier of the event in shared memory.
+ *
+ * With ReceiveHandlerDispatch::kDedicatedThread the handler is not registered with the MessagePassingFacade either.
+ * Instead, a process local EventUpdateNotifier gets signalled directly by the thread, which received the notification,
+ * and an EventUpdateListener exclusively owned by this event calls the handler. Its thread gets the configured
+ * ReceiveHandlerThreadAttributes.
  */
 class EventReceiveHandlerManager
 {
   public:
     EventReceiveHandlerManager(const QualityType asil_level,
                                const ElementFqId element_fq_id,
-                               const pid_t event_source_pid) noexcept
-        : asil_level_{asil_level}, element_fq_id_{element_fq_id}, event_source_pid_{event_source_pid}
+                               const pid_t event_source_pid,
+                               EventUpdateNotifier& update_notifier,
+                               const ReceiveHandlerDispatch dispatch,
+                               const ReceiveHandlerThreadAttributes& thread_attributes = {}) noexcept
+        : asil_level_{asil_level},
+          element_fq_id_{element_fq_id},
+          event_source_pid_{event_source_pid},
+          update_notifier_{update_notifier},
+          dispatch_{dispatch},
+          thread_attributes_{thread_attributes}
     {
     }
 
@@ -68,6 +90,12 @@ class EventReceiveHandlerManager
     const QualityType asil_level_;
     const ElementFqId element_fq_id_;
     pid_t event_source_pid_;
+    EventUpdateNotifier& update_notifier_;
+    const ReceiveHandlerDispatch dispatch_;
+    const ReceiveHandlerThreadAttributes thread_attributes_;
+    std::unique_ptr<EventUpdateNotifier> dedicated_thread_notifier_{};
+    safecpp::Scope<> dedicated_thread_scope_{};
+    std::unique_ptr<EventUpdateListener> update_listener_{};
 };
 
 class SubscriptionData
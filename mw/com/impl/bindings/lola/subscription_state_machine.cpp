@@ -34,11 +34,14 @@ namespace impl
 namespace lola
 {
 
-SubscriptionStateMachine::SubscriptionStateMachine(const QualityType quality_type,
-                                                   const ElementFqId element_fq_id,
-                                                   const pid_t event_source_pid,
-                                                   EventControl& event_control,
-                                                   const TransactionLogId& transaction_log_id) noexcept
+SubscriptionStateMachine::SubscriptionStateMachine(
+    const QualityType quality_type,
+    const ElementFqId element_fq_id,
+    const pid_t event_source_pid,
+    EventControl& event_control,
+    const TransactionLogId& transaction_log_id,
+    const ReceiveHandlerDispatch receive_handler_dispatch,
+    const ReceiveHandlerThreadAttributes& receive_handler_thread_attributes) noexcept
     : std::enable_shared_from_this<SubscriptionStateMachine>{},
       state_mutex_{},
       states_{std::make_unique<NotSubscribedState>(*this),
@@ -47,7 +50,12 @@ SubscriptionStateMachine::SubscriptionStateMachine(const QualityType quality_typ
       current_state_idx_{SubscriptionStateMachineState::NOT_SUBSCRIBED_STATE},
       subscription_data_{},
       event_receiver_handler_{},
-      event_receive_handler_manager_{quality_type, element_fq_id, event_source_pid},
+      event_receive_handler_manager_{quality_type,
+                                     element_fq_id,
+                                     event_source_pid,
+                                     event_control.data_control.GetUpdateNotifier(),
+                                     receive_handler_dispatch,
+                                     receive_handler_thread_attributes},
       event_control_{event_control},
       provider_service_instance_is_available_{true},
       transaction_log_id_{transaction_log_id},
@@ -83,7 +83,9 @@ class SubscriptionStateMachine : public std::enable_shared_from_this<Subscriptio
                              const ElementFqId element_fq_id,
                              const pid_t event_source_pid,
                              EventControl& event_control,
-                             const TransactionLogId& transaction_log_id) noexcept;
+                             const TransactionLogId& transaction_log_id,
+                             const ReceiveHandlerDispatch receive_handler_dispatch,
+                             const ReceiveHandlerThreadAttributes& receive_handler_thread_attributes = {}) noexcept;
 
     SubscriptionStateMachine(SubscriptionStateMachine&&) noexcept = delete;
     SubscriptionStateMachine& operator=(SubscriptionStateMachine&&) noexcept = delete;
@@ -55,7 +55,8 @@ class StateMachineEventsFixture : public LolaProxyEventResources
                          element_fq_id_,
                          kDummyPid,
                          parent_->GetEventControl(element_fq_id_),
-                         kDummyTransactionLogId}
+                         kDummyTransactionLogId,
+                         ReceiveHandlerDispatch::kThreadPool}
     {
     }
 
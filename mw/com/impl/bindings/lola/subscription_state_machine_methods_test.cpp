@@ -63,7 +63,8 @@ class StateMachineMethodsFixture : public LolaProxyEventResources
                          element_fq_id_,
                          kDummyPid,
                          parent_->GetEventControl(element_fq_id_),
-                         kDummyTransactionLogId}
+                         kDummyTransactionLogId,
+                         ReceiveHandlerDispatch::kThreadPool}
     {
     }
 
@@ -192,7 +193,7 @@ TEST_F(StateMachineMethodsNotSubscribedStateFixture, CallingSubscribeAfterUnsett
     StrictMock<MockFunction<void()>> receive_handler{};
 
     EXPECT_CALL(*mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid))
+                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid, ::testing::_))
         .Times(0);
 
     state_machine_.SetReceiveHandler(CreateMockBindingEventReceiveHandler(receive_handler));
@@ -347,7 +348,7 @@ TEST_F(StateMachineMethodsSubscriptionPendingStateFixture, CallingSetReceiveHand
 
     // Expecting that the handler will never be Registered or Unregistered
     EXPECT_CALL(*mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid))
+                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid, ::testing::_))
         .Times(0);
     EXPECT_CALL(*mock_service_,
                 UnregisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid))
@@ -452,7 +453,7 @@ TEST_F(StateMachineMethodsSubscriptionPendingStateFixture,
 
     // Expecting that the an event notification handler will never be registered
     EXPECT_CALL(*mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid))
+                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, kDummyPid, ::testing::_))
         .Times(0);
 
     EnterSubscriptionPending(max_num_slots_);
@@ -176,7 +176,8 @@ std::future<BindingEventReceiveHandler> LolaProxyEventResources::ExpectRegisterE
     auto local_handler_future = local_handler_promise->get_future();
 
     EXPECT_CALL(*mock_service_,
-                RegisterEventNotification(QualityType::kASIL_QM, element_fq_id_, ::testing::_, pid_to_use))
+                RegisterEventNotification(
+                    QualityType::kASIL_QM, element_fq_id_, ::testing::_, pid_to_use, ::testing::_))
         .WillOnce(::testing::Invoke(::testing::WithArg<2>([local_handler_promise](BindingEventReceiveHandler handler)
                                                               -> IMessagePassingService::HandlerRegistrationNoType {
             local_handler_promise->set_value(std::move(handler));
@@ -149,6 +149,7 @@ class LolaRuntimeMock : public IRuntime
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (noexcept, override));
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, override));
+    MOCK_METHOD(EventNotificationMode, GetEventNotificationMode, (), (const, override));
     MOCK_METHOD(impl::tracing::ITracingRuntimeBinding*, GetTracingRuntime, (), (noexcept, override));
     MOCK_METHOD(RollbackData&, GetRollbackData, (), (noexcept, override));
     MOCK_METHOD(pid_t, GetPid, (), (const, noexcept, override));
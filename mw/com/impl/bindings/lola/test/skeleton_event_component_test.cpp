@@ -47,6 +47,9 @@ namespace lola
 namespace
 {
 
+using ::testing::_;
+using ::testing::Truly;
+
 using SkeletonEventSampleType = std::uint32_t;
 
 template <std::size_t MaxSamples>
@@ -229,6 +232,57 @@ TEST_F(SkeletonEventComponentTestFixture, CanAllocateAndSendEvent)
     EXPECT_EQ(GetLastSendEvent(), 5);
 }
 
+TEST_F(SkeletonEventComponentTestFixture, CoalescedEventNotificationsAreSentOnFlush)
+{
+    // Given an offered event in an offered service, which coalesces its event notifications
+    const auto prepare_offer_result = skeleton_event_.PrepareOffer();
+    ASSERT_TRUE(prepare_offer_result.has_value());
+    parent_skeleton_->SetEventNotificationCoalescing(true);
+
+    // expect, that no event update notification is sent directly
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(_, _)).Times(0);
+
+    // but exactly one coalesced notification per ASIL level containing the event once on flush
+    const auto contains_event_once = [this](const amp::span<const ElementFqId> event_ids) {
+        return (event_ids.size() == 1) && (event_ids[0] == fake_element_fq_id_);
+    };
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvents(QualityType::kASIL_QM, Truly(contains_event_once)));
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvents(QualityType::kASIL_B, Truly(contains_event_once)));
+
+    // When sending the event twice and flushing the notifications afterwards
+    skeleton_event_.Send(5, {});
+    skeleton_event_.Send(6, {});
+    parent_skeleton_->FlushEventNotifications();
+
+    // Then the last send event in shared memory can be found by a proxy
+    EXPECT_EQ(GetLastSendEvent(), 6);
+}
+
+TEST_F(SkeletonEventComponentTestFixture, DisablingEventNotificationCoalescingFlushesPendingNotifications)
+{
+    // Given an offered event in an offered service, which coalesces its event notifications
+    const auto prepare_offer_result = skeleton_event_.PrepareOffer();
+    ASSERT_TRUE(prepare_offer_result.has_value());
+    parent_skeleton_->SetEventNotificationCoalescing(true);
+
+    // and which sent the event
+    skeleton_event_.Send(5, {});
+
+    // expect, that the pending notifications are sent for both ASIL levels
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvents(QualityType::kASIL_QM, _));
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvents(QualityType::kASIL_B, _));
+
+    // When disabling coalescing
+    parent_skeleton_->SetEventNotificationCoalescing(false);
+
+    // expect, that further notifications are sent directly again
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_QM, fake_element_fq_id_));
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_B, fake_element_fq_id_));
+
+    // When sending the event again
+    skeleton_event_.Send(6, {});
+}
+
 TEST_F(SkeletonEventComponentTestFixture, CanSendByValue)
 {
     RecordProperty("Verifies", ", 5");
@@ -275,6 +329,36 @@ TEST_F(SkeletonEventComponentTestFixture, SkeletonWillCalculateEventMetaInfoFrom
     EXPECT_EQ(event_meta_info.value().data_type_info_.size_of_, sizeof(SkeletonEventSampleType));
 }
 
+TEST_F(SkeletonEventComponentTestFixture, SkeletonProvidesPerformanceCountersOfSentEvent)
+{
+    // Given an offered event in an offered service
+    const auto prepare_offer_result = skeleton_event_.PrepareOffer();
+    ASSERT_TRUE(prepare_offer_result.has_value());
+
+    // When allocating and sending an event
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_QM, fake_element_fq_id_));
+    EXPECT_CALL(message_passing_service_mock_, NotifyEvent(QualityType::kASIL_B, fake_element_fq_id_));
+    auto slot_result = skeleton_event_.Allocate();
+    ASSERT_TRUE(slot_result.has_value());
+    skeleton_event_.Send(std::move(slot_result).value(), {});
+
+    // Then the allocation and the notification are counted for QM and ASIL-B
+    for (const auto quality_type : {QualityType::kASIL_QM, QualityType::kASIL_B})
+    {
+        const auto counters = parent_skeleton_->GetEventPerformanceCounters(fake_element_fq_id_, quality_type);
+        ASSERT_TRUE(counters.has_value());
+        EXPECT_EQ(counters->allocations, 1U);
+        EXPECT_EQ(counters->allocation_failures, 0U);
+        EXPECT_EQ(counters->notifications, 1U);
+    }
+
+    // and there are no counters for an unknown event
+    const ElementFqId unknown_element_fq_id{1, 99, 1, ElementType::EVENT};
+    const auto unknown_counters =
+        parent_skeleton_->GetEventPerformanceCounters(unknown_element_fq_id, QualityType::kASIL_QM);
+    EXPECT_FALSE(unknown_counters.has_value());
+}
+
 using SkeletonEventSingleSlotComponentTestFixture = SkeletonEventComponentTestTemplateFixture<1>;
 TEST_F(SkeletonEventSingleSlotComponentTestFixture, SendByValueReturnsErrorIfSlotCannotBeAllocated)
 {
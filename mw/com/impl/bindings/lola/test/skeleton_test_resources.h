@@ -297,6 +297,8 @@ class SkeletonAttorney
         }
     }
 
+    ServiceDataStorage* GetServiceDataStorage() const noexcept { return skeleton_.storage_; }
+
   private:
     Skeleton& skeleton_;
 };
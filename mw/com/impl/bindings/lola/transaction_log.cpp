@@ -49,7 +49,10 @@ bool DoesLogContainIncrementOrDecrementTransactions(
 }  // namespace
 
 TransactionLog::TransactionLog(std::size_t number_of_slots, const memory::shared::MemoryResourceProxy* proxy) noexcept
-    : reference_count_slots_(number_of_slots, proxy), subscribe_transactions_{}, subscription_max_sample_count_{}
+    : reference_count_slots_(number_of_slots, proxy),
+      subscribe_transactions_{},
+      subscription_max_sample_count_{},
+      performance_counters_{}
 {
 }
 
@@ -125,6 +128,12 @@ void TransactionLog::DereferenceTransactionCommit(SlotIndexType slot_index) noex
     reference_count_slots_.at(slot_index).SetTransactionEnd(false);
 }
 
+bool TransactionLog::IsSlotReferenced(const SlotIndexType slot_index) const noexcept
+{
+    const auto& slot = reference_count_slots_.at(slot_index);
+    return slot.GetTransactionBegin() && slot.GetTransactionEnd();
+}
+
 ResultBlank TransactionLog::RollbackProxyElementLog(const DereferenceSlotCallback& dereference_slot_callback,
                                                     const UnsubscribeCallback& unsubscribe_callback) noexcept
 {
@@ -15,6 +15,7 @@
 #ifndef PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_H
 #define PLATFORM_AAS_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_H
 
+#include "platform/aas/mw/com/impl/bindings/lola/event_performance_counters.h"
 #include "platform/aas/mw/com/impl/bindings/lola/transaction_log_slot.h"
 
 #include "platform/aas/lib/memory/shared/memory_resource_proxy.h"
@@ -107,6 +108,17 @@ class TransactionLog
     ///         finished with a completed Unsubscribe or Dereference transaction.
     bool ContainsTransactions() const noexcept;
 
+    /// \brief Checks whether the slot with the given index is referenced according to the recorded transactions.
+    /// \return Returns true if a Reference transaction for the slot has been committed and no Dereference transaction
+    ///         has been started yet.
+    bool IsSlotReferenced(const SlotIndexType slot_index) const noexcept;
+
+    /// \brief Performance counters of the reference operations, which were done by the owner of this TransactionLog.
+    ///
+    /// The counters are neither cleared by a rollback nor when the TransactionLog gets reused.
+    ReferencePerformanceCounters& GetPerformanceCounters() noexcept { return performance_counters_; }
+    const ReferencePerformanceCounters& GetPerformanceCounters() const noexcept { return performance_counters_; }
+
   private:
     ResultBlank RollbackIncrementTransactions(const DereferenceSlotCallback& dereference_slot_callback) noexcept;
     ResultBlank RollbackSubscribeTransactions(const UnsubscribeCallback& unsubscribe_callback) noexcept;
@@ -121,6 +133,9 @@ class TransactionLog
     ///
     /// This is set in SubscribeTransactionBegin() and used in the UnsubscribeCallback which is called during Rollback()
     amp::optional<MaxSampleCountType> subscription_max_sample_count_;
+
+    /// \brief Counters, which are only written by the owner of this TransactionLog and summed up on query.
+    ReferencePerformanceCounters performance_counters_;
 };
 
 }  // namespace lola
@@ -26,6 +26,7 @@
 #include "platform/aas/lib/result/result.h"
 
 #include <atomic>
+#include <mutex>
 #include <vector>
 
 namespace bmw::mw::com::impl::lola
@@ -81,6 +82,7 @@ class TransactionLogSet
         TransactionLogId GetTransactionLogId() const noexcept { return transaction_log_id_; }
 
         TransactionLog& GetTransactionLog() noexcept { return transaction_log_; }
+        const TransactionLog& GetTransactionLog() const noexcept { return transaction_log_; }
 
         void Reset() noexcept;
 
@@ -173,11 +175,43 @@ class TransactionLogSet
     /// Must not be called concurrently with Unregister() with the same transaction_log_index.
     TransactionLog& GetTransactionLog(const TransactionLogIndex transaction_log_index) noexcept;
 
+    /// \brief Returns all proxy TransactionLogs. Only the active ones are registered to a Proxy service element.
+    ///
+    /// Intended for diagnostics: The TransactionLogs are read without locking the mutex and while their owners modify
+    /// them. So the returned state is only a best-effort snapshot.
+    const TransactionLogCollection& GetProxyTransactionLogs() const noexcept { return proxy_transaction_logs_; }
+
+    /// \brief Calls the visitor with each active proxy TransactionLogNode while holding the mutex.
+    ///
+    /// Intended for diagnostics: Holding the mutex keeps the nodes from being registered, unregistered or rolled back
+    /// during the walk. The slot references within the TransactionLogs are still modified by their owners. So they are
+    /// only a best-effort snapshot.
+    template <typename Visitor>
+    void VisitActiveProxyTransactionLogs(Visitor&& visitor) const noexcept
+    {
+        const std::lock_guard lock{transaction_log_mutex_};
+        for (const auto& transaction_log_node : proxy_transaction_logs_)
+        {
+            if (transaction_log_node.IsActive())
+            {
+                visitor(transaction_log_node);
+            }
+        }
+    }
+
+    /// \brief Returns the skeleton tracing TransactionLog. It is only registered, if it is active.
+    ///
+    /// Intended for diagnostics, see GetProxyTransactionLogs().
+    const TransactionLogNode& GetSkeletonTracingTransactionLog() const noexcept
+    {
+        return skeleton_tracing_transaction_log_;
+    }
+
   private:
     TransactionLogCollection proxy_transaction_logs_;
     TransactionLogNode skeleton_tracing_transaction_log_;
     const memory::shared::MemoryResourceProxy* proxy_;
-    os::InterprocessMutex transaction_log_mutex_;
+    mutable os::InterprocessMutex transaction_log_mutex_;
 };
 
 }  // namespace bmw::mw::com::impl::lola
@@ -21,6 +21,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace bmw
 {
 namespace mw
@@ -424,6 +426,24 @@ TEST_F(TransactionLogSetRegisterFixture, CallingUnRegisterWillRemoveSkeletonTran
     EXPECT_FALSE(TransactionLogSetAttorney{unit_}.GetSkeletonTransactionLog().has_value());
 }
 
+using TransactionLogSetVisitFixture = TransactionLogSetFixture;
+TEST_F(TransactionLogSetVisitFixture, VisitsOnlyActiveProxyTransactionLogs)
+{
+    const TransactionLogId other_transaction_log_id{kDummyTransactionLogId + 1U};
+    const auto transaction_log_index = unit_.RegisterProxyElement(kDummyTransactionLogId).value();
+    unit_.RegisterProxyElement(other_transaction_log_id).value();
+    unit_.Unregister(transaction_log_index);
+
+    std::vector<TransactionLogId> visited_transaction_log_ids{};
+    unit_.VisitActiveProxyTransactionLogs(
+        [&visited_transaction_log_ids](const TransactionLogSet::TransactionLogNode& transaction_log_node) noexcept {
+            visited_transaction_log_ids.push_back(transaction_log_node.GetTransactionLogId());
+        });
+
+    ASSERT_EQ(visited_transaction_log_ids.size(), 1U);
+    EXPECT_EQ(visited_transaction_log_ids.front(), other_transaction_log_id);
+}
+
 }  // namespace
 }  // namespace lola
 }  // namespace impl
@@ -608,6 +608,31 @@ TEST_F(TransactionLogSkeletonTracingElementFixture, RollbackWillReturnErrorIfDer
     EXPECT_FALSE(rollback_result_2.has_value());
 }
 
+TEST_F(TransactionLogFixture, SlotIsOnlyReferencedBetweenReferenceCommitAndDereferenceBegin)
+{
+    const TransactionLog::SlotIndexType slot_index{2U};
+
+    // Given a TransactionLog without transactions
+    EXPECT_FALSE(unit_.IsSlotReferenced(slot_index));
+
+    // When a Reference transaction is started, the slot is not referenced yet
+    unit_.ReferenceTransactionBegin(slot_index);
+    EXPECT_FALSE(unit_.IsSlotReferenced(slot_index));
+
+    // and when it is committed, the slot is referenced
+    unit_.ReferenceTransactionCommit(slot_index);
+    EXPECT_TRUE(unit_.IsSlotReferenced(slot_index));
+
+    // but no other slot
+    EXPECT_FALSE(unit_.IsSlotReferenced(slot_index + 1U));
+
+    // and when a Dereference transaction is started, the slot is not referenced anymore
+    unit_.DereferenceTransactionBegin(slot_index);
+    EXPECT_FALSE(unit_.IsSlotReferenced(slot_index));
+    unit_.DereferenceTransactionCommit(slot_index);
+    EXPECT_FALSE(unit_.IsSlotReferenced(slot_index));
+}
+
 }  // namespace
 }  // namespace lola
 }  // namespace impl
@@ -30,7 +30,7 @@ namespace impl
 namespace lola
 {
 
-std::pair<UidPidMappingEntry::MappingEntryStatus, uid_t> UidPidMappingEntry::GetStatusAndUidAtomic() noexcept
+std::pair<UidPidMappingEntry::MappingEntryStatus, uid_t> UidPidMappingEntry::GetStatusAndUidAtomic() const noexcept
 {
     constexpr std::uint64_t kMaskUid = 0x00000000FFFFFFFF;
     auto status_uid = key_uid_status_.load();
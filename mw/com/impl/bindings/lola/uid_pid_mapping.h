@@ -57,7 +57,7 @@ class UidPidMappingEntry
 
     /// \brief Load key atomically and return its parts as a pair.
     /// \return parts, which make up the key
-    std::pair<MappingEntryStatus, uid_t> GetStatusAndUidAtomic() noexcept;
+    std::pair<MappingEntryStatus, uid_t> GetStatusAndUidAtomic() const noexcept;
     void SetStatusAndUidAtomic(MappingEntryStatus status, uid_t uid) noexcept;
     static key_type CreateKey(MappingEntryStatus status, uid_t uid) noexcept;
     std::atomic<key_type> key_uid_status_{};
@@ -133,6 +133,22 @@ class UidPidMapping
             mapping_entries_.begin(), mapping_entries_.end(), uid, pid);
     };
 
+    /// \brief Returns the pid, which is currently registered for the given uid.
+    /// \param uid uid identifying the application
+    /// \return the registered pid or an empty optional, if there is no completed registration for the uid.
+    amp::optional<pid_t> GetPid(const uid_t uid) const noexcept
+    {
+        for (const auto& entry : mapping_entries_)
+        {
+            const auto status_uid = entry.GetStatusAndUidAtomic();
+            if ((status_uid.first == UidPidMappingEntry::MappingEntryStatus::kUsed) && (status_uid.second == uid))
+            {
+                return entry.pid_;
+            }
+        }
+        return {};
+    }
+
   private:
     using mapping_entry_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<UidPidMappingEntry>;
 
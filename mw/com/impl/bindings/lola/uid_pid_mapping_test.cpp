@@ -104,6 +104,34 @@ TEST(UidPidMapping, ReregisterPIDSuccess)
     EXPECT_EQ(result.value(), 142);
 }
 
+TEST(UidPidMapping, GetPidReturnsRegisteredPid)
+{
+    // Given a UidPidMapping, in which PIDs for two uids are registered
+    UidPidMapping<Allocator> unit{kMaxNumberOfMappings, Allocator()};
+    ASSERT_TRUE(unit.RegisterPid(42, 142).has_value());
+    ASSERT_TRUE(unit.RegisterPid(43, 143).has_value());
+
+    // when getting the PID of one of the uids
+    const auto pid = unit.GetPid(43);
+
+    // expect, that its registered PID is returned
+    ASSERT_TRUE(pid.has_value());
+    EXPECT_EQ(pid.value(), 143);
+}
+
+TEST(UidPidMapping, GetPidReturnsEmptyOptionalForUnknownUid)
+{
+    // Given a UidPidMapping, in which a PID for one uid is registered
+    UidPidMapping<Allocator> unit{kMaxNumberOfMappings, Allocator()};
+    ASSERT_TRUE(unit.RegisterPid(42, 142).has_value());
+
+    // when getting the PID of another uid
+    const auto pid = unit.GetPid(43);
+
+    // expect, that an empty optional is returned
+    EXPECT_FALSE(pid.has_value());
+}
+
 TEST(UidPidMapping, ConcurrentAccess)
 {
     // Given a UidPidMapping with a max number of supported mappings of 100
@@ -82,6 +82,8 @@ class ProxyEvent : public ProxyEventBinding<SampleType>
                 GetNewSamples,
                 (typename ProxyEventBinding<SampleType>::Callback&&, TrackerGuardFactory&),
                 (noexcept, override));
+    MOCK_METHOD(Result<SampleType>, GetLatestValue, (), (const, noexcept, override));
+    MOCK_METHOD(Result<SampleBatch<SampleType>>, GetNewSamplesBatch, (TrackerGuardFactory&), (noexcept, override));
     MOCK_METHOD(ResultBlank, SetReceiveHandler, (BindingEventReceiveHandler), (noexcept, override));
     MOCK_METHOD(ResultBlank, UnsetReceiveHandler, (), (noexcept, override));
     MOCK_METHOD(amp::optional<std::uint16_t>, GetMaxSampleCount, (), (const, noexcept, override));
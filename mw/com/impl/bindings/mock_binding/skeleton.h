@@ -43,6 +43,12 @@ class Skeleton : public SkeletonBinding
                 (noexcept, override, final));
     MOCK_METHOD(ResultBlank, FinalizeOffer, (), (noexcept, override, final));
     MOCK_METHOD(void, PrepareStopOffer, (amp::optional<UnregisterShmObjectTraceCallback>), (noexcept, override, final));
+    MOCK_METHOD(void,
+                PrepareSuspendOffer,
+                (amp::optional<UnregisterShmObjectTraceCallback>),
+                (noexcept, override, final));
+    MOCK_METHOD(void, SetEventNotificationCoalescing, (bool), (noexcept, override, final));
+    MOCK_METHOD(void, FlushEventNotifications, (), (noexcept, override, final));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override, final));
 };
 
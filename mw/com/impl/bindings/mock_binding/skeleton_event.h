@@ -39,6 +39,7 @@ class SkeletonEventBase : public SkeletonEventBindingBase
     MOCK_METHOD(ResultBlank, PrepareOffer, (), (noexcept, override));
     MOCK_METHOD(void, PrepareStopOffer, (), (noexcept, override));
     MOCK_METHOD(std::size_t, GetMaxSize, (), (const, noexcept, override));
+    MOCK_METHOD(std::size_t, GetMaxAlign, (), (const, noexcept, override));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(void, SetSkeletonEventTracingData, (impl::tracing::SkeletonEventTracingData), (noexcept, override));
 };
@@ -57,9 +58,17 @@ class SkeletonEvent : public SkeletonEventBinding<SampleType>
                  amp::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>),
                 (noexcept, override));
     MOCK_METHOD(Result<SampleAllocateePtr<SampleType>>, Allocate, (), (noexcept, override));
+    MOCK_METHOD(Result<SampleAllocateePtr<SampleType>>, AllocateDynamic, (const std::size_t), (noexcept, override));
+    MOCK_METHOD(ResultBlank, AllocateBatch, (amp::span<SampleAllocateePtr<SampleType>>), (noexcept, override));
+    MOCK_METHOD(ResultBlank,
+                SendBatch,
+                (amp::span<SampleAllocateePtr<SampleType>>,
+                 amp::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>),
+                (noexcept, override));
     MOCK_METHOD(ResultBlank, PrepareOffer, (), (noexcept, override));
     MOCK_METHOD(void, PrepareStopOffer, (), (noexcept, override));
     MOCK_METHOD(std::size_t, GetMaxSize, (), (const, noexcept, override));
+    MOCK_METHOD(std::size_t, GetMaxAlign, (), (const, noexcept, override));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(void, SetSkeletonEventTracingData, (impl::tracing::SkeletonEventTracingData), (noexcept, override));
 };
@@ -0,0 +1,767 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/configuration/binary_config.h"
+
+#include "platform/aas/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "platform/aas/mw/com/impl/configuration/lola_service_type_deployment.h"
+#include "platform/aas/mw/com/impl/configuration/someip_service_instance_deployment.h"
+#include "platform/aas/mw/log/logging.h"
+
+#include <amp_assert.hpp>
+#include <amp_utility.hpp>
+#include <amp_variant.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace configuration
+{
+namespace
+{
+
+/// \brief "LCFG" read as little endian number. An image from a host with other byte order has a different magic.
+constexpr std::uint32_t kBinaryConfigurationMagic{0x4746434CU};
+
+constexpr std::uint8_t kLolaBindingIndex{0U};
+constexpr std::uint8_t kSomeIpBindingIndex{1U};
+constexpr std::uint8_t kBlankBindingIndex{2U};
+
+/// \brief Minimum number of bytes of a ServiceIdentifierType in the image: the size of its (empty) name and the major
+/// and minor version.
+constexpr std::size_t kMinServiceIdentifierTypeSize{3U * sizeof(std::uint32_t)};
+/// \brief Minimum number of bytes of a service type in the image: its ServiceIdentifierType and the binding index.
+constexpr std::size_t kMinServiceTypeSize{kMinServiceIdentifierTypeSize + sizeof(std::uint8_t)};
+/// \brief Minimum number of bytes of a service instance in the image: the size of its (empty) instance specifier, its
+/// ServiceIdentifierType, the asil level, the size of the (empty) instance specifier of the deployment and the binding
+/// index.
+constexpr std::size_t kMinServiceInstanceSize{sizeof(std::uint32_t) + kMinServiceIdentifierTypeSize +
+                                              sizeof(std::underlying_type_t<QualityType>) + sizeof(std::uint32_t) +
+                                              sizeof(std::uint8_t)};
+
+struct BinaryConfigurationHeader
+{
+    std::uint32_t magic;
+    std::uint32_t format_version;
+    std::uint64_t payload_size;
+};
+
+[[noreturn]] void TerminateOnInvalidImage(const amp::string_view reason) noexcept
+{
+    ::bmw::mw::log::LogFatal("lola") << "Invalid binary configuration:" << reason << ". Terminating.";
+    std::terminate();
+}
+
+class BinaryConfigurationWriter final
+{
+  public:
+    template <typename T>
+    void Write(const T value) noexcept
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be written");
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + sizeof(T));
+        std::memcpy(&buffer_[offset], &value, sizeof(T));
+    }
+
+    template <typename T>
+    void WriteOptional(const amp::optional<T>& value) noexcept
+    {
+        Write(value.has_value());
+        if (value.has_value())
+        {
+            Write(value.value());
+        }
+    }
+
+    void WriteSize(const std::size_t size) noexcept
+    {
+        AMP_ASSERT_PRD_MESSAGE(size <= std::numeric_limits<std::uint32_t>::max(), "Container too big for image");
+        Write(static_cast<std::uint32_t>(size));
+    }
+
+    void WriteString(const amp::string_view value) noexcept
+    {
+        WriteSize(value.size());
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + value.size());
+        if (value.size() > 0U)
+        {
+            std::memcpy(&buffer_[offset], value.data(), value.size());
+        }
+    }
+
+    std::vector<std::uint8_t>& GetBuffer() noexcept { return buffer_; }
+
+  private:
+    std::vector<std::uint8_t> buffer_{};
+};
+
+class BinaryConfigurationReader final
+{
+  public:
+    BinaryConfigurationReader(const std::uint8_t* const data, const std::size_t size) noexcept
+        : data_{data}, size_{size}, offset_{0U}
+    {
+    }
+
+    template <typename T>
+    T Read() noexcept
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be read");
+        if constexpr (std::is_same<T, bool>::value)
+        {
+            // Any other byte than 0 or 1 would be an invalid bool representation.
+            static_assert(sizeof(bool) == sizeof(std::uint8_t), "bool is written as single byte");
+            const auto value = Read<std::uint8_t>();
+            if (value > 1U)
+            {
+                TerminateOnInvalidImage("bool value is out of range");
+            }
+            return value == 1U;
+        }
+        else
+        {
+            CheckAvailable(sizeof(T));
+            T value{};
+            std::memcpy(&value, &data_[offset_], sizeof(T));
+            offset_ += sizeof(T);
+            return value;
+        }
+    }
+
+    /// \brief Reads an enum, which is stored as its underlying type. Its enumerators have to be contiguous from zero
+    /// up to max_value.
+    template <typename EnumType>
+    EnumType ReadEnum(const EnumType max_value) noexcept
+    {
+        static_assert(std::is_enum<EnumType>::value, "Only enums can be read");
+        using UnderlyingType = std::underlying_type_t<EnumType>;
+        static_assert(std::is_unsigned<UnderlyingType>::value, "Only enums with unsigned underlying type can be read");
+        const auto value = Read<UnderlyingType>();
+        if (value > static_cast<UnderlyingType>(max_value))
+        {
+            TerminateOnInvalidImage("enum value is out of range");
+        }
+        return static_cast<EnumType>(value);
+    }
+
+    template <typename T>
+    amp::optional<T> ReadOptional() noexcept
+    {
+        if (!Read<bool>())
+        {
+            return {};
+        }
+        return Read<T>();
+    }
+
+    std::size_t ReadSize() noexcept { return Read<std::uint32_t>(); }
+
+    /// \brief Reads the number of elements of a container, of which each takes at least min_element_size bytes in the
+    /// image. Terminates, if the remaining image is too small for them, so that the count can be used for reserving.
+    std::size_t ReadCount(const std::size_t min_element_size) noexcept
+    {
+        const auto count = ReadSize();
+        if (count > ((size_ - offset_) / min_element_size))
+        {
+            TerminateOnInvalidImage("element count exceeds image size");
+        }
+        return count;
+    }
+
+    std::string ReadString() noexcept
+    {
+        const auto size = ReadSize();
+        CheckAvailable(size);
+        std::string value{};
+        value.assign(static_cast<const char*>(static_cast<const void*>(&data_[offset_])), size);
+        offset_ += size;
+        return value;
+    }
+
+    bool IsAtEnd() const noexcept { return offset_ == size_; }
+
+  private:
+    void CheckAvailable(const std::size_t size) const noexcept
+    {
+        if (size > (size_ - offset_))
+        {
+            TerminateOnInvalidImage("image is truncated");
+        }
+    }
+
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::size_t offset_;
+};
+
+void WriteServiceIdentifierType(BinaryConfigurationWriter& writer, const ServiceIdentifierType& service) noexcept
+{
+    const ServiceIdentifierTypeView service_view{service};
+    writer.WriteString(service_view.getInternalTypeName());
+    const auto version = service_view.GetVersion();
+    const ServiceVersionTypeView version_view{version};
+    writer.Write(version_view.getMajor());
+    writer.Write(version_view.getMinor());
+}
+
+ServiceIdentifierType ReadServiceIdentifierType(BinaryConfigurationReader& reader) noexcept
+{
+    auto service_type_name = reader.ReadString();
+    const auto major_version = reader.Read<std::uint32_t>();
+    const auto minor_version = reader.Read<std::uint32_t>();
+    return make_ServiceIdentifierType(std::move(service_type_name), major_version, minor_version);
+}
+
+InstanceSpecifier ReadInstanceSpecifier(BinaryConfigurationReader& reader) noexcept
+{
+    const auto instance_specifier_string = reader.ReadString();
+    auto instance_specifier = InstanceSpecifier::Create(instance_specifier_string);
+    if (!instance_specifier.has_value())
+    {
+        TerminateOnInvalidImage("instance specifier is invalid");
+    }
+    return std::move(instance_specifier).value();
+}
+
+template <typename IdMapping>
+void WriteIdMapping(BinaryConfigurationWriter& writer, const IdMapping& id_mapping) noexcept
+{
+    writer.WriteSize(id_mapping.size());
+    for (const auto& element : id_mapping)
+    {
+        writer.WriteString(element.first);
+        writer.Write(element.second);
+    }
+}
+
+template <typename IdMapping>
+IdMapping ReadIdMapping(BinaryConfigurationReader& reader) noexcept
+{
+    IdMapping id_mapping{};
+    const auto number_of_elements = reader.ReadSize();
+    for (std::size_t element_index{0U}; element_index < number_of_elements; ++element_index)
+    {
+        auto name = reader.ReadString();
+        const auto id = reader.Read<typename IdMapping::mapped_type>();
+        amp::ignore = id_mapping.emplace(std::move(name), id);
+    }
+    return id_mapping;
+}
+
+void WriteServiceTypeDeployment(BinaryConfigurationWriter& writer, const ServiceTypeDeployment& deployment) noexcept
+{
+    const auto* const lola_deployment = amp::get_if<LolaServiceTypeDeployment>(&deployment.binding_info_);
+    if (lola_deployment == nullptr)
+    {
+        writer.Write(kBlankBindingIndex);
+        return;
+    }
+    writer.Write(kLolaBindingIndex);
+    writer.Write(lola_deployment->service_id_);
+    WriteIdMapping(writer, lola_deployment->events_);
+    WriteIdMapping(writer, lola_deployment->fields_);
+}
+
+ServiceTypeDeployment ReadServiceTypeDeployment(BinaryConfigurationReader& reader) noexcept
+{
+    const auto binding_index = reader.Read<std::uint8_t>();
+    if (binding_index == kBlankBindingIndex)
+    {
+        return ServiceTypeDeployment{amp::blank{}};
+    }
+    if (binding_index != kLolaBindingIndex)
+    {
+        TerminateOnInvalidImage("unknown service type binding");
+    }
+    const auto service_id = reader.Read<LolaServiceTypeDeployment::ServiceId>();
+    auto events = ReadIdMapping<LolaServiceTypeDeployment::EventIdMapping>(reader);
+    auto fields = ReadIdMapping<LolaServiceTypeDeployment::FieldIdMapping>(reader);
+    return ServiceTypeDeployment{LolaServiceTypeDeployment{service_id, std::move(events), std::move(fields)}};
+}
+
+void WriteLolaEventInstanceDeployment(BinaryConfigurationWriter& writer,
+                                      const LolaEventInstanceDeployment& deployment) noexcept
+{
+    writer.WriteOptional(deployment.GetNumberOfSampleSlotsExcludingTracingSlot());
+    writer.WriteOptional(deployment.max_subscribers_);
+    writer.WriteOptional(deployment.max_concurrent_allocations_);
+    writer.WriteOptional(deployment.enforce_max_samples_);
+    writer.Write(static_cast<std::uint8_t>(deployment.slot_status_layout_));
+    writer.WriteOptional(deployment.slot_alignment_);
+    writer.WriteOptional(deployment.sample_arena_size_);
+    writer.Write(static_cast<std::uint8_t>(deployment.receive_handler_dispatch_));
+    writer.WriteOptional(deployment.receive_handler_thread_attributes_.priority);
+    writer.WriteOptional(deployment.receive_handler_thread_attributes_.cpu_affinity);
+    writer.Write(deployment.IsTracingEnabled());
+}
+
+LolaEventInstanceDeployment ReadLolaEventInstanceDeployment(BinaryConfigurationReader& reader) noexcept
+{
+    const auto number_of_sample_slots = reader.ReadOptional<LolaEventInstanceDeployment::SampleSlotCountType>();
+    const auto max_subscribers = reader.ReadOptional<LolaEventInstanceDeployment::SubscriberCountType>();
+    const auto max_concurrent_allocations = reader.ReadOptional<std::uint8_t>();
+    const auto enforce_max_samples = reader.ReadOptional<bool>();
+    const auto slot_status_layout = reader.ReadEnum(SlotStatusLayout::kCacheLineAligned);
+    const auto slot_alignment = reader.ReadOptional<std::uint32_t>();
+    const auto sample_arena_size = reader.ReadOptional<std::uint32_t>();
+    const auto receive_handler_dispatch = reader.ReadEnum(ReceiveHandlerDispatch::kDedicatedThread);
+    const auto receive_handler_thread_priority = reader.ReadOptional<std::int32_t>();
+    const auto receive_handler_thread_cpu_affinity = reader.ReadOptional<std::uint64_t>();
+    const auto is_tracing_enabled = reader.Read<bool>();
+
+    LolaEventInstanceDeployment deployment{
+        number_of_sample_slots, max_subscribers, max_concurrent_allocations, enforce_max_samples, is_tracing_enabled};
+    deployment.slot_status_layout_ = slot_status_layout;
+    deployment.slot_alignment_ = slot_alignment;
+    deployment.sample_arena_size_ = sample_arena_size;
+    deployment.receive_handler_dispatch_ = receive_handler_dispatch;
+    deployment.receive_handler_thread_attributes_.priority = receive_handler_thread_priority;
+    deployment.receive_handler_thread_attributes_.cpu_affinity = receive_handler_thread_cpu_affinity;
+    return deployment;
+}
+
+template <typename InstanceMapping>
+void WriteLolaInstanceMapping(BinaryConfigurationWriter& writer, const InstanceMapping& instance_mapping) noexcept
+{
+    writer.WriteSize(instance_mapping.size());
+    for (const auto& element : instance_mapping)
+    {
+        writer.WriteString(element.first);
+        WriteLolaEventInstanceDeployment(writer, element.second);
+    }
+}
+
+template <typename InstanceMapping>
+InstanceMapping ReadLolaInstanceMapping(BinaryConfigurationReader& reader) noexcept
+{
+    InstanceMapping instance_mapping{};
+    const auto number_of_elements = reader.ReadSize();
+    for (std::size_t element_index{0U}; element_index < number_of_elements; ++element_index)
+    {
+        auto name = reader.ReadString();
+        amp::ignore = instance_mapping.emplace(std::move(name), ReadLolaEventInstanceDeployment(reader));
+    }
+    return instance_mapping;
+}
+
+void WriteAllowedUsers(BinaryConfigurationWriter& writer,
+                       const std::unordered_map<QualityType, std::vector<uid_t>>& allowed_users) noexcept
+{
+    writer.WriteSize(allowed_users.size());
+    for (const auto& element : allowed_users)
+    {
+        writer.Write(static_cast<std::underlying_type_t<QualityType>>(element.first));
+        writer.WriteSize(element.second.size());
+        for (const auto uid : element.second)
+        {
+            writer.Write(uid);
+        }
+    }
+}
+
+std::unordered_map<QualityType, std::vector<uid_t>> ReadAllowedUsers(BinaryConfigurationReader& reader) noexcept
+{
+    std::unordered_map<QualityType, std::vector<uid_t>> allowed_users{};
+    const auto number_of_quality_types = reader.ReadSize();
+    for (std::size_t quality_type_index{0U}; quality_type_index < number_of_quality_types; ++quality_type_index)
+    {
+        const auto quality_type = reader.ReadEnum(QualityType::kASIL_B);
+        std::vector<uid_t> uids{};
+        const auto number_of_uids = reader.ReadCount(sizeof(uid_t));
+        uids.reserve(number_of_uids);
+        for (std::size_t uid_index{0U}; uid_index < number_of_uids; ++uid_index)
+        {
+            uids.push_back(reader.Read<uid_t>());
+        }
+        amp::ignore = allowed_users.emplace(quality_type, std::move(uids));
+    }
+    return allowed_users;
+}
+
+void WriteLolaServiceInstanceDeployment(BinaryConfigurationWriter& writer,
+                                        const LolaServiceInstanceDeployment& deployment) noexcept
+{
+    writer.Write(deployment.instance_id_.has_value());
+    if (deployment.instance_id_.has_value())
+    {
+        writer.Write(deployment.instance_id_->id_);
+    }
+    writer.Write(deployment.shared_memory_size_.has_value());
+    if (deployment.shared_memory_size_.has_value())
+    {
+        writer.Write(static_cast<std::uint64_t>(deployment.shared_memory_size_.value()));
+    }
+    WriteLolaInstanceMapping(writer, deployment.events_);
+    WriteLolaInstanceMapping(writer, deployment.fields_);
+    writer.Write(deployment.strict_permissions_);
+    writer.Write(deployment.shm_huge_pages_);
+    writer.Write(static_cast<std::uint8_t>(deployment.shm_prefault_mode_));
+    WriteAllowedUsers(writer, deployment.allowed_consumer_);
+    WriteAllowedUsers(writer, deployment.allowed_provider_);
+}
+
+LolaServiceInstanceDeployment ReadLolaServiceInstanceDeployment(BinaryConfigurationReader& reader) noexcept
+{
+    LolaServiceInstanceDeployment deployment{};
+    const auto instance_id = reader.ReadOptional<LolaServiceInstanceId::InstanceId>();
+    if (instance_id.has_value())
+    {
+        deployment.instance_id_ = LolaServiceInstanceId{instance_id.value()};
+    }
+    const auto shared_memory_size = reader.ReadOptional<std::uint64_t>();
+    if (shared_memory_size.has_value())
+    {
+        deployment.shared_memory_size_ = static_cast<std::size_t>(shared_memory_size.value());
+    }
+    deployment.events_ = ReadLolaInstanceMapping<LolaServiceInstanceDeployment::EventInstanceMapping>(reader);
+    deployment.fields_ = ReadLolaInstanceMapping<LolaServiceInstanceDeployment::FieldInstanceMapping>(reader);
+    deployment.strict_permissions_ = reader.Read<bool>();
+    deployment.shm_huge_pages_ = reader.Read<bool>();
+    deployment.shm_prefault_mode_ = reader.ReadEnum(ShmPrefaultMode::kLock);
+    deployment.allowed_consumer_ = ReadAllowedUsers(reader);
+    deployment.allowed_provider_ = ReadAllowedUsers(reader);
+    return deployment;
+}
+
+template <typename InstanceMapping>
+void WriteSomeIpInstanceMapping(BinaryConfigurationWriter& writer, const InstanceMapping& instance_mapping) noexcept
+{
+    // SOME/IP event and field instance deployments have no content yet, so only their names are stored.
+    writer.WriteSize(instance_mapping.size());
+    for (const auto& element : instance_mapping)
+    {
+        writer.WriteString(element.first);
+    }
+}
+
+template <typename InstanceMapping>
+InstanceMapping ReadSomeIpInstanceMapping(BinaryConfigurationReader& reader) noexcept
+{
+    InstanceMapping instance_mapping{};
+    const auto number_of_elements = reader.ReadSize();
+    for (std::size_t element_index{0U}; element_index < number_of_elements; ++element_index)
+    {
+        amp::ignore = instance_mapping.emplace(reader.ReadString(), typename InstanceMapping::mapped_type{});
+    }
+    return instance_mapping;
+}
+
+void WriteSomeIpServiceInstanceDeployment(BinaryConfigurationWriter& writer,
+                                          const SomeIpServiceInstanceDeployment& deployment) noexcept
+{
+    writer.Write(deployment.instance_id_.has_value());
+    if (deployment.instance_id_.has_value())
+    {
+        writer.Write(deployment.instance_id_->id_);
+    }
+    WriteSomeIpInstanceMapping(writer, deployment.events_);
+    WriteSomeIpInstanceMapping(writer, deployment.fields_);
+}
+
+SomeIpServiceInstanceDeployment ReadSomeIpServiceInstanceDeployment(BinaryConfigurationReader& reader) noexcept
+{
+    amp::optional<SomeIpServiceInstanceId> instance_id{};
+    const auto instance_id_value = reader.ReadOptional<SomeIpServiceInstanceId::InstanceId>();
+    if (instance_id_value.has_value())
+    {
+        instance_id = SomeIpServiceInstanceId{instance_id_value.value()};
+    }
+    auto events = ReadSomeIpInstanceMapping<SomeIpServiceInstanceDeployment::EventInstanceMapping>(reader);
+    auto fields = ReadSomeIpInstanceMapping<SomeIpServiceInstanceDeployment::FieldInstanceMapping>(reader);
+    return SomeIpServiceInstanceDeployment{instance_id, std::move(events), std::move(fields)};
+}
+
+void WriteServiceInstanceDeployment(BinaryConfigurationWriter& writer,
+                                    const ServiceInstanceDeployment& deployment) noexcept
+{
+    WriteServiceIdentifierType(writer, deployment.service_);
+    writer.Write(static_cast<std::underlying_type_t<QualityType>>(deployment.asilLevel_));
+    writer.WriteString(deployment.instance_specifier_.ToString());
+
+    const auto* const lola_deployment = amp::get_if<LolaServiceInstanceDeployment>(&deployment.bindingInfo_);
+    const auto* const someip_deployment = amp::get_if<SomeIpServiceInstanceDeployment>(&deployment.bindingInfo_);
+    if (lola_deployment != nullptr)
+    {
+        writer.Write(kLolaBindingIndex);
+        WriteLolaServiceInstanceDeployment(writer, *lola_deployment);
+    }
+    else if (someip_deployment != nullptr)
+    {
+        writer.Write(kSomeIpBindingIndex);
+        WriteSomeIpServiceInstanceDeployment(writer, *someip_deployment);
+    }
+    else
+    {
+        writer.Write(kBlankBindingIndex);
+    }
+}
+
+ServiceInstanceDeployment ReadServiceInstanceDeployment(BinaryConfigurationReader& reader) noexcept
+{
+    auto service = ReadServiceIdentifierType(reader);
+    const auto asil_level = reader.ReadEnum(QualityType::kASIL_B);
+    auto instance_specifier = ReadInstanceSpecifier(reader);
+
+    ServiceInstanceDeployment::BindingInformation binding_information{amp::blank{}};
+    const auto binding_index = reader.Read<std::uint8_t>();
+    switch (binding_index)
+    {
+        case kLolaBindingIndex:
+            binding_information = ReadLolaServiceInstanceDeployment(reader);
+            break;
+        case kSomeIpBindingIndex:
+            binding_information = ReadSomeIpServiceInstanceDeployment(reader);
+            break;
+        case kBlankBindingIndex:
+            break;
+        default:
+            TerminateOnInvalidImage("unknown service instance binding");
+    }
+    return ServiceInstanceDeployment{
+        std::move(service), std::move(binding_information), asil_level, std::move(instance_specifier)};
+}
+
+void WriteGlobalConfiguration(BinaryConfigurationWriter& writer,
+                              const GlobalConfiguration& global_configuration) noexcept
+{
+    writer.Write(static_cast<std::underlying_type_t<QualityType>>(global_configuration.GetProcessAsilLevel()));
+    writer.Write(global_configuration.GetReceiverMessageQueueSize(QualityType::kASIL_QM));
+    writer.Write(global_configuration.GetReceiverMessageQueueSize(QualityType::kASIL_B));
+    writer.Write(global_configuration.GetSenderMessageQueueSize());
+    writer.Write(static_cast<std::uint8_t>(global_configuration.GetShmSizeCalcMode()));
+    writer.Write(static_cast<std::uint8_t>(global_configuration.GetEventNotificationMode()));
+}
+
+GlobalConfiguration ReadGlobalConfiguration(BinaryConfigurationReader& reader) noexcept
+{
+    GlobalConfiguration global_configuration{};
+    global_configuration.SetProcessAsilLevel(reader.ReadEnum(QualityType::kASIL_B));
+    global_configuration.SetReceiverMessageQueueSize(QualityType::kASIL_QM, reader.Read<std::int32_t>());
+    global_configuration.SetReceiverMessageQueueSize(QualityType::kASIL_B, reader.Read<std::int32_t>());
+    global_configuration.SetSenderMessageQueueSize(reader.Read<std::int32_t>());
+    global_configuration.SetShmSizeCalcMode(reader.ReadEnum(ShmSizeCalculationMode::kSimulation));
+    global_configuration.SetEventNotificationMode(reader.ReadEnum(EventNotificationMode::kSharedMemory));
+    return global_configuration;
+}
+
+void WriteTracingConfiguration(BinaryConfigurationWriter& writer,
+                               const TracingConfiguration& tracing_configuration) noexcept
+{
+    writer.Write(tracing_configuration.IsTracingEnabled());
+    writer.WriteString(tracing_configuration.GetApplicationInstanceID());
+    writer.WriteString(tracing_configuration.GetTracingFilterConfigPath());
+
+    const auto& service_element_tracing_enabled_map = tracing_configuration.GetServiceElementTracingEnabledMap();
+    writer.WriteSize(service_element_tracing_enabled_map.size());
+    for (const auto& element : service_element_tracing_enabled_map)
+    {
+        writer.WriteString(element.first.service_type_name);
+        writer.WriteString(element.first.service_element_name);
+        writer.Write(static_cast<std::uint8_t>(element.first.service_element_type));
+        writer.WriteSize(element.second.size());
+        for (const auto& instance_specifier : element.second)
+        {
+            writer.WriteString(instance_specifier.ToString());
+        }
+    }
+}
+
+TracingConfiguration ReadTracingConfiguration(BinaryConfigurationReader& reader) noexcept
+{
+    TracingConfiguration tracing_configuration{};
+    tracing_configuration.SetTracingEnabled(reader.Read<bool>());
+    tracing_configuration.SetApplicationInstanceID(reader.ReadString());
+    tracing_configuration.SetTracingTraceFilterConfigPath(reader.ReadString());
+
+    const auto number_of_service_elements = reader.ReadSize();
+    for (std::size_t service_element_index{0U}; service_element_index < number_of_service_elements;
+         ++service_element_index)
+    {
+        tracing::ServiceElementIdentifier service_element_identifier{};
+        service_element_identifier.service_type_name = reader.ReadString();
+        service_element_identifier.service_element_name = reader.ReadString();
+        service_element_identifier.service_element_type = reader.ReadEnum(tracing::ServiceElementType::METHOD);
+        const auto number_of_instance_specifiers = reader.ReadSize();
+        for (std::size_t instance_specifier_index{0U}; instance_specifier_index < number_of_instance_specifiers;
+             ++instance_specifier_index)
+        {
+            tracing_configuration.SetServiceElementTracingEnabled(service_element_identifier,
+                                                                  ReadInstanceSpecifier(reader));
+        }
+    }
+    return tracing_configuration;
+}
+
+}  // namespace
+
+std::vector<std::uint8_t> SerializeBinary(const Configuration& configuration) noexcept
+{
+    BinaryConfigurationWriter writer{};
+    writer.GetBuffer().resize(sizeof(BinaryConfigurationHeader));
+
+    WriteTracingConfiguration(writer, configuration.GetTracingConfiguration());
+
+    const auto& service_types = configuration.GetServiceTypes();
+    writer.WriteSize(service_types.size());
+    for (const auto& service_type : service_types)
+    {
+        WriteServiceIdentifierType(writer, service_type.first);
+        WriteServiceTypeDeployment(writer, service_type.second);
+    }
+
+    const auto& service_instances = configuration.GetServiceInstances();
+    writer.WriteSize(service_instances.size());
+    for (const auto& service_instance : service_instances)
+    {
+        writer.WriteString(service_instance.first.ToString());
+        WriteServiceInstanceDeployment(writer, service_instance.second);
+    }
+
+    WriteGlobalConfiguration(writer, configuration.GetGlobalConfiguration());
+
+    auto& image = writer.GetBuffer();
+    const auto payload_size = static_cast<std::uint64_t>(image.size() - sizeof(BinaryConfigurationHeader));
+    const BinaryConfigurationHeader header{kBinaryConfigurationMagic, kBinaryConfigurationFormatVersion, payload_size};
+    std::memcpy(image.data(), &header, sizeof(header));
+    return std::move(image);
+}
+
+Configuration ParseBinary(const amp::span<const std::uint8_t> image) noexcept
+{
+    const auto image_size = static_cast<std::size_t>(image.size());
+    if (image_size < sizeof(BinaryConfigurationHeader))
+    {
+        TerminateOnInvalidImage("image is smaller than its header");
+    }
+
+    BinaryConfigurationHeader header{};
+    std::memcpy(&header, image.data(), sizeof(header));
+    if (header.magic != kBinaryConfigurationMagic)
+    {
+        TerminateOnInvalidImage("magic doesn't match");
+    }
+    if (header.format_version != kBinaryConfigurationFormatVersion)
+    {
+        ::bmw::mw::log::LogFatal("lola") << "Binary configuration format versions don't match."
+                                         << header.format_version << "!=" << kBinaryConfigurationFormatVersion
+                                         << ". Terminating.";
+        std::terminate();
+    }
+    if (header.payload_size != (image_size - sizeof(BinaryConfigurationHeader)))
+    {
+        TerminateOnInvalidImage("payload size doesn't match image size");
+    }
+
+    BinaryConfigurationReader reader{&image.data()[sizeof(BinaryConfigurationHeader)],
+                                     image_size - sizeof(BinaryConfigurationHeader)};
+
+    auto tracing_configuration = ReadTracingConfiguration(reader);
+
+    Configuration::ServiceTypeDeployments service_type_deployments{};
+    const auto number_of_service_types = reader.ReadCount(kMinServiceTypeSize);
+    service_type_deployments.reserve(number_of_service_types);
+    for (std::size_t service_type_index{0U}; service_type_index < number_of_service_types; ++service_type_index)
+    {
+        auto service = ReadServiceIdentifierType(reader);
+        auto deployment = ReadServiceTypeDeployment(reader);
+        amp::ignore = service_type_deployments.emplace(std::move(service), std::move(deployment));
+    }
+
+    Configuration::ServiceInstanceDeployments service_instance_deployments{};
+    const auto number_of_service_instances = reader.ReadCount(kMinServiceInstanceSize);
+    service_instance_deployments.reserve(number_of_service_instances);
+    for (std::size_t service_instance_index{0U}; service_instance_index < number_of_service_instances;
+         ++service_instance_index)
+    {
+        auto instance_specifier = ReadInstanceSpecifier(reader);
+        auto deployment = ReadServiceInstanceDeployment(reader);
+        amp::ignore = service_instance_deployments.emplace(std::move(instance_specifier), std::move(deployment));
+    }
+
+    auto global_configuration = ReadGlobalConfiguration(reader);
+
+    if (!reader.IsAtEnd())
+    {
+        TerminateOnInvalidImage("image has trailing data");
+    }
+
+    return Configuration{std::move(service_type_deployments),
+                         std::move(service_instance_deployments),
+                         std::move(global_configuration),
+                         std::move(tracing_configuration)};
+}
+
+Configuration ParseBinary(const amp::string_view path) noexcept
+{
+    const std::string path_string{path.data(), path.size()};
+    // NOLINTNEXTLINE(bmw-banned-function): The user has to guarantee the integrity of the path
+    const int file_descriptor = ::open(path_string.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+    {
+        ::bmw::mw::log::LogFatal("lola") << "Opening binary configuration" << path << "failed. Terminating.";
+        std::terminate();
+    }
+
+    struct stat file_status{};
+    if (::fstat(file_descriptor, &file_status) != 0)
+    {
+        ::bmw::mw::log::LogFatal("lola") << "Reading size of binary configuration" << path << "failed. Terminating.";
+        std::terminate();
+    }
+    const auto image_size = static_cast<std::size_t>(file_status.st_size);
+    if (image_size == 0U)
+    {
+        TerminateOnInvalidImage("file is empty");
+    }
+
+    void* const image_address = ::mmap(nullptr, image_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    amp::ignore = ::close(file_descriptor);
+    if (image_address == MAP_FAILED)
+    {
+        ::bmw::mw::log::LogFatal("lola") << "Mapping binary configuration" << path << "failed. Terminating.";
+        std::terminate();
+    }
+
+    // All values are copied out of the image, so it can be unmapped once the configuration has been built.
+    auto configuration =
+        ParseBinary(amp::span<const std::uint8_t>{static_cast<const std::uint8_t*>(image_address), image_size});
+    amp::ignore = ::munmap(image_address, image_size);
+    return configuration;
+}
+
+}  // namespace configuration
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
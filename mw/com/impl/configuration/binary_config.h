@@ -0,0 +1,67 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_BINARY_CONFIG_H
+#define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_BINARY_CONFIG_H
+
+#include "platform/aas/mw/com/impl/configuration/configuration.h"
+
+#include <amp_span.hpp>
+#include <amp_string_view.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace configuration
+{
+
+/// \brief Version of the binary configuration format.
+///
+/// Has to be incremented, whenever the layout of the binary image changes, e.g. because a configuration class got a
+/// new member. Images with a different version are rejected.
+constexpr std::uint32_t kBinaryConfigurationFormatVersion{2U};
+
+/// \brief Serializes the given configuration into a binary image.
+///
+/// \details The image starts with a header (magic, format version and payload size) followed by the payload. It
+///          contains no pointers or offsets into process memory, so it can be stored in a file and mapped at any
+///          address. Multi-byte values are stored in the byte order of the host. The configuration is expected to be
+///          the result of Parse(), i.e. it has already been validated.
+std::vector<std::uint8_t> SerializeBinary(const Configuration& configuration) noexcept;
+
+/// \brief Maps the binary configuration image under the given path and builds the configuration from it.
+///
+/// \details No JSON parsing and no validation of the configuration content is done. Terminates, if the file can't be
+///          mapped or if its header doesn't match this format version.
+Configuration ParseBinary(const amp::string_view path) noexcept;
+
+/// \brief Builds the configuration from the given binary configuration image.
+Configuration ParseBinary(const amp::span<const std::uint8_t> image) noexcept;
+
+}  // namespace configuration
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_BINARY_CONFIG_H
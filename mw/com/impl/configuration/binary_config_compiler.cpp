@@ -0,0 +1,51 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/configuration/binary_config.h"
+#include "platform/aas/mw/com/impl/configuration/config_parser.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+/// \brief Offline compiler from mw_com_config.json to the binary configuration image.
+///
+/// \details Usage: binary_config_compiler <mw_com_config.json> <output image>
+///          The json configuration is parsed and validated the same way as by Runtime::Initialize(). An invalid
+///          configuration terminates the compiler, so no image is written for it.
+int main(int argc, const char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <mw_com_config.json> <output image>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto configuration = bmw::mw::com::impl::configuration::Parse(amp::string_view{argv[1]});
+    const auto image = bmw::mw::com::impl::configuration::SerializeBinary(configuration);
+
+    std::ofstream output_file{argv[2], std::ios::binary | std::ios::trunc};
+    output_file.write(static_cast<const char*>(static_cast<const void*>(image.data())),
+                      static_cast<std::streamsize>(image.size()));
+    output_file.close();
+    if (!output_file)
+    {
+        std::cerr << "Writing binary configuration to " << argv[2] << " failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Wrote binary configuration of " << image.size() << " bytes to " << argv[2] << std::endl;
+    return EXIT_SUCCESS;
+}
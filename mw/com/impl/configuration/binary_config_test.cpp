@@ -0,0 +1,195 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/configuration/binary_config.h"
+
+#include "platform/aas/mw/com/impl/configuration/config_parser.h"
+#include "platform/aas/mw/com/impl/configuration/test/configuration_test_resources.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace configuration
+{
+namespace
+{
+
+constexpr auto kJsonConfigurationPath{"platform/aas/mw/com/impl/configuration/example/ara_com_config.json"};
+/// \brief Size of the image header: magic, format version and payload size.
+constexpr std::size_t kBinaryConfigurationHeaderSize{(2U * sizeof(std::uint32_t)) + sizeof(std::uint64_t)};
+/// \brief Size of the global configuration at the end of the image: process asil level, three message queue sizes,
+/// ShmSizeCalculationMode and EventNotificationMode.
+constexpr std::size_t kGlobalConfigurationSize{sizeof(std::uint16_t) + (3U * sizeof(std::int32_t)) +
+                                               (2U * sizeof(std::uint8_t))};
+
+class BinaryConfigFixture : public ConfigurationStructsFixture
+{
+  public:
+    void ExpectConfigurationsEqual(const Configuration& lhs, const Configuration& rhs) const noexcept
+    {
+        ASSERT_EQ(lhs.GetServiceTypes().size(), rhs.GetServiceTypes().size());
+        for (const auto& service_type : lhs.GetServiceTypes())
+        {
+            const auto rhs_service_type = rhs.GetServiceTypes().find(service_type.first);
+            ASSERT_NE(rhs_service_type, rhs.GetServiceTypes().cend());
+            ExpectServiceTypeDeploymentObjectsEqual(service_type.second, rhs_service_type->second);
+        }
+
+        ASSERT_EQ(lhs.GetServiceInstances().size(), rhs.GetServiceInstances().size());
+        for (const auto& service_instance : lhs.GetServiceInstances())
+        {
+            const auto rhs_service_instance = rhs.GetServiceInstances().find(service_instance.first);
+            ASSERT_NE(rhs_service_instance, rhs.GetServiceInstances().cend());
+            ExpectServiceInstanceDeploymentObjectsEqual(service_instance.second, rhs_service_instance->second);
+        }
+
+        const auto& lhs_global = lhs.GetGlobalConfiguration();
+        const auto& rhs_global = rhs.GetGlobalConfiguration();
+        EXPECT_EQ(lhs_global.GetProcessAsilLevel(), rhs_global.GetProcessAsilLevel());
+        EXPECT_EQ(lhs_global.GetReceiverMessageQueueSize(QualityType::kASIL_QM),
+                  rhs_global.GetReceiverMessageQueueSize(QualityType::kASIL_QM));
+        EXPECT_EQ(lhs_global.GetReceiverMessageQueueSize(QualityType::kASIL_B),
+                  rhs_global.GetReceiverMessageQueueSize(QualityType::kASIL_B));
+        EXPECT_EQ(lhs_global.GetSenderMessageQueueSize(), rhs_global.GetSenderMessageQueueSize());
+        EXPECT_EQ(lhs_global.GetShmSizeCalcMode(), rhs_global.GetShmSizeCalcMode());
+        EXPECT_EQ(lhs_global.GetEventNotificationMode(), rhs_global.GetEventNotificationMode());
+
+        const auto& lhs_tracing = lhs.GetTracingConfiguration();
+        const auto& rhs_tracing = rhs.GetTracingConfiguration();
+        EXPECT_EQ(lhs_tracing.IsTracingEnabled(), rhs_tracing.IsTracingEnabled());
+        EXPECT_EQ(lhs_tracing.GetApplicationInstanceID(), rhs_tracing.GetApplicationInstanceID());
+        EXPECT_EQ(lhs_tracing.GetTracingFilterConfigPath(), rhs_tracing.GetTracingFilterConfigPath());
+        EXPECT_EQ(lhs_tracing.GetServiceElementTracingEnabledMap(), rhs_tracing.GetServiceElementTracingEnabledMap());
+    }
+};
+
+TEST_F(BinaryConfigFixture, ParsingSerializedImageRestoresConfiguration)
+{
+    // Given a configuration parsed from json
+    const auto configuration = Parse(kJsonConfigurationPath);
+
+    // When serializing it to a binary image and parsing the image again
+    const auto image = SerializeBinary(configuration);
+    const auto restored_configuration = ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()});
+
+    // Then the restored configuration equals the parsed one
+    ExpectConfigurationsEqual(configuration, restored_configuration);
+}
+
+TEST_F(BinaryConfigFixture, ReserializingRestoredConfigurationYieldsImageOfSameSize)
+{
+    // Given a configuration parsed from json and serialized to a binary image
+    const auto configuration = Parse(kJsonConfigurationPath);
+    const auto image = SerializeBinary(configuration);
+
+    // When serializing the configuration restored from the image again
+    const auto restored_configuration = ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()});
+    const auto second_image = SerializeBinary(restored_configuration);
+
+    // Then both images have the same size
+    EXPECT_EQ(image.size(), second_image.size());
+}
+
+TEST(BinaryConfigDeathTest, ParsingImageWithOtherFormatVersionTerminates)
+{
+    const auto configuration = Parse(kJsonConfigurationPath);
+    auto image = SerializeBinary(configuration);
+
+    // Given an image with a format version, which doesn't match
+    const std::uint32_t other_format_version{kBinaryConfigurationFormatVersion + 1U};
+    std::memcpy(&image[sizeof(std::uint32_t)], &other_format_version, sizeof(other_format_version));
+
+    // When parsing it, then the program terminates
+    EXPECT_DEATH(ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()}), ".*");
+}
+
+TEST(BinaryConfigDeathTest, ParsingTruncatedImageTerminates)
+{
+    const auto configuration = Parse(kJsonConfigurationPath);
+    auto image = SerializeBinary(configuration);
+
+    // Given an image, which is missing its last byte
+    image.pop_back();
+
+    // When parsing it, then the program terminates
+    EXPECT_DEATH(ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()}), ".*");
+}
+
+TEST(BinaryConfigDeathTest, ParsingImageWithInvalidBoolValueTerminates)
+{
+    const auto configuration = Parse(kJsonConfigurationPath);
+    auto image = SerializeBinary(configuration);
+
+    // Given an image, of which the first bool (whether tracing is enabled) is neither 0 nor 1
+    image.at(kBinaryConfigurationHeaderSize) = 2U;
+
+    // When parsing it, then the program terminates
+    EXPECT_DEATH(ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()}), ".*");
+}
+
+TEST(BinaryConfigDeathTest, ParsingImageWithInvalidEnumValueTerminates)
+{
+    const auto configuration = Parse(kJsonConfigurationPath);
+    auto image = SerializeBinary(configuration);
+
+    // Given an image, of which the last byte (the EventNotificationMode) is no valid enumerator
+    image.back() = 0xFFU;
+
+    // When parsing it, then the program terminates
+    EXPECT_DEATH(ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()}), ".*");
+}
+
+TEST(BinaryConfigDeathTest, ParsingImageWithServiceInstanceCountBeyondImageSizeTerminates)
+{
+    const Configuration configuration{Configuration::ServiceTypeDeployments{},
+                                      Configuration::ServiceInstanceDeployments{},
+                                      GlobalConfiguration{},
+                                      TracingConfiguration{}};
+    auto image = SerializeBinary(configuration);
+
+    // Given an image without service instances, of which the number of service instances is overwritten with a
+    // number, which doesn't fit into the image. It is stored in front of the global configuration.
+    const std::uint32_t number_of_service_instances{std::numeric_limits<std::uint32_t>::max()};
+    std::memcpy(&image.at(image.size() - kGlobalConfigurationSize - sizeof(number_of_service_instances)),
+                &number_of_service_instances,
+                sizeof(number_of_service_instances));
+
+    // When parsing it, then the program terminates before reserving memory for the service instances
+    EXPECT_DEATH(ParseBinary(amp::span<const std::uint8_t>{image.data(), image.size()}), ".*");
+}
+
+TEST(BinaryConfigDeathTest, ParsingNonExistingFileTerminates)
+{
+    EXPECT_DEATH(ParseBinary(amp::string_view{"/non/existing/mw_com_config.bin"}), ".*");
+}
+
+}  // namespace
+}  // namespace configuration
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
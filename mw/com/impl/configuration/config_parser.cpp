@@ -17,6 +17,9 @@
 #include "platform/aas/mw/com/impl/configuration/lola_service_instance_deployment.h"
 #include "platform/aas/mw/com/impl/configuration/quality_type.h"
 #include "platform/aas/mw/com/impl/configuration/service_type_deployment.h"
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
+#include "platform/aas/mw/com/impl/configuration/shm_prefault_mode.h"
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
 #include "platform/aas/mw/com/impl/configuration/tracing_configuration.h"
 #include "platform/aas/mw/com/impl/instance_specifier.h"
 #include "platform/aas/mw/com/impl/tracing/configuration/service_element_type.h"
@@ -80,12 +83,21 @@ constexpr auto FieldNumberOfSampleSlotsKey = "numberOfSampleSlots"sv;
 constexpr auto FieldMaxSubscribersKey = "maxSubscribers"sv;
 constexpr auto FieldEnforceMaxSamplesKey = "enforceMaxSamples"sv;
 constexpr auto FieldMaxConcurrentAllocationsKey = "maxConcurrentAllocations"sv;
+constexpr auto SlotStatusLayoutKey = "slotStatusLayout"sv;
+constexpr auto ReceiveHandlerDispatchKey = "receiveHandlerDispatch"sv;
+constexpr auto ReceiveHandlerThreadPriorityKey = "receiveHandlerThreadPriority"sv;
+constexpr auto ReceiveHandlerThreadCpuAffinityKey = "receiveHandlerThreadCpuAffinity"sv;
+constexpr auto SlotAlignmentKey = "slotAlignment"sv;
+constexpr auto SampleArenaSizeKey = "sampleArenaSize"sv;
 constexpr auto LolaShmSizeKey = "shm-size"sv;
+constexpr auto LolaShmHugePagesKey = "shm-huge-pages"sv;
+constexpr auto LolaShmPrefaultKey = "shm-prefault"sv;
 constexpr auto GlobalPropertiesKey = "global"sv;
 constexpr auto AllowedConsumerKey = "allowedConsumer"sv;
 constexpr auto AllowedProviderKey = "allowedProvider"sv;
 constexpr auto QueueSizeKey = "queue-size"sv;
 constexpr auto ShmSizeCalcModeKey = "shm-size-calc-mode"sv;
+constexpr auto EventNotificationModeKey = "event-notification-mode"sv;
 constexpr auto TracingPropertiesKey = "tracing"sv;
 constexpr auto TracingEnabledKey = "enable"sv;
 constexpr auto TracingApplicationInstanceIDKey = "applicationInstanceID"sv;
@@ -97,6 +109,23 @@ constexpr auto SomeIpBinding = "SOME/IP"sv;
 constexpr auto ShmBinding = "SHM"sv;
 constexpr auto ShmSizeCalcModeSimulation = "SIMULATION"sv;
 constexpr auto ShmSizeCalcModeEstimation = "ESTIMATION"sv;
+constexpr auto EventNotificationModeMessagePassing = "MESSAGE_PASSING"sv;
+constexpr auto EventNotificationModeSharedMemory = "SHARED_MEMORY"sv;
+constexpr auto SlotStatusLayoutPacked = "PACKED"sv;
+constexpr auto SlotStatusLayoutCacheLineAligned = "CACHE_LINE_ALIGNED"sv;
+constexpr auto ReceiveHandlerDispatchThreadPool = "THREAD_POOL"sv;
+constexpr auto ReceiveHandlerDispatchInline = "INLINE"sv;
+constexpr auto ReceiveHandlerDispatchDedicatedThread = "DEDICATED_THREAD"sv;
+constexpr auto ShmPrefaultNone = "NONE"sv;
+constexpr auto ShmPrefaultPopulate = "POPULATE"sv;
+constexpr auto ShmPrefaultLock = "LOCK"sv;
+
+// Slots are aligned relative to the start of the data shared memory, which is mapped page aligned. So the slot
+// alignment must not exceed the smallest page size of our target platforms.
+constexpr std::uint32_t MaxSlotAlignment{4096U};
+
+// The CPU affinity of a receive handler thread is stored as bit mask.
+constexpr std::uint32_t MaxReceiveHandlerThreadCpus{64U};
 
 constexpr auto TracingEnabledDefaultValue = false;
 constexpr auto TracingTraceFilterConfigPathDefaultValue{"./etc/mw_com_trace_filter.json"sv};
@@ -235,6 +264,34 @@ auto ParseShmSizeCalcMode(const bmw::json::Any& json) -> amp::optional<ShmSizeCa
     return amp::nullopt;
 }
 
+auto ParseEventNotificationMode(const bmw::json::Any& json) -> amp::optional<EventNotificationMode>
+{
+    const auto& event_notification_mode =
+        json.As<bmw::json::Object>().value().get().find(EventNotificationModeKey.data());
+    if (event_notification_mode != json.As<bmw::json::Object>().value().get().cend())
+    {
+        const auto& event_notification_mode_value = event_notification_mode->second.As<std::string>().value().get();
+
+        if (event_notification_mode_value == EventNotificationModeMessagePassing)
+        {
+            return EventNotificationMode::kMessagePassing;
+        }
+        else if (event_notification_mode_value == EventNotificationModeSharedMemory)
+        {
+            return EventNotificationMode::kSharedMemory;
+        }
+        else
+        {
+            bmw::mw::log::LogError("lola")
+                << "Unknown value " << event_notification_mode_value << " in key " << EventNotificationModeKey;
+            /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+            std::terminate();
+        }
+    }
+
+    return amp::nullopt;
+}
+
 auto ParseAllowedUser(const bmw::json::Any& json, std::string_view key) noexcept
     -> std::unordered_map<QualityType, std::vector<uid_t>>
 {
@@ -361,6 +418,125 @@ class ServiceElementInstanceDeploymentParser
         }
     }
 
+    template <typename Deployment>
+    void FillSlotStatusLayout(const bmw::json::Object::const_iterator slot_status_layout, Deployment& deployment)
+    {
+        if (slot_status_layout != json_object_.cend())
+        {
+            const auto slot_status_layout_value = slot_status_layout->second.As<std::string>().value().get();
+            if (slot_status_layout_value == SlotStatusLayoutPacked)
+            {
+                deployment.slot_status_layout_ = SlotStatusLayout::kPacked;
+            }
+            else if (slot_status_layout_value == SlotStatusLayoutCacheLineAligned)
+            {
+                deployment.slot_status_layout_ = SlotStatusLayout::kCacheLineAligned;
+            }
+            else
+            {
+                bmw::mw::log::LogFatal("lola")
+                    << "Unknown value " << slot_status_layout_value << " in key " << SlotStatusLayoutKey;
+                /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+                std::terminate();
+            }
+        }
+    }
+
+    template <typename Deployment>
+    void FillReceiveHandlerDispatch(const bmw::json::Object::const_iterator receive_handler_dispatch,
+                                    Deployment& deployment)
+    {
+        if (receive_handler_dispatch != json_object_.cend())
+        {
+            const auto receive_handler_dispatch_value =
+                receive_handler_dispatch->second.As<std::string>().value().get();
+            if (receive_handler_dispatch_value == ReceiveHandlerDispatchThreadPool)
+            {
+                deployment.receive_handler_dispatch_ = ReceiveHandlerDispatch::kThreadPool;
+            }
+            else if (receive_handler_dispatch_value == ReceiveHandlerDispatchInline)
+            {
+                deployment.receive_handler_dispatch_ = ReceiveHandlerDispatch::kInline;
+            }
+            else if (receive_handler_dispatch_value == ReceiveHandlerDispatchDedicatedThread)
+            {
+                deployment.receive_handler_dispatch_ = ReceiveHandlerDispatch::kDedicatedThread;
+            }
+            else
+            {
+                bmw::mw::log::LogFatal("lola") << "Unknown value " << receive_handler_dispatch_value << " in key "
+                                               << ReceiveHandlerDispatchKey;
+                /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+                std::terminate();
+            }
+        }
+    }
+
+    template <typename Deployment>
+    void FillReceiveHandlerThreadAttributes(const bmw::json::Object::const_iterator thread_priority,
+                                            const bmw::json::Object::const_iterator thread_cpu_affinity,
+                                            Deployment& deployment)
+    {
+        if (thread_priority != json_object_.cend())
+        {
+            deployment.receive_handler_thread_attributes_.priority = thread_priority->second.As<std::int32_t>().value();
+        }
+        if (thread_cpu_affinity != json_object_.cend())
+        {
+            std::uint64_t cpu_affinity{0U};
+            for (const auto& cpu : thread_cpu_affinity->second.As<bmw::json::List>().value().get())
+            {
+                const auto cpu_value = cpu.As<std::uint32_t>().value();
+                if (cpu_value >= MaxReceiveHandlerThreadCpus)
+                {
+                    bmw::mw::log::LogFatal("lola") << "Invalid CPU " << cpu_value << " in key "
+                                                   << ReceiveHandlerThreadCpuAffinityKey;
+                    /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+                    std::terminate();
+                }
+                cpu_affinity |= (std::uint64_t{1U} << cpu_value);
+            }
+            deployment.receive_handler_thread_attributes_.cpu_affinity = cpu_affinity;
+        }
+    }
+
+    template <typename Deployment>
+    void FillSlotAlignment(const bmw::json::Object::const_iterator slot_alignment, Deployment& deployment)
+    {
+        if (slot_alignment != json_object_.cend())
+        {
+            const auto slot_alignment_value = slot_alignment->second.As<std::uint32_t>().value();
+            const bool is_power_of_two = (slot_alignment_value != 0U) &&
+                                         ((slot_alignment_value & (slot_alignment_value - 1U)) == 0U);
+            if ((!is_power_of_two) || (slot_alignment_value > MaxSlotAlignment))
+            {
+                bmw::mw::log::LogFatal("lola") << "Invalid value " << slot_alignment_value << " in key "
+                                               << SlotAlignmentKey << ". Has to be a power of two up to "
+                                               << MaxSlotAlignment;
+                /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+                std::terminate();
+            }
+            deployment.slot_alignment_ = slot_alignment_value;
+        }
+    }
+
+    template <typename Deployment>
+    void FillSampleArenaSize(const bmw::json::Object::const_iterator sample_arena_size, Deployment& deployment)
+    {
+        if (sample_arena_size != json_object_.cend())
+        {
+            const auto sample_arena_size_value = sample_arena_size->second.As<std::uint32_t>().value();
+            if (sample_arena_size_value == 0U)
+            {
+                bmw::mw::log::LogFatal("lola") << "Invalid value " << sample_arena_size_value << " in key "
+                                               << SampleArenaSizeKey << ". Omit the key for events without arena.";
+                /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+                std::terminate();
+            }
+            deployment.sample_arena_size_ = sample_arena_size_value;
+        }
+    }
+
   private:
     const bmw::json::Object& json_object_;
 };
@@ -383,6 +559,12 @@ auto ParseLolaEventInstanceDeployment(const bmw::json::Any& json, LolaServiceIns
         const auto& max_subscribers = event_object.find(EventMaxSubscribersKey.data());
         const auto& enforce_max_samples = event_object.find(EventEnforceMaxSamplesKey.data());
         const auto& max_concurrent_allocations = event_object.find(EventMaxConcurrentAllocationsKey.data());
+        const auto& slot_status_layout = event_object.find(SlotStatusLayoutKey.data());
+        const auto& receive_handler_dispatch = event_object.find(ReceiveHandlerDispatchKey.data());
+        const auto& receive_handler_thread_priority = event_object.find(ReceiveHandlerThreadPriorityKey.data());
+        const auto& receive_handler_thread_cpu_affinity = event_object.find(ReceiveHandlerThreadCpuAffinityKey.data());
+        const auto& slot_alignment = event_object.find(SlotAlignmentKey.data());
+        const auto& sample_arena_size = event_object.find(SampleArenaSizeKey.data());
 
         error_if_found(max_concurrent_allocations, event_object);
 
@@ -412,6 +594,12 @@ auto ParseLolaEventInstanceDeployment(const bmw::json::Any& json, LolaServiceIns
         deployment_parser.FillMaxSubscribers(max_subscribers, event_deployment);
         deployment_parser.FillMaxConcurrentAllocations(max_concurrent_allocations, event_deployment);
         deployment_parser.FillEnforceMaxSamples(enforce_max_samples, event_deployment);
+        deployment_parser.FillSlotStatusLayout(slot_status_layout, event_deployment);
+        deployment_parser.FillReceiveHandlerDispatch(receive_handler_dispatch, event_deployment);
+        deployment_parser.FillReceiveHandlerThreadAttributes(
+            receive_handler_thread_priority, receive_handler_thread_cpu_affinity, event_deployment);
+        deployment_parser.FillSlotAlignment(slot_alignment, event_deployment);
+        deployment_parser.FillSampleArenaSize(sample_arena_size, event_deployment);
         const auto emplace_result = service.events_.emplace(std::piecewise_construct,
                                                             std::forward_as_tuple(std::move(event_name_value)),
                                                             std::forward_as_tuple(std::move(event_deployment)));
@@ -436,6 +624,11 @@ auto ParseLolaFieldInstanceDeployment(const bmw::json::Any& json, LolaServiceIns
         const auto& max_subscribers = field_object.find(FieldMaxSubscribersKey.data());
         const auto& enforce_max_samples = field_object.find(FieldEnforceMaxSamplesKey.data());
         const auto& max_concurrent_allocations = field_object.find(FieldMaxConcurrentAllocationsKey.data());
+        const auto& slot_status_layout = field_object.find(SlotStatusLayoutKey.data());
+        const auto& receive_handler_dispatch = field_object.find(ReceiveHandlerDispatchKey.data());
+        const auto& receive_handler_thread_priority = field_object.find(ReceiveHandlerThreadPriorityKey.data());
+        const auto& receive_handler_thread_cpu_affinity = field_object.find(ReceiveHandlerThreadCpuAffinityKey.data());
+        const auto& slot_alignment = field_object.find(SlotAlignmentKey.data());
 
         error_if_found(max_concurrent_allocations, field_object);
 
@@ -450,6 +643,11 @@ auto ParseLolaFieldInstanceDeployment(const bmw::json::Any& json, LolaServiceIns
         deployment_parser.FillMaxSubscribers(max_subscribers, field_deployment);
         deployment_parser.FillMaxConcurrentAllocations(max_concurrent_allocations, field_deployment);
         deployment_parser.FillEnforceMaxSamples(enforce_max_samples, field_deployment);
+        deployment_parser.FillSlotStatusLayout(slot_status_layout, field_deployment);
+        deployment_parser.FillReceiveHandlerDispatch(receive_handler_dispatch, field_deployment);
+        deployment_parser.FillReceiveHandlerThreadAttributes(
+            receive_handler_thread_priority, receive_handler_thread_cpu_affinity, field_deployment);
+        deployment_parser.FillSlotAlignment(slot_alignment, field_deployment);
 
         const auto emplace_result = service.fields_.emplace(std::piecewise_construct,
                                                             std::forward_as_tuple(std::move(field_name_value)),
@@ -547,6 +745,36 @@ auto ParsePermissionChecks(const bmw::json::Any& deployment_instance) -> std::st
     return FilePermissionsOnEmpty;
 }
 
+auto ParseShmPrefaultMode(const bmw::json::Any& deployment_instance) -> ShmPrefaultMode
+{
+    const auto& deployment_instance_object = deployment_instance.As<bmw::json::Object>().value().get();
+    const auto shm_prefault = deployment_instance_object.find(LolaShmPrefaultKey.data());
+    if (shm_prefault == deployment_instance_object.cend())
+    {
+        return ShmPrefaultMode::kNone;
+    }
+
+    const auto& shm_prefault_value = shm_prefault->second.As<std::string>().value().get();
+    if (shm_prefault_value == ShmPrefaultNone)
+    {
+        return ShmPrefaultMode::kNone;
+    }
+    else if (shm_prefault_value == ShmPrefaultPopulate)
+    {
+        return ShmPrefaultMode::kPopulate;
+    }
+    else if (shm_prefault_value == ShmPrefaultLock)
+    {
+        return ShmPrefaultMode::kLock;
+    }
+    else
+    {
+        bmw::mw::log::LogFatal("lola") << "Unknown value " << shm_prefault_value << " in key " << LolaShmPrefaultKey;
+        /* Terminate call tolerated.See Assumptions of Use in mw/com/design/README.md*/
+        std::terminate();
+    }
+}
+
 auto ParseLolaServiceInstanceDeployment(const bmw::json::Any& json) -> LolaServiceInstanceDeployment
 {
     LolaServiceInstanceDeployment service{};
@@ -556,6 +784,13 @@ auto ParseLolaServiceInstanceDeployment(const bmw::json::Any& json) -> LolaServi
         service.shared_memory_size_ = found_shm_size->second.As<std::uint64_t>().value();
     }
 
+    const auto& found_shm_huge_pages = json.As<bmw::json::Object>().value().get().find(LolaShmHugePagesKey.data());
+    if (found_shm_huge_pages != json.As<bmw::json::Object>().value().get().cend())
+    {
+        service.shm_huge_pages_ = found_shm_huge_pages->second.As<bool>().value();
+    }
+    service.shm_prefault_mode_ = ParseShmPrefaultMode(json);
+
     const auto& instance_id = json.As<bmw::json::Object>().value().get().find(InstanceIdKey.data());
     if (instance_id != json.As<bmw::json::Object>().value().get().cend())
     {
@@ -1053,6 +1288,13 @@ auto ParseGlobalProperties(const bmw::json::Any& json) noexcept -> GlobalConfigu
         {
             global_configuration.SetShmSizeCalcMode(shm_size_calc_mode.value());
         }
+
+        const amp::optional<EventNotificationMode> event_notification_mode{
+            ParseEventNotificationMode(process_properties->second)};
+        if (event_notification_mode.has_value())
+        {
+            global_configuration.SetEventNotificationMode(event_notification_mode.value());
+        }
     }
     else
     {
@@ -2074,6 +2074,681 @@ TEST(ConfigParser, LolaFieldOptionalEnforceMaxSamples)
     EXPECT_EQ(deploymentInfo.fields_.at("CurrentTemperatureFrontLeft").enforce_max_samples_.value(), false);
 }
 
+TEST(ConfigParser, LolaEventOptionalSlotStatusLayout)
+{
+    // Given a JSON with optional attribute `slotStatusLayout` for SHM-Binding Info
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "slotStatusLayout": "CACHE_LINE_ALIGNED"
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+
+    // Then the configured layout is used and the default layout is packed
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontLeft").slot_status_layout_,
+              SlotStatusLayout::kCacheLineAligned);
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontRight").slot_status_layout_, SlotStatusLayout::kPacked);
+}
+
+TEST(ConfigParser, LolaEventOptionalReceiveHandlerDispatch)
+{
+    // Given a JSON with optional attribute `receiveHandlerDispatch` for SHM-Binding Info
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "receiveHandlerDispatch": "DEDICATED_THREAD"
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+
+    // Then the configured dispatch is used and the default dispatch is the thread pool
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontLeft").receive_handler_dispatch_,
+              ReceiveHandlerDispatch::kDedicatedThread);
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontRight").receive_handler_dispatch_,
+              ReceiveHandlerDispatch::kThreadPool);
+}
+
+TEST(ConfigParser, LolaEventOptionalReceiveHandlerThreadAttributes)
+{
+    // Given a JSON with optional attributes `receiveHandlerThreadPriority` and `receiveHandlerThreadCpuAffinity` for
+    // SHM-Binding Info
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "receiveHandlerDispatch": "DEDICATED_THREAD",
+                          "receiveHandlerThreadPriority": 42,
+                          "receiveHandlerThreadCpuAffinity": [2, 3, 63]
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+
+    // Then the configured priority and CPUs are used and both are unset by default
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    const auto& thread_attributes =
+        deploymentInfo.events_.at("CurrentPressureFrontLeft").receive_handler_thread_attributes_;
+    EXPECT_EQ(thread_attributes.priority, amp::optional<std::int32_t>{42});
+    EXPECT_EQ(thread_attributes.cpu_affinity,
+              amp::optional<std::uint64_t>{(std::uint64_t{1U} << 2U) | (std::uint64_t{1U} << 3U) |
+                                           (std::uint64_t{1U} << 63U)});
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontRight").receive_handler_thread_attributes_,
+              ReceiveHandlerThreadAttributes{});
+}
+
+TEST(ConfigParserDeathTest, LolaEventReceiveHandlerThreadCpuBeyondBitMaskWillDie)
+{
+    // Given a JSON with a CPU in `receiveHandlerThreadCpuAffinity`, which doesn't fit into the CPU bit mask
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "receiveHandlerDispatch": "DEDICATED_THREAD",
+                          "receiveHandlerThreadCpuAffinity": [64]
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    // Then the process terminates
+    EXPECT_DEATH(bmw::mw::com::impl::configuration::Parse(std::move(j2)), ".*");
+}
+
+TEST(ConfigParser, LolaInstanceOptionalShmPageBacking)
+{
+    // Given a JSON with optional attributes `shm-huge-pages` and `shm-prefault` for one of two SHM-Binding instances
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "shm-huge-pages": true,
+                  "shm-prefault": "POPULATE",
+                  "events": [],
+                  "fields": []
+                }
+            ]
+        },
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort2",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1235,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    // Then the configured page backing is used for the first instance
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    EXPECT_TRUE(deploymentInfo.shm_huge_pages_);
+    EXPECT_EQ(deploymentInfo.shm_prefault_mode_, ShmPrefaultMode::kPopulate);
+
+    // and the second instance uses the defaults
+    const auto deployment2 =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort2").value());
+    const auto deploymentInfo2 = amp::get<LolaServiceInstanceDeployment>(deployment2.bindingInfo_);
+    EXPECT_FALSE(deploymentInfo2.shm_huge_pages_);
+    EXPECT_EQ(deploymentInfo2.shm_prefault_mode_, ShmPrefaultMode::kNone);
+}
+
+TEST(ConfigParser, LolaEventOptionalSlotAlignment)
+{
+    // Given a JSON with optional attribute `slotAlignment` for SHM-Binding Info
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "slotAlignment": 64
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+
+    // Then the configured alignment is used and no alignment is set by default
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    ASSERT_TRUE(deploymentInfo.events_.at("CurrentPressureFrontLeft").slot_alignment_.has_value());
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontLeft").slot_alignment_.value(), 64U);
+    EXPECT_FALSE(deploymentInfo.events_.at("CurrentPressureFrontRight").slot_alignment_.has_value());
+}
+
+TEST(ConfigParserDeathTest, LolaEventSlotAlignmentNotPowerOfTwoTerminates)
+{
+    // Given a JSON with a `slotAlignment`, which is not a power of two
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "slotAlignment": 48
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    // When parsing such a configuration
+    // Then the program terminates
+    EXPECT_DEATH(bmw::mw::com::impl::configuration::Parse(std::move(j2)), ".*");
+}
+
+TEST(ConfigParser, LolaEventOptionalSampleArenaSize)
+{
+    // Given a JSON with optional attribute `sampleArenaSize` for SHM-Binding Info
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "sampleArenaSize": 65536
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    const auto config = bmw::mw::com::impl::configuration::Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+
+    // Then the configured sample arena size is used and there is no sample arena by default
+    const auto deploymentInfo = amp::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+    ASSERT_TRUE(deploymentInfo.events_.at("CurrentPressureFrontLeft").sample_arena_size_.has_value());
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontLeft").sample_arena_size_.value(), 65536U);
+    EXPECT_FALSE(deploymentInfo.events_.at("CurrentPressureFrontRight").sample_arena_size_.has_value());
+}
+
+TEST(ConfigParserDeathTest, LolaEventZeroSampleArenaSizeTerminates)
+{
+    // Given a JSON with a `sampleArenaSize` of zero
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "eventId": 21
+                      }
+                  ],
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5,
+                          "sampleArenaSize": 0
+                      },
+                      {
+                          "eventName": "CurrentPressureFrontRight",
+                          "numberOfSampleSlots": 50,
+                          "maxSubscribers": 5
+                      }
+                  ],
+                  "fields": []
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+    // When parsing such a configuration
+    // Then the program terminates
+    EXPECT_DEATH(bmw::mw::com::impl::configuration::Parse(std::move(j2)), ".*");
+}
+
 TEST(ConfigParser, EmptyServiceTypes)
 {
     // Given a JSON with necessary attribute `serviceTypes` being empty (which is allowed)
@@ -2523,6 +3198,45 @@ const std::vector<std::tuple<std::string, ShmSizeCalculationMode>> valid_global_
 
 INSTANTIATE_TEST_SUITE_P(ValidShmSizeCalcMode, ShmSizeCalcMode, ::testing::ValuesIn(valid_global_shm_size_calc_modes));
 
+class EventNotificationModeParam : public ::testing::TestWithParam<std::tuple<std::string, EventNotificationMode>>
+{
+};
+
+TEST_P(EventNotificationModeParam, ValidEventNotificationMode)
+{
+    json::JsonParser json_parser_obj;
+    json::Any json{json_parser_obj.FromBuffer(std::get<std::string>(GetParam())).value()};
+    Configuration config{configuration::Parse(std::move(json))};
+    EXPECT_EQ(config.GetGlobalConfiguration().GetEventNotificationMode(), std::get<EventNotificationMode>(GetParam()));
+}
+
+const std::vector<std::tuple<std::string, EventNotificationMode>> valid_global_event_notification_modes{
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "event-notification-mode": "MESSAGE_PASSING" }})json",
+     EventNotificationMode::kMessagePassing},
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "event-notification-mode": "SHARED_MEMORY" }})json",
+     EventNotificationMode::kSharedMemory},
+    {R"json({"serviceTypes": [], "serviceInstances": [] })json", EventNotificationMode::kMessagePassing},
+};
+
+INSTANTIATE_TEST_SUITE_P(ValidEventNotificationMode,
+                         EventNotificationModeParam,
+                         ::testing::ValuesIn(valid_global_event_notification_modes));
+
+TEST(ConfigParserDeathTest, UnknownEventNotificationModeTerminates)
+{
+    // Given a JSON with an unknown event notification mode
+    json::JsonParser json_parser_obj;
+    json::Any json{
+        json_parser_obj
+            .FromBuffer(
+                R"json({"serviceTypes": [], "serviceInstances": [], "global": { "event-notification-mode": "CARRIER_PIGEON" }})json")
+            .value()};
+
+    // When parsing such a configuration
+    // Then the program terminates
+    EXPECT_DEATH(configuration::Parse(std::move(json)), ".*");
+}
+
 TEST(ConfigParserTracing, ProvidingAllTracingConfigElementsDoesNotCrash)
 {
     RecordProperty("Verifies", "2");
@@ -0,0 +1,33 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/configuration/event_notification_mode.h"
+
+std::ostream& bmw::mw::com::impl::operator<<(std::ostream& ostream_out, const EventNotificationMode& mode)
+{
+    switch (mode)
+    {
+        case EventNotificationMode::kMessagePassing:
+            ostream_out << "MESSAGE_PASSING";
+            break;
+        case EventNotificationMode::kSharedMemory:
+            ostream_out << "SHARED_MEMORY";
+            break;
+        default:
+            ostream_out << "(unknown)";
+            break;
+    }
+
+    return ostream_out;
+}
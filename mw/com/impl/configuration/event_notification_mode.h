@@ -0,0 +1,43 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_EVENT_NOTIFICATION_MODE_H
+#define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_EVENT_NOTIFICATION_MODE_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+enum class EventNotificationMode : std::uint8_t
+{
+    kMessagePassing = 0x00,
+    kSharedMemory = 0x01,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const EventNotificationMode& mode);
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_EVENT_NOTIFICATION_MODE_H
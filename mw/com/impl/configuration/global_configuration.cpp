@@ -32,7 +32,8 @@ GlobalConfiguration::GlobalConfiguration() noexcept
       message_rx_queue_size_qm{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_rx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_tx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_TX_QUEUE},
-      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation}
+      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation},
+      event_notification_mode_{EventNotificationMode::kMessagePassing}
 {
 }
 
@@ -84,6 +85,11 @@ void GlobalConfiguration::SetShmSizeCalcMode(const ShmSizeCalculationMode shm_si
     shm_size_calc_mode_ = shm_size_calc_mode;
 }
 
+void GlobalConfiguration::SetEventNotificationMode(const EventNotificationMode event_notification_mode) noexcept
+{
+    event_notification_mode_ = event_notification_mode;
+}
+
 }  // namespace impl
 }  // namespace com
 }  // namespace mw
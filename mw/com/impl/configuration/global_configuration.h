@@ -15,6 +15,7 @@
 #ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_GLOBAL_CONFIGURATION_H
 #define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_GLOBAL_CONFIGURATION_H
 
+#include "platform/aas/mw/com/impl/configuration/event_notification_mode.h"
 #include "platform/aas/mw/com/impl/configuration/quality_type.h"
 #include "platform/aas/mw/com/impl/configuration/shm_size_calc_mode.h"
 
@@ -57,6 +58,8 @@ class GlobalConfiguration final
 
     void SetShmSizeCalcMode(const ShmSizeCalculationMode shm_size_calc_mode) noexcept;
 
+    void SetEventNotificationMode(const EventNotificationMode event_notification_mode) noexcept;
+
     std::int32_t GetReceiverMessageQueueSize(const QualityType quality_type) const noexcept;
 
     std::int32_t GetSenderMessageQueueSize() const noexcept { return message_tx_queue_size_b; }
@@ -65,6 +68,8 @@ class GlobalConfiguration final
 
     ShmSizeCalculationMode GetShmSizeCalcMode() const noexcept { return shm_size_calc_mode_; }
 
+    EventNotificationMode GetEventNotificationMode() const noexcept { return event_notification_mode_; }
+
   private:
     /// properties/settings from the "global" section
     QualityType process_asil_level_;
@@ -74,6 +79,8 @@ class GlobalConfiguration final
     std::int32_t message_tx_queue_size_b;
 
     ShmSizeCalculationMode shm_size_calc_mode_;
+
+    EventNotificationMode event_notification_mode_;
 };
 
 }  // namespace impl
@@ -134,6 +134,24 @@ TEST(GlobalConfigurationTest, GettingShmSizeCalcModeBeforeSetValueReturnsDefault
     EXPECT_EQ(get_shm_calc_size_mod, kDefaultShmSizeCalculationMode);
 }
 
+TEST(GlobalConfigurationTest, GettingEventNotificationModeReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    global_configuration.SetEventNotificationMode(EventNotificationMode::kSharedMemory);
+    EXPECT_EQ(global_configuration.GetEventNotificationMode(), EventNotificationMode::kSharedMemory);
+
+    global_configuration.SetEventNotificationMode(EventNotificationMode::kMessagePassing);
+    EXPECT_EQ(global_configuration.GetEventNotificationMode(), EventNotificationMode::kMessagePassing);
+}
+
+TEST(GlobalConfigurationTest, GettingEventNotificationModeBeforeSetValueReturnsMessagePassing)
+{
+    GlobalConfiguration global_configuration{};
+
+    EXPECT_EQ(global_configuration.GetEventNotificationMode(), EventNotificationMode::kMessagePassing);
+}
+
 TEST(GlobalConfigurationDeathTest, GetReceiverMessageQueueSize_InvalidQualityType)
 {
     // Given a default constructed GlobalConfiguration
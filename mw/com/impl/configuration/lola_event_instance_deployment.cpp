@@ -36,6 +36,12 @@ constexpr auto kNumberOfSampleSlotsKey = "numberOfSampleSlots";
 constexpr auto kSubscribersKey = "maxSubscribers";
 constexpr auto kMaxConcurrentAllocationsKey = "maxConcurrentAllocations";
 constexpr auto kEnforceMaxSamplesKey = "enforceMaxSamples";
+constexpr auto kSlotStatusLayoutKey = "slotStatusLayout";
+constexpr auto kReceiveHandlerDispatchKey = "receiveHandlerDispatch";
+constexpr auto kReceiveHandlerThreadPriorityKey = "receiveHandlerThreadPriority";
+constexpr auto kReceiveHandlerThreadCpuAffinityKey = "receiveHandlerThreadCpuAffinity";
+constexpr auto kSlotAlignmentKey = "slotAlignment";
+constexpr auto kSampleArenaSizeKey = "sampleArenaSize";
 
 }  // namespace
 
@@ -84,6 +90,45 @@ LolaEventInstanceDeployment::LolaEventInstanceDeployment(const bmw::json::Object
     {
         enforce_max_samples_ = enforce_max_samples_it->second.As<bool>();
     }
+
+    const auto slot_status_layout_it = json_object.find(kSlotStatusLayoutKey);
+    if (slot_status_layout_it != json_object.end())
+    {
+        slot_status_layout_ = static_cast<SlotStatusLayout>(slot_status_layout_it->second.As<std::uint8_t>().value());
+    }
+
+    const auto receive_handler_dispatch_it = json_object.find(kReceiveHandlerDispatchKey);
+    if (receive_handler_dispatch_it != json_object.end())
+    {
+        receive_handler_dispatch_ =
+            static_cast<ReceiveHandlerDispatch>(receive_handler_dispatch_it->second.As<std::uint8_t>().value());
+    }
+
+    const auto receive_handler_thread_priority_it = json_object.find(kReceiveHandlerThreadPriorityKey);
+    if (receive_handler_thread_priority_it != json_object.end())
+    {
+        receive_handler_thread_attributes_.priority =
+            receive_handler_thread_priority_it->second.As<std::int32_t>().value();
+    }
+
+    const auto receive_handler_thread_cpu_affinity_it = json_object.find(kReceiveHandlerThreadCpuAffinityKey);
+    if (receive_handler_thread_cpu_affinity_it != json_object.end())
+    {
+        receive_handler_thread_attributes_.cpu_affinity =
+            receive_handler_thread_cpu_affinity_it->second.As<std::uint64_t>().value();
+    }
+
+    const auto slot_alignment_it = json_object.find(kSlotAlignmentKey);
+    if (slot_alignment_it != json_object.end())
+    {
+        slot_alignment_ = slot_alignment_it->second.As<std::uint32_t>();
+    }
+
+    const auto sample_arena_size_it = json_object.find(kSampleArenaSizeKey);
+    if (sample_arena_size_it != json_object.end())
+    {
+        sample_arena_size_ = sample_arena_size_it->second.As<std::uint32_t>();
+    }
 }
 
 bmw::json::Object LolaEventInstanceDeployment::Serialize() const noexcept
@@ -109,6 +154,28 @@ bmw::json::Object LolaEventInstanceDeployment::Serialize() const noexcept
         json_object[kEnforceMaxSamplesKey] = bmw::json::Any{enforce_max_samples_.value()};
     }
 
+    json_object[kSlotStatusLayoutKey] = bmw::json::Any{static_cast<std::uint8_t>(slot_status_layout_)};
+    json_object[kReceiveHandlerDispatchKey] = bmw::json::Any{static_cast<std::uint8_t>(receive_handler_dispatch_)};
+    if (receive_handler_thread_attributes_.priority.has_value())
+    {
+        json_object[kReceiveHandlerThreadPriorityKey] =
+            bmw::json::Any{receive_handler_thread_attributes_.priority.value()};
+    }
+    if (receive_handler_thread_attributes_.cpu_affinity.has_value())
+    {
+        json_object[kReceiveHandlerThreadCpuAffinityKey] =
+            bmw::json::Any{receive_handler_thread_attributes_.cpu_affinity.value()};
+    }
+
+    if (slot_alignment_.has_value())
+    {
+        json_object[kSlotAlignmentKey] = bmw::json::Any{slot_alignment_.value()};
+    }
+    if (sample_arena_size_.has_value())
+    {
+        json_object[kSampleArenaSizeKey] = bmw::json::Any{sample_arena_size_.value()};
+    }
+
     return json_object;
 }
 
@@ -155,11 +222,19 @@ bool operator==(const LolaEventInstanceDeployment& lhs, const LolaEventInstanceD
     const bool max_subscribers_equal = (lhs.max_subscribers_ == rhs.max_subscribers_);
     const bool max_concurrent_allocations_equal = (lhs.max_concurrent_allocations_ == rhs.max_concurrent_allocations_);
     const bool enforce_max_samples_equal = (lhs.enforce_max_samples_ == rhs.enforce_max_samples_);
+    const bool slot_status_layout_equal = (lhs.slot_status_layout_ == rhs.slot_status_layout_);
+    const bool receive_handler_dispatch_equal = (lhs.receive_handler_dispatch_ == rhs.receive_handler_dispatch_);
+    const bool slot_alignment_equal = (lhs.slot_alignment_ == rhs.slot_alignment_);
+    const bool sample_arena_size_equal = (lhs.sample_arena_size_ == rhs.sample_arena_size_);
+    const bool receive_handler_thread_attributes_equal =
+        (lhs.receive_handler_thread_attributes_ == rhs.receive_handler_thread_attributes_);
     // Adding Brackets to the expression does not give additional value since only one logical operator is used which
     // is independent of the execution order
     // 
     return (number_of_sample_slots_equal && is_tracing_enabled_equal && max_subscribers_equal &&
-            max_concurrent_allocations_equal && enforce_max_samples_equal);
+            max_concurrent_allocations_equal && enforce_max_samples_equal && slot_status_layout_equal &&
+            receive_handler_dispatch_equal && slot_alignment_equal && sample_arena_size_equal &&
+            receive_handler_thread_attributes_equal);
 }
 
 }  // namespace impl
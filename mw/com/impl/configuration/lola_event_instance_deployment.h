@@ -15,6 +15,9 @@
 #ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_LOLA_EVENT_INSTANCE_DEPLOYMENT_H
 #define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_LOLA_EVENT_INSTANCE_DEPLOYMENT_H
 
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
+
 #include "platform/aas/lib/json/json_parser.h"
 
 #include <amp_optional.hpp>
@@ -49,6 +52,7 @@ class LolaEventInstanceDeployment
     void SetNumberOfSampleSlots(SampleSlotCountType number_of_sample_slots) noexcept;
     void SetMaxSubscribers(SubscriberCountType max_subscribers) noexcept;
     void SetTracingEnabled(bool is_tracing_enabled) noexcept;
+    bool IsTracingEnabled() const noexcept { return is_tracing_enabled_; }
 
     amp::optional<SampleSlotCountType> GetNumberOfSampleSlots() const noexcept;
     amp::optional<SampleSlotCountType> GetNumberOfSampleSlotsExcludingTracingSlot() const noexcept;
@@ -59,6 +63,26 @@ class LolaEventInstanceDeployment
     amp::optional<std::uint8_t> max_concurrent_allocations_;
     amp::optional<bool> enforce_max_samples_;
 
+    /// \brief layout of the slot status array in the control shared memory. Only relevant on skeleton side, where the
+    ///        control shared memory gets created.
+    SlotStatusLayout slot_status_layout_{SlotStatusLayout::kPacked};
+
+    /// \brief minimum alignment (in bytes) of each sample slot in the data shared memory. Only relevant on skeleton
+    ///        side, where the data shared memory gets created. Proxies get the resulting slot layout from the
+    ///        EventMetaInfo. If not set, the slots are aligned according to the sample type.
+    amp::optional<std::uint32_t> slot_alignment_;
+
+    /// \brief size (in bytes) of the sample arena of this event in the data shared memory, from which samples of type
+    ///        DynamicSample get their data. Only relevant on skeleton side. If not set, the event has no sample arena.
+    amp::optional<std::uint32_t> sample_arena_size_;
+
+    /// \brief thread, which calls a registered receive handler. Only relevant on proxy side.
+    ReceiveHandlerDispatch receive_handler_dispatch_{ReceiveHandlerDispatch::kThreadPool};
+
+    /// \brief priority and CPU affinity of the thread of ReceiveHandlerDispatch::kDedicatedThread. Only relevant on
+    ///        proxy side.
+    ReceiveHandlerThreadAttributes receive_handler_thread_attributes_{};
+
     constexpr static std::uint32_t serializationVersion = 1U;
 
     friend bool operator==(const LolaEventInstanceDeployment& lhs, const LolaEventInstanceDeployment& rhs) noexcept;
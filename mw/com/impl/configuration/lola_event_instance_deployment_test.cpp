@@ -59,6 +59,53 @@ TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithoutO
     ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
 }
 
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithSlotAlignment)
+{
+    // Given a deployment with a slot alignment
+    LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
+    unit.slot_alignment_ = 64U;
+
+    // When serializing and reconstructing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the slot alignment is kept
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit, unit);
+}
+
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithSampleArenaSize)
+{
+    // Given a deployment with a sample arena
+    LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
+    unit.sample_arena_size_ = 4096U;
+
+    // When serializing and reconstructing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the sample arena size is kept
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit, unit);
+}
+
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithReceiveHandlerThreadAttributes)
+{
+    // Given a deployment with priority and CPU affinity of the dedicated receive handler thread
+    LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
+    unit.receive_handler_dispatch_ = ReceiveHandlerDispatch::kDedicatedThread;
+    unit.receive_handler_thread_attributes_.priority = 42;
+    unit.receive_handler_thread_attributes_.cpu_affinity = 0x0CU;
+
+    // When serializing and reconstructing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the thread attributes are kept
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit, unit);
+}
+
 TEST(LolaEventInstanceDeploymentDeathTest, CreatingFromSerializedObjectWithMismatchedSerializationVersionTerminates)
 {
     LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
@@ -36,6 +36,8 @@ constexpr auto kFieldsKeyInstDepl = "fields";
 constexpr auto kStrictKeyInstDepl = "strict";
 constexpr auto kAllowedConsumerKeyInstDepl = "allowedConsumer";
 constexpr auto kAllowedProviderKeyInstDepl = "allowedProvider";
+constexpr auto kShmHugePagesKeyInstDepl = "shmHugePages";
+constexpr auto kShmPrefaultModeKeyInstDepl = "shmPrefaultMode";
 
 std::unordered_map<QualityType, std::vector<uid_t>> ConvertJsonToUidMap(const json::Object& json_object,
                                                                         amp::string_view key) noexcept
@@ -123,6 +125,18 @@ LolaServiceInstanceDeployment::LolaServiceInstanceDeployment(const bmw::json::Ob
     {
         shared_memory_size_ = shared_memory_size_it->second.As<std::size_t>().value();
     }
+
+    const auto shm_huge_pages_it = json_object.find(kShmHugePagesKeyInstDepl);
+    if (shm_huge_pages_it != json_object.end())
+    {
+        shm_huge_pages_ = shm_huge_pages_it->second.As<bool>().value();
+    }
+
+    const auto shm_prefault_mode_it = json_object.find(kShmPrefaultModeKeyInstDepl);
+    if (shm_prefault_mode_it != json_object.end())
+    {
+        shm_prefault_mode_ = static_cast<ShmPrefaultMode>(shm_prefault_mode_it->second.As<std::uint8_t>().value());
+    }
 }
 
 LolaServiceInstanceDeployment::LolaServiceInstanceDeployment(const LolaServiceInstanceId instance_id,
@@ -158,6 +172,8 @@ bmw::json::Object LolaServiceInstanceDeployment::Serialize() const noexcept
     json_object[kFieldsKeyInstDepl] = ConvertServiceElementMapToJson(fields_);
 
     json_object[kStrictKeyInstDepl] = strict_permissions_;
+    json_object[kShmHugePagesKeyInstDepl] = shm_huge_pages_;
+    json_object[kShmPrefaultModeKeyInstDepl] = bmw::json::Any{static_cast<std::uint8_t>(shm_prefault_mode_)};
 
     json_object[kAllowedConsumerKeyInstDepl] = ConvertUidMapToJson(allowed_consumer_);
     json_object[kAllowedProviderKeyInstDepl] = ConvertUidMapToJson(allowed_provider_);
@@ -20,6 +20,7 @@
 #include "platform/aas/mw/com/impl/configuration/lola_field_instance_deployment.h"
 #include "platform/aas/mw/com/impl/configuration/lola_service_instance_id.h"
 #include "platform/aas/mw/com/impl/configuration/quality_type.h"
+#include "platform/aas/mw/com/impl/configuration/shm_prefault_mode.h"
 
 #include "platform/aas/lib/json/json_parser.h"
 
@@ -65,6 +66,9 @@ struct LolaServiceInstanceDeployment
     EventInstanceMapping events_;  // key = event name
     FieldInstanceMapping fields_;  // key = field name
     bool strict_permissions_{false};
+    /// \brief whether transparent huge pages shall be requested for the shm-objects of this instance.
+    bool shm_huge_pages_{false};
+    ShmPrefaultMode shm_prefault_mode_{ShmPrefaultMode::kNone};
     std::unordered_map<QualityType, std::vector<uid_t>> allowed_consumer_;
     std::unordered_map<QualityType, std::vector<uid_t>> allowed_provider_;
 
@@ -127,6 +127,19 @@ TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithSe
     ExpectLolaServiceInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
 }
 
+TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithShmPageBacking)
+{
+    LolaServiceInstanceDeployment unit{MakeLolaServiceInstanceDeployment()};
+    unit.shm_huge_pages_ = true;
+    unit.shm_prefault_mode_ = ShmPrefaultMode::kLock;
+
+    const auto serialized_unit{unit.Serialize()};
+
+    LolaServiceInstanceDeployment reconstructed_unit{serialized_unit};
+
+    ExpectLolaServiceInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+}
+
 TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithoutOptionals)
 {
     const LolaServiceInstanceDeployment unit{MakeLolaServiceInstanceDeployment({}, {})};
@@ -0,0 +1,42 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/configuration/receive_handler_dispatch.h"
+
+std::ostream& bmw::mw::com::impl::operator<<(std::ostream& ostream_out, const ReceiveHandlerDispatch& dispatch)
+{
+    switch (dispatch)
+    {
+        case ReceiveHandlerDispatch::kThreadPool:
+            ostream_out << "THREAD_POOL";
+            break;
+        case ReceiveHandlerDispatch::kInline:
+            ostream_out << "INLINE";
+            break;
+        case ReceiveHandlerDispatch::kDedicatedThread:
+            ostream_out << "DEDICATED_THREAD";
+            break;
+        default:
+            ostream_out << "(unknown)";
+            break;
+    }
+
+    return ostream_out;
+}
+
+bool bmw::mw::com::impl::operator==(const ReceiveHandlerThreadAttributes& lhs,
+                                    const ReceiveHandlerThreadAttributes& rhs) noexcept
+{
+    return (lhs.priority == rhs.priority) && (lhs.cpu_affinity == rhs.cpu_affinity);
+}
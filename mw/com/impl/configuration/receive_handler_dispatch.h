@@ -0,0 +1,64 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_RECEIVE_HANDLER_DISPATCH_H
+#define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_RECEIVE_HANDLER_DISPATCH_H
+
+#include <amp_optional.hpp>
+
+#include <cstdint>
+#include <ostream>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+/// \brief Thread, which calls the receive handler of a LoLa proxy event/field on an update notification.
+///
+/// kThreadPool uses the worker threads shared by all proxy events of the process. kInline calls the handler directly
+/// from the thread, which received (or, for a process local provider, sent) the notification, i.e. without any thread
+/// hop but blocking this thread for the runtime of the handler. kDedicatedThread calls the handler from a thread owned
+/// by the proxy event, so that its latency doesn't depend on the handlers of other proxy events.
+enum class ReceiveHandlerDispatch : std::uint8_t
+{
+    kThreadPool = 0x00,
+    kInline = 0x01,
+    kDedicatedThread = 0x02,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const ReceiveHandlerDispatch& dispatch);
+
+/// \brief Scheduling attributes of the thread of ReceiveHandlerDispatch::kDedicatedThread. Attributes, which are not
+/// set, are inherited from the thread, which registers the receive handler.
+struct ReceiveHandlerThreadAttributes
+{
+    /// \brief SCHED_FIFO priority of the thread.
+    amp::optional<std::int32_t> priority{};
+    /// \brief CPUs, the thread may run on. Bit i stands for CPU i.
+    amp::optional<std::uint64_t> cpu_affinity{};
+};
+
+bool operator==(const ReceiveHandlerThreadAttributes& lhs, const ReceiveHandlerThreadAttributes& rhs) noexcept;
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_RECEIVE_HANDLER_DISPATCH_H
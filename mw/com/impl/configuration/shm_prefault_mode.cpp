@@ -0,0 +1,36 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/configuration/shm_prefault_mode.h"
+
+std::ostream& bmw::mw::com::impl::operator<<(std::ostream& ostream_out, const ShmPrefaultMode& prefault_mode)
+{
+    switch (prefault_mode)
+    {
+        case ShmPrefaultMode::kNone:
+            ostream_out << "NONE";
+            break;
+        case ShmPrefaultMode::kPopulate:
+            ostream_out << "POPULATE";
+            break;
+        case ShmPrefaultMode::kLock:
+            ostream_out << "LOCK";
+            break;
+        default:
+            ostream_out << "(unknown)";
+            break;
+    }
+
+    return ostream_out;
+}
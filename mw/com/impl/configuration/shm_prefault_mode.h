@@ -0,0 +1,48 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
+#define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+/// \brief Whether the pages of the LoLa shm-objects of a service instance get mapped right after creating/opening them.
+///
+/// kNone maps each page on its first access. kPopulate maps all pages up front, so that the first access of a slot
+/// doesn't take a page fault. kLock additionally locks all pages into RAM via mlock().
+enum class ShmPrefaultMode : std::uint8_t
+{
+    kNone = 0x00,
+    kPopulate = 0x01,
+    kLock = 0x02,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const ShmPrefaultMode& prefault_mode);
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
@@ -0,0 +1,33 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/configuration/slot_status_layout.h"
+
+std::ostream& bmw::mw::com::impl::operator<<(std::ostream& ostream_out, const SlotStatusLayout& layout)
+{
+    switch (layout)
+    {
+        case SlotStatusLayout::kPacked:
+            ostream_out << "PACKED";
+            break;
+        case SlotStatusLayout::kCacheLineAligned:
+            ostream_out << "CACHE_LINE_ALIGNED";
+            break;
+        default:
+            ostream_out << "(unknown)";
+            break;
+    }
+
+    return ostream_out;
+}
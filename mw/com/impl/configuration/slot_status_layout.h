@@ -0,0 +1,48 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SLOT_STATUS_LAYOUT_H
+#define PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SLOT_STATUS_LAYOUT_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+/// \brief Layout of the slot status array of a LoLa event/field in the control shared memory.
+///
+/// kPacked places the slot states back to back. kCacheLineAligned places every slot state in its own cache line, so
+/// that a producer and consumers working on neighbouring slots don't invalidate each others cache lines (false sharing)
+/// at the cost of a larger control shared memory.
+enum class SlotStatusLayout : std::uint8_t
+{
+    kPacked = 0x00,
+    kCacheLineAligned = 0x01,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const SlotStatusLayout& layout);
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_CONFIGURATION_SLOT_STATUS_LAYOUT_H
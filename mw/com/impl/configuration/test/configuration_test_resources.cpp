@@ -138,6 +138,9 @@ void ConfigurationStructsFixture::ExpectLolaEventInstanceDeploymentObjectsEqual(
     EXPECT_EQ(lhs.max_subscribers_, rhs.max_subscribers_);
     EXPECT_EQ(lhs.max_concurrent_allocations_, rhs.max_concurrent_allocations_);
     EXPECT_EQ(lhs.enforce_max_samples_, rhs.enforce_max_samples_);
+    EXPECT_EQ(lhs.slot_alignment_, rhs.slot_alignment_);
+    EXPECT_EQ(lhs.sample_arena_size_, rhs.sample_arena_size_);
+    EXPECT_EQ(lhs.receive_handler_thread_attributes_, rhs.receive_handler_thread_attributes_);
     EXPECT_EQ(lhs.GetNumberOfSampleSlotsExcludingTracingSlot(), rhs.GetNumberOfSampleSlotsExcludingTracingSlot());
 }
 
@@ -148,6 +151,9 @@ void ConfigurationStructsFixture::ExpectLolaFieldInstanceDeploymentObjectsEqual(
     EXPECT_EQ(lhs.max_subscribers_, rhs.max_subscribers_);
     EXPECT_EQ(lhs.max_concurrent_allocations_, rhs.max_concurrent_allocations_);
     EXPECT_EQ(lhs.enforce_max_samples_, rhs.enforce_max_samples_);
+    EXPECT_EQ(lhs.slot_alignment_, rhs.slot_alignment_);
+    EXPECT_EQ(lhs.sample_arena_size_, rhs.sample_arena_size_);
+    EXPECT_EQ(lhs.receive_handler_thread_attributes_, rhs.receive_handler_thread_attributes_);
     EXPECT_EQ(lhs.GetNumberOfSampleSlotsExcludingTracingSlot(), rhs.GetNumberOfSampleSlotsExcludingTracingSlot());
 }
 
@@ -169,6 +175,8 @@ void ConfigurationStructsFixture::ExpectLolaServiceInstanceDeploymentObjectsEqua
 {
     EXPECT_EQ(lhs.instance_id_, rhs.instance_id_);
     EXPECT_EQ(lhs.shared_memory_size_, rhs.shared_memory_size_);
+    EXPECT_EQ(lhs.shm_huge_pages_, rhs.shm_huge_pages_);
+    EXPECT_EQ(lhs.shm_prefault_mode_, rhs.shm_prefault_mode_);
 
     ASSERT_EQ(lhs.events_.size(), rhs.events_.size());
     for (auto lhs_it : lhs.events_)
@@ -54,6 +54,11 @@ class CompareServiceElementIdentifierWithView
 class TracingConfiguration final
 {
   public:
+    using ServiceElementTracingEnabledMap =
+        std::map<tracing::ServiceElementIdentifier,
+                 std::unordered_set<InstanceSpecifier>,
+                 detail_tracing_configuration::CompareServiceElementIdentifierWithView>;
+
     TracingConfiguration() noexcept = default;
 
     /**
@@ -79,11 +84,13 @@ class TracingConfiguration final
     bool IsServiceElementTracingEnabled(tracing::ServiceElementIdentifierView service_element_identifier_view,
                                         amp::string_view instance_specifier_view) const noexcept;
 
+    const ServiceElementTracingEnabledMap& GetServiceElementTracingEnabledMap() const noexcept
+    {
+        return service_element_tracing_enabled_map_;
+    }
+
   private:
-    std::map<tracing::ServiceElementIdentifier,
-             std::unordered_set<InstanceSpecifier>,
-             detail_tracing_configuration::CompareServiceElementIdentifierWithView>
-        service_element_tracing_enabled_map_{};
+    ServiceElementTracingEnabledMap service_element_tracing_enabled_map_{};
     tracing::TracingConfig tracing_config_{};
 };
 
@@ -0,0 +1,49 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/dynamic_sample.h"
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+DynamicSample::DynamicSample() noexcept : data_{nullptr}, size_{0U} {}
+
+DynamicSample::DynamicSample(std::uint8_t* const data, const std::size_t size) noexcept : data_{data}, size_{size} {}
+
+amp::span<std::uint8_t> DynamicSample::GetData() noexcept
+{
+    return {data_.get(), size_};
+}
+
+amp::span<const std::uint8_t> DynamicSample::GetData() const noexcept
+{
+    return {data_.get(), size_};
+}
+
+std::size_t DynamicSample::GetSize() const noexcept
+{
+    return size_;
+}
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -0,0 +1,67 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_DYNAMIC_SAMPLE_H
+#define PLATFORM_AAS_MW_COM_IMPL_DYNAMIC_SAMPLE_H
+
+#include "platform/aas/lib/memory/shared/offset_ptr.h"
+
+#include <amp_span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+/// \brief Sample type of an event, whose samples have a dynamic length.
+///
+/// \details A DynamicSample doesn't contain the sample data itself. It refers to the bytes, which have been allocated
+/// for it from the sample arena of the event via SkeletonEvent::AllocateDynamic(). The reference is stored relative to
+/// the location of the DynamicSample. Since the sample slots and the sample arena are placed in the same shared memory,
+/// it stays valid in every process, independent of the address this shared memory is mapped to.
+class DynamicSample final
+{
+  public:
+    /// \brief Creates a sample without data.
+    DynamicSample() noexcept;
+
+    /// \brief Creates a sample referring to size bytes starting at data.
+    DynamicSample(std::uint8_t* const data, const std::size_t size) noexcept;
+
+    /// \brief Returns the sample data.
+    amp::span<std::uint8_t> GetData() noexcept;
+    amp::span<const std::uint8_t> GetData() const noexcept;
+
+    /// \brief Returns the size of the sample data in bytes.
+    std::size_t GetSize() const noexcept;
+
+  private:
+    memory::shared::OffsetPtr<std::uint8_t> data_;
+    std::size_t size_;
+};
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_DYNAMIC_SAMPLE_H
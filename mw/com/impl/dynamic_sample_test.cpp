@@ -0,0 +1,79 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/impl/dynamic_sample.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace
+{
+
+TEST(DynamicSampleTest, DefaultConstructedSampleHasNoData)
+{
+    // Given a default constructed sample
+    const DynamicSample unit{};
+
+    // Then it has no data
+    EXPECT_EQ(unit.GetSize(), 0U);
+    EXPECT_EQ(unit.GetData().size(), 0U);
+}
+
+TEST(DynamicSampleTest, ProvidesReferencedData)
+{
+    // Given a sample referring to some bytes
+    std::array<std::uint8_t, 4U> bytes{1U, 2U, 3U, 4U};
+    DynamicSample unit{bytes.data(), bytes.size()};
+
+    // When getting its data
+    const auto data = unit.GetData();
+
+    // Then exactly these bytes are provided
+    EXPECT_EQ(unit.GetSize(), bytes.size());
+    ASSERT_EQ(data.size(), bytes.size());
+    EXPECT_EQ(data.data(), bytes.data());
+}
+
+TEST(DynamicSampleTest, CopiedSampleRefersToSameData)
+{
+    // Given a sample referring to some bytes
+    std::array<std::uint8_t, 4U> bytes{1U, 2U, 3U, 4U};
+    const DynamicSample sample{bytes.data(), bytes.size()};
+
+    // When copying it to another location
+    const auto unit = std::make_unique<DynamicSample>(sample);
+
+    // Then the copy still refers to the same bytes
+    const auto data = static_cast<const DynamicSample&>(*unit).GetData();
+    EXPECT_EQ(data.data(), bytes.data());
+    EXPECT_EQ(data.size(), bytes.size());
+}
+
+}  // namespace
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
@@ -48,6 +48,35 @@ std::string ToStringImpl(const json::Object& serialized_json_object) noexcept
     return serialized_form;
 }
 
+void CombineHash(std::size_t& seed, const std::size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9U + (seed << 6U) + (seed >> 2U);
+}
+
+std::size_t GetInstanceIdHash(const ServiceInstanceDeployment::BindingInformation& binding_info) noexcept
+{
+    auto visitor = amp::overload(
+        [](const LolaServiceInstanceDeployment& deployment) -> std::size_t {
+            return deployment.instance_id_.has_value() ? (std::size_t{deployment.instance_id_->id_} + 1U) : 0U;
+        },
+        [](const SomeIpServiceInstanceDeployment& deployment) -> std::size_t {
+            return deployment.instance_id_.has_value() ? (std::size_t{deployment.instance_id_->id_} + 1U) : 0U;
+        },
+        [](const amp::blank&) -> std::size_t { return 0U; });
+    return amp::visit(visitor, binding_info);
+}
+
+/// \brief Hashes exactly the parts of the identifier, which operator==() compares, so that equal identifiers have the
+///        same hash.
+std::size_t CalculateHash(const ServiceInstanceDeployment& instance_deployment) noexcept
+{
+    std::size_t hash{std::hash<amp::string_view>{}(instance_deployment.service_.ToHashString())};
+    CombineHash(hash, static_cast<std::size_t>(instance_deployment.asilLevel_));
+    CombineHash(hash, static_cast<std::size_t>(instance_deployment.bindingInfo_.index()));
+    CombineHash(hash, GetInstanceIdHash(instance_deployment.bindingInfo_));
+    return hash;
+}
+
 }  // namespace
 
 Configuration* InstanceIdentifier::configuration_{nullptr};
@@ -73,7 +102,10 @@ bmw::Result<InstanceIdentifier> InstanceIdentifier::Create(amp::string_view seri
 }
 
 InstanceIdentifier::InstanceIdentifier(const json::Object& json_object, std::string serialized_string) noexcept
-    : instance_deployment_{nullptr}, type_deployment_{nullptr}, serialized_string_{std::move(serialized_string)}
+    : instance_deployment_{nullptr},
+      type_deployment_{nullptr},
+      serialized_string_{std::move(serialized_string)},
+      hash_{0U}
 {
     const auto serialization_version = GetValueFromJson<std::uint32_t>(json_object, kSerializationVersionKey);
     if (serialization_version != serializationVersion)
@@ -107,13 +139,15 @@ InstanceIdentifier::InstanceIdentifier(const json::Object& json_object, std::str
         std::terminate();
     }
     instance_deployment_ = service_instance_deployment_ptr;
+    hash_ = CalculateHash(*instance_deployment_);
 }
 
 InstanceIdentifier::InstanceIdentifier(const ServiceInstanceDeployment& deployment,
                                        const ServiceTypeDeployment& type_deployment) noexcept
     : instance_deployment_{&deployment},
       type_deployment_{&type_deployment},
-      serialized_string_{ToStringImpl(Serialize())}
+      serialized_string_{ToStringImpl(Serialize())},
+      hash_{CalculateHash(deployment)}
 {
 }
 
@@ -135,6 +169,11 @@ auto InstanceIdentifier::ToString() const noexcept -> amp::string_view
 
 auto operator==(const InstanceIdentifier& lhs, const InstanceIdentifier& rhs) noexcept -> bool
 {
+    // Identifiers of the same configured or deserialized instance share their deployment within the configuration.
+    if (lhs.instance_deployment_ == rhs.instance_deployment_)
+    {
+        return true;
+    }
     return (((lhs.instance_deployment_->service_ == rhs.instance_deployment_->service_) &&
              (*lhs.instance_deployment_ == *rhs.instance_deployment_)));
 }
@@ -196,5 +235,5 @@ auto InstanceIdentifierView::isCompatibleWith(const InstanceIdentifierView& rhs)
 auto std::hash<bmw::mw::com::impl::InstanceIdentifier>::operator()(
     const bmw::mw::com::impl::InstanceIdentifier& instance_identifier) const noexcept -> std::size_t
 {
-    return std::hash<amp::string_view>()(instance_identifier.ToString());
+    return bmw::mw::com::impl::InstanceIdentifierView{instance_identifier}.GetHash();
 }
@@ -25,6 +25,7 @@
 
 #include <amp_string_view.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <utility>
@@ -133,6 +134,14 @@ class InstanceIdentifier final
      */
     std::string serialized_string_;
 
+    /**
+     * @brief hash of the identity of this InstanceIdentifier instance
+     *
+     * Calculated once on construction from the service type, the quality type and the binding specific instance id,
+     * which are the parts operator==() compares. So hashing doesn't need to touch the serialized format.
+     */
+    std::size_t hash_;
+
     /**
      * @brief serialization format version.
      *
@@ -199,6 +208,7 @@ class InstanceIdentifierView final
     const ServiceTypeDeployment& GetServiceTypeDeployment() const;
     bool isCompatibleWith(const InstanceIdentifier&) const;
     bool isCompatibleWith(const InstanceIdentifierView&) const;
+    std::size_t GetHash() const noexcept { return identifier_.hash_; };
     constexpr static std::uint32_t GetSerializationVersion() { return InstanceIdentifier::serializationVersion; };
 
   private:
@@ -277,6 +277,44 @@ TEST_F(InstanceIdentifierFixture, HashInstanceIdentifierComparesEqual)
     EXPECT_EQ(hash_1, hash_2);
 }
 
+TEST_F(InstanceIdentifierFixture, HashOfDeserializedInstanceIdentifierComparesEqual)
+{
+    ConfigurationGuard configuration_guard{};
+
+    // Given an InstanceIdentifier
+    const ServiceInstanceDeployment deployment{
+        kService1, LolaServiceInstanceDeployment{LolaServiceInstanceId{1U}}, QualityType::kASIL_B, kInstanceSpecifier1};
+    const auto identifier = make_InstanceIdentifier(deployment, kTestTypeDeployment2);
+
+    // When creating a second InstanceIdentifier from its serialized form
+    const auto reconstructed_identifier_result = InstanceIdentifier::Create(identifier.ToString());
+    ASSERT_TRUE(reconstructed_identifier_result.has_value());
+
+    // Then both compare equal and have the same hash
+    const auto& reconstructed_identifier = reconstructed_identifier_result.value();
+    EXPECT_EQ(identifier, reconstructed_identifier);
+    EXPECT_EQ(std::hash<InstanceIdentifier>{}.operator()(identifier),
+              std::hash<InstanceIdentifier>{}.operator()(reconstructed_identifier));
+}
+
+TEST_F(InstanceIdentifierFixture, EqualInstanceIdentifiersWithDifferentInstanceSpecifiersHaveSameHash)
+{
+    // Given two deployments of the same service instance, which only differ in their instance specifier
+    const ServiceInstanceDeployment deployment_1{
+        kService1, kServiceInstanceDeployment1, QualityType::kASIL_QM, kInstanceSpecifier1};
+    const ServiceInstanceDeployment deployment_2{
+        kService1, kServiceInstanceDeployment1, QualityType::kASIL_QM, kInstanceSpecifier2};
+
+    // When creating an InstanceIdentifier from each of them
+    const auto identifier_1 = make_InstanceIdentifier(deployment_1, kTestTypeDeployment1);
+    const auto identifier_2 = make_InstanceIdentifier(deployment_2, kTestTypeDeployment1);
+
+    // Then both compare equal and have the same hash
+    EXPECT_EQ(identifier_1, identifier_2);
+    EXPECT_EQ(std::hash<InstanceIdentifier>{}.operator()(identifier_1),
+              std::hash<InstanceIdentifier>{}.operator()(identifier_2));
+}
+
 class InstanceIdentifierHashFixture : public ::testing::TestWithParam<std::array<InstanceIdentifier, 2>>
 {
 };
@@ -292,7 +330,7 @@ TEST_P(InstanceIdentifierHashFixture, HashesOfDifferentInstanceIdentifiersCompar
     EXPECT_NE(hash_1, hash_2);
 }
 
-// Test that each element that should be used in the hashing algorithm is used by changing them one at a time.
+// Test that each element compared by operator==() is used in the hashing algorithm by changing them one at a time.
 INSTANTIATE_TEST_SUITE_P(
     InstanceIdentifierHashDifferentKeys,
     InstanceIdentifierHashFixture,
@@ -328,29 +366,7 @@ INSTANTIATE_TEST_SUITE_P(
                                                                                             kServiceInstanceDeployment1,
                                                                                             QualityType::kASIL_B,
                                                                                             kInstanceSpecifier1},
-                                                                  kTestTypeDeployment1)},
-
-        std::array<InstanceIdentifier, 2>{make_InstanceIdentifier(ServiceInstanceDeployment{kService1,
-                                                                                            kServiceInstanceDeployment1,
-                                                                                            QualityType::kASIL_QM,
-                                                                                            kInstanceSpecifier1},
-                                                                  kTestTypeDeployment1),
-                                          make_InstanceIdentifier(ServiceInstanceDeployment{kService1,
-                                                                                            kServiceInstanceDeployment1,
-                                                                                            QualityType::kASIL_QM,
-                                                                                            kInstanceSpecifier2},
-                                                                  kTestTypeDeployment1)},
-
-        std::array<InstanceIdentifier, 2>{make_InstanceIdentifier(ServiceInstanceDeployment{kService1,
-                                                                                            kServiceInstanceDeployment1,
-                                                                                            QualityType::kASIL_QM,
-                                                                                            kInstanceSpecifier1},
-                                                                  kTestTypeDeployment1),
-                                          make_InstanceIdentifier(ServiceInstanceDeployment{kService1,
-                                                                                            kServiceInstanceDeployment1,
-                                                                                            QualityType::kASIL_QM,
-                                                                                            kInstanceSpecifier1},
-                                                                  kTestTypeDeployment2)}));
+                                                                  kTestTypeDeployment1)}));
 
 }  // namespace
 }  // namespace impl
@@ -82,7 +82,10 @@ auto SkeletonEventBindingFactoryImpl<SampleType>::Create(const InstanceIdentifie
                 event_name,
                 lola::SkeletonEventProperties{shm_depl.events_.at(event_name_string).GetNumberOfSampleSlots().value(),
                                               shm_depl.events_.at(event_name_string).max_subscribers_.value(),
-                                              shm_depl.events_.at(event_name_string).enforce_max_samples_.value()});
+                                              shm_depl.events_.at(event_name_string).enforce_max_samples_.value(),
+                                              shm_depl.events_.at(event_name_string).slot_status_layout_,
+                                              shm_depl.events_.at(event_name_string).slot_alignment_.value_or(1U),
+                                              shm_depl.events_.at(event_name_string).sample_arena_size_.value_or(0U)});
         },
         [](const SomeIpServiceInstanceDeployment&) -> std::unique_ptr<SkeletonEventBinding<SampleType>> {
             return nullptr; /* not yet implemented */
@@ -85,7 +85,9 @@ auto SkeletonFieldBindingFactoryImpl<SampleType>::CreateEventBinding(const Insta
                 field_name,
                 lola::SkeletonEventProperties{shm_depl.fields_.at(field_name_string).GetNumberOfSampleSlots().value(),
                                               shm_depl.fields_.at(field_name_string).max_subscribers_.value(),
-                                              shm_depl.fields_.at(field_name_string).enforce_max_samples_.value()});
+                                              shm_depl.fields_.at(field_name_string).enforce_max_samples_.value(),
+                                              shm_depl.fields_.at(field_name_string).slot_status_layout_,
+                                              shm_depl.fields_.at(field_name_string).slot_alignment_.value_or(1U)});
             
         },
         [](const SomeIpServiceInstanceDeployment&) -> std::unique_ptr<SkeletonEventBinding<SampleType>> {
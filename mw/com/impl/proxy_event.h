@@ -118,8 +118,24 @@ class ProxyEvent final : public ProxyEventBase
     template <typename F>
     Result<std::size_t> GetNewSamples(F&& receiver, std::size_t max_num_samples) noexcept;
 
+    /// \brief Receive pending data from the event as one batch.
+    ///
+    /// \details This is a proprietary extension to the official ara::com API. It provides the same samples as
+    ///          GetNewSamples(), but instead of calling a callable with a SamplePtr per sample, it returns a view,
+    ///          which yields const SampleType& for each sample. All samples of the batch are released together, when
+    ///          the batch is destroyed. Until then, they count against the max_sample_count of the subscription like
+    ///          SamplePtrs do. The LoLa binding supports only one batch per event at a time.
+    ///          For further details see //platform/aas/mw/com/design/extensions/README.md.
+    ///
+    /// \param max_num_samples Maximum number of samples in the batch.
+    /// \return Batch of new samples, which might be empty, or an error.
+    Result<SampleBatch<SampleType>> GetNewSamplesBatch(std::size_t max_num_samples) noexcept;
+
   private:
     ProxyEventBinding<SampleType>* GetTypedEventBinding() const noexcept;
+
+    /// \brief Returns a copy of the latest value. Only offered for fields, see ProxyField::GetLatestValue().
+    Result<SampleType> GetLatestValue() noexcept;
 };
 
 template <typename SampleType>
@@ -184,6 +200,44 @@ Result<std::size_t> ProxyEvent<SampleType>::GetNewSamples(F&& receiver, std::siz
     return get_new_samples_result;
 }
 
+template <typename SampleType>
+Result<SampleType> ProxyEvent<SampleType>::GetLatestValue() noexcept
+{
+    // Reading the latest value is a receive path like GetNewSamples(), so it shares its trace point.
+    tracing::TraceGetNewSamples(tracing_data_, *binding_base_);
+    return GetTypedEventBinding()->GetLatestValue();
+}
+
+template <typename SampleType>
+Result<SampleBatch<SampleType>> ProxyEvent<SampleType>::GetNewSamplesBatch(std::size_t max_num_samples) noexcept
+{
+    tracing::TraceGetNewSamples(tracing_data_, *binding_base_);
+
+    auto guard_factory{tracker_->Allocate(max_num_samples)};
+    if (guard_factory.GetNumAvailableGuards() == 0U)
+    {
+        bmw::mw::log::LogWarn("lola")
+            << "Unable to emit new samples, no free sample slots for this subscription available.";
+        return MakeUnexpected(ComErrc::kMaxSamplesReached);
+    }
+
+    // references, which are not taken by the batch, are returned on destruction of guard_factory.
+    auto get_new_samples_batch_result = GetTypedEventBinding()->GetNewSamplesBatch(guard_factory);
+    if (!get_new_samples_batch_result.has_value())
+    {
+        if ((get_new_samples_batch_result.error() == ComErrc::kNotSubscribed) ||
+            (get_new_samples_batch_result.error() == ComErrc::kMaxSamplesReached))
+        {
+            return get_new_samples_batch_result;
+        }
+        else
+        {
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+    }
+    return get_new_samples_batch_result;
+}
+
 template <typename SampleType>
 ProxyEventBinding<SampleType>* ProxyEvent<SampleType>::GetTypedEventBinding() const noexcept
 {
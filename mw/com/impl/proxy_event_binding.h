@@ -17,6 +17,7 @@
 
 #include "platform/aas/mw/com/impl/plumbing/sample_ptr.h"
 #include "platform/aas/mw/com/impl/proxy_event_binding_base.h"
+#include "platform/aas/mw/com/impl/sample_batch.h"
 #include "platform/aas/mw/com/impl/sample_reference_tracker.h"
 #include "platform/aas/mw/com/impl/tracing/i_tracing_runtime.h"
 
@@ -64,6 +65,22 @@ class ProxyEventBinding : public ProxyEventBindingBase
     /// \return Number of samples that were handed over to the callable.
     virtual Result<std::size_t> GetNewSamples(Callback&& receiver, TrackerGuardFactory& reference_tracker) noexcept = 0;
 
+    /// \brief Get a copy of the latest sample of the event.
+    ///
+    /// In contrast to GetNewSamples(), the sample is copied without referencing it. Bindings may therefore only support
+    /// this for trivially copyable sample types.
+    ///
+    /// \return Copy of the latest sample or an error, if there is none.
+    virtual Result<SampleType> GetLatestValue() const noexcept = 0;
+
+    /// \brief Get pending data from the event as one batch.
+    ///
+    /// Provides the same samples as GetNewSamples(), but without creating a SamplePtr per sample.
+    ///
+    /// \param reference_tracker Tracker, from which the batch takes one reference per sample.
+    /// \return Batch of new samples, which might be empty.
+    virtual Result<SampleBatch<SampleType>> GetNewSamplesBatch(TrackerGuardFactory& reference_tracker) noexcept = 0;
+
   protected:
     ProxyEventBinding() = default;
 
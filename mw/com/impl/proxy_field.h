@@ -24,6 +24,7 @@
 #include <amp_string_view.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace bmw
@@ -152,6 +153,28 @@ class ProxyField final
         return proxy_event_dispatch_.GetNewSamples(std::forward<F>(receiver), max_num_samples);
     }
 
+    /// \brief Receive pending data from the field as one batch. See ProxyEvent::GetNewSamplesBatch().
+    Result<SampleBatch<FieldType>> GetNewSamplesBatch(const std::size_t max_num_samples) noexcept
+    {
+        return proxy_event_dispatch_.GetNewSamplesBatch(max_num_samples);
+    }
+
+    /// \brief Returns a copy of the latest value of the field.
+    ///
+    /// \details This is a proprietary extension to the official ara::com API. In contrast to GetNewSamples(), the value
+    ///          is copied without referencing the underlying sample, i.e. without modifying any state, which is shared
+    ///          with the provider or other consumers. Therefore, it is only available for trivially copyable field
+    ///          types. The field has to be subscribed, but the call doesn't occupy any of the max_sample_count samples.
+    ///          For further details see //platform/aas/mw/com/design/extensions/README.md.
+    ///
+    /// \return Copy of the latest value or an error. kFieldValueIsNotValid is returned, if no value has been set yet.
+    Result<FieldType> GetLatestValue() noexcept
+    {
+        static_assert(std::is_trivially_copyable<FieldType>::value,
+                      "GetLatestValue is only supported for trivially copyable field types.");
+        return proxy_event_dispatch_.GetLatestValue();
+    }
+
     ResultBlank SetReceiveHandler(EventReceiveHandler handler) noexcept
     {
         return proxy_event_dispatch_.SetReceiveHandler(std::move(handler));
@@ -21,6 +21,9 @@
 
 #include "platform/aas/mw/com/impl/proxy_field.h"
 
+#include "platform/aas/mw/com/impl/bindings/mock_binding/proxy.h"
+#include "platform/aas/mw/com/impl/bindings/mock_binding/proxy_event.h"
+#include "platform/aas/mw/com/impl/com_error.h"
 #include "platform/aas/mw/com/impl/runtime.h"
 #include "platform/aas/mw/com/impl/runtime_mock.h"
 #include "platform/aas/mw/com/impl/test/binding_factory_resources.h"
@@ -28,7 +31,9 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace bmw
 {
@@ -45,6 +50,35 @@ using namespace ::testing;
 
 using TestSampleType = std::uint8_t;
 
+const ServiceTypeDeployment kEmptyTypeDeployment{amp::blank{}};
+const ServiceIdentifierType kFooservice{make_ServiceIdentifierType("foo")};
+const auto kInstanceSpecifier = InstanceSpecifier::Create("abc/abc/TirePressurePort").value();
+const ServiceInstanceDeployment kEmptyInstanceDeployment{kFooservice,
+                                                         LolaServiceInstanceDeployment{LolaServiceInstanceId{10U}},
+                                                         QualityType::kASIL_QM,
+                                                         kInstanceSpecifier};
+const auto kFieldName{"DummyField1"};
+
+class ProxyFieldLatestValueFixture : public ::testing::Test
+{
+  protected:
+    ProxyFieldLatestValueFixture()
+        : proxy_base_{std::make_unique<mock_binding::Proxy>(),
+                      make_HandleType(make_InstanceIdentifier(kEmptyInstanceDeployment, kEmptyTypeDeployment))},
+          mock_proxy_event_ptr_{std::make_unique<StrictMock<mock_binding::ProxyEvent<TestSampleType>>>()},
+          mock_proxy_event_{*mock_proxy_event_ptr_},
+          proxy_field_{proxy_base_,
+                       std::unique_ptr<ProxyEventBinding<TestSampleType>>{std::move(mock_proxy_event_ptr_)},
+                       kFieldName}
+    {
+    }
+
+    ProxyBase proxy_base_;
+    std::unique_ptr<StrictMock<mock_binding::ProxyEvent<TestSampleType>>> mock_proxy_event_ptr_;
+    StrictMock<mock_binding::ProxyEvent<TestSampleType>>& mock_proxy_event_;
+    ProxyField<TestSampleType> proxy_field_;
+};
+
 TEST(ProxyFieldTest, NotCopyable)
 {
     RecordProperty("Verifies", "7");
@@ -91,6 +125,46 @@ TEST(ProxyFieldTest, ProxyFieldContainsPublicFieldType)
                   "Incorrect FieldType.");
 }
 
+TEST_F(ProxyFieldLatestValueFixture, GetLatestValueReturnsValueOfBinding)
+{
+    RecordProperty("Verifies", "");
+    RecordProperty("Description", "GetLatestValue returns the latest value provided by the binding.");
+    RecordProperty("TestType", "Requirements-based test");
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const TestSampleType latest_value{42U};
+
+    // Given a field, of which the binding holds a latest value
+    EXPECT_CALL(mock_proxy_event_, GetLatestValue()).WillOnce(Return(Result<TestSampleType>{latest_value}));
+
+    // When getting the latest value
+    const auto result = proxy_field_.GetLatestValue();
+
+    // Then the value of the binding is returned
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), latest_value);
+}
+
+TEST_F(ProxyFieldLatestValueFixture, GetLatestValueForwardsErrorIfNoValueWasSet)
+{
+    RecordProperty("Verifies", "");
+    RecordProperty("Description", "GetLatestValue returns the error of the binding, if no value has been set yet.");
+    RecordProperty("TestType", "Requirements-based test");
+    RecordProperty("Priority", "1");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a field, of which the binding holds no value yet
+    EXPECT_CALL(mock_proxy_event_, GetLatestValue()).WillOnce(Return(MakeUnexpected(ComErrc::kFieldValueIsNotValid)));
+
+    // When getting the latest value
+    const auto result = proxy_field_.GetLatestValue();
+
+    // Then kFieldValueIsNotValid is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kFieldValueIsNotValid);
+}
+
 }  // namespace
 }  // namespace impl
 }  // namespace com
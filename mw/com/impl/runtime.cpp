@@ -15,6 +15,7 @@
 #include "platform/aas/mw/com/impl/runtime.h"
 
 #include "platform/aas/lib/memory/shared/memory_resource_registry.h"
+#include "platform/aas/mw/com/impl/configuration/binary_config.h"
 #include "platform/aas/mw/com/impl/configuration/config_parser.h"
 #include "platform/aas/mw/com/impl/instance_specifier.h"
 #include "platform/aas/mw/com/impl/plumbing/runtime_binding_factory.h"
@@ -34,6 +35,7 @@ namespace
 {
 constexpr auto default_manifest_path = "./etc/mw_com_config.json";
 constexpr auto ServiceInstanceManifestOption = "-service_instance_manifest";
+constexpr auto BinaryServiceInstanceManifestOption = "-binary_service_instance_manifest";
 
 inline void warn_double_init()
 {
@@ -135,6 +137,23 @@ void Runtime::Initialize(const std::string& buffer)
     StoreConfiguration(std::move(config));
 }
 
+void Runtime::Initialize(const amp::span<const std::uint8_t> binary_configuration)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (runtime_initialization_locked_)
+    {
+        error_double_init();
+        return;
+    }
+    if (initialization_config_.has_value())
+    {
+        warn_double_init();
+    }
+
+    auto config = configuration::ParseBinary(binary_configuration);
+    StoreConfiguration(std::move(config));
+}
+
 void Runtime::Initialize(const amp::span<const bmw::StringLiteral> arguments)
 {
     std::lock_guard<std::mutex> lock{mutex_};
@@ -151,10 +170,12 @@ void Runtime::Initialize(const amp::span<const bmw::StringLiteral> arguments)
 
     const auto num_args = arguments.size();
     bmw::StringLiteral manifestFilePath = nullptr;
+    bool isBinaryManifest{false};
     for (std::int32_t argNum = 0; argNum < num_args; argNum++)
     {
         const std::string inputServiceInstanceManifestOption{amp::at(arguments, argNum)};
-        if (inputServiceInstanceManifestOption == ServiceInstanceManifestOption)
+        isBinaryManifest = (inputServiceInstanceManifestOption == BinaryServiceInstanceManifestOption);
+        if ((inputServiceInstanceManifestOption == ServiceInstanceManifestOption) || isBinaryManifest)
         {
             if (argNum + 1 < num_args)
             {
@@ -164,6 +185,13 @@ void Runtime::Initialize(const amp::span<const bmw::StringLiteral> arguments)
         }
     }
 
+    if ((manifestFilePath != nullptr) && isBinaryManifest)
+    {
+        auto config = configuration::ParseBinary(amp::string_view{manifestFilePath});
+        StoreConfiguration(std::move(config));
+        return;
+    }
+
     if (manifestFilePath == nullptr)
     {
         manifestFilePath = default_manifest_path;
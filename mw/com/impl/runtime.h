@@ -29,6 +29,7 @@
 #include <amp_span.hpp>
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -72,6 +73,9 @@ class Runtime final : public IRuntime
 
     /// \brief static initializer for the runtime. Must be called once per process, which intends to use ara::com
     ///        functionality.
+    /// \details The configuration is parsed from the json file given with -service_instance_manifest. If a binary
+    ///          configuration image is given with -binary_service_instance_manifest instead, it is mapped and used
+    ///          without json parsing.
     /// \attention Multiple calls to one of the Initialize() overloads shall be avoided. They may have no effect after
     ///            once our Runtime singleton has been created via getInstance()/getInstanceInternal()
     /// \param args passed through command line args
@@ -82,6 +86,12 @@ class Runtime final : public IRuntime
     ///            once our Runtime singleton has been created via getInstance()/getInstanceInternal()
     static void Initialize(const std::string&);
 
+    /// \brief Initialize runtime from a binary configuration image (see configuration::SerializeBinary()), which
+    ///        bypasses any json parsing.
+    /// \attention Multiple calls to one of the Initialize() overloads shall be avoided. They may have no effect after
+    ///            once our Runtime singleton has been created via getInstance()/getInstanceInternal()
+    static void Initialize(const amp::span<const std::uint8_t> binary_configuration);
+
     /// \brief get singleton.
     /// \details Might return either reference to a real Runtime instance or to a mock.
     /// \return singleton ref.
@@ -0,0 +1,82 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/configuration/binary_config.h"
+#include "platform/aas/mw/com/impl/configuration/config_parser.h"
+#include "platform/aas/mw/com/impl/instance_specifier.h"
+#include "platform/aas/mw/com/impl/runtime.h"
+
+#include "platform/aas/lib/memory/string_literal.h"
+
+#include <amp_span.hpp>
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/// \attention There shall be only ONE test case per translation unit/unit test, which deals with the runtime Meyers
+///            singleton instance. The reason is the singleton behavior of impl::Runtime! Once the singleton (Meyer
+///            singleton) has been initialized with a certain config, it is fixed! Even if Runtime::Initialize is called
+///            again with a different config/json, the singleton returned by Runtime::getInstance() remains unchanged!
+///            And the Meyer singleton can't be removed/reset between tests!
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace
+{
+
+constexpr auto kBinaryManifestPath = "/tmp/runtime_single_exec_test_11_mw_com_config.bin";
+
+/// \brief TC verifies that the runtime can be initialized from a binary configuration image, which has been compiled
+/// from a json configuration.
+///
+/// \note we are re-using the existing //platform/aas/mw/com/impl/configuration:example/ara_com_config.json manifest
+///       in this test.
+TEST(RuntimeSingleProcessTest, initValidBinaryManifestPathReturnsWithValidInstanceSpecifier)
+{
+    // Given a binary configuration image compiled from a json configuration file
+    const auto image = configuration::SerializeBinary(
+        configuration::Parse("platform/aas/mw/com/impl/configuration/example/ara_com_config.json"));
+    {
+        std::ofstream image_file{kBinaryManifestPath, std::ios::binary | std::ios::trunc};
+        image_file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+        ASSERT_TRUE(image_file.good());
+    }
+    const auto instance_specifier_result = InstanceSpecifier::Create("abc/abc/TirePressurePort");
+    ASSERT_TRUE(instance_specifier_result.has_value());
+    bmw::StringLiteral test_args[] = {"dummyname", "-binary_service_instance_manifest", kBinaryManifestPath};
+    const amp::span<const bmw::StringLiteral> test_args_span{test_args};
+
+    // When initializing the runtime with the path of the image
+    Runtime::Initialize(test_args_span);
+    static_cast<void>(std::remove(kBinaryManifestPath));
+
+    // Then the instance specifier of the json configuration can be resolved
+    const auto identifiers = Runtime::getInstance().resolve(instance_specifier_result.value());
+    EXPECT_EQ(identifiers.size(), 1);
+}
+
+}  // namespace
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
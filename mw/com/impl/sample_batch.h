@@ -0,0 +1,175 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#ifndef PLATFORM_AAS_MW_COM_IMPL_SAMPLE_BATCH_H
+#define PLATFORM_AAS_MW_COM_IMPL_SAMPLE_BATCH_H
+
+#include "platform/aas/mw/com/impl/sample_reference_tracker.h"
+
+#include <amp_assert.hpp>
+#include <amp_optional.hpp>
+#include <amp_span.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+
+/// \brief Interface of a proxy event binding, which owns the samples handed out within a SampleBatch.
+class ISampleBatchOwner
+{
+  public:
+    ISampleBatchOwner() noexcept = default;
+    virtual ~ISampleBatchOwner() noexcept = default;
+
+    ISampleBatchOwner(const ISampleBatchOwner&) = delete;
+    ISampleBatchOwner& operator=(const ISampleBatchOwner&) & = delete;
+    ISampleBatchOwner(ISampleBatchOwner&&) noexcept = delete;
+    ISampleBatchOwner& operator=(ISampleBatchOwner&&) & noexcept = delete;
+
+    /// \brief Releases all samples of the batch, which is currently handed out.
+    virtual void ReleaseSampleBatch() noexcept = 0;
+};
+
+/// \brief Read-only view on all samples received by one call to ProxyEvent::GetNewSamplesBatch().
+///
+/// In contrast to GetNewSamples(), no SamplePtr is created per sample. Instead, the batch keeps one reference per
+/// sample and releases all of them together on destruction. The samples are provided in the same order as by
+/// GetNewSamples().
+///
+/// \pre A batch must be destroyed before the ProxyEvent it has been received from.
+///
+/// \tparam SampleType Data type of the samples
+template <typename SampleType>
+class SampleBatch final
+{
+  public:
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SampleType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const SampleType*;
+        using reference = const SampleType&;
+
+        explicit const_iterator(const SampleType* const* sample) noexcept : sample_{sample} {}
+
+        reference operator*() const noexcept { return **sample_; }
+        pointer operator->() const noexcept { return *sample_; }
+
+        const_iterator& operator++() noexcept
+        {
+            ++sample_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            const_iterator previous{*this};
+            ++sample_;
+            return previous;
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+        {
+            return lhs.sample_ == rhs.sample_;
+        }
+
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        const SampleType* const* sample_;
+    };
+
+    /// \brief Creates a batch.
+    /// \param samples Pointers to the samples. They have to stay valid until owner.ReleaseSampleBatch() is called.
+    /// \param reference_guards One reserved reference per sample, which is returned on destruction.
+    /// \param owner Binding, which owns the samples.
+    SampleBatch(const amp::span<const SampleType* const> samples,
+                TrackerGuardFactory reference_guards,
+                ISampleBatchOwner& owner) noexcept
+        : samples_{samples}, reference_guards_{std::move(reference_guards)}, owner_{&owner}
+    {
+        AMP_PRECONDITION_PRD_MESSAGE(
+            reference_guards_->GetNumAvailableGuards() == static_cast<std::size_t>(samples_.size()),
+            "A SampleBatch needs exactly one reference per sample.");
+    }
+
+    ~SampleBatch() noexcept { Release(); }
+
+    SampleBatch(const SampleBatch&) = delete;
+    SampleBatch& operator=(const SampleBatch&) & = delete;
+
+    SampleBatch(SampleBatch&& other) noexcept
+        : samples_{other.samples_}, reference_guards_{std::move(other.reference_guards_)}, owner_{other.owner_}
+    {
+        other.reference_guards_.reset();
+        other.owner_ = nullptr;
+        other.samples_ = {};
+    }
+
+    // The move assignment operator is deleted, as TrackerGuardFactory can't be assigned.
+    SampleBatch& operator=(SampleBatch&&) & noexcept = delete;
+
+    std::size_t size() const noexcept { return static_cast<std::size_t>(samples_.size()); }
+    bool empty() const noexcept { return samples_.size() == 0U; }
+
+    const_iterator begin() const noexcept { return const_iterator{samples_.data()}; }
+    const_iterator end() const noexcept
+    {
+        return const_iterator{std::next(samples_.data(), static_cast<std::ptrdiff_t>(samples_.size()))};
+    }
+
+    const SampleType& operator[](const std::size_t index) const noexcept
+    {
+        AMP_PRECONDITION_PRD_MESSAGE(index < size(), "Index out of range of SampleBatch.");
+        return **std::next(samples_.data(), static_cast<std::ptrdiff_t>(index));
+    }
+
+  private:
+    void Release() noexcept
+    {
+        if (owner_ != nullptr)
+        {
+            owner_->ReleaseSampleBatch();
+            owner_ = nullptr;
+        }
+        // returns all references of the batch to the SampleReferenceTracker at once
+        reference_guards_.reset();
+        samples_ = {};
+    }
+
+    amp::span<const SampleType* const> samples_;
+    amp::optional<TrackerGuardFactory> reference_guards_;
+    ISampleBatchOwner* owner_;
+};
+
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
+
+#endif  // PLATFORM_AAS_MW_COM_IMPL_SAMPLE_BATCH_H
@@ -0,0 +1,137 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include "platform/aas/mw/com/impl/sample_batch.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace impl
+{
+namespace
+{
+
+using TestSampleType = std::uint32_t;
+
+class SampleBatchOwnerMock : public ISampleBatchOwner
+{
+  public:
+    MOCK_METHOD(void, ReleaseSampleBatch, (), (noexcept, override));
+};
+
+class SampleBatchFixture : public ::testing::Test
+{
+  protected:
+    SampleBatch<TestSampleType> CreateBatch(const std::size_t num_samples)
+    {
+        return SampleBatch<TestSampleType>{amp::span<const TestSampleType* const>{sample_pointers_.data(), num_samples},
+                                           tracker_.Allocate(num_samples),
+                                           owner_};
+    }
+
+    std::array<TestSampleType, 3U> samples_{1U, 2U, 3U};
+    std::array<const TestSampleType*, 3U> sample_pointers_{&samples_[0U], &samples_[1U], &samples_[2U]};
+    SampleReferenceTracker tracker_{3U};
+    ::testing::StrictMock<SampleBatchOwnerMock> owner_{};
+};
+
+TEST_F(SampleBatchFixture, ProvidesAllSamplesInOrder)
+{
+    EXPECT_CALL(owner_, ReleaseSampleBatch());
+
+    // Given a batch of three samples
+    const auto unit = CreateBatch(3U);
+
+    // When iterating over the batch
+    std::vector<TestSampleType> iterated_samples{};
+    for (const auto& sample : unit)
+    {
+        iterated_samples.push_back(sample);
+    }
+
+    // Then all samples are provided in order
+    EXPECT_EQ(unit.size(), 3U);
+    EXPECT_FALSE(unit.empty());
+    EXPECT_THAT(iterated_samples, ::testing::ElementsAre(1U, 2U, 3U));
+    EXPECT_EQ(unit[2U], 3U);
+}
+
+TEST_F(SampleBatchFixture, EmptyBatchHasNoSamples)
+{
+    EXPECT_CALL(owner_, ReleaseSampleBatch());
+
+    // Given a batch without samples
+    const auto unit = CreateBatch(0U);
+
+    // Then it is empty
+    EXPECT_TRUE(unit.empty());
+    EXPECT_EQ(unit.begin(), unit.end());
+}
+
+TEST_F(SampleBatchFixture, DestructionReleasesAllSamplesAtOnce)
+{
+    {
+        // Given a batch of three samples
+        const auto unit = CreateBatch(3U);
+        EXPECT_EQ(tracker_.GetNumAvailableSamples(), 0U);
+
+        // Expecting that the owner is asked exactly once to release the samples
+        EXPECT_CALL(owner_, ReleaseSampleBatch());
+
+        // When the batch is destroyed
+    }
+
+    // Then all references are returned to the tracker
+    EXPECT_EQ(tracker_.GetNumAvailableSamples(), 3U);
+    EXPECT_FALSE(tracker_.IsUsed());
+}
+
+TEST_F(SampleBatchFixture, MovingTransfersOwnershipOfSamples)
+{
+    // Expecting that the samples are only released once
+    EXPECT_CALL(owner_, ReleaseSampleBatch());
+
+    // Given a batch of two samples
+    auto source = CreateBatch(2U);
+
+    // When moving the batch
+    const SampleBatch<TestSampleType> unit{std::move(source)};
+
+    // Then the new batch provides the samples
+    EXPECT_EQ(unit.size(), 2U);
+    EXPECT_EQ(unit[0U], 1U);
+
+    // and the moved-from batch is empty
+    EXPECT_TRUE(source.empty());
+
+    // and the references are still in use
+    EXPECT_EQ(tracker_.GetNumAvailableSamples(), 1U);
+}
+
+}  // namespace
+}  // namespace impl
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
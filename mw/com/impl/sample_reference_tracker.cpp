@@ -121,6 +121,13 @@ amp::optional<SampleReferenceGuard> TrackerGuardFactory::TakeGuard() noexcept
     }
 }
 
+TrackerGuardFactory TrackerGuardFactory::TakeGuards(const std::size_t num_guards) noexcept
+{
+    const auto num_taken_guards = std::min(num_guards, num_available_guards_);
+    num_available_guards_ -= num_taken_guards;
+    return makeTrakerGuardFactory(tracker_, num_taken_guards);
+}
+
 SampleReferenceTracker::SampleReferenceTracker(const std::size_t max_num_samples) noexcept
     : available_samples_{max_num_samples}, max_num_samples_{max_num_samples}
 {
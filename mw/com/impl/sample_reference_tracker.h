@@ -59,6 +59,13 @@ class TrackerGuardFactory final
     /// \return A guard managing a single reference, amp::nullopt otherwise.
     amp::optional<SampleReferenceGuard> TakeGuard() noexcept;
 
+    /// Moves up to num_guards of the reserved references into a new factory, e.g. to keep them for a whole batch of
+    /// samples. They are returned to the tracker together on destruction of the new factory.
+    ///
+    /// \param num_guards Number of references to move. Limited to GetNumAvailableGuards().
+    /// \return A factory holding the moved references.
+    TrackerGuardFactory TakeGuards(const std::size_t num_guards) noexcept;
+
   private:
     TrackerGuardFactory(SampleReferenceTracker& tracker, const std::size_t num_available_guards) noexcept;
 
@@ -158,6 +158,29 @@ TEST(SampleReferenceTrackerTest, MoveConstructTrackerFactory)
     EXPECT_EQ(tracker.GetNumAvailableSamples(), 3U);
 }
 
+TEST(SampleReferenceTrackerTest, TakeGuardsMovesReferencesIntoNewFactory)
+{
+    SampleReferenceTracker tracker{5U};
+
+    {
+        TrackerGuardFactory guard_factory = tracker.Allocate(4U);
+        EXPECT_EQ(tracker.GetNumAvailableSamples(), 1U);
+
+        TrackerGuardFactory batch_factory = guard_factory.TakeGuards(3U);
+        EXPECT_EQ(batch_factory.GetNumAvailableGuards(), 3U);
+        EXPECT_EQ(guard_factory.GetNumAvailableGuards(), 1U);
+        EXPECT_EQ(tracker.GetNumAvailableSamples(), 1U);
+
+        // taking more guards than available is limited to the available ones
+        TrackerGuardFactory rest_factory = guard_factory.TakeGuards(3U);
+        EXPECT_EQ(rest_factory.GetNumAvailableGuards(), 1U);
+        EXPECT_EQ(guard_factory.GetNumAvailableGuards(), 0U);
+    }
+
+    EXPECT_FALSE(tracker.IsUsed());
+    EXPECT_EQ(tracker.GetNumAvailableSamples(), 5U);
+}
+
 TEST(SampleReferenceTrackerTest, ConcurrentlyAcquireSamples)
 {
     constexpr static std::size_t NUM_WORKERS = 32U;
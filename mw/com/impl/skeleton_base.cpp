@@ -92,7 +92,12 @@ SkeletonBinding::SkeletonFieldBindings GetSkeletonFieldBindingsMap(const Skeleto
 SkeletonBase::SkeletonBase(std::unique_ptr<SkeletonBinding> skeleton_binding,
                            const InstanceIdentifier instance_id,
                            MethodCallProcessingMode)
-    : binding_{std::move(skeleton_binding)}, events_{}, fields_{}, instance_id_{instance_id}, service_offered_flag_{}
+    : binding_{std::move(skeleton_binding)},
+      events_{},
+      fields_{},
+      instance_id_{instance_id},
+      service_offered_flag_{},
+      service_offer_suspended_flag_{}
 {
 }
 
@@ -115,6 +120,12 @@ void SkeletonBase::Cleanup()
         binding_->PrepareStopOffer(std::move(tracing_handler));
         service_offered_flag_.Clear();
     }
+    else if (service_offer_suspended_flag_.IsSet())
+    {
+        // The shm-objects of a suspended offer have already been unregistered from tracing on suspension.
+        binding_->PrepareStopOffer(amp::nullopt);
+        service_offer_suspended_flag_.Clear();
+    }
 }
 
 SkeletonBase::SkeletonBase(SkeletonBase&& other) noexcept
@@ -122,7 +133,8 @@ SkeletonBase::SkeletonBase(SkeletonBase&& other) noexcept
       events_{std::move(other.events_)},
       fields_{std::move(other.fields_)},
       instance_id_{std::move(other.instance_id_)},
-      service_offered_flag_{std::move(other.service_offered_flag_)}
+      service_offered_flag_{std::move(other.service_offered_flag_)},
+      service_offer_suspended_flag_{std::move(other.service_offer_suspended_flag_)}
 {
     // Since the address of this skeleton has changed, we need update the address stored in each of the events and
     // fields belonging to the skeleton.
@@ -147,6 +159,7 @@ SkeletonBase& SkeletonBase::operator=(SkeletonBase&& other) noexcept
         fields_ = std::move(other.fields_);
         instance_id_ = std::move(other.instance_id_);
         service_offered_flag_ = std::move(other.service_offered_flag_);
+        service_offer_suspended_flag_ = std::move(other.service_offer_suspended_flag_);
 
         // Since the address of this skeleton has changed, we need update the address stored in each of the events and
         // fields belonging to the skeleton.
@@ -221,6 +234,8 @@ auto SkeletonBase::OfferService() noexcept -> ResultBlank
                                            << ": " << result.error().UserMessage();
             return MakeUnexpected(ComErrc::kBindingFailure);
         }
+        // A suspended offer has been resumed by PrepareOffer() and its resources are now owned by the new offer.
+        service_offer_suspended_flag_.Clear();
 
         const auto event_verification_result = OfferServiceEvents();
         if (!event_verification_result.has_value())
@@ -263,26 +278,68 @@ auto SkeletonBase::OfferService() noexcept -> ResultBlank
     return {};
 }
 
+auto SkeletonBase::StopOfferServiceElements() const noexcept -> void
+{
+    for (auto& event : events_)
+    {
+        event.second.get().PrepareStopOffer();
+    }
+    for (auto& field : fields_)
+    {
+        field.second.get().PrepareStopOffer();
+    }
+}
+
 auto SkeletonBase::StopOfferService() noexcept -> void
 {
     if (binding_ != nullptr && service_offered_flag_.IsSet())
     {
         StopOfferServiceInServiceDiscovery(instance_id_);
-
-        for (auto& event : events_)
-        {
-            event.second.get().PrepareStopOffer();
-        }
-        for (auto& field : fields_)
-        {
-            field.second.get().PrepareStopOffer();
-        }
+        StopOfferServiceElements();
 
         auto tracing_handler = tracing::CreateUnregisterShmObjectCallback(instance_id_, events_, fields_, *binding_);
         binding_->PrepareStopOffer(std::move(tracing_handler));
         service_offered_flag_.Clear();
         mw::log::LogInfo("lola") << "Service was stop offered successfully";
     }
+    else if (binding_ != nullptr && service_offer_suspended_flag_.IsSet())
+    {
+        // The service is not offered anymore. Only the resources kept by the binding have to be released.
+        binding_->PrepareStopOffer(amp::nullopt);
+        service_offer_suspended_flag_.Clear();
+        mw::log::LogInfo("lola") << "Suspended service offer was released successfully";
+    }
+}
+
+auto SkeletonBase::SuspendOfferService() noexcept -> void
+{
+    if (binding_ != nullptr && service_offered_flag_.IsSet())
+    {
+        StopOfferServiceInServiceDiscovery(instance_id_);
+        StopOfferServiceElements();
+
+        auto tracing_handler = tracing::CreateUnregisterShmObjectCallback(instance_id_, events_, fields_, *binding_);
+        binding_->PrepareSuspendOffer(std::move(tracing_handler));
+        service_offered_flag_.Clear();
+        service_offer_suspended_flag_.Set();
+        mw::log::LogInfo("lola") << "Service offer was suspended successfully";
+    }
+}
+
+auto SkeletonBase::SetEventNotificationCoalescing(const bool enabled) noexcept -> void
+{
+    if (binding_ != nullptr)
+    {
+        binding_->SetEventNotificationCoalescing(enabled);
+    }
+}
+
+auto SkeletonBase::FlushEventNotifications() noexcept -> void
+{
+    if (binding_ != nullptr)
+    {
+        binding_->FlushEventNotifications();
+    }
 }
 
 auto SkeletonBase::AreBindingsValid() const noexcept -> bool
@@ -98,6 +98,26 @@ class SkeletonBase
     /// \requirement 
     void StopOfferService() noexcept;
 
+    /// \brief Stops offering the respective service to other applications, but keeps the resources of the offer.
+    ///
+    /// \details For consumers, this is the same as StopOfferService(). But the binding keeps the resources it set up
+    /// for the offer (e.g. the shared memory of LoLa), so that a subsequent OfferService() can reuse them and completes
+    /// much faster. Consumers, which are still connected, can keep using them as well. The resources are released by
+    /// StopOfferService() or the destruction of the skeleton. Calling it, while the service is not offered, has no
+    /// effect.
+    void SuspendOfferService() noexcept;
+
+    /// \brief Enables/disables coalescing of the update notifications of all events/fields of this skeleton.
+    ///
+    /// \details A skeleton, which updates several events within one cycle, can enable coalescing and call
+    /// FlushEventNotifications() at the end of each cycle. Then the update notifications of all events sent within the
+    /// cycle are transmitted together to each interested consumer, instead of one notification per Send() call.
+    /// Disabling coalescing flushes the pending notifications.
+    void SetEventNotificationCoalescing(const bool enabled) noexcept;
+
+    /// \brief Sends out all update notifications, which have been collected since the last flush.
+    void FlushEventNotifications() noexcept;
+
   protected:
     bool AreBindingsValid() const noexcept;
 
@@ -114,8 +134,10 @@ class SkeletonBase
 
     [[nodiscard]] bmw::ResultBlank OfferServiceEvents() const noexcept;
     [[nodiscard]] bmw::ResultBlank OfferServiceFields() const noexcept;
+    void StopOfferServiceElements() const noexcept;
 
     FlagOwner service_offered_flag_;
+    FlagOwner service_offer_suspended_flag_;
 };
 
 class SkeletonBaseView
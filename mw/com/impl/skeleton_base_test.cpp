@@ -487,6 +487,123 @@ TEST_F(SkeletonBaseStopOfferFixture, StopOfferIsNotCalledIfServiceWasNotOffered)
     // Or when destroying the skeleton
 }
 
+using SkeletonBaseSuspendOfferFixture = SkeletonBaseFixture;
+TEST_F(SkeletonBaseSuspendOfferFixture, SuspendOfferServiceCallsPrepareSuspendOfferOnBinding)
+{
+    // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // and that the service is offered
+    ExpectOfferService();
+    EXPECT_CALL(*field_binding_mock_, Send(kInitialFieldValue, _));
+    skeleton_->dummy_field.Update(kInitialFieldValue);
+    ASSERT_TRUE(skeleton_->OfferService().has_value());
+
+    // Expecting that the service is stop offered in the service discovery and on each event and the field
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_));
+    EXPECT_CALL(*event_binding_mock_1_, PrepareStopOffer());
+    EXPECT_CALL(*event_binding_mock_2_, PrepareStopOffer());
+    EXPECT_CALL(*field_binding_mock_, PrepareStopOffer());
+
+    // and that PrepareSuspendOffer is called on the skeleton binding and PrepareStopOffer only afterwards, when the
+    // skeleton is destroyed
+    ::testing::Sequence sequence{};
+    EXPECT_CALL(*binding_mock_, PrepareSuspendOffer(_)).InSequence(sequence);
+    EXPECT_CALL(*binding_mock_, PrepareStopOffer(_)).InSequence(sequence);
+
+    // When suspending the offer
+    skeleton_->SuspendOfferService();
+}
+
+TEST_F(SkeletonBaseSuspendOfferFixture, OfferServiceAfterSuspendOfferServiceOffersTheServiceAgain)
+{
+    // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // Expecting that the service is offered twice
+    EXPECT_CALL(*binding_mock_, PrepareOffer(_, _, _)).Times(2);
+    EXPECT_CALL(*event_binding_mock_1_, PrepareOffer()).Times(2);
+    EXPECT_CALL(*event_binding_mock_2_, PrepareOffer()).Times(2);
+    EXPECT_CALL(*field_binding_mock_, PrepareOffer()).Times(2);
+    EXPECT_CALL(*binding_mock_, FinalizeOffer()).Times(2);
+    EXPECT_CALL(service_discovery_mock_, OfferService(_)).Times(2);
+    EXPECT_CALL(*field_binding_mock_, Send(kInitialFieldValue, _));
+
+    // and that the offer is suspended in between
+    EXPECT_CALL(*binding_mock_, PrepareSuspendOffer(_));
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_)).Times(2);
+    EXPECT_CALL(*event_binding_mock_1_, PrepareStopOffer()).Times(2);
+    EXPECT_CALL(*event_binding_mock_2_, PrepareStopOffer()).Times(2);
+    EXPECT_CALL(*field_binding_mock_, PrepareStopOffer()).Times(2);
+
+    // and that the skeleton binding is stopped only once with the tracing callback of the second offer
+    EXPECT_CALL(*binding_mock_, PrepareStopOffer(_));
+
+    // When offering the service
+    skeleton_->dummy_field.Update(kInitialFieldValue);
+    ASSERT_TRUE(skeleton_->OfferService().has_value());
+
+    // and suspending the offer
+    skeleton_->SuspendOfferService();
+
+    // and offering the service again
+    const auto offer_result = skeleton_->OfferService();
+
+    // Then no error is returned
+    ASSERT_TRUE(offer_result.has_value());
+
+    // When stop offering the service
+    skeleton_->StopOfferService();
+}
+
+TEST_F(SkeletonBaseSuspendOfferFixture, StopOfferServiceReleasesSuspendedOffer)
+{
+    // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // and that the service is offered
+    ExpectOfferService();
+    EXPECT_CALL(*field_binding_mock_, Send(kInitialFieldValue, _));
+    skeleton_->dummy_field.Update(kInitialFieldValue);
+    ASSERT_TRUE(skeleton_->OfferService().has_value());
+
+    // and that the offer is suspended
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_));
+    EXPECT_CALL(*event_binding_mock_1_, PrepareStopOffer());
+    EXPECT_CALL(*event_binding_mock_2_, PrepareStopOffer());
+    EXPECT_CALL(*field_binding_mock_, PrepareStopOffer());
+    EXPECT_CALL(*binding_mock_, PrepareSuspendOffer(_));
+    skeleton_->SuspendOfferService();
+
+    // Expecting that PrepareStopOffer is called once on the skeleton binding without UnregisterShmObjectTraceCallback
+    EXPECT_CALL(*binding_mock_, PrepareStopOffer(_))
+        .WillOnce([](amp::optional<SkeletonBinding::UnregisterShmObjectTraceCallback> unregister_shm_object_callback) {
+            EXPECT_FALSE(unregister_shm_object_callback.has_value());
+        });
+
+    // When stop offering the service
+    skeleton_->StopOfferService();
+
+    // Or when destroying the skeleton afterwards
+}
+
+using SkeletonBaseEventNotificationFixture = SkeletonBaseFixture;
+TEST_F(SkeletonBaseEventNotificationFixture, EventNotificationCoalescingIsForwardedToBinding)
+{
+    // Given a constructed Skeleton with a valid identifier
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // Expecting that enabling/disabling coalescing and flushing is forwarded to the binding
+    EXPECT_CALL(*binding_mock_, SetEventNotificationCoalescing(true));
+    EXPECT_CALL(*binding_mock_, FlushEventNotifications());
+    EXPECT_CALL(*binding_mock_, SetEventNotificationCoalescing(false));
+
+    // When enabling coalescing, flushing and disabling coalescing again
+    skeleton_->SetEventNotificationCoalescing(true);
+    skeleton_->FlushEventNotifications();
+    skeleton_->SetEventNotificationCoalescing(false);
+}
+
 using SkeletonBaseMoveFixture = SkeletonBaseFixture;
 TEST_F(SkeletonBaseMoveFixture, MovingConstructingSkeletonBaseDoesNotCallPrepareStopOffer)
 {
@@ -111,6 +111,24 @@ class SkeletonBinding
      */
     virtual void PrepareStopOffer(amp::optional<UnregisterShmObjectTraceCallback>) noexcept = 0;
 
+    /**
+     * \brief Like PrepareStopOffer(), but the binding keeps all resources of the offer (e.g. its shm-objects), so that
+     * a subsequent PrepareOffer() can reuse them instead of setting them up again. A suspended offer is either resumed
+     * by PrepareOffer() or released by PrepareStopOffer(), which is then called without unregister callback.
+     *
+     * \return void
+     */
+    virtual void PrepareSuspendOffer(amp::optional<UnregisterShmObjectTraceCallback>) noexcept = 0;
+
+    /// \brief Enables/disables coalescing of event update notifications.
+    /// \details If enabled, the update notifications of all events/fields of this skeleton, which are sent until the
+    ///          next call to FlushEventNotifications(), are collected and sent out together. Disabling it flushes the
+    ///          collected notifications.
+    virtual void SetEventNotificationCoalescing(const bool enabled) noexcept = 0;
+
+    /// \brief Sends out all event update notifications, which have been collected while coalescing was enabled.
+    virtual void FlushEventNotifications() noexcept = 0;
+
     /// \brief Gets the binding type of the binding
     virtual BindingType GetBindingType() const noexcept = 0;
 };
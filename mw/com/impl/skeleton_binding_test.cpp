@@ -39,6 +39,9 @@ class MySkeleton final : public SkeletonBinding
     }
     ResultBlank FinalizeOffer() noexcept override { return {}; }
     void PrepareStopOffer(amp::optional<UnregisterShmObjectTraceCallback>) noexcept override {}
+    void PrepareSuspendOffer(amp::optional<UnregisterShmObjectTraceCallback>) noexcept override {}
+    void SetEventNotificationCoalescing(const bool) noexcept override {}
+    void FlushEventNotifications() noexcept override {}
     BindingType GetBindingType() const noexcept override { return BindingType::kFake; };
 };
 
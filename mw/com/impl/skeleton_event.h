@@ -27,6 +27,7 @@
 #include "platform/aas/lib/result/result.h"
 #include "platform/aas/mw/log/logging.h"
 
+#include <amp_span.hpp>
 #include <amp_string_view.hpp>
 
 #include <memory>
@@ -104,6 +105,35 @@ class SkeletonEvent : public SkeletonEventBase
     /// implementations.
     Result<SampleAllocateePtr<EventType>> Allocate() noexcept;
 
+    /// \brief Allocates a DynamicSample, which refers to data_size bytes of sample data, for the user to fill it.
+    ///
+    /// \details This is a proprietary extension to the official ara::com API for events with EventType DynamicSample,
+    ///          whose samples vary in size. The LoLa binding allocates the sample data from the sample arena of the
+    ///          event, which has to be configured via "sampleArenaSize". For further details see
+    ///          //platform/aas/mw/com/design/extensions/README.md.
+    ///
+    /// \return On failure (e.g. no free range of data_size bytes in the sample arena), returns an error code.
+    Result<SampleAllocateePtr<EventType>> AllocateDynamic(const std::size_t data_size) noexcept;
+
+    /// \brief Allocates memory for an EventType in each element of the given span for the user to fill it.
+    ///
+    /// \details This is a proprietary extension to the official ara::com API for producers, which send several samples
+    ///          per cycle. Either all or no elements get allocated. The LoLa binding acquires all slots within one walk
+    ///          over its slots. For further details see //platform/aas/mw/com/design/extensions/README.md.
+    ///
+    /// \param samples Receives the allocated samples. Its size is the number of samples to allocate.
+    /// \return On failure, returns an error code.
+    ResultBlank AllocateBatch(amp::span<SampleAllocateePtr<EventType>> samples) noexcept;
+
+    /// \brief Sends all samples of the given span in their order.
+    ///
+    /// \details This is a proprietary extension to the official ara::com API. The samples have been allocated via
+    ///          AllocateBatch() or Allocate() and filled by the user. Consumers are notified only once for all of them.
+    ///          All elements of the span are empty afterwards.
+    ///
+    /// \return On failure, returns an error code.
+    ResultBlank SendBatch(amp::span<SampleAllocateePtr<EventType>> samples) noexcept;
+
   private:
     SkeletonEventBinding<EventType>* GetTypedEventBinding() const noexcept;
 };
@@ -226,6 +256,60 @@ Result<SampleAllocateePtr<SampleDataType>> SkeletonEvent<SampleDataType>::Alloca
     return allocate_result;
 }
 
+template <typename SampleDataType>
+Result<SampleAllocateePtr<SampleDataType>> SkeletonEvent<SampleDataType>::AllocateDynamic(
+    const std::size_t data_size) noexcept
+{
+    if (!service_offered_flag_.IsSet())
+    {
+        bmw::mw::log::LogError("lola") << "SkeletonEvent::AllocateDynamic failed as Event has not yet been offered";
+        return MakeUnexpected(ComErrc::kNotOffered);
+    }
+
+    auto allocate_result = GetTypedEventBinding()->AllocateDynamic(data_size);
+    if (!allocate_result.has_value())
+    {
+        bmw::mw::log::LogError("lola") << "SkeletonEvent::AllocateDynamic failed: "
+                                       << allocate_result.error().Message() << ": "
+                                       << allocate_result.error().UserMessage();
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+    return allocate_result;
+}
+
+template <typename SampleDataType>
+ResultBlank SkeletonEvent<SampleDataType>::AllocateBatch(amp::span<SampleAllocateePtr<EventType>> samples) noexcept
+{
+    if (!service_offered_flag_.IsSet())
+    {
+        bmw::mw::log::LogError("lola") << "SkeletonEvent::AllocateBatch failed as Event has not yet been offered";
+        return MakeUnexpected(ComErrc::kNotOffered);
+    }
+    const auto allocate_result = GetTypedEventBinding()->AllocateBatch(samples);
+    if (!allocate_result.has_value())
+    {
+        bmw::mw::log::LogError("lola") << "SkeletonEvent::AllocateBatch failed: " << allocate_result.error().Message()
+                                       << ": " << allocate_result.error().UserMessage();
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+    return allocate_result;
+}
+
+template <typename SampleDataType>
+ResultBlank SkeletonEvent<SampleDataType>::SendBatch(amp::span<SampleAllocateePtr<EventType>> samples) noexcept
+{
+    auto tracing_handler =
+        impl::tracing::CreateTracingSendWithAllocateCallback<SampleDataType>(tracing_data_, *binding_);
+    const auto send_result = GetTypedEventBinding()->SendBatch(samples, std::move(tracing_handler));
+    if (!send_result.has_value())
+    {
+        bmw::mw::log::LogError("lola") << "SkeletonEvent::SendBatch failed: " << send_result.error().Message()
+                                       << ": " << send_result.error().UserMessage();
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+    return send_result;
+}
+
 template <typename SampleDataType>
 SkeletonEventBinding<SampleDataType>* SkeletonEvent<SampleDataType>::GetTypedEventBinding() const noexcept
 {
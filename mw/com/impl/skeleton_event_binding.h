@@ -23,6 +23,7 @@
 
 #include <amp_callback.hpp>
 #include <amp_optional.hpp>
+#include <amp_span.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -69,6 +70,9 @@ class SkeletonEventBindingBase
     /// allocations)
     virtual std::size_t GetMaxSize() const noexcept = 0;
 
+    /// \brief Gets the alignment of the underlying event-type
+    virtual std::size_t GetMaxAlign() const noexcept = 0;
+
     /// \brief Gets the binding type of the binding
     virtual BindingType GetBindingType() const noexcept = 0;
 
@@ -97,7 +101,24 @@ class SkeletonEventBinding : public SkeletonEventBindingBase
     /// implementations.
     virtual Result<SampleAllocateePtr<SampleType>> Allocate() noexcept = 0;
 
+    /// \brief Allocates memory for a DynamicSample and data_size bytes of sample data it refers to.
+    /// \return On failure (e.g. SampleType is not DynamicSample or the binding has no memory for sample data), returns
+    /// an error code.
+    virtual Result<SampleAllocateePtr<SampleType>> AllocateDynamic(const std::size_t data_size) noexcept = 0;
+
+    /// \brief Allocates memory for a SampleType in each element of the given span for the user to fill it. Either all
+    /// or no elements get allocated.
+    /// \return On failure, returns an error code.
+    virtual ResultBlank AllocateBatch(amp::span<SampleAllocateePtr<SampleType>>) noexcept = 0;
+
+    /// \brief Sends all samples of the given span, which have been allocated via AllocateBatch() or Allocate(), in
+    /// their order. Consumers are notified once for all of them.
+    /// \return On failure, returns an error code.
+    virtual ResultBlank SendBatch(amp::span<SampleAllocateePtr<SampleType>>,
+                                  amp::optional<SendTraceCallback>) noexcept = 0;
+
     std::size_t GetMaxSize() const noexcept override { return sizeof(SampleType); }
+    std::size_t GetMaxAlign() const noexcept override { return alignof(SampleType); }
 };
 
 }  // namespace impl
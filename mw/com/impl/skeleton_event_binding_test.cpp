@@ -51,6 +51,16 @@ class MyEvent final : public SkeletonEventBinding<SampleType>
     {
         return MakeSampleAllocateePtr(std::make_unique<SampleType>());
     }
+    Result<SampleAllocateePtr<SampleType>> AllocateDynamic(const std::size_t) noexcept override
+    {
+        return MakeSampleAllocateePtr(std::make_unique<SampleType>());
+    }
+    ResultBlank AllocateBatch(amp::span<SampleAllocateePtr<SampleType>>) noexcept override { return {}; }
+    ResultBlank SendBatch(amp::span<SampleAllocateePtr<SampleType>>,
+                          amp::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>) noexcept override
+    {
+        return {};
+    }
     BindingType GetBindingType() const noexcept override { return BindingType::kFake; }
     void SetSkeletonEventTracingData(impl::tracing::SkeletonEventTracingData) noexcept override {}
 };
@@ -61,6 +71,12 @@ TEST(SkeletonEventBindingTest, CanGetMaxSizeOfLiteralType)
     EXPECT_EQ(unit.GetMaxSize(), 1);
 }
 
+TEST(SkeletonEventBindingTest, CanGetMaxAlignOfLiteralType)
+{
+    MyEvent<std::uint64_t> unit{};
+    EXPECT_EQ(unit.GetMaxAlign(), alignof(std::uint64_t));
+}
+
 TEST(SkeletonEventBindingTest, SkeletonEventBindingShouldNotBeCopyable)
 {
     static_assert(!std::is_copy_constructible<MyEvent<std::uint8_t>>::value, "Is wrongly copyable");
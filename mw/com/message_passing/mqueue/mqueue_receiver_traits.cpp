@@ -18,6 +18,8 @@
 
 #include <amp_utility.hpp>
 
+#include <ctime>
+
 namespace bmw
 {
 namespace mw
@@ -29,6 +31,7 @@ namespace message_passing
 
 // Only one thread,  () implicitly fulfilled for Mqueue implementation
 constexpr std::size_t MqueueReceiverTraits::kConcurrency;
+constexpr std::size_t MqueueReceiverTraits::kMaxDrainedMessages;
 
 amp::expected<MqueueReceiverTraits::file_descriptor_type, bmw::os::Error> MqueueReceiverTraits::open_receiver(
     const amp::string_view identifier,
@@ -84,6 +87,19 @@ void MqueueReceiverTraits::stop_receive(const MqueueReceiverTraits::file_descrip
     amp::ignore = os_resources.mqueue->mq_send(file_descriptor, &message, sizeof(MessageType), GetMessagePriority());
 }
 
+bool MqueueReceiverTraits::TryReceive(const MqueueReceiverTraits::file_descriptor_type file_descriptor,
+                                      RawMessageBuffer& buffer,
+                                      const FileDescriptorResourcesType& os_resources) noexcept
+{
+    // An absolute timeout in the past makes mq_timedreceive() return ETIMEDOUT right away for an empty queue, while
+    // the queue descriptor itself stays blocking for receive_next().
+    const timespec expired_timeout{0, 0};
+    std::uint32_t message_priority{0U};
+    const auto received = os_resources.mqueue->mq_timedreceive(
+        file_descriptor, buffer.begin(), buffer.size(), &message_priority, &expired_timeout);
+    return received.has_value();
+}
+
 bool MqueueReceiverTraits::IsOsResourcesValid(const FileDescriptorResourcesType& os_resources) noexcept
 {
     return ((os_resources.unistd != nullptr) && (os_resources.mqueue != nullptr)) && (os_resources.os_stat != nullptr);
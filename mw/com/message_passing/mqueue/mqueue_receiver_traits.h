@@ -29,6 +29,7 @@
 #include <amp_string_view.hpp>
 #include <amp_vector.hpp>
 
+#include <array>
 #include <cstdint>
 
 namespace bmw
@@ -44,6 +45,8 @@ class MqueueReceiverTraits
 {
   public:
     static constexpr std::size_t kConcurrency{1U};
+    /// \brief Upper bound of messages, which get drained from the queue without blocking after one blocking receive.
+    static constexpr std::size_t kMaxDrainedMessages{64U};
     using file_descriptor_type = mqd_t;
     // 
     static constexpr file_descriptor_type INVALID_FILE_DESCRIPTOR{-1};
@@ -81,6 +84,12 @@ class MqueueReceiverTraits
     static void stop_receive(const file_descriptor_type file_descriptor,
                              const FileDescriptorResourcesType& os_resources) noexcept;
 
+    /// \brief Waits for the next message. Afterwards all messages, which are already queued, are received as well (up
+    ///        to kMaxDrainedMessages), without blocking again. Only then the received messages get processed.
+    /// \details Draining the queue before the first processor is called ensures, that a batch only contains messages,
+    ///          which have been sent before any of them got processed. A message sent while a processor runs (e.g. a
+    ///          new event notification) therefore belongs to the next batch and can't be coalesced with an older one.
+    /// \return false, if a stop message has been received, true otherwise.
     template <typename ShortMessageProcessor, typename MediumMessageProcessor>
     static amp::expected<bool, bmw::os::Error> receive_next(const file_descriptor_type file_descriptor,
                                                             std::size_t thread,
@@ -94,42 +103,73 @@ class MqueueReceiverTraits
         amp::ignore = thread;  // Ignoring for now to avoid MISRA:FUNC:UNUSEDPAR.UNNAMED
 
         std::uint32_t message_priority{0U};
-        RawMessageBuffer buffer{};
-        const auto received =
-            os_resources.mqueue->mq_receive(file_descriptor, buffer.begin(), buffer.size(), &message_priority);
-        if (received.has_value())
+        std::array<RawMessageBuffer, kMaxDrainedMessages + 1U> buffers{};
+        auto& first_buffer = buffers.front();
+        const auto received = os_resources.mqueue->mq_receive(
+            file_descriptor, first_buffer.begin(), first_buffer.size(), &message_priority);
+        if (!received.has_value())
         {
-            switch (buffer.at(GetMessageTypePosition()))
+            return amp::make_unexpected(received.error());
+        }
+
+        // Under notification bursts further messages are already queued. Receiving them here saves the wake-up of a
+        // blocking receive per message and lets the caller see them as one batch.
+        std::size_t number_of_messages{1U};
+        while ((number_of_messages < buffers.size()) &&
+               TryReceive(file_descriptor, buffers.at(number_of_messages), os_resources))
+        {
+            ++number_of_messages;
+        }
+
+        for (std::size_t message_index{0U}; message_index < number_of_messages; ++message_index)
+        {
+            if (!ProcessMessage(buffers.at(message_index), fShort, fMedium))
             {
-                case static_cast<std::underlying_type_t<MessageType>>(MessageType::kStopMessage):
-                    return false;
-                // 
-                case static_cast<std::underlying_type_t<MessageType>>(MessageType::kShortMessage):
-                {
-                    const auto message = DeserializeToShortMessage(buffer);
-                    fShort(message);
-                    return true;
-                }
-                // 
-                case static_cast<std::underlying_type_t<MessageType>>(MessageType::kMediumMessage):
-                {
-                    const auto message = DeserializeToMediumMessage(buffer);
-                    fMedium(message);
-                    return true;
-                }
-                // 
-                default:
-                    // ignore request from a misbehaving client
-                    return true;
+                return false;
             }
         }
-        else
+        return true;
+    }
+
+  private:
+    /// \brief Calls the processor matching the type of the message in buffer.
+    /// \return false, if buffer contains a stop message, true otherwise.
+    template <typename ShortMessageProcessor, typename MediumMessageProcessor>
+    static bool ProcessMessage(const RawMessageBuffer& buffer,
+                               ShortMessageProcessor& fShort,
+                               MediumMessageProcessor& fMedium)
+    {
+        switch (buffer.at(GetMessageTypePosition()))
         {
-            return amp::make_unexpected(received.error());
+            case static_cast<std::underlying_type_t<MessageType>>(MessageType::kStopMessage):
+                return false;
+            // 
+            case static_cast<std::underlying_type_t<MessageType>>(MessageType::kShortMessage):
+            {
+                const auto message = DeserializeToShortMessage(buffer);
+                fShort(message);
+                return true;
+            }
+            // 
+            case static_cast<std::underlying_type_t<MessageType>>(MessageType::kMediumMessage):
+            {
+                const auto message = DeserializeToMediumMessage(buffer);
+                fMedium(message);
+                return true;
+            }
+            // 
+            default:
+                // ignore request from a misbehaving client
+                return true;
         }
     }
 
-  private:
+    /// \brief Receives the next message into buffer, if there is already one in the queue.
+    /// \return true, if a message has been received, false if the queue is empty or receiving failed.
+    static bool TryReceive(const file_descriptor_type file_descriptor,
+                           RawMessageBuffer& buffer,
+                           const FileDescriptorResourcesType& os_resources) noexcept;
+
     static bool IsOsResourcesValid(const FileDescriptorResourcesType& os_resources) noexcept;
 };
 
@@ -0,0 +1,216 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#include "platform/aas/mw/com/message_passing/mqueue/mqueue_receiver_traits.h"
+
+#include "platform/aas/mw/com/message_passing/serializer.h"
+
+#include "platform/aas/lib/os/mocklib/mqueue_mock.h"
+#include "platform/aas/lib/os/mocklib/stat_mock.h"
+#include "platform/aas/lib/os/mocklib/unistdmock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <deque>
+#include <vector>
+
+namespace bmw
+{
+namespace mw
+{
+namespace com
+{
+namespace message_passing
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+
+constexpr MqueueReceiverTraits::file_descriptor_type kFileDescriptor{42};
+constexpr MessageId kNotifyMessageId{0x42};
+constexpr pid_t kSenderPid{1233};
+
+/// \brief Emulates a message queue on top of the mqueue mock: mq_receive() takes the oldest queued message (the tests
+///        never call it on an empty queue) and mq_timedreceive() fails with ETIMEDOUT, if the queue is empty.
+class MqueueReceiverTraitsFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        auto* const memory_resource = amp::pmr::get_default_resource();
+        auto mqueue_mock = amp::pmr::make_unique<bmw::os::MqueueMock>(memory_resource);
+        mqueue_mock_ = mqueue_mock.get();
+        os_resources_.mqueue = std::move(mqueue_mock);
+        os_resources_.unistd = amp::pmr::make_unique<bmw::os::UnistdMock>(memory_resource);
+        os_resources_.os_stat = amp::pmr::make_unique<bmw::os::StatMock>(memory_resource);
+
+        ON_CALL(*mqueue_mock_, mq_receive(kFileDescriptor, _, _, _))
+            .WillByDefault(Invoke([this](const mqd_t, char* const buffer, const std::size_t, std::uint32_t* const) {
+                return PopMessage(buffer);
+            }));
+        ON_CALL(*mqueue_mock_, mq_timedreceive(kFileDescriptor, _, _, _, _))
+            .WillByDefault(Invoke(
+                [this](const mqd_t, char* const buffer, const std::size_t, std::uint32_t* const, const timespec* const)
+                    -> amp::expected<ssize_t, bmw::os::Error> {
+                    if (queued_messages_.empty())
+                    {
+                        return amp::make_unexpected(bmw::os::Error::createFromErrno(ETIMEDOUT));
+                    }
+                    return PopMessage(buffer);
+                }));
+        EXPECT_CALL(*mqueue_mock_, mq_receive(kFileDescriptor, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(*mqueue_mock_, mq_timedreceive(kFileDescriptor, _, _, _, _)).Times(AnyNumber());
+    }
+
+    void QueueNotification(const ShortMessagePayload payload)
+    {
+        ShortMessage message{};
+        message.id = kNotifyMessageId;
+        message.pid = kSenderPid;
+        message.payload = payload;
+        queued_messages_.push_back(SerializeToRawMessage(message));
+    }
+
+    void QueueStopMessage()
+    {
+        RawMessageBuffer buffer{};
+        buffer.at(GetMessageTypePosition()) =
+            static_cast<std::underlying_type_t<MessageType>>(MessageType::kStopMessage);
+        queued_messages_.push_back(buffer);
+    }
+
+    template <typename ShortMessageProcessor>
+    amp::expected<bool, bmw::os::Error> ReceiveNext(ShortMessageProcessor short_message_processor)
+    {
+        return MqueueReceiverTraits::receive_next(
+            kFileDescriptor, 0U, short_message_processor, [](const MediumMessage&) noexcept {}, os_resources_);
+    }
+
+    std::deque<RawMessageBuffer> queued_messages_{};
+    bmw::os::MqueueMock* mqueue_mock_{nullptr};
+    MqueueReceiverTraits::OsResources os_resources_{};
+
+  private:
+    amp::expected<ssize_t, bmw::os::Error> PopMessage(char* const buffer)
+    {
+        const auto message = queued_messages_.front();
+        queued_messages_.pop_front();
+        std::copy(message.cbegin(), message.cend(), buffer);
+        return static_cast<ssize_t>(message.size());
+    }
+};
+
+TEST_F(MqueueReceiverTraitsFixture, AllQueuedMessagesAreReceivedBeforeTheFirstOneIsProcessed)
+{
+    // Given three notifications in the queue
+    QueueNotification(0x1);
+    QueueNotification(0x2);
+    QueueNotification(0x3);
+
+    // When receiving the next messages
+    std::vector<ShortMessagePayload> processed_payloads{};
+    std::vector<std::size_t> queue_sizes_on_processing{};
+    const auto processor = [this, &processed_payloads, &queue_sizes_on_processing](const ShortMessage& message) {
+        processed_payloads.push_back(message.payload);
+        queue_sizes_on_processing.push_back(queued_messages_.size());
+    };
+    const auto result = ReceiveNext(processor);
+
+    // Then all notifications are processed in order within one call
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result.value());
+    EXPECT_THAT(processed_payloads, ::testing::ElementsAre(0x1, 0x2, 0x3));
+    // and the queue had already been drained, when the first one got processed
+    EXPECT_THAT(queue_sizes_on_processing, ::testing::Each(0U));
+}
+
+TEST_F(MqueueReceiverTraitsFixture, NotificationSentWhileProcessingIsReceivedByNextCall)
+{
+    // Given a notification in the queue
+    QueueNotification(0x1);
+
+    // and a processor, which sends an identical notification while processing the first one
+    std::vector<ShortMessagePayload> processed_payloads{};
+    const auto processor = [this, &processed_payloads](const ShortMessage& message) {
+        if (processed_payloads.empty())
+        {
+            QueueNotification(message.payload);
+        }
+        processed_payloads.push_back(message.payload);
+    };
+
+    // When receiving the next messages
+    const auto first_result = ReceiveNext(processor);
+
+    // Then only the first notification has been processed, so that it can't be coalesced with the second one
+    ASSERT_TRUE(first_result.has_value());
+    EXPECT_TRUE(first_result.value());
+    EXPECT_EQ(processed_payloads.size(), 1U);
+    EXPECT_EQ(queued_messages_.size(), 1U);
+
+    // and when receiving the next messages again
+    const auto second_result = ReceiveNext(processor);
+
+    // Then the notification sent while processing is delivered as well
+    ASSERT_TRUE(second_result.has_value());
+    EXPECT_TRUE(second_result.value());
+    EXPECT_EQ(processed_payloads.size(), 2U);
+    EXPECT_TRUE(queued_messages_.empty());
+}
+
+TEST_F(MqueueReceiverTraitsFixture, MessagesDrainedBeforeStopMessageAreProcessed)
+{
+    // Given a notification followed by a stop message in the queue
+    QueueNotification(0x1);
+    QueueStopMessage();
+
+    // When receiving the next messages
+    std::vector<ShortMessagePayload> processed_payloads{};
+    const auto result = ReceiveNext([&processed_payloads](const ShortMessage& message) {
+        processed_payloads.push_back(message.payload);
+    });
+
+    // Then the notification is processed and the stop is reported
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result.value());
+    EXPECT_THAT(processed_payloads, ::testing::ElementsAre(0x1));
+}
+
+TEST_F(MqueueReceiverTraitsFixture, BlockingReceiveErrorIsReturned)
+{
+    // Given that the blocking receive fails
+    EXPECT_CALL(*mqueue_mock_, mq_receive(kFileDescriptor, _, _, _))
+        .WillOnce(::testing::Return(amp::make_unexpected(bmw::os::Error::createFromErrno(EINTR))));
+
+    // When receiving the next messages
+    bool processor_called{false};
+    const auto result = ReceiveNext([&processor_called](const ShortMessage&) { processor_called = true; });
+
+    // Then the error is returned without draining or processing anything
+    EXPECT_FALSE(result.has_value());
+    EXPECT_FALSE(processor_called);
+}
+
+}  // namespace
+}  // namespace message_passing
+}  // namespace com
+}  // namespace mw
+}  // namespace bmw
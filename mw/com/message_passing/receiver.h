@@ -37,7 +37,9 @@
 #include <cstdint>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
+#include <iterator>
 #include <thread>
 #include <utility>
 
@@ -75,6 +77,10 @@ namespace message_passing
 ///         ChannelTraits::receive_next() breaks the wait and returns false.
 ///         If multiple ChannelTraits::receive_next() are running, the matching number of ChannelTraits::stop_receive()
 ///         shall be called to stop them all.
+///         ChannelTraits::receive_next() may process further messages, which are already queued, within the same call.
+///         It shall then receive all of them before calling the first handler, so that a message sent while a handler
+///         runs is not part of the current call. All messages processed within one call form a batch, within which
+///         duplicates of short messages listed in ReceiverConfig::coalesced_short_message_ids are dropped.
 template <typename ChannelTraits>
 class Receiver final : public IReceiver
 {
@@ -112,12 +118,23 @@ class Receiver final : public IReceiver
     amp::expected_blank<bmw::os::Error> StartListening() override;
 
   private:
+    /// \brief Max. number of distinct coalesced short messages remembered per batch. Further ones are not coalesced.
+    static constexpr std::size_t kMaxCoalescedMessagesPerBatch{16U};
+
+    /// \brief Coalesced short messages, which have already been processed within the current batch.
+    struct ProcessedShortMessages
+    {
+        std::array<ShortMessage, kMaxCoalescedMessagesPerBatch> messages{};
+        std::size_t count{0U};
+    };
+
     void RunListeningThread(amp::stop_token token,
                             const std::size_t thread,
                             const std::size_t max_threads) const noexcept;
     void MessageLoop(const std::size_t thread) const noexcept;
     void ExecuteMessageHandler(const ShortMessage) const noexcept;
     void ExecuteMessageHandler(const MediumMessage) const noexcept;
+    bool IsDuplicateInBatch(const ShortMessage& message, ProcessedShortMessages& processed_messages) const noexcept;
 
     concurrency::Executor& executor_;
     amp::pmr::unordered_map<MessageId, amp::variant<ShortMessageReceivedCallback, MediumMessageReceivedCallback>>
@@ -128,6 +145,7 @@ class Receiver final : public IReceiver
     amp::pmr::vector<uid_t> allowed_uids_;
     std::int32_t max_number_message_in_queue_;
     amp::optional<std::chrono::milliseconds> message_loop_delay_;
+    amp::pmr::vector<MessageId> coalesced_short_message_ids_;
     FDResourcesType fd_resources_;
 };
 
@@ -145,6 +163,9 @@ Receiver<ChannelTraits>::Receiver(const amp::string_view identifier,
       allowed_uids_{allowed_uids.cbegin(), allowed_uids.cend(), allocator},
       max_number_message_in_queue_{receiver_config.max_number_message_in_queue},
       message_loop_delay_{receiver_config.message_loop_delay},
+      coalesced_short_message_ids_{receiver_config.coalesced_short_message_ids.cbegin(),
+                                   receiver_config.coalesced_short_message_ids.cend(),
+                                   allocator},
       fd_resources_{ChannelTraits::GetDefaultOSResources(allocator.resource())}
 {
 }
@@ -248,10 +269,16 @@ void Receiver<ChannelTraits>::MessageLoop(const std::size_t thread) const noexce
 {
     while (true)
     {
+        ProcessedShortMessages processed_messages{};
         const auto received = ChannelTraits::receive_next(
             file_descriptor_,
             thread,
-            [this](const ShortMessage& message) noexcept { ExecuteMessageHandler(message); },
+            [this, &processed_messages](const ShortMessage& message) noexcept {
+                if (!IsDuplicateInBatch(message, processed_messages))
+                {
+                    ExecuteMessageHandler(message);
+                }
+            },
             [this](const MediumMessage& message) noexcept { ExecuteMessageHandler(message); },
             fd_resources_);
         if (received.has_value())
@@ -316,6 +343,31 @@ void Receiver<ChannelTraits>::ExecuteMessageHandler(const MediumMessage message)
     }
 }
 
+template <typename ChannelTraits>
+bool Receiver<ChannelTraits>::IsDuplicateInBatch(const ShortMessage& message,
+                                                 ProcessedShortMessages& processed_messages) const noexcept
+{
+    if (std::find(coalesced_short_message_ids_.cbegin(), coalesced_short_message_ids_.cend(), message.id) ==
+        coalesced_short_message_ids_.cend())
+    {
+        return false;
+    }
+
+    const auto processed_end = std::next(processed_messages.messages.cbegin(),
+                                         static_cast<std::ptrdiff_t>(processed_messages.count));
+    const auto is_duplicate =
+        std::any_of(processed_messages.messages.cbegin(), processed_end, [&message](const ShortMessage& processed) {
+            return (processed.id == message.id) && (processed.pid == message.pid) &&
+                   (processed.payload == message.payload);
+        });
+    if ((!is_duplicate) && (processed_messages.count < processed_messages.messages.size()))
+    {
+        processed_messages.messages.at(processed_messages.count) = message;
+        processed_messages.count++;
+    }
+    return is_duplicate;
+}
+
 }  // namespace message_passing
 }  // namespace com
 }  // namespace mw
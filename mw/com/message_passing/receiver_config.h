@@ -15,9 +15,12 @@
 #ifndef PLATFORM_AAS_MW_COM_MESSAGE_PASSING_RECEIVER_CONFIG_H
 #define PLATFORM_AAS_MW_COM_MESSAGE_PASSING_RECEIVER_CONFIG_H
 
+#include "platform/aas/mw/com/message_passing/message.h"
+
 #include <amp_optional.hpp>
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 namespace bmw
 {
@@ -36,6 +39,9 @@ struct ReceiverConfig
     std::int32_t max_number_message_in_queue = 10;
     /// \brief artificially throttles the receiver message loop to limit the processing rate of incoming messages
     amp::optional<std::chrono::milliseconds> message_loop_delay = amp::nullopt;
+    /// \brief ids of short messages, which are idempotent. If such a message is received several times with identical
+    ///        payload and sender within one batch of received messages, the callback is only called for the first one.
+    std::vector<MessageId> coalesced_short_message_ids{};
 };
 
 }  // namespace message_passing
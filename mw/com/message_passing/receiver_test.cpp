@@ -278,6 +278,98 @@ TEST_F(ReceiverFixture, ReceiveMessageWhileNoCallbackIsRegistered)
     EXPECT_CALL(mock_, stop_receive).Times(AnyNumber());
 }
 
+TEST_F(ReceiverFixture, DuplicateCoalescedShortMessagesWithinOneBatchAreProcessedOnce)
+{
+    // Given a unit, for which short messages with id 0x42 are configured to be coalesced
+    ReceiverConfig receiver_config{};
+    receiver_config.coalesced_short_message_ids = {0x42};
+    auto unit = ReceiverFactoryMock::Create(SOME_PATH, thread_pool_, amp::span<const uid_t>{}, receiver_config);
+
+    // ... and which has registered callbacks for the ids 0x42 and 0x43
+    std::atomic<std::uint32_t> coalesced_callback_count{0U};
+    std::atomic<std::uint32_t> other_callback_count{0U};
+    unit->Register(0x42,
+                   amp::callback<void(const ShortMessagePayload, const pid_t)>{
+                       [&coalesced_callback_count](const ShortMessagePayload, const pid_t) noexcept {
+                           coalesced_callback_count++;
+                       }});
+    unit->Register(0x43,
+                   amp::callback<void(const ShortMessagePayload, const pid_t)>{
+                       [&other_callback_count](const ShortMessagePayload, const pid_t) noexcept {
+                           other_callback_count++;
+                       }});
+    std::atomic_bool stop_received{false};
+
+    // Expect call to open_receiver on underlying receiver traits
+    EXPECT_CALL(mock_, open_receiver(_, _, _, _)).WillOnce(Return(VALID_FILE_DESCRIPTOR));
+    // Expect call to receive_next on underlying receiver traits, which:
+    //  - 1st will process a batch containing three identical messages with id 0x42, one message with id 0x42 but a
+    //        different payload and two identical messages with id 0x43
+    //  - 2nd will process a batch containing the same message with id 0x42 again
+    //  - 3rd will indicate that it has received a stop-request and won't wait for any further message
+    EXPECT_CALL(mock_, receive_next)
+        .WillOnce(
+            Invoke([](const file_descriptor_type /*file_descriptor*/,
+                      std::size_t /*thread*/,
+                      ShortMessageProcessor fShort,
+                      MediumMessageProcessor /*fMedium*/,
+                      const FileDescriptorResourcesType& /*os_resources*/) -> amp::expected<bool, bmw::os::Error> {
+                ShortMessage message{};
+                message.id = 0x42;
+                message.pid = 1233;
+                message.payload = 0x1;
+                fShort(message);
+                fShort(message);
+                fShort(message);
+                message.payload = 0x2;
+                fShort(message);
+                message.id = 0x43;
+                fShort(message);
+                fShort(message);
+                return true;
+            }))
+        .WillOnce(
+            Invoke([](const file_descriptor_type /*file_descriptor*/,
+                      std::size_t /*thread*/,
+                      ShortMessageProcessor fShort,
+                      MediumMessageProcessor /*fMedium*/,
+                      const FileDescriptorResourcesType& /*os_resources*/) -> amp::expected<bool, bmw::os::Error> {
+                ShortMessage message{};
+                message.id = 0x42;
+                message.pid = 1233;
+                message.payload = 0x1;
+                fShort(message);
+                return true;
+            }))
+        .WillOnce(Invoke([&stop_received](const file_descriptor_type,
+                                          std::size_t,
+                                          ShortMessageProcessor,
+                                          MediumMessageProcessor,
+                                          const FileDescriptorResourcesType&) -> amp::expected<bool, bmw::os::Error> {
+            stop_received = true;
+            return false;
+        }));
+
+    // When starting to listen on the unit
+    unit->StartListening();
+
+    // and waiting until all batches have been processed
+    while (stop_received == false)
+    {
+        std::this_thread::yield();
+    }
+
+    // Then the callback for the coalesced id was called once per distinct message and batch
+    EXPECT_EQ(coalesced_callback_count, 3U);
+    // and the callback for the other id was called for each message
+    EXPECT_EQ(other_callback_count, 2U);
+
+    // finally on destruction of our receiver/unit
+    // expect stop_receive and close_receiver being called on underlying receiver traits
+    EXPECT_CALL(mock_, close_receiver).Times(1);
+    EXPECT_CALL(mock_, stop_receive).Times(AnyNumber());
+}
+
 TEST_F(ReceiverFixture, ReceivedErrorFromChannelTraits)
 {
     // Given a valid unit prepared in SetUp()
@@ -0,0 +1,790 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+/// \file
+/// \brief End-to-end latency and throughput benchmark of mw::com over LoLa.
+///
+/// \details For each combination of the configured payload sizes, slot counts, ASIL levels, receive modes and event
+/// notification modes, the application forks the given number of producer and consumer processes. Each producer offers
+/// its own service instance and sends samples with an embedded send time. Each consumer subscribes to the events of all
+/// producers and records the latency between sending and receiving each sample. The controller (parent process)
+/// collects the results of all consumers from shared memory and prints throughput and latency distribution of each
+/// case. With receive handlers, the latency contains the notification up to the handler call, so the sweep over the
+/// notification modes compares message passing with the shared-memory wake-up counter.
+
+#include "platform/aas/mw/com/test/ipc_benchmark/ipc_benchmark_application.h"
+
+#include "platform/aas/mw/com/impl/bindings/lola/benchmark/latency_histogram.h"
+#include "platform/aas/mw/com/runtime.h"
+#include "platform/aas/mw/com/test/common_test_resources/assert_handler.h"
+#include "platform/aas/mw/com/test/common_test_resources/child_process_guard.h"
+#include "platform/aas/mw/com/test/common_test_resources/general_resources.h"
+
+#include <amp_optional.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/anonymous_shared_memory.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bmw::mw::com::test
+{
+namespace
+{
+
+using impl::lola::LatencyHistogram;
+
+/// \brief Number of producer service instances per ASIL level and slot count in mw_com_config.json.
+constexpr std::size_t kMaxProducers{4U};
+/// \brief maxSubscribers of the events in mw_com_config.json.
+constexpr std::size_t kMaxConsumers{8U};
+/// \brief Slot counts (maxSamples), for which mw_com_config.json contains service instances.
+constexpr std::array<std::size_t, 2U> kConfiguredSlotCounts{8U, 32U};
+constexpr std::array<std::size_t, 4U> kPayloadSizes{64U, 1024U, 16U * 1024U, 256U * 1024U};
+
+/// \brief Maximum time to offer, find and subscribe to the services and to finish the cases after sending.
+constexpr std::chrono::seconds kSetupTimeout{10};
+/// \brief Time, consumers keep receiving after all producers finished sending.
+constexpr std::chrono::milliseconds kDrainTime{100};
+
+enum class ReceiveMode : std::uint8_t
+{
+    kReceiveHandler,
+    kPolling,
+};
+
+/// \brief event-notification-mode of the consumers, which is selected by the mw_com_config.json they are started with.
+/// Only relevant for ReceiveMode::kReceiveHandler.
+enum class NotificationMode : std::uint8_t
+{
+    kMessagePassing,
+    kSharedMemory,
+};
+
+struct BenchmarkCase
+{
+    std::size_t payload_size;
+    std::size_t number_of_slots;
+    std::size_t number_of_producers;
+    std::size_t number_of_consumers;
+    std::string quality;
+    ReceiveMode receive_mode;
+    NotificationMode notification_mode;
+    std::uint64_t samples_per_producer;
+    std::chrono::microseconds send_interval;
+};
+
+struct ProducerResult
+{
+    std::uint64_t sent_samples{0U};
+    std::int64_t first_send_time_ns{std::numeric_limits<std::int64_t>::max()};
+    bool failed{true};
+};
+
+struct ConsumerResult
+{
+    LatencyHistogram latencies{};
+    std::uint64_t received_samples{0U};
+    std::int64_t last_receive_time_ns{0};
+    bool failed{true};
+};
+
+/// \brief State of one benchmark case, which is shared between the controller and all producers and consumers.
+/// \details Producers and consumers synchronize via the counters instead of a barrier, so that a failing or crashing
+/// process only leads to a timeout and not to a deadlock.
+struct SharedBenchmarkState
+{
+    std::atomic<std::uint32_t> offered_producers{0U};
+    std::atomic<std::uint32_t> ready_consumers{0U};
+    std::atomic<std::uint32_t> finished_producers{0U};
+    std::atomic<std::uint32_t> finished_consumers{0U};
+    std::array<ProducerResult, kMaxProducers> producers{};
+    std::array<ConsumerResult, kMaxConsumers> consumers{};
+};
+
+std::int64_t GetSteadyClockTimeNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool WaitForCount(const std::atomic<std::uint32_t>& counter,
+                  const std::size_t expected_count,
+                  const std::chrono::milliseconds timeout) noexcept
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (counter.load() < expected_count)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+std::chrono::milliseconds GetSendDuration(const BenchmarkCase& benchmark_case) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        benchmark_case.send_interval * static_cast<std::int64_t>(benchmark_case.samples_per_producer));
+}
+
+/// \brief Number of samples each consumer subscribes to, so that the subscriptions of all consumers fit into the slots.
+std::size_t GetMaxSamplesPerSubscription(const BenchmarkCase& benchmark_case) noexcept
+{
+    return std::max(std::size_t{1U}, (benchmark_case.number_of_slots - 1U) / benchmark_case.number_of_consumers);
+}
+
+amp::optional<InstanceSpecifier> CreateInstanceSpecifier(const BenchmarkCase& benchmark_case,
+                                                         const std::size_t producer_index) noexcept
+{
+    const std::string instance_specifier = "ipc_benchmark/" + benchmark_case.quality + "/slots_" +
+                                           std::to_string(benchmark_case.number_of_slots) + "/producer_" +
+                                           std::to_string(producer_index);
+    auto instance_specifier_result = InstanceSpecifier::Create(instance_specifier);
+    if (!instance_specifier_result.has_value())
+    {
+        std::cerr << "Invalid instance specifier " << instance_specifier << '\n';
+        return amp::nullopt;
+    }
+    return std::move(instance_specifier_result).value();
+}
+
+/// \brief Calls the callable with the payload size as std::integral_constant.
+template <typename Callable>
+void VisitPayloadSize(const std::size_t payload_size, Callable&& callable) noexcept
+{
+    switch (payload_size)
+    {
+        case kPayloadSizes[0U]:
+            callable(std::integral_constant<std::size_t, kPayloadSizes[0U]>{});
+            break;
+        case kPayloadSizes[1U]:
+            callable(std::integral_constant<std::size_t, kPayloadSizes[1U]>{});
+            break;
+        case kPayloadSizes[2U]:
+            callable(std::integral_constant<std::size_t, kPayloadSizes[2U]>{});
+            break;
+        case kPayloadSizes[3U]:
+            callable(std::integral_constant<std::size_t, kPayloadSizes[3U]>{});
+            break;
+        default:
+            std::cerr << "No event for payload size " << payload_size << '\n';
+            break;
+    }
+}
+
+template <std::size_t PayloadSize>
+void RunProducer(const BenchmarkCase& benchmark_case,
+                 const std::size_t producer_index,
+                 SharedBenchmarkState& state) noexcept
+{
+    auto& result = state.producers[producer_index];
+    const auto instance_specifier = CreateInstanceSpecifier(benchmark_case, producer_index);
+    if (!instance_specifier.has_value())
+    {
+        ++state.finished_producers;
+        return;
+    }
+    auto skeleton_result = BenchmarkSkeleton::Create(instance_specifier.value());
+    if (!skeleton_result.has_value())
+    {
+        std::cerr << "Producer " << producer_index << ": Unable to create skeleton: " << skeleton_result.error()
+                  << '\n';
+        ++state.finished_producers;
+        return;
+    }
+    auto& skeleton = skeleton_result.value();
+    const auto offer_result = skeleton.OfferService();
+    if (!offer_result.has_value())
+    {
+        std::cerr << "Producer " << producer_index << ": Unable to offer service: " << offer_result.error() << '\n';
+        ++state.finished_producers;
+        return;
+    }
+    ++state.offered_producers;
+
+    if (!WaitForCount(state.ready_consumers, benchmark_case.number_of_consumers, kSetupTimeout))
+    {
+        std::cerr << "Producer " << producer_index << ": Consumers didn't get ready in time\n";
+        ++state.finished_producers;
+        skeleton.StopOfferService();
+        return;
+    }
+
+    auto& event = GetBenchmarkEvent<PayloadSize>(skeleton);
+    auto next_send_time = std::chrono::steady_clock::now();
+    for (std::uint64_t sequence_number{0U}; sequence_number < benchmark_case.samples_per_producer; ++sequence_number)
+    {
+        if (benchmark_case.send_interval.count() > 0)
+        {
+            std::this_thread::sleep_until(next_send_time);
+            next_send_time += benchmark_case.send_interval;
+        }
+        auto sample_result = event.Allocate();
+        if (!sample_result.has_value())
+        {
+            continue;
+        }
+        auto sample = std::move(sample_result).value();
+        std::fill(sample->payload.begin(), sample->payload.end(), static_cast<std::uint8_t>(sequence_number));
+        sample->sequence_number = sequence_number;
+        sample->producer_index = static_cast<std::uint32_t>(producer_index);
+        sample->send_time_ns = GetSteadyClockTimeNs();
+        result.first_send_time_ns = std::min(result.first_send_time_ns, sample->send_time_ns);
+        if (event.Send(std::move(sample)).has_value())
+        {
+            ++result.sent_samples;
+        }
+    }
+    result.failed = false;
+    ++state.finished_producers;
+
+    // Keep the service offered until all consumers are done receiving.
+    static_cast<void>(WaitForCount(state.finished_consumers, benchmark_case.number_of_consumers, kSetupTimeout));
+    skeleton.StopOfferService();
+}
+
+/// \brief Records the latencies of all samples received by one consumer. Samples of different producers may be
+/// received in parallel in receive handlers, so recording is synchronized.
+class LatencyRecorder
+{
+  public:
+    template <std::size_t PayloadSize>
+    void Record(const BenchmarkSample<PayloadSize>& sample) noexcept
+    {
+        const auto receive_time_ns = GetSteadyClockTimeNs();
+        std::lock_guard<std::mutex> lock{mutex_};
+        result_.latencies.Record(std::chrono::nanoseconds{receive_time_ns - sample.send_time_ns});
+        ++result_.received_samples;
+        result_.last_receive_time_ns = std::max(result_.last_receive_time_ns, receive_time_ns);
+    }
+
+    ConsumerResult GetResult() noexcept
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return result_;
+    }
+
+  private:
+    std::mutex mutex_{};
+    ConsumerResult result_{};
+};
+
+amp::optional<BenchmarkProxy> FindAndCreateProxy(const BenchmarkCase& benchmark_case,
+                                                 const std::size_t producer_index) noexcept
+{
+    const auto instance_specifier = CreateInstanceSpecifier(benchmark_case, producer_index);
+    if (!instance_specifier.has_value())
+    {
+        return amp::nullopt;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + kSetupTimeout;
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        auto handles_result = BenchmarkProxy::FindService(instance_specifier.value());
+        if (handles_result.has_value() && (!handles_result.value().empty()))
+        {
+            auto proxy_result = BenchmarkProxy::Create(handles_result.value().front());
+            if (!proxy_result.has_value())
+            {
+                std::cerr << "Unable to create proxy: " << proxy_result.error() << '\n';
+                return amp::nullopt;
+            }
+            return std::move(proxy_result).value();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    std::cerr << "Producer " << producer_index << " not found in time\n";
+    return amp::nullopt;
+}
+
+template <std::size_t PayloadSize>
+bool ReceiveNewSamples(BenchmarkProxy& proxy, LatencyRecorder& recorder, const std::size_t max_samples) noexcept
+{
+    const auto result = GetBenchmarkEvent<PayloadSize>(proxy).GetNewSamples(
+        [&recorder](SamplePtr<BenchmarkSample<PayloadSize>> sample) noexcept {
+            recorder.Record(*sample);
+        },
+        max_samples);
+    return result.has_value();
+}
+
+template <std::size_t PayloadSize>
+bool SubscribeToAllProducers(const BenchmarkCase& benchmark_case,
+                             std::vector<BenchmarkProxy>& proxies,
+                             LatencyRecorder& recorder) noexcept
+{
+    const auto max_samples = GetMaxSamplesPerSubscription(benchmark_case);
+    for (std::size_t producer_index{0U}; producer_index < benchmark_case.number_of_producers; ++producer_index)
+    {
+        auto proxy = FindAndCreateProxy(benchmark_case, producer_index);
+        if (!proxy.has_value())
+        {
+            return false;
+        }
+        proxies.push_back(std::move(proxy).value());
+    }
+
+    for (auto& proxy : proxies)
+    {
+        auto& event = GetBenchmarkEvent<PayloadSize>(proxy);
+        if (benchmark_case.receive_mode == ReceiveMode::kReceiveHandler)
+        {
+            // proxies doesn't get resized anymore, so the reference to proxy stays valid.
+            const auto set_handler_result = event.SetReceiveHandler([&proxy, &recorder, max_samples]() noexcept {
+                static_cast<void>(ReceiveNewSamples<PayloadSize>(proxy, recorder, max_samples));
+            });
+            if (!set_handler_result.has_value())
+            {
+                std::cerr << "Unable to set receive handler: " << set_handler_result.error() << '\n';
+                return false;
+            }
+        }
+        const auto subscribe_result = event.Subscribe(max_samples);
+        if (!subscribe_result.has_value())
+        {
+            std::cerr << "Unable to subscribe: " << subscribe_result.error() << '\n';
+            return false;
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + kSetupTimeout;
+    for (auto& proxy : proxies)
+    {
+        while (GetBenchmarkEvent<PayloadSize>(proxy).GetSubscriptionState() != SubscriptionState::kSubscribed)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                std::cerr << "Subscription not accepted in time\n";
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+    return true;
+}
+
+template <std::size_t PayloadSize>
+void RunConsumer(const BenchmarkCase& benchmark_case,
+                 const std::size_t consumer_index,
+                 SharedBenchmarkState& state) noexcept
+{
+    const auto max_samples = GetMaxSamplesPerSubscription(benchmark_case);
+    LatencyRecorder recorder{};
+    std::vector<BenchmarkProxy> proxies{};
+    proxies.reserve(benchmark_case.number_of_producers);
+
+    if ((!WaitForCount(state.offered_producers, benchmark_case.number_of_producers, kSetupTimeout)) ||
+        (!SubscribeToAllProducers<PayloadSize>(benchmark_case, proxies, recorder)))
+    {
+        std::cerr << "Consumer " << consumer_index << ": Setup failed\n";
+        ++state.ready_consumers;
+        ++state.finished_consumers;
+        return;
+    }
+    ++state.ready_consumers;
+
+    const auto deadline = std::chrono::steady_clock::now() + GetSendDuration(benchmark_case) + kSetupTimeout;
+    bool receive_failed{false};
+    amp::optional<std::chrono::steady_clock::time_point> drain_end{};
+    while ((!drain_end.has_value()) || (std::chrono::steady_clock::now() < drain_end.value()))
+    {
+        if ((!drain_end.has_value()) && (state.finished_producers.load() >= benchmark_case.number_of_producers))
+        {
+            drain_end = std::chrono::steady_clock::now() + kDrainTime;
+        }
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            std::cerr << "Consumer " << consumer_index << ": Producers didn't finish in time\n";
+            receive_failed = true;
+            break;
+        }
+        if (benchmark_case.receive_mode == ReceiveMode::kPolling)
+        {
+            for (auto& proxy : proxies)
+            {
+                receive_failed = (!ReceiveNewSamples<PayloadSize>(proxy, recorder, max_samples)) || receive_failed;
+            }
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+
+    for (auto& proxy : proxies)
+    {
+        auto& event = GetBenchmarkEvent<PayloadSize>(proxy);
+        if (benchmark_case.receive_mode == ReceiveMode::kReceiveHandler)
+        {
+            static_cast<void>(event.UnsetReceiveHandler());
+        }
+        event.Unsubscribe();
+    }
+
+    state.consumers[consumer_index] = recorder.GetResult();
+    state.consumers[consumer_index].failed = receive_failed;
+    ++state.finished_consumers;
+}
+
+const char* GetNotificationModeString(const BenchmarkCase& benchmark_case) noexcept
+{
+    if (benchmark_case.receive_mode == ReceiveMode::kPolling)
+    {
+        return "-";
+    }
+    return (benchmark_case.notification_mode == NotificationMode::kSharedMemory) ? "shm" : "mp";
+}
+
+void PrintResultHeader() noexcept
+{
+    std::cout << std::setw(8) << "payload" << std::setw(7) << "slots" << std::setw(6) << "prod" << std::setw(6)
+              << "cons" << std::setw(8) << "asil" << std::setw(9) << "receive" << std::setw(8) << "notify"
+              << std::setw(10) << "sent"
+              << std::setw(10) << "received" << std::setw(8) << "lost" << std::setw(12) << "samples/s"
+              << std::setw(10) << "MB/s" << std::setw(10) << "p50[ns]" << std::setw(10) << "p99[ns]" << std::setw(11)
+              << "p99.9[ns]" << std::setw(11) << "max[ns]" << '\n';
+}
+
+void PrintResult(const BenchmarkCase& benchmark_case, const SharedBenchmarkState& state) noexcept
+{
+    std::uint64_t sent_samples{0U};
+    std::int64_t first_send_time_ns{std::numeric_limits<std::int64_t>::max()};
+    for (std::size_t producer_index{0U}; producer_index < benchmark_case.number_of_producers; ++producer_index)
+    {
+        sent_samples += state.producers[producer_index].sent_samples;
+        first_send_time_ns = std::min(first_send_time_ns, state.producers[producer_index].first_send_time_ns);
+    }
+
+    LatencyHistogram latencies{};
+    std::uint64_t received_samples{0U};
+    std::int64_t last_receive_time_ns{first_send_time_ns};
+    for (std::size_t consumer_index{0U}; consumer_index < benchmark_case.number_of_consumers; ++consumer_index)
+    {
+        const auto& consumer = state.consumers[consumer_index];
+        latencies.Merge(consumer.latencies);
+        received_samples += consumer.received_samples;
+        last_receive_time_ns = std::max(last_receive_time_ns, consumer.last_receive_time_ns);
+    }
+
+    // Each consumer receives the samples of all producers.
+    const auto expected_samples = sent_samples * benchmark_case.number_of_consumers;
+    const auto lost_samples = (expected_samples > received_samples) ? (expected_samples - received_samples) : 0U;
+    const auto duration_s = static_cast<double>(last_receive_time_ns - first_send_time_ns) / 1.0e9;
+    std::size_t sample_size{0U};
+    VisitPayloadSize(benchmark_case.payload_size, [&sample_size](auto payload_size) noexcept {
+        sample_size = sizeof(BenchmarkSample<decltype(payload_size)::value>);
+    });
+    const double samples_per_second = (duration_s > 0.0) ? (static_cast<double>(received_samples) / duration_s) : 0.0;
+    const double megabytes_per_second = (samples_per_second * static_cast<double>(sample_size)) / 1.0e6;
+
+    std::cout << std::setw(8) << benchmark_case.payload_size << std::setw(7) << benchmark_case.number_of_slots
+              << std::setw(6) << benchmark_case.number_of_producers << std::setw(6)
+              << benchmark_case.number_of_consumers << std::setw(8) << benchmark_case.quality << std::setw(9)
+              << ((benchmark_case.receive_mode == ReceiveMode::kReceiveHandler) ? "handler" : "polling")
+              << std::setw(8) << GetNotificationModeString(benchmark_case) << std::setw(10) << sent_samples
+              << std::setw(10) << received_samples << std::setw(8) << lost_samples << std::fixed << std::setprecision(0)
+              << std::setw(12) << samples_per_second << std::setprecision(1) << std::setw(10) << megabytes_per_second
+              << std::setw(10) << latencies.GetPercentile(50.0).count() << std::setw(10)
+              << latencies.GetPercentile(99.0).count() << std::setw(11) << latencies.GetPercentile(99.9).count()
+              << std::setw(11) << latencies.GetMax().count() << std::endl;
+}
+
+/// \brief Forks all producers and consumers of the case, waits for them and prints the result.
+/// \return true, if all producers and consumers succeeded.
+bool RunBenchmarkCase(const BenchmarkCase& benchmark_case,
+                      void* const shared_state_memory,
+                      const bool initialize_runtime,
+                      const std::string& shared_memory_notification_manifest,
+                      const int argc,
+                      const char** argv) noexcept
+{
+    auto* const state = new (shared_state_memory) SharedBenchmarkState{};
+
+    const auto run_child = [&benchmark_case, &shared_memory_notification_manifest, state, initialize_runtime, argc,
+                            argv](const bool is_producer, const std::size_t index) {
+        // Has to be done after forking as messaging permanently stores the pid as the node identifier.
+        if ((!is_producer) && (benchmark_case.receive_mode == ReceiveMode::kReceiveHandler) &&
+            (benchmark_case.notification_mode == NotificationMode::kSharedMemory))
+        {
+            // The notification mode only affects the consumer side, so producers keep the default configuration.
+            const char* shared_memory_notification_args[] = {
+                argv[0], "-service_instance_manifest", shared_memory_notification_manifest.c_str()};
+            runtime::InitializeRuntime(3, shared_memory_notification_args);
+        }
+        else if (initialize_runtime)
+        {
+            runtime::InitializeRuntime(argc, argv);
+        }
+        VisitPayloadSize(benchmark_case.payload_size, [&benchmark_case, state, is_producer, index](auto payload_size) {
+            if (is_producer)
+            {
+                RunProducer<decltype(payload_size)::value>(benchmark_case, index, *state);
+            }
+            else
+            {
+                RunConsumer<decltype(payload_size)::value>(benchmark_case, index, *state);
+            }
+        });
+    };
+
+    bool success{true};
+    std::vector<ChildProcessGuard> children{};
+    for (std::size_t producer_index{0U}; producer_index < benchmark_case.number_of_producers; ++producer_index)
+    {
+        auto child = ForkProcessAndRunInChildProcess("ipc_benchmark", "producer", [&run_child, producer_index]() {
+            run_child(true, producer_index);
+        });
+        if (!child.has_value())
+        {
+            success = false;
+            break;
+        }
+        children.push_back(child.value());
+    }
+    for (std::size_t consumer_index{0U}; success && (consumer_index < benchmark_case.number_of_consumers);
+         ++consumer_index)
+    {
+        auto child = ForkProcessAndRunInChildProcess("ipc_benchmark", "consumer", [&run_child, consumer_index]() {
+            run_child(false, consumer_index);
+        });
+        if (!child.has_value())
+        {
+            success = false;
+            break;
+        }
+        children.push_back(child.value());
+    }
+
+    const auto max_wait_time = GetSendDuration(benchmark_case) + (3 * kSetupTimeout);
+    for (auto& child : children)
+    {
+        if (!WaitForChildProcessToTerminate("ipc_benchmark", child, max_wait_time))
+        {
+            static_cast<void>(child.KillChildProcess());
+            success = false;
+        }
+    }
+
+    for (std::size_t producer_index{0U}; producer_index < benchmark_case.number_of_producers; ++producer_index)
+    {
+        success = (!state->producers[producer_index].failed) && success;
+    }
+    for (std::size_t consumer_index{0U}; consumer_index < benchmark_case.number_of_consumers; ++consumer_index)
+    {
+        success = (!state->consumers[consumer_index].failed) && success;
+    }
+    if (success)
+    {
+        PrintResult(benchmark_case, *state);
+    }
+    else
+    {
+        std::cerr << "Benchmark case with payload size " << benchmark_case.payload_size << ", "
+                  << benchmark_case.number_of_slots << " slots, " << benchmark_case.number_of_producers
+                  << " producers, " << benchmark_case.number_of_consumers << " consumers, ASIL level "
+                  << benchmark_case.quality << " and notification mode " << GetNotificationModeString(benchmark_case)
+                  << " failed\n";
+    }
+    state->~SharedBenchmarkState();
+    return success;
+}
+
+template <typename T, std::size_t N>
+bool IsOneOf(const T& value, const std::array<T, N>& allowed_values) noexcept
+{
+    return std::find(allowed_values.begin(), allowed_values.end(), value) != allowed_values.end();
+}
+
+}  // namespace
+}  // namespace bmw::mw::com::test
+
+int main(int argc, const char** argv)
+{
+    namespace po = boost::program_options;
+    namespace fs = boost::filesystem;
+    namespace ipc = boost::interprocess;
+    using namespace bmw::mw::com::test;
+
+    SetupAssertHandler();
+
+    // HAXX: Create symlink for logging.json so that it appears in the cwd
+    const fs::path logging_json_target_path{fs::current_path() / "logging.json"};
+    if (!fs::exists(logging_json_target_path))
+    {
+        const fs::path logging_json_source_path{fs::current_path() / "platform" / "aas" / "mw" / "com" / "test" /
+                                                "ipc_benchmark" / "logging.json"};
+        fs::create_symlink(logging_json_source_path, logging_json_target_path);
+    }
+
+    std::vector<std::size_t> payload_sizes;
+    std::vector<std::size_t> slot_counts;
+    std::vector<std::size_t> producer_counts;
+    std::vector<std::size_t> consumer_counts;
+    std::vector<std::string> qualities;
+    std::vector<std::string> receive_modes;
+    std::vector<std::string> notification_modes;
+    std::string shared_memory_notification_manifest;
+    std::uint64_t samples_per_producer;
+    std::int64_t send_interval_us;
+
+    po::options_description options;
+    // clang-format off
+    options.add_options()
+        ("help", "Display the help message")
+        ("service_instance_manifest", po::value<std::string>(), "Path to the com configuration file")
+        ("payload-sizes", po::value<std::vector<std::size_t>>(&payload_sizes)->multitoken()->default_value({64U, 1024U, 16384U, 262144U}, "64 1024 16384 262144"), "Payload sizes in bytes (64, 1024, 16384 or 262144)")
+        ("slots", po::value<std::vector<std::size_t>>(&slot_counts)->multitoken()->default_value({8U, 32U}, "8 32"), "Slot counts (maxSamples) of the events (8 or 32)")
+        ("producers", po::value<std::vector<std::size_t>>(&producer_counts)->multitoken()->default_value({1U}, "1"), "Numbers of producer processes (1 to 4)")
+        ("consumers", po::value<std::vector<std::size_t>>(&consumer_counts)->multitoken()->default_value({1U}, "1"), "Numbers of consumer processes (1 to 8)")
+        ("asil-levels", po::value<std::vector<std::string>>(&qualities)->multitoken()->default_value({"qm", "asil_b"}, "qm asil_b"), "ASIL levels of the service instances (qm or asil_b)")
+        ("receive-modes", po::value<std::vector<std::string>>(&receive_modes)->multitoken()->default_value({"handler", "polling"}, "handler polling"), "How consumers wait for samples (handler or polling)")
+        ("notification-modes", po::value<std::vector<std::string>>(&notification_modes)->multitoken()->default_value({"message_passing", "shared_memory"}, "message_passing shared_memory"), "How receive handlers of consumers get notified (message_passing or shared_memory)")
+        ("shared_memory_notification_manifest", po::value<std::string>(&shared_memory_notification_manifest), "Path to the com configuration file of consumers with shared_memory notification, default: mw_com_config_shared_memory.json next to service_instance_manifest")
+        ("samples-per-producer", po::value<std::uint64_t>(&samples_per_producer)->default_value(10000U), "Number of samples each producer sends per case")
+        ("send-interval-us", po::value<std::int64_t>(&send_interval_us)->default_value(100), "Interval between two samples of a producer in us, 0 sends as fast as possible");
+    // clang-format on
+    po::variables_map args;
+    const auto parsed_args =
+        po::command_line_parser{argc, argv}
+            .options(options)
+            .style(po::command_line_style::unix_style | po::command_line_style::allow_long_disguise)
+            .run();
+    po::store(parsed_args, args);
+
+    if (args.count("help") > 0U)
+    {
+        std::cerr << options << std::endl;
+        return EXIT_FAILURE;
+    }
+    po::notify(args);
+
+    const bool valid_arguments =
+        std::all_of(payload_sizes.begin(),
+                    payload_sizes.end(),
+                    [](const std::size_t size) { return IsOneOf(size, kPayloadSizes); }) &&
+        std::all_of(slot_counts.begin(),
+                    slot_counts.end(),
+                    [](const std::size_t slots) { return IsOneOf(slots, kConfiguredSlotCounts); }) &&
+        std::all_of(producer_counts.begin(),
+                    producer_counts.end(),
+                    [](const std::size_t count) { return (count > 0U) && (count <= kMaxProducers); }) &&
+        std::all_of(consumer_counts.begin(),
+                    consumer_counts.end(),
+                    [](const std::size_t count) { return (count > 0U) && (count <= kMaxConsumers); }) &&
+        std::all_of(qualities.begin(),
+                    qualities.end(),
+                    [](const std::string& quality) { return (quality == "qm") || (quality == "asil_b"); }) &&
+        std::all_of(receive_modes.begin(),
+                    receive_modes.end(),
+                    [](const std::string& mode) { return (mode == "handler") || (mode == "polling"); }) &&
+        std::all_of(notification_modes.begin(),
+                    notification_modes.end(),
+                    [](const std::string& mode) { return (mode == "message_passing") || (mode == "shared_memory"); }) &&
+        (send_interval_us >= 0);
+    if (!valid_arguments)
+    {
+        std::cerr << "Invalid arguments, the service instances in mw_com_config.json only support:\n"
+                  << options << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    ipc::mapped_region shared_state_memory{ipc::anonymous_shared_memory(sizeof(SharedBenchmarkState))};
+    const bool initialize_runtime = args.count("service_instance_manifest") > 0U;
+    if (shared_memory_notification_manifest.empty() && initialize_runtime)
+    {
+        shared_memory_notification_manifest =
+            (fs::path{args["service_instance_manifest"].as<std::string>()}.parent_path() /
+             "mw_com_config_shared_memory.json")
+                .string();
+    }
+    const bool shared_memory_notification_requested =
+        std::find(notification_modes.begin(), notification_modes.end(), "shared_memory") != notification_modes.end();
+    if (shared_memory_notification_requested && shared_memory_notification_manifest.empty())
+    {
+        std::cerr << "Notification mode shared_memory requires service_instance_manifest or "
+                     "shared_memory_notification_manifest"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    bool success{true};
+    PrintResultHeader();
+    for (const auto payload_size : payload_sizes)
+    {
+        for (const auto number_of_slots : slot_counts)
+        {
+            for (const auto number_of_producers : producer_counts)
+            {
+                for (const auto number_of_consumers : consumer_counts)
+                {
+                    for (const auto& quality : qualities)
+                    {
+                        for (const auto& receive_mode : receive_modes)
+                        {
+                            for (const auto& notification_mode : notification_modes)
+                            {
+                                const bool polling = receive_mode == "polling";
+                                // Polling consumers don't get notified, so they are only run once.
+                                if (polling && (notification_mode != notification_modes.front()))
+                                {
+                                    continue;
+                                }
+                                const BenchmarkCase benchmark_case{
+                                    payload_size,
+                                    number_of_slots,
+                                    number_of_producers,
+                                    number_of_consumers,
+                                    quality,
+                                    polling ? ReceiveMode::kPolling : ReceiveMode::kReceiveHandler,
+                                    (notification_mode == "shared_memory") ? NotificationMode::kSharedMemory
+                                                                           : NotificationMode::kMessagePassing,
+                                    samples_per_producer,
+                                    std::chrono::microseconds{send_interval_us}};
+                                success = RunBenchmarkCase(benchmark_case,
+                                                           shared_state_memory.get_address(),
+                                                           initialize_runtime,
+                                                           shared_memory_notification_manifest,
+                                                           argc,
+                                                           argv) &&
+                                          success;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
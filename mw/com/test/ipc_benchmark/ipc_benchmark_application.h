@@ -0,0 +1,81 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+
+#ifndef PLATFORM_AAS_MW_COM_TEST_IPC_BENCHMARK_IPC_BENCHMARK_APPLICATION_H
+#define PLATFORM_AAS_MW_COM_TEST_IPC_BENCHMARK_IPC_BENCHMARK_APPLICATION_H
+
+#include "platform/aas/mw/com/types.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bmw::mw::com::test
+{
+
+/// \brief Sample type of the benchmark, which carries its send time, so that consumers can calculate the latency.
+/// \tparam PayloadSize number of payload bytes in addition to the header.
+template <std::size_t PayloadSize>
+struct BenchmarkSample
+{
+    /// \brief steady clock time directly before sending in ns. The steady clock is system-wide, so it can be compared
+    ///        with the receive time in another process.
+    std::int64_t send_time_ns;
+    std::uint64_t sequence_number;
+    std::uint32_t producer_index;
+    std::array<std::uint8_t, PayloadSize> payload;
+};
+
+template <typename Trait>
+class BenchmarkInterface : public Trait::Base
+{
+  public:
+    using Trait::Base::Base;
+
+    typename Trait::template Event<BenchmarkSample<64U>> payload_64_{*this, "payload_64"};
+    typename Trait::template Event<BenchmarkSample<1024U>> payload_1k_{*this, "payload_1k"};
+    typename Trait::template Event<BenchmarkSample<16U * 1024U>> payload_16k_{*this, "payload_16k"};
+    typename Trait::template Event<BenchmarkSample<256U * 1024U>> payload_256k_{*this, "payload_256k"};
+};
+
+using BenchmarkSkeleton = AsSkeleton<BenchmarkInterface>;
+using BenchmarkProxy = AsProxy<BenchmarkInterface>;
+
+/// \brief Returns the event of the interface, which transports samples with the given payload size.
+template <std::size_t PayloadSize, typename Interface>
+auto& GetBenchmarkEvent(Interface& interface) noexcept
+{
+    if constexpr (PayloadSize == 64U)
+    {
+        return interface.payload_64_;
+    }
+    else if constexpr (PayloadSize == 1024U)
+    {
+        return interface.payload_1k_;
+    }
+    else if constexpr (PayloadSize == (16U * 1024U))
+    {
+        return interface.payload_16k_;
+    }
+    else
+    {
+        static_assert(PayloadSize == (256U * 1024U), "No event with this payload size in the BenchmarkInterface");
+        return interface.payload_256k_;
+    }
+}
+
+}  // namespace bmw::mw::com::test
+
+#endif  // PLATFORM_AAS_MW_COM_TEST_IPC_BENCHMARK_IPC_BENCHMARK_APPLICATION_H
@@ -195,12 +195,14 @@ int main(int argc, const char* argv[])
         messaging.RegisterEventNotification(impl::QualityType::kASIL_B,
                                             dummy_element_fq_id,
                                             std::move(event_update_notification_handler_asil_b),
-                                            kDummyTargetNodeId);
+                                            kDummyTargetNodeId,
+                                            impl::ReceiveHandlerDispatch::kThreadPool);
     const auto registration_number_qm =
         messaging.RegisterEventNotification(impl::QualityType::kASIL_QM,
                                             dummy_element_fq_id,
                                             std::move(event_update_notification_handler_asil_qm),
-                                            kDummyTargetNodeId);
+                                            kDummyTargetNodeId,
+                                            impl::ReceiveHandlerDispatch::kThreadPool);
 
     std::thread send_thread(message_sender, stop_token);
 
@@ -18,6 +18,7 @@
 #include "platform/aas/mw/com/impl/plumbing/sample_allocatee_ptr.h"
 #include "platform/aas/mw/com/impl/plumbing/sample_ptr.h"
 
+#include "platform/aas/mw/com/impl/dynamic_sample.h"
 #include "platform/aas/mw/com/impl/event_receive_handler.h"
 #include "platform/aas/mw/com/impl/find_service_handle.h"
 #include "platform/aas/mw/com/impl/find_service_handler.h"
@@ -98,6 +99,10 @@ using SamplePtr = impl::SamplePtr<SampleType>;
 template <typename SampleType>
 using SampleAllocateePtr = impl::SampleAllocateePtr<SampleType>;
 
+/// \brief Sample type of events, whose samples vary in size. The sample data is allocated via
+/// SkeletonEvent::AllocateDynamic() and provided as span on both sides.
+using DynamicSample = impl::DynamicSample;
+
 /// \brief Callback for event notifications on proxy side.
 /// \requirement 
 using EventReceiveHandler = impl::EventReceiveHandler;